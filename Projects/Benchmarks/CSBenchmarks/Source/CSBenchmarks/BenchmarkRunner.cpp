@@ -0,0 +1,197 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <CSBenchmarks/BenchmarkRunner.h>
+
+#include <json/json.h>
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <sstream>
+
+namespace CSBenchmarks
+{
+    namespace
+    {
+        /// @param checksum
+        ///     The checksum.
+        ///
+        /// @return The checksum as a fixed width hex string.
+        ///
+        std::string ChecksumToString(u64 checksum) noexcept
+        {
+            std::ostringstream stream;
+            stream << std::hex << std::setw(16) << std::setfill('0') << checksum;
+            return stream.str();
+        }
+        
+        /// @param results
+        ///     The sorted benchmark results.
+        ///
+        /// @return The results as a JSON document.
+        ///
+        std::string FormatResultsAsJson(const std::vector<BenchmarkResult>& results) noexcept
+        {
+            Json::Value resultsJson(Json::arrayValue);
+            for (const auto& result : results)
+            {
+                Json::Value resultJson(Json::objectValue);
+                resultJson["Name"] = result.m_name;
+                resultJson["Samples"] = result.m_numSamples;
+                resultJson["RunsPerSample"] = result.m_numRunsPerSample;
+                resultJson["MinNs"] = Json::UInt64(result.m_minTime);
+                resultJson["MedianNs"] = Json::UInt64(result.m_medianTime);
+                resultJson["MeanNs"] = Json::UInt64(result.m_meanTime);
+                resultJson["MaxNs"] = Json::UInt64(result.m_maxTime);
+                resultJson["Checksum"] = ChecksumToString(result.m_checksum);
+                resultJson["ChecksumStable"] = result.m_isChecksumStable;
+                resultsJson.append(resultJson);
+            }
+            
+            Json::Value rootJson(Json::objectValue);
+            rootJson["Benchmarks"] = resultsJson;
+            return rootJson.toStyledString();
+        }
+        
+        /// @param results
+        ///     The sorted benchmark results.
+        ///
+        /// @return The results as CSV, with a header row.
+        ///
+        std::string FormatResultsAsCsv(const std::vector<BenchmarkResult>& results) noexcept
+        {
+            std::ostringstream stream;
+            stream << "Name,Samples,RunsPerSample,MinNs,MedianNs,MeanNs,MaxNs,Checksum,ChecksumStable\n";
+            for (const auto& result : results)
+            {
+                stream << result.m_name << "," << result.m_numSamples << "," << result.m_numRunsPerSample << ","
+                    << result.m_minTime << "," << result.m_medianTime << "," << result.m_meanTime << "," << result.m_maxTime << ","
+                    << ChecksumToString(result.m_checksum) << "," << (result.m_isChecksumStable ? "true" : "false") << "\n";
+            }
+            
+            return stream.str();
+        }
+    }
+    
+    //------------------------------------------------------------------------------
+    void BenchmarkRunner::Add(const std::string& name, u32 numRunsPerSample, const SetupDelegate& setupDelegate) noexcept
+    {
+        assert(numRunsPerSample > 0 && setupDelegate != nullptr);
+        assert(std::find_if(m_benchmarks.begin(), m_benchmarks.end(), [&](const Benchmark& benchmark) { return benchmark.m_name == name; }) == m_benchmarks.end());
+        
+        m_benchmarks.push_back(Benchmark{ name, numRunsPerSample, setupDelegate });
+    }
+    
+    //------------------------------------------------------------------------------
+    std::vector<BenchmarkResult> BenchmarkRunner::Run(const std::string& filter, u32 numSamples) const noexcept
+    {
+        assert(numSamples > 0);
+        
+        std::vector<BenchmarkResult> results;
+        for (const auto& benchmark : m_benchmarks)
+        {
+            if (filter.empty() == false && benchmark.m_name.find(filter) == std::string::npos)
+            {
+                continue;
+            }
+            
+            fprintf(stderr, "Running %s...\n", benchmark.m_name.c_str());
+            results.push_back(RunBenchmark(benchmark, numSamples));
+            
+            if (results.back().m_isChecksumStable == false)
+            {
+                fprintf(stderr, "Warning: %s produced different checksums between runs.\n", benchmark.m_name.c_str());
+            }
+        }
+        
+        return results;
+    }
+    
+    //------------------------------------------------------------------------------
+    std::string BenchmarkRunner::FormatResults(std::vector<BenchmarkResult> results, BenchmarkOutputFormat format) noexcept
+    {
+        std::sort(results.begin(), results.end(), [](const BenchmarkResult& a, const BenchmarkResult& b) { return a.m_name < b.m_name; });
+        
+        switch (format)
+        {
+            case BenchmarkOutputFormat::k_json:
+                return FormatResultsAsJson(results);
+            case BenchmarkOutputFormat::k_csv:
+                return FormatResultsAsCsv(results);
+        }
+        
+        return "";
+    }
+    
+    //------------------------------------------------------------------------------
+    BenchmarkResult BenchmarkRunner::RunBenchmark(const Benchmark& benchmark, u32 numSamples) noexcept
+    {
+        auto runDelegate = benchmark.m_setupDelegate();
+        assert(runDelegate != nullptr);
+        
+        BenchmarkResult result;
+        result.m_name = benchmark.m_name;
+        result.m_numSamples = numSamples;
+        result.m_numRunsPerSample = benchmark.m_numRunsPerSample;
+        result.m_checksum = runDelegate();
+        
+        std::vector<u64> sampleTimes;
+        sampleTimes.reserve(numSamples);
+        
+        for (u32 sample = 0; sample < numSamples; ++sample)
+        {
+            auto start = std::chrono::steady_clock::now();
+            for (u32 run = 0; run < benchmark.m_numRunsPerSample; ++run)
+            {
+                if (runDelegate() != result.m_checksum)
+                {
+                    result.m_isChecksumStable = false;
+                }
+            }
+            auto end = std::chrono::steady_clock::now();
+            
+            auto sampleTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+            sampleTimes.push_back(u64(sampleTime) / benchmark.m_numRunsPerSample);
+        }
+        
+        std::sort(sampleTimes.begin(), sampleTimes.end());
+        
+        u64 totalTime = 0;
+        for (auto sampleTime : sampleTimes)
+        {
+            totalTime += sampleTime;
+        }
+        
+        result.m_minTime = sampleTimes.front();
+        result.m_medianTime = sampleTimes[sampleTimes.size() / 2];
+        result.m_meanTime = totalTime / sampleTimes.size();
+        result.m_maxTime = sampleTimes.back();
+        
+        return result;
+    }
+}
@@ -0,0 +1,153 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CSBENCHMARKS_BENCHMARKRUNNER_H_
+#define _CSBENCHMARKS_BENCHMARKRUNNER_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace CSBenchmarks
+{
+    /// The results of running a single benchmark. All times are in nanoseconds for a
+    /// single run of the benchmark's workload.
+    ///
+    struct BenchmarkResult final
+    {
+        std::string m_name;
+        u32 m_numSamples = 0;
+        u32 m_numRunsPerSample = 0;
+        u64 m_minTime = 0;
+        u64 m_medianTime = 0;
+        u64 m_meanTime = 0;
+        u64 m_maxTime = 0;
+        u64 m_checksum = 0;
+        bool m_isChecksumStable = true;
+    };
+    
+    /// The formats the benchmark results can be output in.
+    ///
+    enum class BenchmarkOutputFormat
+    {
+        k_json,
+        k_csv
+    };
+    
+    /// Registers and runs a set of benchmarks, each of which times a fixed workload.
+    ///
+    /// A benchmark is registered with a setup delegate, which is only called if the
+    /// benchmark is going to be run, and prepares any data required by the workload.
+    /// It returns a run delegate which performs the workload once and returns a checksum
+    /// of the output. The checksum prevents the workload being optimised away, and as
+    /// the workload is fixed it should be identical for every run and across builds;
+    /// a change indicates that the behaviour of the benchmarked code has changed.
+    ///
+    /// Each benchmark is run once to warm up, then timed over a number of samples,
+    /// each of which performs the workload a fixed number of times.
+    ///
+    /// As benchmarks are run without an Application, engine logging is unavailable and
+    /// all output is written directly to stdout and stderr.
+    ///
+    /// This is not thread-safe.
+    ///
+    class BenchmarkRunner final
+    {
+    public:
+        CS_DECLARE_NOCOPY(BenchmarkRunner);
+        
+        /// Performs the benchmark workload once, returning a checksum of the output.
+        ///
+        using RunDelegate = std::function<u64()>;
+        
+        /// Prepares the data required by a benchmark, returning the delegate which
+        /// performs the workload.
+        ///
+        using SetupDelegate = std::function<RunDelegate()>;
+        
+        BenchmarkRunner() = default;
+        
+        /// Registers a new benchmark.
+        ///
+        /// @param name
+        ///     The unique name of the benchmark in the form "Category/Name".
+        /// @param numRunsPerSample
+        ///     The number of times the workload is performed for each timed sample. This
+        ///     should be high enough that a sample is well above the timer resolution.
+        /// @param setupDelegate
+        ///     The delegate which prepares the benchmark and returns the workload.
+        ///
+        void Add(const std::string& name, u32 numRunsPerSample, const SetupDelegate& setupDelegate) noexcept;
+        
+        /// Runs all benchmarks whose name contains the given filter, in the order they
+        /// were registered. Progress is written to stderr so that stdout can be used
+        /// for the results.
+        ///
+        /// @param filter
+        ///     Only benchmarks with names containing this are run. If empty, all
+        ///     benchmarks are run.
+        /// @param numSamples
+        ///     The number of timed samples to take for each benchmark.
+        ///
+        /// @return The results of each benchmark which was run.
+        ///
+        std::vector<BenchmarkResult> Run(const std::string& filter, u32 numSamples) const noexcept;
+        
+        /// @param results
+        ///     The benchmark results.
+        /// @param format
+        ///     The format to output the results in.
+        ///
+        /// @return The results in the given machine-readable format, sorted by name so that
+        ///     the output of two builds can be diffed directly.
+        ///
+        static std::string FormatResults(std::vector<BenchmarkResult> results, BenchmarkOutputFormat format) noexcept;
+        
+    private:
+        struct Benchmark final
+        {
+            std::string m_name;
+            u32 m_numRunsPerSample;
+            SetupDelegate m_setupDelegate;
+        };
+        
+        /// Runs a single benchmark.
+        ///
+        /// @param benchmark
+        ///     The benchmark to run.
+        /// @param numSamples
+        ///     The number of timed samples to take.
+        ///
+        /// @return The result of the benchmark.
+        ///
+        static BenchmarkResult RunBenchmark(const Benchmark& benchmark, u32 numSamples) noexcept;
+        
+        std::vector<Benchmark> m_benchmarks;
+    };
+}
+
+#endif
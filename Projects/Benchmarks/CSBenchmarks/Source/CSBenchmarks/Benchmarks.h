@@ -0,0 +1,98 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CSBENCHMARKS_BENCHMARKS_H_
+#define _CSBENCHMARKS_BENCHMARKS_H_
+
+namespace CSBenchmarks
+{
+    class BenchmarkRunner;
+    
+    /// Registers benchmarks for vector, matrix and quaternion maths.
+    ///
+    /// @param runner
+    ///     The runner to register the benchmarks with.
+    ///
+    void RegisterMathBenchmarks(BenchmarkRunner& runner) noexcept;
+    
+    /// Registers benchmarks for the engine's containers.
+    ///
+    /// @param runner
+    ///     The runner to register the benchmarks with.
+    ///
+    void RegisterContainerBenchmarks(BenchmarkRunner& runner) noexcept;
+    
+    /// Registers benchmarks for the engine's allocators.
+    ///
+    /// @param runner
+    ///     The runner to register the benchmarks with.
+    ///
+    void RegisterMemoryBenchmarks(BenchmarkRunner& runner) noexcept;
+    
+    /// Registers benchmarks for the task pool.
+    ///
+    /// @param runner
+    ///     The runner to register the benchmarks with.
+    ///
+    void RegisterThreadingBenchmarks(BenchmarkRunner& runner) noexcept;
+    
+    /// Registers benchmarks for JSON and XML parsing.
+    ///
+    /// @param runner
+    ///     The runner to register the benchmarks with.
+    ///
+    void RegisterSerialisationBenchmarks(BenchmarkRunner& runner) noexcept;
+    
+    /// Registers benchmarks for image format conversion.
+    ///
+    /// @param runner
+    ///     The runner to register the benchmarks with.
+    ///
+    void RegisterImageBenchmarks(BenchmarkRunner& runner) noexcept;
+    
+    /// Registers benchmarks for hashing and encoding.
+    ///
+    /// @param runner
+    ///     The runner to register the benchmarks with.
+    ///
+    void RegisterCryptographicBenchmarks(BenchmarkRunner& runner) noexcept;
+    
+    /// Registers benchmarks for UTF-8 text processing and string utilities.
+    ///
+    /// @param runner
+    ///     The runner to register the benchmarks with.
+    ///
+    void RegisterTextBenchmarks(BenchmarkRunner& runner) noexcept;
+    
+    /// Registers benchmarks for applying materials. Each run performs a fixed number of
+    /// material switches, so switches per second can be derived from the run time.
+    ///
+    /// @param runner
+    ///     The runner to register the benchmarks with.
+    ///
+    void RegisterRenderingBenchmarks(BenchmarkRunner& runner) noexcept;
+}
+
+#endif
@@ -0,0 +1,207 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <CSBenchmarks/Benchmarks.h>
+
+#include <CSBenchmarks/BenchmarkRunner.h>
+#include <CSBenchmarks/DeterministicData.h>
+
+#include <ChilliSource/Core/Container.h>
+#include <ChilliSource/Core/Cryptographic/HashCRC32.h>
+#include <ChilliSource/Core/String/ToString.h>
+
+#include <memory>
+#include <vector>
+
+namespace CSBenchmarks
+{
+    namespace
+    {
+        const u32 k_numElements = 4096;
+        const u32 k_numKeys = 256;
+        const u32 k_numLookups = 4096;
+        
+        /// @param numKeys
+        ///     The number of keys to create.
+        ///
+        /// @return A set of unique string keys in a fixed order.
+        ///
+        std::vector<std::string> CreateKeys(u32 numKeys) noexcept
+        {
+            std::vector<std::string> keys;
+            keys.reserve(numKeys);
+            for (u32 i = 0; i < numKeys; ++i)
+            {
+                keys.push_back("Key" + ChilliSource::ToString(i));
+            }
+            return keys;
+        }
+        
+        /// @param data
+        ///     The data generator.
+        /// @param numKeys
+        ///     The number of keys which can be looked up.
+        ///
+        /// @return A fixed sequence of key indices to look up.
+        ///
+        std::vector<u32> CreateLookupIndices(DeterministicData& data, u32 numKeys) noexcept
+        {
+            std::vector<u32> indices;
+            indices.reserve(k_numLookups);
+            for (u32 i = 0; i < k_numLookups; ++i)
+            {
+                indices.push_back(data.NextU32(numKeys));
+            }
+            return indices;
+        }
+    }
+    
+    //------------------------------------------------------------------------------
+    void RegisterContainerBenchmarks(BenchmarkRunner& runner) noexcept
+    {
+        runner.Add("Containers/ConcurrentVectorPushAndIterate", 50, []()
+        {
+            return []()
+            {
+                ChilliSource::concurrent_vector<u32> vector;
+                for (u32 i = 0; i < k_numElements; ++i)
+                {
+                    vector.push_back(i);
+                }
+                
+                u64 checksum = 0;
+                for (auto value : vector)
+                {
+                    checksum = CombineChecksum(checksum, value);
+                }
+                return checksum;
+            };
+        });
+        
+        runner.Add("Containers/DynamicArrayFillAndIterate", 200, []()
+        {
+            return []()
+            {
+                ChilliSource::dynamic_array<u32> array(k_numElements);
+                for (u32 i = 0; i < k_numElements; ++i)
+                {
+                    array[i] = i * 3;
+                }
+                
+                u64 checksum = 0;
+                for (auto value : array)
+                {
+                    checksum = CombineChecksum(checksum, value);
+                }
+                return checksum;
+            };
+        });
+        
+        runner.Add("Containers/SpscQueuePushAndPop", 50, []()
+        {
+            auto queue = std::make_shared<ChilliSource::concurrent_spsc_queue<u32>>(k_numElements);
+            return [=]()
+            {
+                for (u32 i = 0; i < k_numElements; ++i)
+                {
+                    queue->push(i);
+                }
+                
+                u64 checksum = 0;
+                u32 value = 0;
+                while (queue->try_pop(value))
+                {
+                    checksum = CombineChecksum(checksum, value);
+                }
+                return checksum;
+            };
+        });
+        
+        runner.Add("Containers/ParamDictionaryLookup", 50, []()
+        {
+            DeterministicData data(10);
+            
+            auto keys = CreateKeys(k_numKeys);
+            auto dictionary = std::make_shared<ChilliSource::ParamDictionary>();
+            for (u32 i = 0; i < k_numKeys; ++i)
+            {
+                dictionary->SetValue(keys[i], ChilliSource::ToString(i));
+            }
+            
+            auto lookupKeys = std::make_shared<std::vector<std::string>>();
+            for (auto index : CreateLookupIndices(data, k_numKeys))
+            {
+                lookupKeys->push_back(keys[index]);
+            }
+            
+            return [=]()
+            {
+                u64 checksum = 0;
+                std::string value;
+                for (const auto& key : *lookupKeys)
+                {
+                    if (dictionary->TryGetValue(key, value))
+                    {
+                        checksum = CombineChecksum(checksum, value.size());
+                    }
+                }
+                return checksum;
+            };
+        });
+        
+        runner.Add("Containers/HashedArrayFind", 50, []()
+        {
+            DeterministicData data(11);
+            
+            auto keys = CreateKeys(k_numKeys);
+            auto hashFunction = [](std::string key) { return ChilliSource::HashCRC32::GenerateHashCode(key); };
+            auto array = std::make_shared<ChilliSource::HashedArray<std::string, u32>>(k_numKeys, hashFunction);
+            for (u32 i = 0; i < k_numKeys; ++i)
+            {
+                array->insert(keys[i], i);
+            }
+            
+            auto lookupKeys = std::make_shared<std::vector<std::string>>();
+            for (auto index : CreateLookupIndices(data, k_numKeys))
+            {
+                lookupKeys->push_back(keys[index]);
+            }
+            
+            return [=]()
+            {
+                u64 checksum = 0;
+                for (const auto& key : *lookupKeys)
+                {
+                    auto it = array->find(key);
+                    if (it != array->end())
+                    {
+                        checksum = CombineChecksum(checksum, it->second);
+                    }
+                }
+                return checksum;
+            };
+        });
+    }
+}
@@ -0,0 +1,186 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <CSBenchmarks/Benchmarks.h>
+
+#include <CSBenchmarks/BenchmarkRunner.h>
+#include <CSBenchmarks/DeterministicData.h>
+
+#include <ChilliSource/Core/Cryptographic/BaseEncoding.h>
+#include <ChilliSource/Core/Cryptographic/HashCRC32.h>
+#include <ChilliSource/Core/Cryptographic/HashMD5.h>
+#include <ChilliSource/Core/Cryptographic/HashSHA1.h>
+#include <ChilliSource/Core/Cryptographic/HashSHA256.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace CSBenchmarks
+{
+    namespace
+    {
+        const u32 k_dataSize = 256 * 1024;
+        const u32 k_numKeys = 4096;
+        
+        /// @return A fixed buffer of random bytes.
+        ///
+        std::shared_ptr<std::string> CreateData() noexcept
+        {
+            DeterministicData data(60);
+            
+            auto buffer = std::make_shared<std::string>(k_dataSize, '\0');
+            for (auto& character : *buffer)
+            {
+                character = s8(data.NextU32(256));
+            }
+            return buffer;
+        }
+        
+        /// The byte-at-a-time table driven CRC32 that HashCRC32 used before
+        /// slicing-by-8. Kept as a reference so the two can be compared for
+        /// both throughput and output.
+        ///
+        class BytewiseCRC32 final
+        {
+        public:
+            /// Builds the 256 entry lookup table for the reflected 0xEDB88320
+            /// polynomial.
+            ///
+            BytewiseCRC32() noexcept
+            {
+                for (u32 i = 0; i < 256; ++i)
+                {
+                    u32 value = i;
+                    for (u32 bit = 0; bit < 8; ++bit)
+                    {
+                        value = (value & 1) ? (value >> 1) ^ 0xedb88320u : (value >> 1);
+                    }
+                    m_lookup[i] = value;
+                }
+            }
+            
+            /// @param data
+            ///     The data to hash.
+            /// @param size
+            ///     The size of the data in bytes.
+            ///
+            /// @return The CRC32 hash code of the data.
+            ///
+            u32 GenerateHashCode(const s8* data, u32 size) const noexcept
+            {
+                u32 result = 0xffffffff;
+                for (u32 i = 0; i < size; ++i)
+                {
+                    result = (result >> 8) ^ m_lookup[(result & 0xff) ^ u8(data[i])];
+                }
+                return ~result;
+            }
+            
+        private:
+            u32 m_lookup[256];
+        };
+    }
+    
+    //------------------------------------------------------------------------------
+    void RegisterCryptographicBenchmarks(BenchmarkRunner& runner) noexcept
+    {
+        runner.Add("Cryptographic/CRC32Buffer", 20, []()
+        {
+            auto buffer = CreateData();
+            return [=]()
+            {
+                return u64(ChilliSource::HashCRC32::GenerateHashCode(buffer->data(), u32(buffer->size())));
+            };
+        });
+        
+        runner.Add("Cryptographic/CRC32BufferBytewise", 20, []()
+        {
+            auto buffer = CreateData();
+            auto crc32 = std::make_shared<BytewiseCRC32>();
+            return [=]()
+            {
+                return u64(crc32->GenerateHashCode(buffer->data(), u32(buffer->size())));
+            };
+        });
+        
+        runner.Add("Cryptographic/CRC32ShortKeys", 20, []()
+        {
+            auto keys = std::make_shared<std::vector<std::string>>();
+            for (u32 i = 0; i < k_numKeys; ++i)
+            {
+                keys->push_back("Entities/Entity" + ChilliSource::ToString(i) + "/Component");
+            }
+            
+            return [=]()
+            {
+                u64 checksum = 0;
+                for (const auto& key : *keys)
+                {
+                    checksum = CombineChecksum(checksum, ChilliSource::HashCRC32::GenerateHashCode(key));
+                }
+                return checksum;
+            };
+        });
+        
+        runner.Add("Cryptographic/MD5", 5, []()
+        {
+            auto buffer = CreateData();
+            return [=]()
+            {
+                return CombineStringChecksum(0, ChilliSource::HashMD5::GenerateHexHashCode(buffer->data(), u32(buffer->size())));
+            };
+        });
+        
+        runner.Add("Cryptographic/SHA1", 5, []()
+        {
+            auto buffer = CreateData();
+            return [=]()
+            {
+                return CombineStringChecksum(0, ChilliSource::HashSHA1::GenerateHexHashCode(buffer->data(), u32(buffer->size())));
+            };
+        });
+        
+        runner.Add("Cryptographic/SHA256", 5, []()
+        {
+            auto buffer = CreateData();
+            return [=]()
+            {
+                return CombineStringChecksum(0, ChilliSource::HashSHA256::GenerateHexHashCode(buffer->data(), u32(buffer->size())));
+            };
+        });
+        
+        runner.Add("Cryptographic/Base64EncodeAndDecode", 5, []()
+        {
+            auto buffer = CreateData();
+            return [=]()
+            {
+                auto encoded = ChilliSource::BaseEncoding::Base64Encode(*buffer);
+                auto decoded = ChilliSource::BaseEncoding::Base64Decode(encoded);
+                return CombineChecksum(CombineChecksum(0, encoded.size()), ChilliSource::HashCRC32::GenerateHashCode(decoded.data(), u32(decoded.size())));
+            };
+        });
+    }
+}
@@ -0,0 +1,136 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CSBENCHMARKS_DETERMINISTICDATA_H_
+#define _CSBENCHMARKS_DETERMINISTICDATA_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <string>
+
+namespace CSBenchmarks
+{
+    /// A small pseudo-random generator used to build benchmark input data. The engine's
+    /// own random number generator is deliberately not used so that the workloads remain
+    /// identical if it changes. The sequence generated for a given seed is the same on
+    /// every platform and build.
+    ///
+    class DeterministicData final
+    {
+    public:
+        /// @param seed
+        ///     The seed. Benchmarks should always use a fixed seed.
+        ///
+        explicit DeterministicData(u64 seed) noexcept
+            : m_state(seed != 0 ? seed : 1)
+        {
+        }
+        
+        /// @return The next value in the sequence.
+        ///
+        u32 NextU32() noexcept
+        {
+            m_state ^= m_state >> 12;
+            m_state ^= m_state << 25;
+            m_state ^= m_state >> 27;
+            return u32((m_state * 2685821657736338717ull) >> 32);
+        }
+        
+        /// @param max
+        ///     The exclusive upper bound. Must be greater than zero.
+        ///
+        /// @return The next value in the sequence in the range [0, max).
+        ///
+        u32 NextU32(u32 max) noexcept
+        {
+            return NextU32() % max;
+        }
+        
+        /// @param min
+        ///     The inclusive lower bound.
+        /// @param max
+        ///     The exclusive upper bound.
+        ///
+        /// @return The next value in the sequence in the range [min, max).
+        ///
+        f32 NextF32(f32 min, f32 max) noexcept
+        {
+            return min + (max - min) * (f32(NextU32() >> 8) / f32(1 << 24));
+        }
+        
+    private:
+        u64 m_state;
+    };
+    
+    /// Combines a value into a running checksum.
+    ///
+    /// @param checksum
+    ///     The current checksum.
+    /// @param value
+    ///     The value to combine.
+    ///
+    /// @return The new checksum.
+    ///
+    inline u64 CombineChecksum(u64 checksum, u64 value) noexcept
+    {
+        return (checksum ^ value) * 1099511628211ull;
+    }
+    
+    /// Combines a float into a running checksum. The float is quantised first so that
+    /// differences in the last few bits, such as those caused by SIMD or fused
+    /// multiply-add code paths, rarely change the checksum.
+    ///
+    /// @param checksum
+    ///     The current checksum.
+    /// @param value
+    ///     The value to combine.
+    ///
+    /// @return The new checksum.
+    ///
+    inline u64 CombineFloatChecksum(u64 checksum, f32 value) noexcept
+    {
+        return CombineChecksum(checksum, u64(s64(value * 1024.0f)));
+    }
+    
+    /// Combines every byte of a string into a running checksum.
+    ///
+    /// @param checksum
+    ///     The current checksum.
+    /// @param value
+    ///     The string to combine.
+    ///
+    /// @return The new checksum.
+    ///
+    inline u64 CombineStringChecksum(u64 checksum, const std::string& value) noexcept
+    {
+        for (auto character : value)
+        {
+            checksum = CombineChecksum(checksum, u8(character));
+        }
+        return checksum;
+    }
+}
+
+#endif
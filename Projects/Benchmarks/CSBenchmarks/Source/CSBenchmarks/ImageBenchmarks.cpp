@@ -0,0 +1,132 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <CSBenchmarks/Benchmarks.h>
+
+#include <CSBenchmarks/BenchmarkRunner.h>
+#include <CSBenchmarks/DeterministicData.h>
+
+#include <ChilliSource/Core/Image/ImageFormat.h>
+#include <ChilliSource/Core/Image/ImageFormatConverter.h>
+#include <ChilliSource/Core/Threading.h>
+
+#include <memory>
+#include <vector>
+
+namespace CSBenchmarks
+{
+    namespace
+    {
+        const u32 k_imageWidth = 512;
+        const u32 k_imageHeight = 512;
+        const u32 k_imageDataSize = k_imageWidth * k_imageHeight * 4;
+        const u32 k_numThreads = 3;
+        
+        /// @return Fixed RGBA8888 image data. Pixels are random rather than a pattern so
+        ///     that the conversion can't benefit from unrealistic branch prediction.
+        ///
+        std::shared_ptr<std::vector<u8>> CreateImageData() noexcept
+        {
+            DeterministicData data(50);
+            
+            auto imageData = std::make_shared<std::vector<u8>>(k_imageDataSize);
+            for (auto& byte : *imageData)
+            {
+                byte = u8(data.NextU32(256));
+            }
+            return imageData;
+        }
+        
+        /// @param data
+        ///     The converted image data.
+        /// @param size
+        ///     The size of the converted image data.
+        ///
+        /// @return A checksum of a sample of the converted image data.
+        ///
+        u64 ChecksumImageData(const u8* data, u32 size) noexcept
+        {
+            u64 checksum = CombineChecksum(0, size);
+            for (u32 i = 0; i < size; i += 61)
+            {
+                checksum = CombineChecksum(checksum, data[i]);
+            }
+            return checksum;
+        }
+        
+        /// Registers a benchmark which converts an RGBA8888 image to the given format on
+        /// a single thread.
+        ///
+        /// @param runner
+        ///     The runner to register the benchmark with.
+        /// @param name
+        ///     The name of the benchmark.
+        /// @param format
+        ///     The target format.
+        ///
+        void AddConversionBenchmark(BenchmarkRunner& runner, const std::string& name, ChilliSource::ImageFormat format) noexcept
+        {
+            runner.Add(name, 10, [=]()
+            {
+                auto imageData = CreateImageData();
+                auto outputSize = k_imageWidth * k_imageHeight * ChilliSource::ImageFormatConverter::GetBytesPerPixel(format);
+                auto output = std::make_shared<std::vector<u8>>(outputSize);
+                return [=]()
+                {
+                    ChilliSource::ImageFormatConverter::ConvertRGBA8888(imageData->data(), k_imageWidth * k_imageHeight, format, output->data());
+                    return ChecksumImageData(output->data(), outputSize);
+                };
+            });
+        }
+    }
+    
+    //------------------------------------------------------------------------------
+    void RegisterImageBenchmarks(BenchmarkRunner& runner) noexcept
+    {
+        AddConversionBenchmark(runner, "Image/ConvertRGBA8888ToRGB888", ChilliSource::ImageFormat::k_RGB888);
+        AddConversionBenchmark(runner, "Image/ConvertRGBA8888ToRGB565", ChilliSource::ImageFormat::k_RGB565);
+        AddConversionBenchmark(runner, "Image/ConvertRGBA8888ToRGBA4444", ChilliSource::ImageFormat::k_RGBA4444);
+        AddConversionBenchmark(runner, "Image/ConvertRGBA8888ToLumA88", ChilliSource::ImageFormat::k_LumA88);
+        AddConversionBenchmark(runner, "Image/ConvertRGBA8888ToLum8", ChilliSource::ImageFormat::k_Lum8);
+        
+        runner.Add("Image/ConvertRGBA8888ToRGB565Parallel", 10, []()
+        {
+            auto imageData = CreateImageData();
+            auto taskPool = std::make_shared<ChilliSource::TaskPool>(ChilliSource::TaskType::k_small, k_numThreads);
+            return [=]()
+            {
+                u64 checksum = 0;
+                std::vector<ChilliSource::Task> tasks(1, [&](const ChilliSource::TaskContext& taskContext) noexcept
+                {
+                    auto output = ChilliSource::ImageFormatConverter::ConvertRGBA8888(taskContext, imageData->data(), k_imageDataSize, ChilliSource::ImageFormat::k_RGB565);
+                    checksum = ChecksumImageData(output.m_data.get(), output.m_size);
+                });
+                
+                taskPool->AddTasksAndYield(tasks);
+                return checksum;
+            };
+        });
+    }
+}
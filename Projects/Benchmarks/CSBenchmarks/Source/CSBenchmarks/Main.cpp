@@ -0,0 +1,160 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <CSBenchmarks/BenchmarkRunner.h>
+#include <CSBenchmarks/Benchmarks.h>
+
+#include <ChilliSource/Core/Base/Application.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+namespace
+{
+    const u32 k_defaultNumSamples = 15;
+    
+    /// Prints the command line usage to stderr.
+    ///
+    void PrintUsage() noexcept
+    {
+        fprintf(stderr, "Usage: CSBenchmarks [--filter <text>] [--samples <count>] [--format json|csv] [--output <file>]\n");
+        fprintf(stderr, "  --filter   Only run benchmarks whose name contains the given text.\n");
+        fprintf(stderr, "  --samples  The number of timed samples per benchmark. Defaults to %u.\n", k_defaultNumSamples);
+        fprintf(stderr, "  --format   The output format. Defaults to json.\n");
+        fprintf(stderr, "  --output   Writes the results to the given file rather than stdout.\n");
+    }
+}
+
+/// The engine library expects the app to provide this. It is never called as the
+/// benchmarks don't start the platform window which creates the Application.
+///
+/// @param systemInfo
+///     The system info.
+///
+/// @return Always null.
+///
+ChilliSource::Application* CreateApplication(ChilliSource::SystemInfoCUPtr systemInfo) noexcept
+{
+    return nullptr;
+}
+
+/// Entry point for the benchmark suite. This runs headless: no Application, window or
+/// rendering context is created, so only subsystems which can be used standalone are
+/// benchmarked. Results are written to stdout, or a file, in a machine-readable format
+/// so that the results of two builds can be compared.
+///
+/// @param argc
+///     Number of arguments
+/// @param argv
+///     Argument list
+///
+/// @return Exit status
+///
+int main(int argc, const char** argv)
+{
+    std::string filter;
+    u32 numSamples = k_defaultNumSamples;
+    CSBenchmarks::BenchmarkOutputFormat format = CSBenchmarks::BenchmarkOutputFormat::k_json;
+    std::string outputFilePath;
+    
+    for (int i = 1; i < argc; ++i)
+    {
+        bool hasValue = (i + 1 < argc);
+        
+        if (strcmp(argv[i], "--filter") == 0 && hasValue)
+        {
+            filter = argv[++i];
+        }
+        else if (strcmp(argv[i], "--samples") == 0 && hasValue)
+        {
+            numSamples = u32(atoi(argv[++i]));
+        }
+        else if (strcmp(argv[i], "--format") == 0 && hasValue && strcmp(argv[i + 1], "json") == 0)
+        {
+            format = CSBenchmarks::BenchmarkOutputFormat::k_json;
+            ++i;
+        }
+        else if (strcmp(argv[i], "--format") == 0 && hasValue && strcmp(argv[i + 1], "csv") == 0)
+        {
+            format = CSBenchmarks::BenchmarkOutputFormat::k_csv;
+            ++i;
+        }
+        else if (strcmp(argv[i], "--output") == 0 && hasValue)
+        {
+            outputFilePath = argv[++i];
+        }
+        else
+        {
+            PrintUsage();
+            return 1;
+        }
+    }
+    
+    if (numSamples == 0)
+    {
+        PrintUsage();
+        return 1;
+    }
+    
+    CSBenchmarks::BenchmarkRunner runner;
+    CSBenchmarks::RegisterMathBenchmarks(runner);
+    CSBenchmarks::RegisterContainerBenchmarks(runner);
+    CSBenchmarks::RegisterMemoryBenchmarks(runner);
+    CSBenchmarks::RegisterThreadingBenchmarks(runner);
+    CSBenchmarks::RegisterSerialisationBenchmarks(runner);
+    CSBenchmarks::RegisterImageBenchmarks(runner);
+    CSBenchmarks::RegisterCryptographicBenchmarks(runner);
+    CSBenchmarks::RegisterTextBenchmarks(runner);
+    CSBenchmarks::RegisterRenderingBenchmarks(runner);
+    
+    auto results = runner.Run(filter, numSamples);
+    if (results.empty())
+    {
+        fprintf(stderr, "No benchmarks match the filter '%s'.\n", filter.c_str());
+        return 1;
+    }
+    
+    auto output = CSBenchmarks::BenchmarkRunner::FormatResults(results, format);
+    
+    if (outputFilePath.empty())
+    {
+        fputs(output.c_str(), stdout);
+    }
+    else
+    {
+        std::ofstream outputFile(outputFilePath);
+        outputFile << output;
+        if (!outputFile)
+        {
+            fprintf(stderr, "Failed to write results to '%s'.\n", outputFilePath.c_str());
+            return 1;
+        }
+    }
+    
+    return 0;
+}
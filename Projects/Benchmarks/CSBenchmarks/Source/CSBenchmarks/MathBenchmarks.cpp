@@ -0,0 +1,225 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <CSBenchmarks/Benchmarks.h>
+
+#include <CSBenchmarks/BenchmarkRunner.h>
+#include <CSBenchmarks/DeterministicData.h>
+
+#include <ChilliSource/Core/Math.h>
+
+#include <memory>
+#include <vector>
+
+namespace CSBenchmarks
+{
+    namespace
+    {
+        const u32 k_numMatrices = 1024;
+        const u32 k_numVectors = 4096;
+        const u32 k_numQuaternions = 4096;
+        
+        /// @param data
+        ///     The data generator.
+        ///
+        /// @return A random unit quaternion.
+        ///
+        ChilliSource::Quaternion CreateRotation(DeterministicData& data) noexcept
+        {
+            auto axis = ChilliSource::Vector3::Normalise(ChilliSource::Vector3(data.NextF32(-1.0f, 1.0f), data.NextF32(-1.0f, 1.0f), data.NextF32(0.1f, 1.0f)));
+            return ChilliSource::Quaternion(axis, data.NextF32(-ChilliSource::MathUtils::k_pi, ChilliSource::MathUtils::k_pi));
+        }
+        
+        /// @param data
+        ///     The data generator.
+        ///
+        /// @return A random, invertible transform matrix.
+        ///
+        ChilliSource::Matrix4 CreateTransform(DeterministicData& data) noexcept
+        {
+            ChilliSource::Vector3 translation(data.NextF32(-100.0f, 100.0f), data.NextF32(-100.0f, 100.0f), data.NextF32(-100.0f, 100.0f));
+            ChilliSource::Vector3 scale(data.NextF32(0.5f, 2.0f), data.NextF32(0.5f, 2.0f), data.NextF32(0.5f, 2.0f));
+            return ChilliSource::Matrix4::CreateTransform(translation, scale, CreateRotation(data));
+        }
+        
+        /// @param matrices
+        ///     The matrices.
+        /// @param count
+        ///     The number of matrices.
+        ///
+        /// @return A checksum of the translation of each matrix.
+        ///
+        u64 ChecksumMatrices(const ChilliSource::Matrix4* matrices, u32 count) noexcept
+        {
+            u64 checksum = 0;
+            for (u32 i = 0; i < count; ++i)
+            {
+                checksum = CombineFloatChecksum(checksum, matrices[i].m[12] + matrices[i].m[13] + matrices[i].m[14]);
+            }
+            return checksum;
+        }
+        
+        /// A set of matrices used as the input and output of matrix benchmarks.
+        ///
+        struct MatrixData final
+        {
+            std::vector<ChilliSource::Matrix4> m_inputs;
+            std::vector<ChilliSource::Matrix4> m_outputs;
+            ChilliSource::Matrix4 m_viewProjection;
+        };
+        
+        /// @return Matrix benchmark data generated from a fixed seed.
+        ///
+        std::shared_ptr<MatrixData> CreateMatrixData() noexcept
+        {
+            DeterministicData data(1);
+            
+            auto matrixData = std::make_shared<MatrixData>();
+            matrixData->m_inputs.reserve(k_numMatrices);
+            for (u32 i = 0; i < k_numMatrices; ++i)
+            {
+                matrixData->m_inputs.push_back(CreateTransform(data));
+            }
+            matrixData->m_outputs.resize(k_numMatrices);
+            
+            auto view = ChilliSource::Matrix4::CreateLookAt(ChilliSource::Vector3(0.0f, 10.0f, -50.0f), ChilliSource::Vector3::k_zero, ChilliSource::Vector3::k_unitPositiveY);
+            auto projection = ChilliSource::Matrix4::CreatePerspectiveProjectionLH(ChilliSource::MathUtils::k_pi / 3.0f, 16.0f / 9.0f, 1.0f, 1000.0f);
+            matrixData->m_viewProjection = view * projection;
+            
+            return matrixData;
+        }
+    }
+    
+    //------------------------------------------------------------------------------
+    void RegisterMathBenchmarks(BenchmarkRunner& runner) noexcept
+    {
+        runner.Add("Math/Matrix4Multiply", 100, []()
+        {
+            auto matrixData = CreateMatrixData();
+            return [=]()
+            {
+                for (u32 i = 0; i < k_numMatrices; ++i)
+                {
+                    matrixData->m_outputs[i] = matrixData->m_inputs[i] * matrixData->m_viewProjection;
+                }
+                return ChecksumMatrices(matrixData->m_outputs.data(), k_numMatrices);
+            };
+        });
+        
+        runner.Add("Math/Matrix4MultiplyBatch", 100, []()
+        {
+            auto matrixData = CreateMatrixData();
+            return [=]()
+            {
+                ChilliSource::Matrix4::Multiply(matrixData->m_inputs.data(), matrixData->m_viewProjection, matrixData->m_outputs.data(), k_numMatrices);
+                return ChecksumMatrices(matrixData->m_outputs.data(), k_numMatrices);
+            };
+        });
+        
+        runner.Add("Math/Matrix4Inverse", 50, []()
+        {
+            auto matrixData = CreateMatrixData();
+            return [=]()
+            {
+                for (u32 i = 0; i < k_numMatrices; ++i)
+                {
+                    matrixData->m_outputs[i] = ChilliSource::Matrix4::Inverse(matrixData->m_inputs[i]);
+                }
+                return ChecksumMatrices(matrixData->m_outputs.data(), k_numMatrices);
+            };
+        });
+        
+        runner.Add("Math/Matrix4CreateTransform", 50, []()
+        {
+            DeterministicData data(2);
+            
+            auto translations = std::make_shared<std::vector<ChilliSource::Vector3>>();
+            auto rotations = std::make_shared<std::vector<ChilliSource::Quaternion>>();
+            auto outputs = std::make_shared<std::vector<ChilliSource::Matrix4>>(k_numMatrices);
+            for (u32 i = 0; i < k_numMatrices; ++i)
+            {
+                translations->push_back(ChilliSource::Vector3(data.NextF32(-100.0f, 100.0f), data.NextF32(-100.0f, 100.0f), data.NextF32(-100.0f, 100.0f)));
+                rotations->push_back(CreateRotation(data));
+            }
+            
+            return [=]()
+            {
+                for (u32 i = 0; i < k_numMatrices; ++i)
+                {
+                    (*outputs)[i] = ChilliSource::Matrix4::CreateTransform((*translations)[i], ChilliSource::Vector3::k_one, (*rotations)[i]);
+                }
+                return ChecksumMatrices(outputs->data(), k_numMatrices);
+            };
+        });
+        
+        runner.Add("Math/Vector3TransformByMatrix4", 100, []()
+        {
+            DeterministicData data(3);
+            
+            auto transform = CreateTransform(data);
+            auto inputs = std::make_shared<std::vector<ChilliSource::Vector3>>();
+            auto outputs = std::make_shared<std::vector<ChilliSource::Vector3>>(k_numVectors);
+            for (u32 i = 0; i < k_numVectors; ++i)
+            {
+                inputs->push_back(ChilliSource::Vector3(data.NextF32(-10.0f, 10.0f), data.NextF32(-10.0f, 10.0f), data.NextF32(-10.0f, 10.0f)));
+            }
+            
+            return [=]()
+            {
+                u64 checksum = 0;
+                for (u32 i = 0; i < k_numVectors; ++i)
+                {
+                    (*outputs)[i] = (*inputs)[i] * transform;
+                    checksum = CombineFloatChecksum(checksum, (*outputs)[i].x + (*outputs)[i].y + (*outputs)[i].z);
+                }
+                return checksum;
+            };
+        });
+        
+        runner.Add("Math/QuaternionSlerp", 100, []()
+        {
+            DeterministicData data(4);
+            
+            auto from = std::make_shared<std::vector<ChilliSource::Quaternion>>();
+            auto to = std::make_shared<std::vector<ChilliSource::Quaternion>>();
+            for (u32 i = 0; i < k_numQuaternions; ++i)
+            {
+                from->push_back(CreateRotation(data));
+                to->push_back(CreateRotation(data));
+            }
+            
+            return [=]()
+            {
+                u64 checksum = 0;
+                for (u32 i = 0; i < k_numQuaternions; ++i)
+                {
+                    auto result = ChilliSource::Quaternion::Slerp((*from)[i], (*to)[i], f32(i) / f32(k_numQuaternions));
+                    checksum = CombineFloatChecksum(checksum, result.x + result.y + result.z + result.w);
+                }
+                return checksum;
+            };
+        });
+    }
+}
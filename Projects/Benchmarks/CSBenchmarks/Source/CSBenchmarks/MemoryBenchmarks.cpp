@@ -0,0 +1,187 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <CSBenchmarks/Benchmarks.h>
+
+#include <CSBenchmarks/BenchmarkRunner.h>
+#include <CSBenchmarks/DeterministicData.h>
+
+#include <ChilliSource/Core/Memory.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace CSBenchmarks
+{
+    namespace
+    {
+        const u32 k_numAllocations = 4096;
+        
+        /// An object of a similar size to a typical render object, used for the object
+        /// allocation benchmarks.
+        ///
+        struct PooledObject final
+        {
+            f32 m_transform[12] = {};
+            u32 m_id = 0;
+        };
+        
+        /// @param data
+        ///     The data generator.
+        ///
+        /// @return A fixed sequence of allocation sizes between 16 and 256 bytes.
+        ///
+        std::shared_ptr<std::vector<std::size_t>> CreateAllocationSizes(DeterministicData& data) noexcept
+        {
+            auto sizes = std::make_shared<std::vector<std::size_t>>();
+            sizes->reserve(k_numAllocations);
+            for (u32 i = 0; i < k_numAllocations; ++i)
+            {
+                sizes->push_back(16 + data.NextU32(241));
+            }
+            return sizes;
+        }
+        
+        /// @param data
+        ///     The data generator.
+        ///
+        /// @return A fixed permutation of allocation indices, used to free allocations
+        ///     in a different order to which they were allocated.
+        ///
+        std::shared_ptr<std::vector<u32>> CreateFreeOrder(DeterministicData& data) noexcept
+        {
+            auto order = std::make_shared<std::vector<u32>>(k_numAllocations);
+            for (u32 i = 0; i < k_numAllocations; ++i)
+            {
+                (*order)[i] = i;
+            }
+            for (u32 i = k_numAllocations - 1; i > 0; --i)
+            {
+                std::swap((*order)[i], (*order)[data.NextU32(i + 1)]);
+            }
+            return order;
+        }
+    }
+    
+    //------------------------------------------------------------------------------
+    void RegisterMemoryBenchmarks(BenchmarkRunner& runner) noexcept
+    {
+        runner.Add("Memory/SystemNewDelete", 20, []()
+        {
+            DeterministicData data(20);
+            
+            auto sizes = CreateAllocationSizes(data);
+            auto pointers = std::make_shared<std::vector<u8*>>(k_numAllocations);
+            return [=]()
+            {
+                u64 checksum = 0;
+                for (u32 i = 0; i < k_numAllocations; ++i)
+                {
+                    (*pointers)[i] = new u8[(*sizes)[i]];
+                    (*pointers)[i][0] = u8(i);
+                }
+                for (u32 i = 0; i < k_numAllocations; ++i)
+                {
+                    checksum = CombineChecksum(checksum, (*pointers)[i][0]);
+                    delete[] (*pointers)[i];
+                }
+                return checksum;
+            };
+        });
+        
+        runner.Add("Memory/PagedLinearAllocatorAllocateAndReset", 20, []()
+        {
+            DeterministicData data(21);
+            
+            auto sizes = CreateAllocationSizes(data);
+            auto pointers = std::make_shared<std::vector<u8*>>(k_numAllocations);
+            auto allocator = std::make_shared<ChilliSource::PagedLinearAllocator>();
+            return [=]()
+            {
+                u64 checksum = 0;
+                for (u32 i = 0; i < k_numAllocations; ++i)
+                {
+                    (*pointers)[i] = reinterpret_cast<u8*>(allocator->Allocate((*sizes)[i]));
+                    (*pointers)[i][0] = u8(i);
+                }
+                for (u32 i = 0; i < k_numAllocations; ++i)
+                {
+                    checksum = CombineChecksum(checksum, (*pointers)[i][0]);
+                    allocator->Deallocate((*pointers)[i], (*sizes)[i]);
+                }
+                allocator->Reset();
+                return checksum;
+            };
+        });
+        
+        runner.Add("Memory/PagedLinearAllocatorMakeUnique", 20, []()
+        {
+            auto objects = std::make_shared<std::vector<ChilliSource::UniquePtr<PooledObject>>>();
+            objects->reserve(k_numAllocations);
+            auto allocator = std::make_shared<ChilliSource::PagedLinearAllocator>();
+            return [=]()
+            {
+                u64 checksum = 0;
+                for (u32 i = 0; i < k_numAllocations; ++i)
+                {
+                    objects->push_back(ChilliSource::MakeUnique<PooledObject>(*allocator));
+                    objects->back()->m_id = i;
+                }
+                for (const auto& object : *objects)
+                {
+                    checksum = CombineChecksum(checksum, object->m_id);
+                }
+                objects->clear();
+                allocator->Reset();
+                return checksum;
+            };
+        });
+        
+        runner.Add("Memory/ObjectPoolAllocatorAllocateAndFree", 20, []()
+        {
+            DeterministicData data(22);
+            
+            auto freeOrder = CreateFreeOrder(data);
+            auto objects = std::make_shared<std::vector<PooledObject*>>(k_numAllocations);
+            auto allocator = std::make_shared<ChilliSource::ObjectPoolAllocator<PooledObject>>(k_numAllocations);
+            return [=]()
+            {
+                u64 checksum = 0;
+                for (u32 i = 0; i < k_numAllocations; ++i)
+                {
+                    (*objects)[i] = allocator->Allocate();
+                    (*objects)[i]->m_id = i;
+                }
+                for (auto index : *freeOrder)
+                {
+                    checksum = CombineChecksum(checksum, (*objects)[index]->m_id);
+                    allocator->Deallocate((*objects)[index]);
+                }
+                return checksum;
+            };
+        });
+    }
+}
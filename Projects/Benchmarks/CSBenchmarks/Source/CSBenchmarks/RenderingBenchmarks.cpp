@@ -0,0 +1,579 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <CSBenchmarks/Benchmarks.h>
+
+#include <CSBenchmarks/BenchmarkRunner.h>
+#include <CSBenchmarks/DeterministicData.h>
+
+#include <ChilliSource/Core/Base/Colour.h>
+#include <ChilliSource/Core/Math.h>
+#include <ChilliSource/Core/Memory/PagedLinearAllocator.h>
+#include <ChilliSource/Core/Memory/UniquePtr.h>
+#include <ChilliSource/Rendering/Base/BlendMode.h>
+#include <ChilliSource/Rendering/Base/CullFace.h>
+#include <ChilliSource/Rendering/Base/RecordingRenderCommandProcessor.h>
+#include <ChilliSource/Rendering/Base/RenderFrameData.h>
+#include <ChilliSource/Rendering/Base/StencilOp.h>
+#include <ChilliSource/Rendering/Base/TestFunc.h>
+#include <ChilliSource/Rendering/Material/RenderMaterial.h>
+#include <ChilliSource/Rendering/Material/RenderMaterialGroup.h>
+#include <ChilliSource/Rendering/Model/RenderDynamicMesh.h>
+#include <ChilliSource/Rendering/Model/RenderMesh.h>
+#include <ChilliSource/Rendering/Model/RenderMeshBatch.h>
+#include <ChilliSource/Rendering/Model/RenderSkinnedAnimation.h>
+#include <ChilliSource/Rendering/RenderCommand/RenderCommandBuffer.h>
+#include <ChilliSource/Rendering/RenderCommand/RenderCommandCapture.h>
+#include <ChilliSource/Rendering/RenderCommand/RenderCommandList.h>
+#include <ChilliSource/Rendering/Shader/RenderShader.h>
+#include <ChilliSource/Rendering/Shader/RenderShaderVariables.h>
+#include <ChilliSource/Rendering/Target/RenderTargetGroup.h>
+#include <ChilliSource/Rendering/Texture/RenderTexture.h>
+
+#include <array>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace CSBenchmarks
+{
+    namespace
+    {
+        const u32 k_numMaterials = 32;
+        // Each run applies this many materials, so switches per second is this divided by the run time.
+        const u32 k_numSwitchesPerRun = 1024;
+        const u32 k_uniformSlotSize = 16;
+        
+        const char* k_colourUniformNames[] = { "u_emissive", "u_ambient", "u_diffuse", "u_specular" };
+        const u32 k_numColourUniforms = 4;
+        
+        const u32 k_numReplayMaterials = 8;
+        const u32 k_numReplayMeshes = 8;
+        const u32 k_numReplayObjects = 256;
+        const u32 k_numReplayInstances = 64;
+        const u32 k_numReplaySprites = 128;
+        const u32 k_numReplayPointLights = 4;
+        const u32 k_numReplayJoints = 32;
+        const u32 k_replayMeshNumVertices = 512;
+        const u32 k_replayMeshNumIndices = 768;
+        const u32 k_replayTextureSize = 64;
+        const std::size_t k_replayFramePageSize = 1024 * 1024;
+        
+        /// Stands in for the OpenGL uniform state of a single shader, so that material
+        /// switches can be benchmarked without a context. Setting a uniform copies its
+        /// values into the slot for the handle, as a driver would.
+        ///
+        class UniformSink final
+        {
+        public:
+            /// @param numHandles
+            ///     The number of uniform handles in the shader.
+            ///
+            explicit UniformSink(u32 numHandles) noexcept
+                : m_data(numHandles * k_uniformSlotSize, 0.0f)
+            {
+            }
+            
+            /// @param handle
+            ///     The uniform handle.
+            /// @param values
+            ///     The values to set.
+            /// @param numValues
+            ///     The number of values.
+            ///
+            void SetUniform(s32 handle, const f32* values, u32 numValues) noexcept
+            {
+                memcpy(m_data.data() + handle * k_uniformSlotSize, values, numValues * sizeof(f32));
+            }
+            
+            /// @return A checksum of the current uniform state.
+            ///
+            u64 Checksum() const noexcept
+            {
+                u64 checksum = 0;
+                for (auto value : m_data)
+                {
+                    checksum = CombineFloatChecksum(checksum, value);
+                }
+                return checksum;
+            }
+            
+        private:
+            std::vector<f32> m_data;
+        };
+        
+        /// The inputs a material is built from. The maps are the form shader variables
+        /// were stored and applied in before they were compiled into a block.
+        ///
+        struct MaterialData final
+        {
+            std::array<ChilliSource::Colour, k_numColourUniforms> m_colours;
+            std::unordered_map<std::string, f32> m_floatVars;
+            std::unordered_map<std::string, ChilliSource::Vector2> m_vec2Vars;
+            std::unordered_map<std::string, ChilliSource::Vector3> m_vec3Vars;
+            std::unordered_map<std::string, ChilliSource::Vector4> m_vec4Vars;
+            std::unordered_map<std::string, ChilliSource::Matrix4> m_mat4Vars;
+            std::unordered_map<std::string, ChilliSource::Colour> m_colourVars;
+            std::unique_ptr<ChilliSource::RenderShaderVariables> m_renderShaderVariables;
+            std::vector<s32> m_handles;
+        };
+        
+        /// The shader and materials used by the material switch benchmarks. Each material
+        /// has 4 colour uniforms and 9 custom uniforms.
+        ///
+        struct MaterialSwitchData final
+        {
+            std::unordered_map<std::string, s32> m_uniformHandles;
+            std::vector<MaterialData> m_materials;
+        };
+        
+        /// @param data
+        ///     The data generator.
+        ///
+        /// @return A random colour.
+        ///
+        ChilliSource::Colour CreateColour(DeterministicData& data) noexcept
+        {
+            return ChilliSource::Colour(data.NextF32(0.0f, 1.0f), data.NextF32(0.0f, 1.0f), data.NextF32(0.0f, 1.0f), data.NextF32(0.0f, 1.0f));
+        }
+        
+        /// @return The shader and fixed, random materials. The compiled uniform handles of each
+        ///     material are resolved here, as they are the first time a material is applied with
+        ///     a shader.
+        ///
+        std::shared_ptr<MaterialSwitchData> CreateMaterialSwitchData() noexcept
+        {
+            DeterministicData data(33);
+            
+            auto output = std::make_shared<MaterialSwitchData>();
+            
+            auto addHandle = [&](const std::string& name)
+            {
+                output->m_uniformHandles.emplace(name, s32(output->m_uniformHandles.size()));
+            };
+            
+            for (u32 i = 0; i < k_numColourUniforms; ++i)
+            {
+                addHandle(k_colourUniformNames[i]);
+            }
+            
+            output->m_materials.resize(k_numMaterials);
+            for (auto& material : output->m_materials)
+            {
+                for (auto& colour : material.m_colours)
+                {
+                    colour = CreateColour(data);
+                }
+                
+                material.m_floatVars.emplace("u_shininess", data.NextF32(1.0f, 64.0f));
+                material.m_floatVars.emplace("u_fresnel", data.NextF32(0.0f, 1.0f));
+                material.m_floatVars.emplace("u_time", data.NextF32(0.0f, 100.0f));
+                material.m_vec2Vars.emplace("u_uvOffset", ChilliSource::Vector2(data.NextF32(0.0f, 1.0f), data.NextF32(0.0f, 1.0f)));
+                material.m_vec2Vars.emplace("u_uvScale", ChilliSource::Vector2(data.NextF32(0.5f, 2.0f), data.NextF32(0.5f, 2.0f)));
+                material.m_vec3Vars.emplace("u_windDirection", ChilliSource::Vector3(data.NextF32(-1.0f, 1.0f), 0.0f, data.NextF32(-1.0f, 1.0f)));
+                material.m_vec4Vars.emplace("u_tint", ChilliSource::Vector4(data.NextF32(0.0f, 1.0f), data.NextF32(0.0f, 1.0f), data.NextF32(0.0f, 1.0f), 1.0f));
+                material.m_mat4Vars.emplace("u_uvTransform", ChilliSource::Matrix4::CreateTranslation(ChilliSource::Vector3(data.NextF32(0.0f, 1.0f), data.NextF32(0.0f, 1.0f), 0.0f)));
+                material.m_colourVars.emplace("u_rimColour", CreateColour(data));
+                
+                material.m_renderShaderVariables.reset(new ChilliSource::RenderShaderVariables(material.m_floatVars, material.m_vec2Vars, material.m_vec3Vars, material.m_vec4Vars, material.m_mat4Vars, material.m_colourVars));
+                
+                for (const auto& variable : material.m_renderShaderVariables->GetVariables())
+                {
+                    if (output->m_uniformHandles.find(variable.m_name) == output->m_uniformHandles.end())
+                    {
+                        addHandle(variable.m_name);
+                    }
+                }
+            }
+            
+            for (auto& material : output->m_materials)
+            {
+                for (const auto& variable : material.m_renderShaderVariables->GetVariables())
+                {
+                    material.m_handles.push_back(output->m_uniformHandles.at(variable.m_name));
+                }
+            }
+            
+            return output;
+        }
+        
+        /// Applies each of the given shader variables by looking up its uniform handle by
+        /// name, as was done when applying a material before the variables were compiled.
+        ///
+        /// @param materialSwitchData
+        ///     The shader data.
+        /// @param variables
+        ///     The variables to apply.
+        /// @param uniformSink
+        ///     The uniform state to apply to.
+        ///
+        template <typename TValueType> void ApplyByName(const MaterialSwitchData& materialSwitchData, const std::unordered_map<std::string, TValueType>& variables, UniformSink& uniformSink) noexcept
+        {
+            for (const auto& variable : variables)
+            {
+                uniformSink.SetUniform(materialSwitchData.m_uniformHandles.at(variable.first), reinterpret_cast<const f32*>(&variable.second), sizeof(TValueType) / sizeof(f32));
+            }
+        }
+        
+        /// The resources referenced by the frame captured for the replay benchmark. These only
+        /// need to live until the frame has been captured.
+        ///
+        struct ReplaySceneData final
+        {
+            ChilliSource::RenderShaderUPtr m_renderShader;
+            std::vector<ChilliSource::RenderTextureUPtr> m_renderTextures;
+            ChilliSource::RenderTextureUPtr m_shadowMapRenderTexture;
+            ChilliSource::RenderTargetGroupUPtr m_shadowMapRenderTargetGroup;
+            std::vector<ChilliSource::RenderMaterialGroupUPtr> m_renderMaterialGroups;
+            std::vector<ChilliSource::RenderMeshUPtr> m_renderMeshes;
+        };
+        
+        /// @param data
+        ///     The data source.
+        /// @param numVertices
+        ///     The number of sprite vertices.
+        ///
+        /// @return The vertex data for the given number of sprite vertices.
+        ///
+        std::vector<ChilliSource::SpriteVertex> CreateSpriteVertices(DeterministicData& data, u32 numVertices) noexcept
+        {
+            std::vector<ChilliSource::SpriteVertex> vertices(numVertices);
+            for (auto& vertex : vertices)
+            {
+                vertex.m_position = ChilliSource::Vector4(data.NextF32(-100.0f, 100.0f), data.NextF32(-100.0f, 100.0f), 0.0f, 1.0f);
+                vertex.m_texCoord = ChilliSource::Vector2(data.NextF32(0.0f, 1.0f), data.NextF32(0.0f, 1.0f));
+                vertex.m_colour = ChilliSource::ByteColour(u8(data.NextU32(256)), u8(data.NextU32(256)), u8(data.NextU32(256)), 255);
+            }
+            
+            return vertices;
+        }
+        
+        /// @param data
+        ///     The data source.
+        /// @param numIndices
+        ///     The number of indices.
+        /// @param numVertices
+        ///     The number of vertices which are indexed.
+        ///
+        /// @return The given number of indices, each referencing one of the vertices.
+        ///
+        std::vector<u16> CreateIndices(DeterministicData& data, u32 numIndices, u32 numVertices) noexcept
+        {
+            std::vector<u16> indices(numIndices);
+            for (auto& index : indices)
+            {
+                index = u16(data.NextU32(numVertices));
+            }
+            
+            return indices;
+        }
+        
+        /// @param data
+        ///     The data source.
+        /// @param size
+        ///     The number of bytes.
+        ///
+        /// @return A copy of the given number of random bytes, in the form taken by load commands.
+        ///
+        std::unique_ptr<const u8[]> CreateBytes(DeterministicData& data, u32 size) noexcept
+        {
+            std::unique_ptr<u8[]> bytes(new u8[size]);
+            for (u32 i = 0; i < size; ++i)
+            {
+                bytes[i] = u8(data.NextU32(256));
+            }
+            
+            return std::unique_ptr<const u8[]>(std::move(bytes));
+        }
+        
+        /// Builds a representative frame, similar to the loading frame of a small scene: shaders,
+        /// textures, materials and meshes are loaded, then the scene is drawn with a shadow
+        /// casting light, point lights, static meshes, instanced meshes, a skinned mesh,
+        /// dynamic sprites and a sprite batch. The frame is then captured, so the benchmark
+        /// only measures the cost of rebuilding and processing it.
+        ///
+        /// @return The capture of the frame.
+        ///
+        std::shared_ptr<const ChilliSource::RenderCommandCapture> CreateReplayCapture() noexcept
+        {
+            DeterministicData data(36);
+            ReplaySceneData scene;
+            
+            scene.m_renderShader.reset(new ChilliSource::RenderShader());
+            
+            for (u32 i = 0; i < k_numReplayMaterials; ++i)
+            {
+                scene.m_renderTextures.push_back(ChilliSource::RenderTextureUPtr(new ChilliSource::RenderTexture(ChilliSource::Integer2(k_replayTextureSize, k_replayTextureSize), ChilliSource::ImageFormat::k_RGBA8888,
+                    ChilliSource::ImageCompression::k_none, ChilliSource::TextureFilterMode::k_bilinear, ChilliSource::TextureWrapMode::k_clamp, ChilliSource::TextureWrapMode::k_clamp, false, false)));
+            }
+            
+            scene.m_shadowMapRenderTexture.reset(new ChilliSource::RenderTexture(ChilliSource::Integer2(512, 512), ChilliSource::ImageFormat::k_Depth16, ChilliSource::ImageCompression::k_none,
+                ChilliSource::TextureFilterMode::k_nearest, ChilliSource::TextureWrapMode::k_clamp, ChilliSource::TextureWrapMode::k_clamp, false, false));
+            scene.m_shadowMapRenderTargetGroup.reset(new ChilliSource::RenderTargetGroup(nullptr, scene.m_shadowMapRenderTexture.get(), ChilliSource::RenderTargetGroupType::k_colour));
+            
+            for (u32 i = 0; i < k_numReplayMaterials; ++i)
+            {
+                std::unordered_map<std::string, f32> floatVars { { "u_shininess", data.NextF32(1.0f, 64.0f) } };
+                std::unordered_map<std::string, ChilliSource::Vector2> vec2Vars { { "u_uvOffset", ChilliSource::Vector2(data.NextF32(0.0f, 1.0f), data.NextF32(0.0f, 1.0f)) } };
+                std::unordered_map<std::string, ChilliSource::Matrix4> mat4Vars { { "u_uvTransform", ChilliSource::Matrix4::CreateTranslation(ChilliSource::Vector3(data.NextF32(0.0f, 1.0f), 0.0f, 0.0f)) } };
+                ChilliSource::RenderShaderVariablesUPtr renderShaderVariables(new ChilliSource::RenderShaderVariables(floatVars, vec2Vars, {}, {}, mat4Vars, {}));
+                
+                std::vector<ChilliSource::UniquePtr<ChilliSource::RenderMaterial>> renderMaterials;
+                renderMaterials.push_back(ChilliSource::UniquePtr<ChilliSource::RenderMaterial>(new ChilliSource::RenderMaterial(scene.m_renderShader.get(), { scene.m_renderTextures[i].get() }, {},
+                    i % 2 == 0, true, true, true, true, false, ChilliSource::TestFunc::k_lessEqual, ChilliSource::BlendMode::k_sourceAlpha, ChilliSource::BlendMode::k_oneMinusSourceAlpha,
+                    ChilliSource::StencilOp::k_keep, ChilliSource::StencilOp::k_keep, ChilliSource::StencilOp::k_keep, ChilliSource::TestFunc::k_always, 0, 0xff, ChilliSource::CullFace::k_back,
+                    ChilliSource::Colour::k_black, ChilliSource::Colour::k_white, ChilliSource::Colour::k_white, ChilliSource::Colour::k_black, std::move(renderShaderVariables)), [](const ChilliSource::RenderMaterial* renderMaterial) noexcept -> void
+                {
+                    delete renderMaterial;
+                }));
+                
+                std::array<const ChilliSource::RenderMaterial*, ChilliSource::RenderMaterialGroup::k_numMaterialSlots> slotRenderMaterials = {{}};
+                slotRenderMaterials[0] = renderMaterials[0].get();
+                
+                std::vector<ChilliSource::RenderMaterialGroup::Collection> collections;
+                collections.push_back(ChilliSource::RenderMaterialGroup::Collection(ChilliSource::VertexFormat::k_staticMesh, slotRenderMaterials));
+                collections.push_back(ChilliSource::RenderMaterialGroup::Collection(ChilliSource::VertexFormat::k_animatedMesh, slotRenderMaterials));
+                collections.push_back(ChilliSource::RenderMaterialGroup::Collection(ChilliSource::VertexFormat::k_sprite, slotRenderMaterials));
+                
+                scene.m_renderMaterialGroups.push_back(ChilliSource::RenderMaterialGroupUPtr(new ChilliSource::RenderMaterialGroup(std::move(renderMaterials), std::move(collections))));
+            }
+            
+            for (u32 i = 0; i < k_numReplayMeshes; ++i)
+            {
+                const auto& vertexFormat = (i == 0) ? ChilliSource::VertexFormat::k_animatedMesh : ChilliSource::VertexFormat::k_staticMesh;
+                std::vector<ChilliSource::Matrix4> inverseBindPoseMatrices((i == 0) ? k_numReplayJoints : 0);
+                scene.m_renderMeshes.push_back(ChilliSource::RenderMeshUPtr(new ChilliSource::RenderMesh(ChilliSource::PolygonType::k_triangle, vertexFormat, ChilliSource::IndexFormat::k_short,
+                    k_replayMeshNumVertices, k_replayMeshNumIndices, ChilliSource::Sphere(ChilliSource::Vector3::k_zero, data.NextF32(1.0f, 10.0f)), false, std::move(inverseBindPoseMatrices))));
+            }
+            
+            ChilliSource::PagedLinearAllocator frameAllocator(k_replayFramePageSize);
+            ChilliSource::RenderFrameData renderFrameData;
+            
+            std::vector<const ChilliSource::RenderDynamicMesh*> renderDynamicMeshes;
+            for (u32 i = 0; i < k_numReplaySprites; ++i)
+            {
+                auto vertices = CreateSpriteVertices(data, 4);
+                auto indices = CreateIndices(data, 6, 4);
+                
+                const u32 vertexDataSize = u32(vertices.size() * sizeof(ChilliSource::SpriteVertex));
+                auto vertexData = ChilliSource::MakeUniqueArray<u8>(frameAllocator, vertexDataSize);
+                memcpy(vertexData.get(), vertices.data(), vertexDataSize);
+                
+                const u32 indexDataSize = u32(indices.size() * sizeof(u16));
+                auto indexData = ChilliSource::MakeUniqueArray<u8>(frameAllocator, indexDataSize);
+                memcpy(indexData.get(), indices.data(), indexDataSize);
+                
+                auto renderDynamicMesh = ChilliSource::MakeUnique<ChilliSource::RenderDynamicMesh>(frameAllocator, ChilliSource::PolygonType::k_triangle, ChilliSource::VertexFormat::k_sprite,
+                    ChilliSource::IndexFormat::k_short, u32(vertices.size()), u32(indices.size()), ChilliSource::Sphere(ChilliSource::Vector3::k_zero, 1.0f), std::move(vertexData), vertexDataSize,
+                    std::move(indexData), indexDataSize);
+                renderDynamicMeshes.push_back(renderDynamicMesh.get());
+                renderFrameData.AddRenderDynamicMesh(std::move(renderDynamicMesh));
+            }
+            
+            auto jointData = ChilliSource::MakeUniqueArray<ChilliSource::Vector4>(frameAllocator, k_numReplayJoints * 3);
+            for (u32 i = 0; i < k_numReplayJoints * 3; ++i)
+            {
+                jointData[i] = ChilliSource::Vector4(data.NextF32(-1.0f, 1.0f), data.NextF32(-1.0f, 1.0f), data.NextF32(-1.0f, 1.0f), data.NextF32(-1.0f, 1.0f));
+            }
+            auto renderSkinnedAnimation = ChilliSource::MakeUnique<ChilliSource::RenderSkinnedAnimation>(frameAllocator, std::move(jointData), k_numReplayJoints * 3);
+            auto renderSkinnedAnimationRaw = renderSkinnedAnimation.get();
+            renderFrameData.AddRenderSkinnedAnimation(std::move(renderSkinnedAnimation));
+            
+            std::vector<ChilliSource::RenderFrameData> renderFramesData;
+            renderFramesData.push_back(std::move(renderFrameData));
+            ChilliSource::RenderCommandBuffer renderCommandBuffer(3, &frameAllocator, std::move(renderFramesData));
+            
+            auto loadCommandList = renderCommandBuffer.GetRenderCommandList(0);
+            loadCommandList->AddLoadShaderCommand(scene.m_renderShader.get(), "vertex shader", "fragment shader");
+            for (auto& renderTexture : scene.m_renderTextures)
+            {
+                const u32 textureDataSize = k_replayTextureSize * k_replayTextureSize * 4;
+                loadCommandList->AddLoadTextureCommand(renderTexture.get(), CreateBytes(data, textureDataSize), textureDataSize);
+            }
+            loadCommandList->AddLoadTextureCommand(scene.m_shadowMapRenderTexture.get(), nullptr, 0);
+            loadCommandList->AddLoadTargetGroupCommand(scene.m_shadowMapRenderTargetGroup.get());
+            for (auto& renderMaterialGroup : scene.m_renderMaterialGroups)
+            {
+                loadCommandList->AddLoadMaterialGroupCommand(renderMaterialGroup.get());
+            }
+            for (auto& renderMesh : scene.m_renderMeshes)
+            {
+                const u32 vertexDataSize = k_replayMeshNumVertices * renderMesh->GetVertexFormat().GetSize();
+                const u32 indexDataSize = k_replayMeshNumIndices * sizeof(u16);
+                loadCommandList->AddLoadMeshCommand(renderMesh.get(), CreateBytes(data, vertexDataSize), vertexDataSize, CreateBytes(data, indexDataSize), indexDataSize);
+            }
+            
+            auto shadowCommandList = renderCommandBuffer.GetRenderCommandList(1);
+            shadowCommandList->AddBeginWithTargetGroupCommand(scene.m_shadowMapRenderTargetGroup.get(), ChilliSource::Colour::k_white);
+            shadowCommandList->AddApplyCameraCommand(ChilliSource::Vector3::k_zero, ChilliSource::Matrix4::k_identity, ChilliSource::Matrix4::k_identity);
+            shadowCommandList->AddApplyMaterialCommand(scene.m_renderMaterialGroups[0]->GetRenderMaterials()[0]);
+            for (u32 i = 1; i < k_numReplayMeshes; ++i)
+            {
+                shadowCommandList->AddApplyMeshCommand(scene.m_renderMeshes[i].get());
+                shadowCommandList->AddRenderInstanceCommand(ChilliSource::Matrix4::CreateTranslation(ChilliSource::Vector3(data.NextF32(-50.0f, 50.0f), 0.0f, data.NextF32(-50.0f, 50.0f))));
+            }
+            shadowCommandList->AddEndCommand();
+            
+            auto sceneCommandList = renderCommandBuffer.GetRenderCommandList(2);
+            sceneCommandList->AddBeginCommand(ChilliSource::Integer2(1280, 720), ChilliSource::Colour::k_cornflowerBlue);
+            sceneCommandList->AddApplyCameraCommand(ChilliSource::Vector3(0.0f, 10.0f, -20.0f), ChilliSource::Matrix4::CreateTranslation(ChilliSource::Vector3(0.0f, -10.0f, 20.0f)), ChilliSource::Matrix4::k_identity);
+            sceneCommandList->AddApplyAmbientLightCommand(ChilliSource::Colour(0.2f, 0.2f, 0.2f, 1.0f));
+            sceneCommandList->AddApplyDirectionalLightCommand(ChilliSource::Colour::k_white, ChilliSource::Vector3(0.0f, -1.0f, 0.0f), ChilliSource::Matrix4::k_identity, 0.01f, scene.m_shadowMapRenderTexture.get());
+            
+            std::vector<ChilliSource::Colour> pointLightColours;
+            std::vector<ChilliSource::Vector3> pointLightPositions;
+            std::vector<ChilliSource::Vector3> pointLightAttenuations;
+            for (u32 i = 0; i < k_numReplayPointLights; ++i)
+            {
+                pointLightColours.push_back(ChilliSource::Colour(data.NextF32(0.0f, 1.0f), data.NextF32(0.0f, 1.0f), data.NextF32(0.0f, 1.0f), 1.0f));
+                pointLightPositions.push_back(ChilliSource::Vector3(data.NextF32(-50.0f, 50.0f), data.NextF32(0.0f, 10.0f), data.NextF32(-50.0f, 50.0f)));
+                pointLightAttenuations.push_back(ChilliSource::Vector3(1.0f, 0.1f, 0.01f));
+            }
+            sceneCommandList->AddApplyPointLightsCommand(std::move(pointLightColours), std::move(pointLightPositions), std::move(pointLightAttenuations));
+            
+            sceneCommandList->AddApplyMaterialCommand(scene.m_renderMaterialGroups[0]->GetRenderMaterials()[0]);
+            sceneCommandList->AddApplyMeshCommand(scene.m_renderMeshes[0].get());
+            sceneCommandList->AddApplySkinnedAnimationCommand(renderSkinnedAnimationRaw);
+            sceneCommandList->AddRenderInstanceCommand(ChilliSource::Matrix4::k_identity);
+            
+            for (u32 i = 0; i < k_numReplayObjects; ++i)
+            {
+                sceneCommandList->AddApplyMaterialCommand(scene.m_renderMaterialGroups[i % k_numReplayMaterials]->GetRenderMaterials()[0]);
+                sceneCommandList->AddApplyMeshCommand(scene.m_renderMeshes[1 + i % (k_numReplayMeshes - 1)].get());
+                sceneCommandList->AddRenderInstanceCommand(ChilliSource::Matrix4::CreateTranslation(ChilliSource::Vector3(data.NextF32(-50.0f, 50.0f), 0.0f, data.NextF32(-50.0f, 50.0f))));
+            }
+            
+            std::vector<ChilliSource::Matrix4> worldMatrices;
+            for (u32 i = 0; i < k_numReplayInstances; ++i)
+            {
+                worldMatrices.push_back(ChilliSource::Matrix4::CreateTranslation(ChilliSource::Vector3(data.NextF32(-50.0f, 50.0f), 0.0f, data.NextF32(-50.0f, 50.0f))));
+            }
+            sceneCommandList->AddApplyMeshCommand(scene.m_renderMeshes[1].get());
+            sceneCommandList->AddRenderInstancesCommand(std::move(worldMatrices));
+            
+            sceneCommandList->AddApplyMaterialCommand(scene.m_renderMaterialGroups[1]->GetRenderMaterials()[0]);
+            for (auto renderDynamicMesh : renderDynamicMeshes)
+            {
+                sceneCommandList->AddApplyDynamicMeshCommand(renderDynamicMesh);
+                sceneCommandList->AddRenderInstanceCommand(ChilliSource::Matrix4::k_identity);
+            }
+            
+            auto batchVertices = CreateSpriteVertices(data, k_numReplaySprites * 4);
+            auto batchIndices = CreateIndices(data, k_numReplaySprites * 6, k_numReplaySprites * 4);
+            std::vector<ChilliSource::RenderMeshBatch::Mesh> batchMeshes;
+            batchMeshes.push_back(ChilliSource::RenderMeshBatch::Mesh(ChilliSource::Matrix4::k_identity, u32(batchVertices.size()), u32(batchIndices.size()), reinterpret_cast<const u8*>(batchVertices.data()),
+                u32(batchVertices.size() * sizeof(ChilliSource::SpriteVertex)), reinterpret_cast<const u8*>(batchIndices.data()), u32(batchIndices.size() * sizeof(u16))));
+            sceneCommandList->AddApplyMeshBatchCommand(ChilliSource::RenderMeshBatchUPtr(new ChilliSource::RenderMeshBatch(ChilliSource::PolygonType::k_triangle, ChilliSource::VertexFormat::k_sprite,
+                ChilliSource::IndexFormat::k_short, std::move(batchMeshes))));
+            sceneCommandList->AddRenderInstanceCommand(ChilliSource::Matrix4::k_identity);
+            sceneCommandList->AddEndCommand();
+            
+            return std::make_shared<const ChilliSource::RenderCommandCapture>(&renderCommandBuffer);
+        }
+    }
+    
+    //------------------------------------------------------------------------------
+    void RegisterRenderingBenchmarks(BenchmarkRunner& runner) noexcept
+    {
+        runner.Add("Rendering/MaterialSwitchByName", 10, []()
+        {
+            auto materialSwitchData = CreateMaterialSwitchData();
+            auto uniformSink = std::make_shared<UniformSink>(u32(materialSwitchData->m_uniformHandles.size()));
+            return [=]()
+            {
+                for (u32 i = 0; i < k_numSwitchesPerRun; ++i)
+                {
+                    const auto& material = materialSwitchData->m_materials[i % k_numMaterials];
+                    
+                    for (u32 j = 0; j < k_numColourUniforms; ++j)
+                    {
+                        uniformSink->SetUniform(materialSwitchData->m_uniformHandles.at(k_colourUniformNames[j]), reinterpret_cast<const f32*>(&material.m_colours[j]), 4);
+                    }
+                    
+                    ApplyByName(*materialSwitchData, material.m_floatVars, *uniformSink);
+                    ApplyByName(*materialSwitchData, material.m_vec2Vars, *uniformSink);
+                    ApplyByName(*materialSwitchData, material.m_vec3Vars, *uniformSink);
+                    ApplyByName(*materialSwitchData, material.m_vec4Vars, *uniformSink);
+                    ApplyByName(*materialSwitchData, material.m_mat4Vars, *uniformSink);
+                    ApplyByName(*materialSwitchData, material.m_colourVars, *uniformSink);
+                }
+                
+                return uniformSink->Checksum();
+            };
+        });
+        
+        runner.Add("Rendering/MaterialSwitchCompiled", 10, []()
+        {
+            auto materialSwitchData = CreateMaterialSwitchData();
+            auto uniformSink = std::make_shared<UniformSink>(u32(materialSwitchData->m_uniformHandles.size()));
+            return [=]()
+            {
+                for (u32 i = 0; i < k_numSwitchesPerRun; ++i)
+                {
+                    const auto& material = materialSwitchData->m_materials[i % k_numMaterials];
+                    
+                    for (u32 j = 0; j < k_numColourUniforms; ++j)
+                    {
+                        uniformSink->SetUniform(s32(j), reinterpret_cast<const f32*>(&material.m_colours[j]), 4);
+                    }
+                    
+                    const auto& variables = material.m_renderShaderVariables->GetVariables();
+                    const auto data = material.m_renderShaderVariables->GetData().data();
+                    for (std::size_t j = 0; j < variables.size(); ++j)
+                    {
+                        uniformSink->SetUniform(material.m_handles[j], data + variables[j].m_dataOffset, ChilliSource::RenderShaderVariables::GetNumComponents(variables[j].m_type));
+                    }
+                }
+                
+                return uniformSink->Checksum();
+            };
+        });
+        
+        runner.Add("Rendering/ReplayCapture", 10, []()
+        {
+            auto capture = CreateReplayCapture();
+            auto frameAllocator = std::make_shared<ChilliSource::PagedLinearAllocator>(k_replayFramePageSize);
+            auto renderCommandProcessor = std::make_shared<ChilliSource::RecordingRenderCommandProcessor>();
+            return [=]()
+            {
+                auto renderCommandBuffer = capture->CreateRenderCommandBuffer(frameAllocator.get());
+                renderCommandProcessor->Process(renderCommandBuffer.get());
+                renderCommandBuffer.reset();
+                frameAllocator->Reset();
+                
+                const auto& stats = renderCommandProcessor->GetLastFrame()->GetStats();
+                u64 checksum = 0;
+                checksum = CombineChecksum(checksum, stats.m_numCommands);
+                checksum = CombineChecksum(checksum, stats.m_numDrawCalls);
+                checksum = CombineChecksum(checksum, stats.m_numInstances);
+                checksum = CombineChecksum(checksum, stats.m_numVertices);
+                checksum = CombineChecksum(checksum, stats.m_numIndices);
+                return checksum;
+            };
+        });
+    }
+}
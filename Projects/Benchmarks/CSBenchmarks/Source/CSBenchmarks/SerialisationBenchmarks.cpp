@@ -0,0 +1,157 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <CSBenchmarks/Benchmarks.h>
+
+#include <CSBenchmarks/BenchmarkRunner.h>
+#include <CSBenchmarks/DeterministicData.h>
+
+#include <ChilliSource/Core/Json/JsonUtils.h>
+#include <ChilliSource/Core/XML/XML.h>
+#include <ChilliSource/Core/XML/XMLUtils.h>
+
+#include <json/json.h>
+
+#include <iomanip>
+#include <memory>
+#include <sstream>
+
+namespace CSBenchmarks
+{
+    namespace
+    {
+        const u32 k_numEntities = 512;
+        
+        /// @return A JSON document describing a fixed scene of entities, similar to
+        ///     typical app data.
+        ///
+        std::string CreateJsonDocument() noexcept
+        {
+            DeterministicData data(40);
+            
+            std::ostringstream stream;
+            stream << std::fixed << std::setprecision(3);
+            stream << "{\n\t\"Name\": \"Benchmark\",\n\t\"Entities\": [\n";
+            for (u32 i = 0; i < k_numEntities; ++i)
+            {
+                stream << "\t\t{\n";
+                stream << "\t\t\t\"Name\": \"Entity" << i << "\",\n";
+                stream << "\t\t\t\"Position\": [" << data.NextF32(-100.0f, 100.0f) << ", " << data.NextF32(-100.0f, 100.0f) << ", " << data.NextF32(-100.0f, 100.0f) << "],\n";
+                stream << "\t\t\t\"Scale\": " << data.NextF32(0.5f, 2.0f) << ",\n";
+                stream << "\t\t\t\"Visible\": " << (data.NextU32(2) == 0 ? "true" : "false") << ",\n";
+                stream << "\t\t\t\"Tags\": [\"Tag" << data.NextU32(16) << "\", \"Tag" << data.NextU32(16) << "\"]\n";
+                stream << "\t\t}" << (i + 1 < k_numEntities ? "," : "") << "\n";
+            }
+            stream << "\t]\n}\n";
+            
+            return stream.str();
+        }
+        
+        /// @return An XML document describing the same kind of scene as the JSON
+        ///     document.
+        ///
+        std::string CreateXmlDocument() noexcept
+        {
+            DeterministicData data(41);
+            
+            std::ostringstream stream;
+            stream << std::fixed << std::setprecision(3);
+            stream << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<Scene name=\"Benchmark\">\n";
+            for (u32 i = 0; i < k_numEntities; ++i)
+            {
+                stream << "\t<Entity name=\"Entity" << i << "\" scale=\"" << data.NextF32(0.5f, 2.0f) << "\" visible=\"" << (data.NextU32(2) == 0 ? "true" : "false") << "\">\n";
+                stream << "\t\t<Position x=\"" << data.NextF32(-100.0f, 100.0f) << "\" y=\"" << data.NextF32(-100.0f, 100.0f) << "\" z=\"" << data.NextF32(-100.0f, 100.0f) << "\"/>\n";
+                stream << "\t\t<Tag>Tag" << data.NextU32(16) << "</Tag>\n";
+                stream << "\t</Entity>\n";
+            }
+            stream << "</Scene>\n";
+            
+            return stream.str();
+        }
+        
+        /// @param root
+        ///     The root of the parsed JSON document.
+        ///
+        /// @return A checksum of the entities in the document.
+        ///
+        u64 ChecksumJson(const Json::Value& root) noexcept
+        {
+            u64 checksum = 0;
+            for (const auto& entity : root["Entities"])
+            {
+                checksum = CombineChecksum(checksum, entity["Name"].asString().size());
+                checksum = CombineFloatChecksum(checksum, entity["Position"][0].asFloat() + entity["Scale"].asFloat());
+                checksum = CombineChecksum(checksum, entity["Visible"].asBool() ? 1 : 0);
+            }
+            return checksum;
+        }
+    }
+    
+    //------------------------------------------------------------------------------
+    void RegisterSerialisationBenchmarks(BenchmarkRunner& runner) noexcept
+    {
+        runner.Add("Serialisation/JsonParse", 5, []()
+        {
+            auto document = std::make_shared<std::string>(CreateJsonDocument());
+            return [=]()
+            {
+                auto root = ChilliSource::JsonUtils::ParseJson(*document);
+                return ChecksumJson(root);
+            };
+        });
+        
+        runner.Add("Serialisation/JsonWrite", 5, []()
+        {
+            auto root = std::make_shared<Json::Value>(ChilliSource::JsonUtils::ParseJson(CreateJsonDocument()));
+            return [=]()
+            {
+                Json::FastWriter writer;
+                auto output = writer.write(*root);
+                return CombineChecksum(0, output.size());
+            };
+        });
+        
+        runner.Add("Serialisation/XmlParse", 10, []()
+        {
+            auto document = std::make_shared<std::string>(CreateXmlDocument());
+            return [=]()
+            {
+                auto xml = ChilliSource::XMLUtils::ParseDocument(*document);
+                auto sceneNode = ChilliSource::XMLUtils::GetFirstChildElement(xml->GetDocument(), "Scene");
+                
+                u64 checksum = 0;
+                for (auto entityNode = ChilliSource::XMLUtils::GetFirstChildElement(sceneNode, "Entity"); entityNode != nullptr; entityNode = ChilliSource::XMLUtils::GetNextSiblingElement(entityNode, "Entity"))
+                {
+                    auto positionNode = ChilliSource::XMLUtils::GetFirstChildElement(entityNode, "Position");
+                    
+                    checksum = CombineChecksum(checksum, ChilliSource::XMLUtils::GetAttributeValue<std::string>(entityNode, "name", "").size());
+                    checksum = CombineFloatChecksum(checksum, ChilliSource::XMLUtils::GetAttributeValue<f32>(positionNode, "x", 0.0f) + ChilliSource::XMLUtils::GetAttributeValue<f32>(entityNode, "scale", 0.0f));
+                    checksum = CombineChecksum(checksum, ChilliSource::XMLUtils::GetAttributeValue<bool>(entityNode, "visible", false) ? 1 : 0);
+                }
+                return checksum;
+            };
+        });
+    }
+}
@@ -0,0 +1,154 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <CSBenchmarks/Benchmarks.h>
+
+#include <CSBenchmarks/BenchmarkRunner.h>
+#include <CSBenchmarks/DeterministicData.h>
+
+#include <ChilliSource/Core/Container/ParamDictionary.h>
+#include <ChilliSource/Core/String/StringUtils.h>
+#include <ChilliSource/Core/String/UTF8StringUtils.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace CSBenchmarks
+{
+    namespace
+    {
+        const u32 k_numWords = 8192;
+        const u32 k_numVariables = 64;
+        
+        /// Words used to build text. These include multi-byte UTF-8 characters, written
+        /// as escaped bytes so the source encoding doesn't matter.
+        ///
+        const char* k_words[] =
+        {
+            "the", "quick", "brown", "fox", "jumps", "over", "lazy", "dog",
+            "caf\xC3\xA9", "na\xC3\xAFve", "\xC3\xBC" "ber", "stra\xC3\x9F" "e",
+            "\xE6\x97\xA5\xE6\x9C\xAC", "\xE4\xB8\xAD\xE6\x96\x87", "\xED\x95\x9C\xEA\xB8\x80", "\xF0\x9F\x98\x80"
+        };
+        const u32 k_numUniqueWords = sizeof(k_words) / sizeof(k_words[0]);
+        
+        /// @return A fixed block of UTF-8 text made up of words separated by spaces
+        ///     and occasional new lines.
+        ///
+        std::shared_ptr<std::string> CreateText() noexcept
+        {
+            DeterministicData data(70);
+            
+            auto text = std::make_shared<std::string>();
+            for (u32 i = 0; i < k_numWords; ++i)
+            {
+                *text += k_words[data.NextU32(k_numUniqueWords)];
+                *text += (data.NextU32(16) == 0) ? "\n" : " ";
+            }
+            return text;
+        }
+    }
+    
+    //------------------------------------------------------------------------------
+    void RegisterTextBenchmarks(BenchmarkRunner& runner) noexcept
+    {
+        runner.Add("Text/UTF8CalcLength", 20, []()
+        {
+            auto text = CreateText();
+            return [=]()
+            {
+                return u64(ChilliSource::UTF8StringUtils::CalcLength(text->begin(), text->end()));
+            };
+        });
+        
+        runner.Add("Text/UTF8Decode", 20, []()
+        {
+            auto text = CreateText();
+            return [=]()
+            {
+                u64 checksum = 0;
+                auto it = text->cbegin();
+                while (it < text->cend())
+                {
+                    checksum = CombineChecksum(checksum, ChilliSource::UTF8StringUtils::Next(it));
+                }
+                return checksum;
+            };
+        });
+        
+        runner.Add("Text/UTF8SubString", 20, []()
+        {
+            auto text = CreateText();
+            return [=]()
+            {
+                u64 checksum = 0;
+                for (u32 start = 0; start < 4096; start += 256)
+                {
+                    checksum = CombineStringChecksum(checksum, ChilliSource::UTF8StringUtils::SubString(*text, start, 64));
+                }
+                return checksum;
+            };
+        });
+        
+        runner.Add("Text/SplitIntoWords", 10, []()
+        {
+            auto text = CreateText();
+            return [=]()
+            {
+                auto words = ChilliSource::StringUtils::Split(*text);
+                
+                u64 checksum = CombineChecksum(0, words.size());
+                for (const auto& word : words)
+                {
+                    checksum = CombineChecksum(checksum, word.size());
+                }
+                return checksum;
+            };
+        });
+        
+        runner.Add("Text/InsertVariables", 10, []()
+        {
+            DeterministicData data(71);
+            
+            auto params = std::make_shared<ChilliSource::ParamDictionary>();
+            for (u32 i = 0; i < k_numVariables; ++i)
+            {
+                params->SetValue("Var" + ChilliSource::ToString(i), k_words[data.NextU32(k_numUniqueWords)]);
+            }
+            
+            auto text = std::make_shared<std::string>();
+            for (u32 i = 0; i < k_numWords / 8; ++i)
+            {
+                *text += k_words[data.NextU32(k_numUniqueWords)];
+                *text += " [var=Var" + ChilliSource::ToString(data.NextU32(k_numVariables)) + "] ";
+            }
+            
+            return [=]()
+            {
+                return CombineStringChecksum(0, ChilliSource::StringUtils::InsertVariables(*text, *params));
+            };
+        });
+    }
+}
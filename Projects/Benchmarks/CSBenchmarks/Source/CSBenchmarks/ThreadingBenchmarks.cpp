@@ -0,0 +1,133 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <CSBenchmarks/Benchmarks.h>
+
+#include <CSBenchmarks/BenchmarkRunner.h>
+#include <CSBenchmarks/DeterministicData.h>
+
+#include <ChilliSource/Core/Threading.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace CSBenchmarks
+{
+    namespace
+    {
+        /// The number of worker threads is fixed rather than based on the number of
+        /// cores so that the workload is the same on every device.
+        ///
+        const u32 k_numThreads = 3;
+        const u32 k_numSmallTasks = 1024;
+        const u32 k_numSumTasks = 16;
+        const u32 k_numValuesPerSumTask = 16384;
+        const u32 k_numParentTasks = 16;
+        const u32 k_numChildTasksPerParent = 16;
+    }
+    
+    //------------------------------------------------------------------------------
+    void RegisterThreadingBenchmarks(BenchmarkRunner& runner) noexcept
+    {
+        runner.Add("Threading/TaskPoolEmptyTasks", 20, []()
+        {
+            auto taskPool = std::make_shared<ChilliSource::TaskPool>(ChilliSource::TaskType::k_small, k_numThreads);
+            return [=]()
+            {
+                std::atomic<u32> numTasksRun(0);
+                std::vector<ChilliSource::Task> tasks(k_numSmallTasks, [&](const ChilliSource::TaskContext& taskContext) noexcept
+                {
+                    ++numTasksRun;
+                });
+                
+                taskPool->AddTasksAndYield(tasks);
+                return u64(numTasksRun.load());
+            };
+        });
+        
+        runner.Add("Threading/TaskPoolParallelSum", 20, []()
+        {
+            DeterministicData data(30);
+            
+            auto values = std::make_shared<std::vector<u32>>();
+            values->reserve(k_numSumTasks * k_numValuesPerSumTask);
+            for (u32 i = 0; i < k_numSumTasks * k_numValuesPerSumTask; ++i)
+            {
+                values->push_back(data.NextU32(1024));
+            }
+            
+            auto taskPool = std::make_shared<ChilliSource::TaskPool>(ChilliSource::TaskType::k_small, k_numThreads);
+            return [=]()
+            {
+                std::vector<u64> sums(k_numSumTasks, 0);
+                std::vector<ChilliSource::Task> tasks;
+                for (u32 taskIndex = 0; taskIndex < k_numSumTasks; ++taskIndex)
+                {
+                    tasks.push_back([=, &sums](const ChilliSource::TaskContext& taskContext) noexcept
+                    {
+                        u64 sum = 0;
+                        for (u32 i = 0; i < k_numValuesPerSumTask; ++i)
+                        {
+                            sum += (*values)[taskIndex * k_numValuesPerSumTask + i];
+                        }
+                        sums[taskIndex] = sum;
+                    });
+                }
+                
+                taskPool->AddTasksAndYield(tasks);
+                
+                u64 checksum = 0;
+                for (auto sum : sums)
+                {
+                    checksum = CombineChecksum(checksum, sum);
+                }
+                return checksum;
+            };
+        });
+        
+        runner.Add("Threading/TaskContextChildTasks", 20, []()
+        {
+            auto taskPool = std::make_shared<ChilliSource::TaskPool>(ChilliSource::TaskType::k_small, k_numThreads);
+            return [=]()
+            {
+                std::atomic<u32> numChildTasksRun(0);
+                
+                std::vector<ChilliSource::Task> childTasks(k_numChildTasksPerParent, [&](const ChilliSource::TaskContext& taskContext) noexcept
+                {
+                    ++numChildTasksRun;
+                });
+                
+                std::vector<ChilliSource::Task> parentTasks(k_numParentTasks, [&](const ChilliSource::TaskContext& taskContext) noexcept
+                {
+                    taskContext.ProcessChildTasks(childTasks);
+                });
+                
+                taskPool->AddTasksAndYield(parentTasks);
+                return u64(numChildTasksRun.load());
+            };
+        });
+    }
+}
@@ -0,0 +1,110 @@
+#!/usr/bin/python
+#  The MIT License (MIT)
+#
+#  Copyright (c) 2017 Tag Games Limited
+#
+#  Permission is hereby granted, free of charge, to any person obtaining a copy
+#  of this software and associated documentation files (the "Software"), to deal
+#  in the Software without restriction, including without limitation the rights
+#  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+#  copies of the Software, and to permit persons to whom the Software is
+#  furnished to do so, subject to the following conditions:
+#
+#  The above copyright notice and this permission notice shall be included in
+#  all copies or substantial portions of the Software.
+#
+#  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+#  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+#  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+#  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+#  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+#  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+#  THE SOFTWARE.
+#-----------------------------------------------------------------------------------
+#
+#  Compares two sets of results output by CSBenchmarks in JSON format, e.g. from
+#  builds of two different commits, printing the change in median time for each
+#  benchmark.
+#
+#     python compare_benchmarks.py baseline.json results.json [threshold_percent]
+#
+#  Benchmarks which are slower by more than the threshold (default 5%), or whose
+#  checksum has changed, are flagged, and the exit status is 1 if any are found.
+#-----------------------------------------------------------------------------------
+import json
+import sys
+
+DEFAULT_THRESHOLD_PERCENT = 5.0
+
+# Reads a CSBenchmarks results file.
+#
+# @param file_path
+#	The path to the JSON results file.
+#
+# @return Dict of benchmark name to result.
+#
+def _read_results(file_path):
+
+	with open(file_path, "r") as results_file:
+		results = json.load(results_file)
+
+	return dict((result["Name"], result) for result in results["Benchmarks"])
+
+# Compares the results of two benchmark runs and prints a report.
+#
+# @param baseline_results
+#	Dict of benchmark name to result for the baseline.
+# @param results
+#	Dict of benchmark name to result to compare against the baseline.
+# @param threshold_percent
+#	The increase in median time, as a percentage, above which a benchmark is considered to have regressed.
+#
+# @return Whether any benchmark regressed or changed checksum.
+#
+def _compare(baseline_results, results, threshold_percent):
+
+	has_regressions = False
+
+	print("{:<50} {:>14} {:>14} {:>9}".format("Benchmark", "Baseline (ns)", "Current (ns)", "Change"))
+	for name in sorted(set(baseline_results) | set(results)):
+		if name not in baseline_results:
+			print("{:<50} {:>14} {:>14} {:>9}".format(name, "-", results[name]["MedianNs"], "new"))
+			continue
+		if name not in results:
+			print("{:<50} {:>14} {:>14} {:>9}".format(name, baseline_results[name]["MedianNs"], "-", "removed"))
+			continue
+
+		baseline_time = baseline_results[name]["MedianNs"]
+		time = results[name]["MedianNs"]
+		change_percent = 100.0 * (time - baseline_time) / baseline_time if baseline_time > 0 else 0.0
+
+		flags = ""
+		if change_percent > threshold_percent:
+			flags += " REGRESSION"
+			has_regressions = True
+		if baseline_results[name]["Checksum"] != results[name]["Checksum"]:
+			flags += " CHECKSUM CHANGED"
+			has_regressions = True
+
+		print("{:<50} {:>14} {:>14} {:>+8.1f}%{}".format(name, baseline_time, time, change_percent, flags))
+
+	return has_regressions
+
+# The entry point into the script.
+#
+# @param args
+#	The list of arguments: the baseline results file, the results file to compare and optionally the threshold percentage.
+#
+def run(args):
+
+	if len(args) < 2:
+		print("Too few args. Usage: <baseline_results> <results> [threshold_percent]")
+		sys.exit(2)
+
+	threshold_percent = float(args[2]) if len(args) > 2 else DEFAULT_THRESHOLD_PERCENT
+
+	if _compare(_read_results(args[0]), _read_results(args[1]), threshold_percent):
+		sys.exit(1)
+
+if __name__ == "__main__":
+	run(sys.argv[1:])
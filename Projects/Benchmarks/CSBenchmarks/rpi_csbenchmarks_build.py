@@ -0,0 +1,228 @@
+#!/usr/bin/python
+#  The MIT License (MIT)
+#
+#  Copyright (c) 2017 Tag Games Limited
+#
+#  Permission is hereby granted, free of charge, to any person obtaining a copy
+#  of this software and associated documentation files (the "Software"), to deal
+#  in the Software without restriction, including without limitation the rights
+#  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+#  copies of the Software, and to permit persons to whom the Software is
+#  furnished to do so, subject to the following conditions:
+#
+#  The above copyright notice and this permission notice shall be included in
+#  all copies or substantial portions of the Software.
+#
+#  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+#  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+#  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+#  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+#  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+#  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+#  THE SOFTWARE.
+#-----------------------------------------------------------------------------------
+#
+#  Builds the headless benchmark suite for Raspberry Pi and other Linux targets
+#  supported by the RPi backend. This should be run from this directory, after
+#  building CSBase, e.g.
+#
+#     python rpi_csbenchmarks_build.py release 4 g++ g++ ar
+#     ./build/RPi/release/CSBenchmarks --output results.json
+#
+#  Results from two builds can then be compared with compare_benchmarks.py.
+#-----------------------------------------------------------------------------------
+import sys
+CS_ROOT = "../../.."
+sys.path.append("{}/Tools/Scripts/".format(CS_ROOT))
+import subprocess
+import os
+from ninja_syntax import Writer
+from file_system_utils import delete_directory
+
+APP_NAME = "CSBenchmarks"
+COMPILER_FLAGS_DEFAULT = "-c -std=c++11 -fsigned-char -pthread -fexceptions -frtti -DCS_TARGETPLATFORM_RPI"
+COMPILER_FLAGS_TARGET_MAP = { "debug":"-g -DDEBUG -DCS_ENABLE_DEBUG",  	"release":"-O3 -DNDEBUG" }
+CS_SOURCE_PATHS = ["{}/Source/ChilliSource".format(CS_ROOT), "{}/Source/CSBackend/Platform/RPi".format(CS_ROOT), "{}/Source/CSBackend/Rendering/OpenGL".format(CS_ROOT)]
+SOURCE_PATHS = ["Source"]
+INCLUDE_PATHS = "-ISource -I{0}/Libraries/Core/RPi/Headers -I{0}/Source -I{0}/Libraries/CricketAudio/RPi/Headers".format(CS_ROOT)
+LIBRARY_PATHS = "-L{0}/Libraries/Core/RPi/Libs -L{0}/Libraries/CricketAudio/RPi/Libs".format(CS_ROOT)
+LIBRARIES = "-lCSBase -lvcos -lbcm_host -lGLESv2 -lEGL -lvchiq_arm -lpthread -l:libX11.so.6.3.0 -l:libXau.so.6.0.0 -l:libXdmcp.so.6.0.0 -l:libxcb.so.1.1.0 -l:libxcb-xkb.so.1.0.0 -l:libxkbcommon.so.0.0.0 -l:libxkbcommon-x11.so.0.0.0 -l:libcurl.so.4.3.0 -l:libidn.so.11.6.12 -l:librtmp.so.1 -l:libssh2.so.1.0.1 -l:libssl.so.1.0.0 -l:libcrypto.so.1.0.0 -l:libgssapi_krb5.so.2.2 -l:libkrb5.so.3.3 -l:libk5crypto.so.3.1 -l:libcom_err.so.2.1 -l:liblber-2.4.so.2.10.3 -l:libldap_r-2.4.so.2.10.3 -l:libz.so.1.2.8 -l:libgnutls-deb0.so.28.41.0 -l:libhogweed.so.2.5 -l:libnettle.so.4.7 -l:libgmp.so.10.2.0 -l:libgcrypt.so.20.0.3 -l:libkrb5support.so.0.1 -l:libkeyutils.so.1.5 -l:libsasl2.so.2.0.25 -l:libp11-kit.so.0.0.0 -l:libtasn1.so.6.3.2 -l:libgpg-error.so.0.13.0 -l:libffi.so.6.0.2 -l:libevdev.so.2.1.3 -l:libudev.so.1.5.0"
+
+# Write build commands to the given ninja file for all source files that have the given extension in the given directories
+#
+# @param ninja_file
+#	File to write commands to
+# @param dirs
+#	List of directories to search for source files
+# @param exts
+# 	The list source file extension to look for in the format "a,b,c"
+# @param compile_rule
+# 	Name of the compile rule to compile this type of source file
+# @param dep_rule
+# 	Name of the rule to generate depencencies for this type of source file
+# @param build_dir
+# 	Location to output compiled files to
+#
+# @return List of output file paths
+#
+def _write_build_command(ninja_file, dirs, exts, compile_rule, dep_rule, build_dir):
+
+	get_files_script = os.path.normpath("{}/Tools/Scripts/get_file_paths_with_extensions.py".format(CS_ROOT))
+	source_files = []
+	for d in dirs:
+		source_files += subprocess.check_output(['python', get_files_script, '--directory', d, '--extensions', exts], universal_newlines=True).split(" ")
+
+	source_files = list(filter(lambda x: len(x) > 0, source_files))
+	# Convert the source files extensions from .c/cpp etc. to .o
+	output_files = map(lambda x: os.path.splitext(x)[0]+'.o', source_files)
+	# Make the file paths relative to the build dir, keeping engine files separate from the benchmark files
+	output_files = map(lambda x: os.path.join(build_dir, os.path.normpath(x).replace(os.path.normpath(CS_ROOT), "ChilliSource", 1)), output_files)
+	# Convert from windows separators to unix ones as Ninja has a bug where it doesn't escape windows properly
+	output_files = list(map(lambda x: x.replace('\\', '/'), output_files))
+
+	for source_file, output_file in zip(source_files, output_files):
+		ninja_file.build(rule=compile_rule, inputs=source_file, outputs=output_file)
+		ninja_file.build(rule=dep_rule, inputs=source_file, outputs=output_file+".d")
+
+	return output_files
+
+# Generate a ninja "makefile"
+#
+# The engine is archived into a static library rather than linked directly so that
+# only the parts used by the benchmarks are linked. This means the platform entry
+# point and window are never pulled in, allowing the benchmarks to run without a
+# display.
+#
+# @param compiler_path
+# 	Path to the g++ compiler
+# @param linker_path
+# 	Path to the g++ linker
+# @param archiver_path
+# 	Path to the archiver for making static libs
+# @param target_scheme
+# 	Used to apply compiler flags
+# @param build_dir
+# 	Location to output temp build files to
+# @param lib_cs_path
+#	Path to the temporary engine library
+# @param exe_path
+#	Path to the output executable
+#
+def _generate_ninja_file(compiler_path, linker_path, archiver_path, target_scheme, build_dir, lib_cs_path, exe_path):
+
+	with open(os.path.join(build_dir, "Application.ninja"), "w") as build_file:
+		ninja_file = Writer(build_file)
+
+		ninja_file.variable(key="builddir", value=build_dir)
+
+		compiler_flags = COMPILER_FLAGS_DEFAULT + " " + COMPILER_FLAGS_TARGET_MAP[target_scheme] + " " + INCLUDE_PATHS
+		linker_flags = LIBRARY_PATHS + " -L" + build_dir + " -lChilliSource " + LIBRARIES
+
+		# Write the compiler rule for c, cpp and cc
+		ninja_file.rule("compile", command="{} {} -o $out $in".format(compiler_path, compiler_flags), description="Compiling source: $in", depfile="$out.o.d", deps="gcc")
+
+		# Write the rule that generates the dependencies
+		ninja_file.rule("dependencies", command="{} {} -MM -MG -MF $out $in".format(compiler_path, compiler_flags), description="Generating dependency: $in")
+
+		# Write the rule to build the static library. Note we use response files as on Windows the command is too long for CreateProcess
+		ninja_file.rule("archive", command="{} rcs $out @$out.rsp".format(archiver_path), description="Building static library: $out", rspfile="$out.rsp", rspfile_content="$in")
+
+		# Write the rule to link. Note we use response files as on Windows the command is too long for CreateProcess
+		ninja_file.rule("link", command="{} @$out.rsp {} -o $out".format(linker_path, linker_flags), description="Linking: $out", rspfile="$out.rsp", rspfile_content="$in")
+
+		# Write the compile command for all source files.
+		cs_output_files = _write_build_command(ninja_file, CS_SOURCE_PATHS, 'c,cpp,cc', 'compile', 'dependencies', build_dir)
+		benchmark_output_files = _write_build_command(ninja_file, SOURCE_PATHS, 'c,cpp,cc', 'compile', 'dependencies', build_dir)
+
+		# Write the command to generate the static library for ChilliSource
+		ninja_file.build(rule="archive", inputs=cs_output_files, outputs=lib_cs_path)
+
+		# Write the rule to link the benchmarks against the library into the executable
+		ninja_file.build(rule="link", inputs=benchmark_output_files, implicit=lib_cs_path, outputs=exe_path)
+
+# Generates the ninja "makefile" and builds the benchmarks
+#
+# @param target_scheme
+# 	Used to apply compiler flags
+# @param num_jobs
+# 	Used to restrict the number of concurrent build jobs. If "None" then unrestricted
+# @param compiler_path
+# 	Path to the g++ compiler
+# @param linker_path
+# 	Path to the g++ linker
+# @param archiver_path
+# 	Path to the archiver for making static libs
+# @param build_dir
+# 	Location to output temp build files to
+# @param lib_cs_path
+#	Path to the temporary engine library
+# @param exe_path
+#	Path to the output executable
+#
+def _build(target_scheme, num_jobs, compiler_path, linker_path, archiver_path, build_dir, lib_cs_path, exe_path):
+
+	try:
+		os.makedirs(build_dir)
+	except OSError:
+		print("Build directory already exists")
+
+	# Remove the old library and exe but not the compiled files
+	_clean(None, lib_cs_path, exe_path)
+
+	# Generate the ninja "makefile" based on the target scheme
+	_generate_ninja_file(compiler_path, linker_path, archiver_path, target_scheme, build_dir, lib_cs_path, exe_path)
+
+	# Build the exe using ninja
+	if num_jobs == "None":
+		subprocess.call(['ninja', '-f', os.path.join(build_dir, 'Application.ninja')])
+	else:
+		subprocess.call(['ninja', '-f', os.path.join(build_dir, 'Application.ninja'), '-j', str(num_jobs)])
+
+# Cleans the build directory, library and exe. Passing None
+# will prevent them from being cleaned
+#
+# @param build_dir
+#	Location for temporary build files
+# @param lib_cs_path
+#	Path to the temporary engine library
+# @param exe_path
+#	Path to the output executable
+#
+def _clean(build_dir, lib_cs_path, exe_path):
+
+	if lib_cs_path != None and os.path.isfile(lib_cs_path):
+		os.remove(lib_cs_path)
+	if exe_path != None and os.path.isfile(exe_path):
+		os.remove(exe_path)
+	if build_dir != None and os.path.isdir(build_dir):
+		delete_directory(build_dir)
+
+# Begin building the benchmarks
+#
+# @param args
+#	The list of arguments - Should have an additional argument "debug" or "release" optionally followed by "clean" then numjobs, compiler path, linker path and archiver path e.g "release 2 g++ g++ ar"
+#
+def run(args):
+
+	if len(args) < 5 and len(args) != 2:
+		print("Too few args {}. Usage: debug|release [clean] <numjobs> <compiler> <linker> <archiver>".format(len(args)))
+		return
+
+	target_scheme = args[0].lower()
+
+	if target_scheme not in ['debug', 'release']:
+		print("Incorrect target scheme {}. Usage: debug|release [clean] <numjobs> <compiler> <linker> <archiver>".format(target_scheme))
+		return
+
+	build_dir = os.path.normpath("build/RPi/{}".format(target_scheme))
+	lib_cs_path = os.path.normpath("{}/libChilliSource.a".format(build_dir))
+	exe_path = os.path.normpath("{}/{}".format(build_dir, APP_NAME))
+
+	if len(args) > 1 and args[1].lower() == "clean":
+		# Remove all libraries, exes and compiled files
+		_clean(build_dir, lib_cs_path, exe_path)
+	else:
+		_build(target_scheme, args[1], args[2], args[3], args[4], build_dir, lib_cs_path, exe_path)
+
+if __name__ == "__main__":
+	run(sys.argv[1:])
@@ -33,6 +33,7 @@
 
 #include <ChilliSource/Core/File/FileSystem.h>
 #include <ChilliSource/Core/Image/Image.h>
+#include <ChilliSource/Core/Image/ImageFormat.h>
 
 namespace CSBackend
 {
@@ -122,8 +123,10 @@ namespace CSBackend
 			///
 			/// @param The storage location to load from.
 			/// @param The file path.
+			/// @param (Optional) The format RGBA8888 images should be converted to. Each
+			/// row is converted as it is decoded.
 			//----------------------------------------------------------------------------------
-			void Load(ChilliSource::StorageLocation ineStorageLocation, const std::string& instrFilename);
+			void Load(ChilliSource::StorageLocation ineStorageLocation, const std::string& instrFilename, ChilliSource::ImageFormat inePreferredFormat = ChilliSource::ImageFormat::k_RGBA8888);
 			//----------------------------------------------------------------------------------
 			/// Release
 			///
@@ -174,8 +177,9 @@ namespace CSBackend
 			/// Loads the png data using lib png
 			///
 			/// @param the stream lib png should use to read the data.
+			/// @param The format RGBA8888 images should be converted to.
 			//----------------------------------------------------------------------------------
-			bool LoadWithLibPng(const ChilliSource::IBinaryInputStreamUPtr& inStream);
+			bool LoadWithLibPng(const ChilliSource::IBinaryInputStreamUPtr& inStream, ChilliSource::ImageFormat inePreferredFormat);
 
 			bool mbIsLoaded;
 			s32 mdwHeight;
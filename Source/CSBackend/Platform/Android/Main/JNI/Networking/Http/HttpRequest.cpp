@@ -39,6 +39,8 @@
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 
+#include <memory>
+
 //------------------------------------------
 /// C function declarations
 //------------------------------------------
@@ -80,11 +82,11 @@ void Java_com_chilliworks_chillisource_networking_HttpRequest_onBufferFlushed(JN
 	CSBackend::Android::JavaClassSPtr javaBoxedPointer = CSBackend::Android::JavaClassSPtr(new CSBackend::Android::JavaClass(in_objectPointer, CSBackend::Android::BoxedPointer::GetBoxedPointerClassDef()));
 
 	CSBackend::Android::HttpRequest* httpRequest = CSBackend::Android::BoxedPointer::Unbox<CSBackend::Android::HttpRequest>(javaBoxedPointer.get());
-	std::string data = CSBackend::Android::JavaUtils::CreateSTDStringFromJByteArray(in_data, in_dataLength);
+	auto data = std::make_shared<std::string>(CSBackend::Android::JavaUtils::CreateSTDStringFromJByteArray(in_data, in_dataLength));
 
 	ChilliSource::Application::Get()->GetTaskScheduler()->ScheduleTask(ChilliSource::TaskType::k_mainThread, [=](const ChilliSource::TaskContext&)
 	{
-		httpRequest->OnFlushed(data, (u32)in_responseCode);
+		httpRequest->OnFlushed(std::move(*data), (u32)in_responseCode);
 	});
 }
 //-----------------------------------------------------------------------
@@ -94,11 +96,11 @@ void Java_com_chilliworks_chillisource_networking_HttpRequest_onComplete(JNIEnv*
 	CSBackend::Android::JavaClassSPtr javaBoxedPointer = CSBackend::Android::JavaClassSPtr(new CSBackend::Android::JavaClass(in_objectPointer, CSBackend::Android::BoxedPointer::GetBoxedPointerClassDef()));
 
 	CSBackend::Android::HttpRequest* httpRequest = CSBackend::Android::BoxedPointer::Unbox<CSBackend::Android::HttpRequest>(javaBoxedPointer.get());
-	std::string data = CSBackend::Android::JavaUtils::CreateSTDStringFromJByteArray(in_data, in_dataLength);
+	auto data = std::make_shared<std::string>(CSBackend::Android::JavaUtils::CreateSTDStringFromJByteArray(in_data, in_dataLength));
 
 	ChilliSource::Application::Get()->GetTaskScheduler()->ScheduleTask(ChilliSource::TaskType::k_mainThread, [=](const ChilliSource::TaskContext&)
 	{
-		httpRequest->OnComplete((u32)in_resultCode, data, (u32)in_responseCode);
+		httpRequest->OnComplete((u32)in_resultCode, std::move(*data), (u32)in_responseCode);
 	});
 }
 
@@ -171,17 +173,19 @@ namespace CSBackend
 		}
 		//--------------------------------------------------------------------------------------
 		//--------------------------------------------------------------------------------------
-		void HttpRequest::OnFlushed(const std::string& in_data, u32 in_responseCode)
+		void HttpRequest::OnFlushed(std::string in_data, u32 in_responseCode)
 		{
-			m_completionDelegate(this, ChilliSource::HttpResponse(ChilliSource::HttpResponse::Result::k_flushed, in_responseCode, in_data));
+			ChilliSource::HttpResponse response(ChilliSource::HttpResponse::Result::k_flushed, in_responseCode, std::move(in_data));
+			m_completionDelegate(this, response);
 		}
 		//--------------------------------------------------------------------------------------
 		//--------------------------------------------------------------------------------------
-		void HttpRequest::OnComplete(u32 in_resultCode, const std::string& in_data, u32 in_responseCode)
+		void HttpRequest::OnComplete(u32 in_resultCode, std::string in_data, u32 in_responseCode)
 		{
 			if(m_isRequestCancelled == false && m_completionDelegate)
 			{
-				m_completionDelegate(this, ChilliSource::HttpResponse((ChilliSource::HttpResponse::Result)in_resultCode, in_responseCode, in_data));
+				ChilliSource::HttpResponse response((ChilliSource::HttpResponse::Result)in_resultCode, in_responseCode, std::move(in_data));
+				m_completionDelegate(this, response);
 			}
 		}
 		//----------------------------------------------------------------------------------------
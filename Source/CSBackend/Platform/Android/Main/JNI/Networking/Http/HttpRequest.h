@@ -97,10 +97,10 @@ namespace CSBackend
 			///
 			/// @author S Downie
 			///
-			/// @param in_data - Partial data
+			/// @param in_data - Partial data. This is moved into the response.
 			/// @param in_responseCode - Response code
 			//--------------------------------------------------------------------------------------
-			void OnFlushed(const std::string& in_data, u32 in_responseCode);
+			void OnFlushed(std::string in_data, u32 in_responseCode);
 			//--------------------------------------------------------------------------------------
 			/// Called by Java when the request completes.
 			/// This is called on the main thread.
@@ -108,10 +108,10 @@ namespace CSBackend
 			/// @author HMcLaughlin
 			///
 			/// @param in_resultCode - Result code
-			/// @param in_data - Data
+			/// @param in_data - Data. This is moved into the response.
 			/// @param in_responseCode - Response code for request
 			//--------------------------------------------------------------------------------------
-		    void OnComplete(u32 in_resultCode, const std::string& in_data, u32 in_responseCode);
+		    void OnComplete(u32 in_resultCode, std::string in_data, u32 in_responseCode);
 
 		private:
 
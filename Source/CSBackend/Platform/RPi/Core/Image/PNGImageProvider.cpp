@@ -31,8 +31,10 @@
 #include <ChilliSource/Core/Image/Image.h>
 #include <ChilliSource/Core/Image/ImageCompression.h>
 #include <ChilliSource/Core/Image/ImageFormat.h>
+#include <ChilliSource/Core/Image/ImageResourceOptions.h>
 #include <ChilliSource/Core/String/StringUtils.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
+#include <ChilliSource/Core/Time/Profiler.h>
 
 namespace CSBackend
 {
@@ -51,18 +53,28 @@ namespace CSBackend
 			///		The storage location.
 			/// @param filePath
 			///		The filepath.
+			/// @param options
+			///		The image load options. May be null.
 			/// @param delegate
 			///		Completion delegate
 			/// @param [Out] out_resource
 			///		The output resource
 			///
-			void CreatePNGImageFromFile(ChilliSource::StorageLocation storageLocation, const std::string& filepath, const ChilliSource::ResourceProvider::AsyncLoadDelegate& delegate, const ChilliSource::ResourceSPtr& out_resource)
+			void CreatePNGImageFromFile(ChilliSource::StorageLocation storageLocation, const std::string& filepath, const ChilliSource::IResourceOptionsBaseCSPtr& options, const ChilliSource::ResourceProvider::AsyncLoadDelegate& delegate, const ChilliSource::ResourceSPtr& out_resource)
 			{
+				CS_PROFILE_SCOPE("PNGImageProvider::CreatePNGImageFromFile");
+				
 				ChilliSource::Image* imageResource = (ChilliSource::Image*)(out_resource.get());
 
 				//load the png image
+				auto preferredFormat = ChilliSource::ImageFormat::k_RGBA8888;
+				if (options != nullptr)
+				{
+					preferredFormat = static_cast<const ChilliSource::ImageResourceOptions*>(options.get())->GetPreferredFormat();
+				}
+
 				PngImage image;
-				image.Load(storageLocation, filepath);
+				image.Load(storageLocation, filepath, preferredFormat);
 
 				//check the image has loaded
 				if (image.IsLoaded() == false)
@@ -125,7 +137,7 @@ namespace CSBackend
 		//---------------------------------------------------------------------------------
 		void PNGImageProvider::CreateResourceFromFile(ChilliSource::StorageLocation storageLocation, const std::string& filepath, const ChilliSource::IResourceOptionsBaseCSPtr& options, const ChilliSource::ResourceSPtr& out_resource)
 		{
-			CreatePNGImageFromFile(storageLocation, filepath, nullptr, out_resource);
+			CreatePNGImageFromFile(storageLocation, filepath, options, nullptr, out_resource);
 		}
 
 		//---------------------------------------------------------------------------------
@@ -133,7 +145,7 @@ namespace CSBackend
 		{
 			ChilliSource::Application::Get()->GetTaskScheduler()->ScheduleTask(ChilliSource::TaskType::k_file, [=](const ChilliSource::TaskContext&)
 			{
-				CreatePNGImageFromFile(storageLocation, filePath, delegate, out_resource);
+				CreatePNGImageFromFile(storageLocation, filePath, options, delegate, out_resource);
 			});
 		}
 	}
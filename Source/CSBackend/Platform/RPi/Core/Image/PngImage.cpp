@@ -29,6 +29,7 @@
 #include <png/png.h>
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Image/ImageFormat.h>
+#include <ChilliSource/Core/Image/ImageFormatConverter.h>
 
 /// A replacement for the default libPng file reading function. This is needed so
 /// the c style file io functions can be replaced with ChilliSource functions,
@@ -84,7 +85,7 @@ namespace CSBackend
 		}
 
 		//---------------------------------------------------------------------------------
-		void PngImage::Load(ChilliSource::StorageLocation location, const std::string& filePath)
+		void PngImage::Load(ChilliSource::StorageLocation location, const std::string& filePath, ChilliSource::ImageFormat preferredFormat)
 		{
 			//create the file stream
 			auto stream = ChilliSource::Application::Get()->GetFileSystem()->CreateBinaryInputStream(location, filePath);
@@ -96,7 +97,7 @@ namespace CSBackend
 			}
 
 			//load from lib png
-			if (LoadWithLibPng(stream) == true)
+			if (LoadWithLibPng(stream, preferredFormat) == true)
 			{
 				mbIsLoaded = true;
 			}
@@ -153,7 +154,7 @@ namespace CSBackend
 		}
 
 		//---------------------------------------------------------------------------------
-		bool PngImage::LoadWithLibPng(const ChilliSource::IBinaryInputStreamUPtr& stream)
+		bool PngImage::LoadWithLibPng(const ChilliSource::IBinaryInputStreamUPtr& stream, ChilliSource::ImageFormat preferredFormat)
 		{
 			//insure that it is indeed a png
 			const s32 dwHeaderSize = 8;
@@ -183,11 +184,22 @@ namespace CSBackend
 				return false;
 			}
 
+			//buffers used while converting during decode. They are allocated with png_malloc() after
+			//the jump is setup, so they are volatile to keep their values valid when libpng reports an
+			//error and jumps back.
+			png_bytep volatile rowBuffer = nullptr;
+			png_bytep volatile decodedBuffer = nullptr;
+
 			//setup jump
 			if (setjmp(png_jmpbuf(pPng)))
 			{
 				CS_LOG_ERROR("Error while loading PNG.");
+				png_free(pPng, rowBuffer);
+				png_free(pPng, decodedBuffer);
 				png_destroy_read_struct(&pPng, &pInfo, (png_infopp)nullptr);
+
+				delete[] mpData;
+				mpData = nullptr;
 				return false;
 			}
 
@@ -240,27 +252,8 @@ namespace CSBackend
 			//after all these transformations, update the png info
 			png_read_update_info(pPng, pInfo);
 
-			//read the image into the data buffer
-			s32 dwRowBytes = s32(png_get_rowbytes(pPng, pInfo));
-			m_dataSize = dwRowBytes * udwHeight;
-			mpData = new u8[m_dataSize];
-
-			for (s32 pass = 0; pass < number_of_passes; pass++)
-			{
-				for (u32 y = 0; y < udwHeight; y += 1)
-				{
-					png_bytep row = (mpData + y * dwRowBytes);
-					png_read_rows(pPng, &row, nullptr, 1);
-				}
-			}
-
-			//store the width and height
-			mdwWidth = (s32)udwWidth;
-			mdwHeight = (s32)udwHeight;
-
 			//-------- Get the image format
-			png_get_IHDR(pPng, pInfo, &udwWidth, &udwHeight, &dwBitDepth, &dwColorType, &dwInterlaceType, &dwCompressionMethod, &dwFilterMethod);
-			switch (dwColorType)
+			switch (png_get_color_type(pPng, pInfo))
 			{
 			case PNG_COLOR_TYPE_GRAY:
 				m_format = ChilliSource::ImageFormat::k_Lum8;
@@ -276,12 +269,70 @@ namespace CSBackend
 				break;
 			default:
 				CS_LOG_ERROR("Trying to load a PNG with an unknown colour format!");
-				png_read_end(pPng, nullptr);
 				png_destroy_read_struct(&pPng, &pInfo, (png_infopp)nullptr);
 				return false;
-				break;
 			}
 
+			//read the image into the data buffer
+			s32 dwRowBytes = s32(png_get_rowbytes(pPng, pInfo));
+			if (m_format == ChilliSource::ImageFormat::k_RGBA8888 && preferredFormat != ChilliSource::ImageFormat::k_RGBA8888)
+			{
+				//convert to the preferred format while decoding. Non-interlaced images are converted a row
+				//at a time, interlaced images need every pass to complete so are converted afterwards.
+				u32 dwOutputRowBytes = udwWidth * ChilliSource::ImageFormatConverter::GetBytesPerPixel(preferredFormat);
+				m_dataSize = dwOutputRowBytes * udwHeight;
+				mpData = new u8[m_dataSize];
+
+				if (number_of_passes == 1)
+				{
+					rowBuffer = png_bytep(png_malloc(pPng, png_alloc_size_t(dwRowBytes)));
+					png_bytep row = rowBuffer;
+					for (u32 y = 0; y < udwHeight; y += 1)
+					{
+						png_read_rows(pPng, &row, nullptr, 1);
+						ChilliSource::ImageFormatConverter::ConvertRGBA8888(row, udwWidth, preferredFormat, mpData + y * dwOutputRowBytes);
+					}
+					png_free(pPng, rowBuffer);
+					rowBuffer = nullptr;
+				}
+				else
+				{
+					decodedBuffer = png_bytep(png_malloc(pPng, png_alloc_size_t(dwRowBytes) * udwHeight));
+					u8* pDecoded = decodedBuffer;
+					for (s32 pass = 0; pass < number_of_passes; pass++)
+					{
+						for (u32 y = 0; y < udwHeight; y += 1)
+						{
+							png_bytep row = (pDecoded + y * dwRowBytes);
+							png_read_rows(pPng, &row, nullptr, 1);
+						}
+					}
+					ChilliSource::ImageFormatConverter::ConvertRGBA8888(pDecoded, udwWidth * udwHeight, preferredFormat, mpData);
+					png_free(pPng, decodedBuffer);
+					decodedBuffer = nullptr;
+				}
+
+				m_format = preferredFormat;
+			}
+			else
+			{
+				m_dataSize = dwRowBytes * udwHeight;
+				mpData = new u8[m_dataSize];
+
+				for (s32 pass = 0; pass < number_of_passes; pass++)
+				{
+					for (u32 y = 0; y < udwHeight; y += 1)
+					{
+						png_bytep row = (mpData + y * dwRowBytes);
+						png_read_rows(pPng, &row, nullptr, 1);
+					}
+				}
+			}
+
+			//store the width and height
+			mdwWidth = (s32)udwWidth;
+			mdwHeight = (s32)udwHeight;
+
 			//end the read
 			png_read_end(pPng, nullptr);
 
@@ -29,6 +29,7 @@
 
 #include <CSBackend/Platform/RPi/ForwardDeclarations.h>
 #include <ChilliSource/Core/File/FileSystem.h>
+#include <ChilliSource/Core/Image/ImageFormat.h>
 
 namespace CSBackend
 {
@@ -55,14 +56,17 @@ namespace CSBackend
 			///
 			~PngImage();
 
-			/// Loads the image
+			/// Loads the image. If the image decodes to RGBA8888 and a different
+			/// format is requested then each row is converted as it is decoded.
 			///
 			/// @param location
 			///		Location to load from
 			/// @param filePath
 			///		File path to load from
+			/// @param preferredFormat
+			///		(Optional) The format RGBA8888 images should be converted to.
 			///
-			void Load(ChilliSource::StorageLocation location, const std::string& filePath);
+			void Load(ChilliSource::StorageLocation location, const std::string& filePath, ChilliSource::ImageFormat preferredFormat = ChilliSource::ImageFormat::k_RGBA8888);
 
 			/// Destroy the image data. If the data has already been destroyed then pass
 			/// false to reset.
@@ -100,10 +104,12 @@ namespace CSBackend
 			/// Load with lib png
 			/// @param stream
 			///		The stream lib png should use to read the data.
+			/// @param preferredFormat
+			///		The format RGBA8888 images should be converted to.
 			///
 			/// @return TRUE if successful
 			///
-			bool LoadWithLibPng(const ChilliSource::IBinaryInputStreamUPtr& stream);
+			bool LoadWithLibPng(const ChilliSource::IBinaryInputStreamUPtr& stream, ChilliSource::ImageFormat preferredFormat);
 
 			bool mbIsLoaded;
 			s32 mdwHeight;
@@ -54,6 +54,7 @@ namespace CSBackend
 		//------------------------------------------------------
 		/// Networking
 		//------------------------------------------------------
+		CS_FORWARDDECLARE_CLASS(CurlHttpEngine);
 		CS_FORWARDDECLARE_CLASS(HttpRequest);
 		CS_FORWARDDECLARE_CLASS(HttpRequestSystem);
 	}
@@ -0,0 +1,198 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifdef CS_TARGETPLATFORM_RPI
+
+#include <CSBackend/Platform/RPi/Networking/Http/CurlHttpEngine.h>
+
+#include <CSBackend/Platform/RPi/Networking/Http/HttpRequest.h>
+
+#include <algorithm>
+#include <chrono>
+
+namespace CSBackend
+{
+	namespace RPi
+	{
+		namespace
+		{
+			// curl_multi_wakeup() is only available from curl 7.68.0. Prior to that the engine thread
+			// instead wakes at this interval to pick up newly added requests.
+			constexpr int k_maxWaitMS = 50;
+		}
+
+		//------------------------------------------------------------------
+		CurlHttpEngine::CurlHttpEngine() noexcept
+			: m_maxConnectionsPerHost(0)
+		{
+			m_curlMulti = curl_multi_init();
+			CS_ASSERT(m_curlMulti, "Failed to create curl multi handle.");
+
+#ifdef CURLPIPE_MULTIPLEX
+			curl_multi_setopt(m_curlMulti, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+#endif
+
+			m_thread = std::thread(&CurlHttpEngine::ProcessTransfers, this);
+		}
+
+		//------------------------------------------------------------------
+		void CurlHttpEngine::AddRequest(HttpRequest* request) noexcept
+		{
+			CS_ASSERT(request, "Cannot add a null request.");
+
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_pendingRequests.push_back(request);
+			lock.unlock();
+
+			m_condition.notify_one();
+			Wake();
+		}
+
+		//------------------------------------------------------------------
+		void CurlHttpEngine::SetMaxConnectionsPerHost(u32 maxConnectionsPerHost) noexcept
+		{
+			m_maxConnectionsPerHost = maxConnectionsPerHost;
+		}
+
+		//------------------------------------------------------------------
+		void CurlHttpEngine::ProcessTransfers() noexcept
+		{
+			std::vector<HttpRequest*> activeRequests;
+			std::vector<HttpRequest*> newRequests;
+			u32 appliedMaxConnectionsPerHost = 0;
+
+			while (true)
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				if (activeRequests.empty())
+				{
+					m_condition.wait(lock, [this]() { return m_isStopping || m_pendingRequests.empty() == false; });
+				}
+
+				if (m_isStopping)
+				{
+					break;
+				}
+
+				newRequests.swap(m_pendingRequests);
+				lock.unlock();
+
+				u32 maxConnectionsPerHost = m_maxConnectionsPerHost;
+				if (maxConnectionsPerHost != appliedMaxConnectionsPerHost)
+				{
+					curl_multi_setopt(m_curlMulti, CURLMOPT_MAX_HOST_CONNECTIONS, long(maxConnectionsPerHost));
+					appliedMaxConnectionsPerHost = maxConnectionsPerHost;
+				}
+
+				for (auto request : newRequests)
+				{
+					curl_multi_add_handle(m_curlMulti, request->m_curl);
+					activeRequests.push_back(request);
+				}
+				newRequests.clear();
+
+				int numRunning = 0;
+				curl_multi_perform(m_curlMulti, &numRunning);
+
+				int numMessages = 0;
+				while (CURLMsg* message = curl_multi_info_read(m_curlMulti, &numMessages))
+				{
+					if (message->msg == CURLMSG_DONE)
+					{
+						CURL* curl = message->easy_handle;
+						CURLcode result = message->data.result;
+
+						HttpRequest* request = nullptr;
+						curl_easy_getinfo(curl, CURLINFO_PRIVATE, reinterpret_cast<char**>(&request));
+						CS_ASSERT(request, "Completed transfer has no request.");
+
+						curl_multi_remove_handle(m_curlMulti, curl);
+						activeRequests.erase(std::remove(activeRequests.begin(), activeRequests.end(), request), activeRequests.end());
+
+						request->OnTransferComplete(result);
+					}
+				}
+
+				if (activeRequests.empty() == false)
+				{
+#if LIBCURL_VERSION_NUM >= 0x074400
+					curl_multi_poll(m_curlMulti, nullptr, 0, k_maxWaitMS, nullptr);
+#else
+					// curl_multi_wait() returns immediately when curl has no sockets to wait on, for example
+					// while resolving a host or backing off before a reconnect. Sleep until curl's own timeout
+					// instead of spinning, while still waking for new requests.
+					int numFds = 0;
+					curl_multi_wait(m_curlMulti, nullptr, 0, k_maxWaitMS, &numFds);
+					if (numFds == 0)
+					{
+						long timeoutMS = -1;
+						curl_multi_timeout(m_curlMulti, &timeoutMS);
+						if (timeoutMS < 0 || timeoutMS > k_maxWaitMS)
+						{
+							timeoutMS = k_maxWaitMS;
+						}
+
+						if (timeoutMS > 0)
+						{
+							std::unique_lock<std::mutex> waitLock(m_mutex);
+							m_condition.wait_for(waitLock, std::chrono::milliseconds(timeoutMS), [this]() { return m_isStopping || m_pendingRequests.empty() == false; });
+						}
+					}
+#endif
+				}
+			}
+
+			for (auto request : activeRequests)
+			{
+				curl_multi_remove_handle(m_curlMulti, request->m_curl);
+			}
+		}
+
+		//------------------------------------------------------------------
+		void CurlHttpEngine::Wake() noexcept
+		{
+#if LIBCURL_VERSION_NUM >= 0x074400
+			curl_multi_wakeup(m_curlMulti);
+#endif
+		}
+
+		//------------------------------------------------------------------
+		CurlHttpEngine::~CurlHttpEngine() noexcept
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_isStopping = true;
+			lock.unlock();
+
+			m_condition.notify_one();
+			Wake();
+
+			m_thread.join();
+
+			curl_multi_cleanup(m_curlMulti);
+		}
+	}
+}
+
+#endif
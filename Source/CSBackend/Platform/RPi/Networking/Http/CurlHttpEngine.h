@@ -0,0 +1,111 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifdef CS_TARGETPLATFORM_RPI
+
+#ifndef _CSBACKEND_PLATFORM_RPI_HTTP_CURLHTTPENGINE_H_
+#define _CSBACKEND_PLATFORM_RPI_HTTP_CURLHTTPENGINE_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <CSBackend/Platform/RPi/ForwardDeclarations.h>
+
+#include <curl/curl.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace CSBackend
+{
+	namespace RPi
+	{
+		/// Performs http requests using the curl multi interface. All transfers are run on a single
+		/// dedicated thread which waits on the sockets of every active transfer at once, rather than
+		/// blocking a background task per request. As every transfer shares the multi handle they
+		/// also share its connection cache, so connections to the same host are kept alive and reused.
+		///
+		/// This is thread-safe.
+		///
+		class CurlHttpEngine final
+		{
+		public:
+			CS_DECLARE_NOCOPY(CurlHttpEngine);
+
+			/// Creates the curl multi handle and starts the engine thread. curl_global_init() must
+			/// have been called prior to this.
+			///
+			CurlHttpEngine() noexcept;
+
+			/// Queues the given request to be started on the engine thread. The request must remain
+			/// alive until it has completed or the engine has been destroyed.
+			///
+			/// @param request
+			///		The request to perform.
+			///
+			void AddRequest(HttpRequest* request) noexcept;
+
+			/// Sets the maximum number of connections that will be opened to a single host at once.
+			/// Any further requests to that host are queued until a connection becomes free.
+			///
+			/// @param maxConnectionsPerHost
+			///		The maximum number of connections per host. 0 is unlimited.
+			///
+			void SetMaxConnectionsPerHost(u32 maxConnectionsPerHost) noexcept;
+
+			/// Aborts all active transfers and stops the engine thread. Once this returns the engine
+			/// will no longer touch any of the requests it was given.
+			///
+			~CurlHttpEngine() noexcept;
+
+		private:
+			/// The entry point of the engine thread. Starts newly added transfers, drives all active
+			/// transfers, and notifies requests as they complete. Sleeps while there are no active
+			/// transfers.
+			///
+			void ProcessTransfers() noexcept;
+
+			/// Wakes the engine thread if it is currently waiting on transfer sockets.
+			///
+			void Wake() noexcept;
+
+			CURLM* m_curlMulti = nullptr;
+
+			std::mutex m_mutex;
+			std::condition_variable m_condition;
+			std::vector<HttpRequest*> m_pendingRequests;
+			bool m_isStopping = false;
+
+			std::atomic<u32> m_maxConnectionsPerHost;
+
+			std::thread m_thread;
+		};
+	}
+}
+
+#endif
+
+#endif
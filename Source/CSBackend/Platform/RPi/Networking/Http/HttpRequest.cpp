@@ -33,14 +33,13 @@
 #include <ChilliSource/Core/String/StringParser.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 
+#include <algorithm>
+#include <memory>
+
 namespace CSBackend
 {
 	namespace RPi
 	{
-		std::list<std::shared_ptr<std::mutex>> HttpRequest::s_destroyingMutexes;
-		std::mutex HttpRequest::s_addingMutexesMutex;
-		bool HttpRequest::s_isDestroying = false;
-
 		/// Callback function used by curl to write data into our response buffer.
 		/// Needs access to private method of HttpRequest so is a friend function
 		///
@@ -57,8 +56,8 @@ namespace CSBackend
 		///
 		std::size_t CurlWriteResponseData(void* data, std::size_t size, std::size_t num, HttpRequest* request) noexcept
 		{
-			// If destroying then just abort
-			if (HttpRequest::s_isDestroying == true || request->m_isRequestCancelled == true)
+			// If cancelled then just abort
+			if (request->m_isRequestCancelled == true)
 				return 0;
 
 			std::size_t writeSize = size * num;
@@ -66,6 +65,20 @@ namespace CSBackend
 			return writeSize;
 		}
 
+		/// Callback function used by curl to report the progress of a transfer. This is used to abort
+		/// cancelled requests promptly, even if no data is currently being received.
+		/// Needs access to private members of HttpRequest so is a friend function
+		///
+		/// @param request
+		///		The request being performed
+		///
+		/// @return Non-zero if the transfer should be aborted.
+		///
+		int CurlTransferProgress(HttpRequest* request, curl_off_t, curl_off_t, curl_off_t, curl_off_t) noexcept
+		{
+			return request->m_isRequestCancelled == true ? 1 : 0;
+		}
+
 		namespace
 		{
 			/// Convert our internal header storage into curl header storage. The curl headers
@@ -92,15 +105,19 @@ namespace CSBackend
 
 		//------------------------------------------------------------------
 		HttpRequest::HttpRequest(Type type, std::string url, std::string body, ChilliSource::ParamDictionary headers, u32 timeoutSecs, CURL* curl, u32 bufferFlushSize, Delegate delegate) noexcept
-		: m_url(std::move(url)), m_type(type), m_headers(std::move(headers)), m_body(std::move(body)), m_bufferFlushSize(bufferFlushSize), m_completionDelegate(std::move(delegate)), m_flushesPending(0), m_curl(curl)
+		: m_url(std::move(url)), m_type(type), m_headers(std::move(headers)), m_body(std::move(body)), m_bufferFlushSize(bufferFlushSize), m_completionDelegate(std::move(delegate)), m_flushesPending(0), m_curl(curl),
+		  m_isPollingComplete(false), m_isRequestCancelled(false)
 		{
 			CS_ASSERT(m_completionDelegate, "Http request cannot have null delegate");
 
-			auto destroyingMutex = std::make_shared<std::mutex>();
-			std::unique_lock<std::mutex> lock(s_addingMutexesMutex);
-			s_destroyingMutexes.push_back(destroyingMutex);
-			lock.unlock();
+			m_taskScheduler = ChilliSource::Application::Get()->GetTaskScheduler();
 
+			curl_easy_setopt(curl, CURLOPT_PRIVATE, this);
+			curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+			curl_easy_setopt(curl, CURLOPT_TCP_KEEPALIVE, 1L);
+			curl_easy_setopt(curl, CURLOPT_NOPROGRESS, 0L);
+			curl_easy_setopt(curl, CURLOPT_XFERINFOFUNCTION, CurlTransferProgress);
+			curl_easy_setopt(curl, CURLOPT_XFERINFODATA, this);
 			curl_easy_setopt(curl, CURLOPT_URL, m_url.c_str());
 			curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
 			curl_easy_setopt(curl, CURLOPT_TIMEOUT, timeoutSecs);
@@ -125,13 +142,6 @@ namespace CSBackend
 				curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, m_body.size());
 				curl_easy_setopt(curl, CURLOPT_POSTFIELDS, m_body.c_str());
 			}
-
-			//TODO: This should probably be handled by a HTTP system specific thread, like the other platforms.
-			m_taskScheduler = ChilliSource::Application::Get()->GetTaskScheduler();
-			m_taskScheduler->ScheduleTask(ChilliSource::TaskType::k_large, [=](const ChilliSource::TaskContext&)
-			{
-				PerformRequest(destroyingMutex);
-			});
 		}
 
 		//------------------------------------------------------------------
@@ -144,24 +154,15 @@ namespace CSBackend
 
 				if (m_isRequestCancelled == false)
 				{
-					m_completionDelegate(this, ChilliSource::HttpResponse(m_requestResult, m_responseCode, m_responseData));
+					ChilliSource::HttpResponse response(m_requestResult, m_responseCode, std::move(m_responseData));
+					m_completionDelegate(this, response);
 				}
 			}
 		}
 
 		//------------------------------------------------------------------
-		void HttpRequest::PerformRequest(std::shared_ptr<std::mutex> destroyingMutex) noexcept
+		void HttpRequest::OnTransferComplete(CURLcode curlResult) noexcept
 		{
-			std::unique_lock<std::mutex> lock(*destroyingMutex);
-
-			if (s_isDestroying == true)
-				return;
-
-			lock.unlock();
-
-			//Blocking call. Will call into the write callback which is responsible for reading the response data into the output buffer.
-			CURLcode curlResult = curl_easy_perform(m_curl);
-
 			//Fetch the response code
 			long httpCode = 0;
 			curl_easy_getinfo (m_curl, CURLINFO_RESPONSE_CODE, &httpCode);
@@ -173,18 +174,12 @@ namespace CSBackend
 				m_curlHeaders = nullptr;
 			}
 
-			lock.lock();
-
-			if (s_isDestroying == true)
-				return;
-
 			switch(curlResult)
 			{
 				case CURLE_OK:
 					m_requestResult = ChilliSource::HttpResponse::Result::k_completed;
-					m_responseData = m_streamBuffer.str();
-					m_streamBuffer.clear();
-					m_streamBuffer.str("");
+					m_responseData = std::move(m_responseBuffer);
+					m_responseBuffer.clear();
 					break;
 				case CURLE_OPERATION_TIMEDOUT:
 					m_requestResult = ChilliSource::HttpResponse::Result::k_timeout;
@@ -206,28 +201,45 @@ namespace CSBackend
 			{
 				double contentLength = 0;
 				curl_easy_getinfo(m_curl, CURLINFO_CONTENT_LENGTH_DOWNLOAD, &contentLength);
-				m_expectedSize = (u32)contentLength;
+				m_expectedSize = (contentLength > 0.0) ? u64(contentLength) : 0;
 			}
 
-			m_streamBuffer.write(data, dataSize);
+			//The response code is also known by now, so it can be reported along with any flushed data
+			if(m_responseCode == 0)
+			{
+				long httpCode = 0;
+				curl_easy_getinfo(m_curl, CURLINFO_RESPONSE_CODE, &httpCode);
+				m_responseCode = (u32)httpCode;
+			}
+
+			//Reserve the full response up front where possible to avoid reallocating as data arrives
+			if(m_responseBuffer.empty())
+			{
+				u64 reserveSize = (m_bufferFlushSize != 0) ? std::min(m_expectedSize, u64(m_bufferFlushSize) + CURL_MAX_WRITE_SIZE) : m_expectedSize;
+				m_responseBuffer.reserve(std::max(u64(dataSize), reserveSize));
+			}
+
+			m_responseBuffer.append(data, dataSize);
 			m_totalBytesRead += dataSize;
-			m_totalBytesReadThisBlock += dataSize;
 
-			if (m_bufferFlushSize != 0 && m_totalBytesReadThisBlock >= m_bufferFlushSize)
+			if (m_bufferFlushSize != 0 && m_responseBuffer.size() >= m_bufferFlushSize)
 			{
-				m_responseData = m_streamBuffer.str();
-				m_requestResult = ChilliSource::HttpResponse::Result::k_flushed;
+				//The flushed data is moved to the main thread so later writes can't overwrite it before it is delivered
+				auto flushedData = std::make_shared<std::string>(std::move(m_responseBuffer));
+				m_responseBuffer.clear();
+				u32 responseCode = m_responseCode;
 
 				++m_flushesPending;
-				m_taskScheduler->ScheduleTask(ChilliSource::TaskType::k_mainThread, [=](const ChilliSource::TaskContext&)
+				m_taskScheduler->ScheduleTask(ChilliSource::TaskType::k_mainThread, [=](const ChilliSource::TaskContext&) noexcept
 				{
 					--m_flushesPending;
-					m_completionDelegate(this, ChilliSource::HttpResponse(m_requestResult, m_responseCode, m_responseData));
-				});
 
-				m_streamBuffer.clear();
-				m_streamBuffer.str("");
-				m_totalBytesReadThisBlock = 0;
+					if (m_isRequestCancelled == false)
+					{
+						ChilliSource::HttpResponse response(ChilliSource::HttpResponse::Result::k_flushed, responseCode, std::move(*flushedData));
+						m_completionDelegate(this, response);
+					}
+				});
 			}
 		}
 
@@ -236,22 +248,6 @@ namespace CSBackend
 		{
 			m_isRequestCancelled = true;
 		}
-
-		//----------------------------------------------------------------------------------------
-		void HttpRequest::Shutdown() noexcept
-		{
-			std::unique_lock<std::mutex> mutexLock(s_addingMutexesMutex);
-
-			std::vector<std::unique_lock<std::mutex>> locks;
-			locks.reserve(s_destroyingMutexes.size());
-
-			for (auto& mutex : s_destroyingMutexes)
-			{
-				locks.push_back(std::unique_lock<std::mutex>(*mutex));
-			}
-
-			s_isDestroying = true;
-		}
 	}
 }
 
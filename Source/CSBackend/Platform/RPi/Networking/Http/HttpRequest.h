@@ -35,16 +35,14 @@
 #include <curl/curl.h>
 
 #include <atomic>
-#include <list>
-#include <mutex>
-#include <sstream>
+#include <string>
 
 namespace CSBackend
 {
 	namespace RPi
 	{
 		/// Concerete implementation of the Raspberry Pi http request using curl library. Requests are
-		/// threaded to avoid blocking the main thread
+		/// performed by the CurlHttpEngine on its own thread to avoid blocking the main thread
 		///
 		class HttpRequest final : public ChilliSource::HttpRequest
 		{
@@ -80,8 +78,10 @@ namespace CSBackend
 			u64 GetDownloadedBytes() const noexcept override { return m_totalBytesRead; }
 
 		private:
+			friend class CurlHttpEngine;
 			friend class HttpRequestSystem;
 			friend std::size_t CurlWriteResponseData(void*, std::size_t, std::size_t, HttpRequest*) noexcept;
+			friend int CurlTransferProgress(HttpRequest*, curl_off_t, curl_off_t, curl_off_t, curl_off_t) noexcept;
 
 			/// @param type
 			///		POST or GET
@@ -94,7 +94,7 @@ namespace CSBackend
 			/// @param timeoutSecs
 			///		Request timeout in seconds
 			/// @param curl
-			///		Curl instance on which to set options and perform the request (passed in so it can be reused for other requests)
+			///		Curl instance on which to set options. The request is performed once it is added to the CurlHttpEngine.
 			/// @param bufferFlushSize
 			///		Max size before the response buffer is flushed to the application
 			/// @param delegate
@@ -102,14 +102,13 @@ namespace CSBackend
 			///
 			HttpRequest(Type type, std::string url, std::string body, ChilliSource::ParamDictionary headers, u32 timeoutSecs, CURL* curl, u32 bufferFlushSize, Delegate delegate) noexcept;
 
-			/// Run on a background thread this function uses a pre-setup curl object to make an http request.
-			/// It will store the response state and then terminate once finished. The completion event
-			/// will be fired on the next update
+			/// Called on the CurlHttpEngine thread once the transfer has finished. This stores the
+			/// response state, and the completion event will be fired on the next update.
 			///
-			/// @param destroyingMutex
-			///		Mutex that manages the critical section of the HTTP system being shutdown
+			/// @param curlResult
+			///		The result of the transfer.
 			///
-			void PerformRequest(std::shared_ptr<std::mutex> destroyingMutex) noexcept;
+			void OnTransferComplete(CURLcode curlResult) noexcept;
 
 			/// Called via curl with response data (partial or full). We then write
 			/// to our response buffer and flush if we exceed the max buffer size
@@ -132,16 +131,8 @@ namespace CSBackend
 			///
 			bool HasCompleted() const noexcept { return m_isRequestComplete; }
 
-			/// Inform the polling threads in a thread-safe manner that the system is shutting down
-			///
-			static void Shutdown() noexcept;
-
 		private:
 
-			static std::mutex s_addingMutexesMutex;
-			static std::list<std::shared_ptr<std::mutex>> s_destroyingMutexes;
-			static bool s_isDestroying;
-
 			const Type m_type;
 			const std::string m_url;
 			const std::string m_body;
@@ -154,16 +145,15 @@ namespace CSBackend
 			ChilliSource::HttpResponse::Result m_requestResult = ChilliSource::HttpResponse::Result::k_failed;
 
 			u64 m_totalBytesRead = 0;
-			u64 m_totalBytesReadThisBlock = 0;
 			u64 m_expectedSize = 0;
 
-			std::stringstream m_streamBuffer;
+			std::string m_responseBuffer;
 			CURL* m_curl;
 			curl_slist* m_curlHeaders = nullptr;
 
-			bool m_isPollingComplete = false;
+			std::atomic<bool> m_isPollingComplete;
 			bool m_isRequestComplete = false;
-			bool m_isRequestCancelled = false;
+			std::atomic<bool> m_isRequestCancelled;
 
 			std::atomic_int m_flushesPending;
 
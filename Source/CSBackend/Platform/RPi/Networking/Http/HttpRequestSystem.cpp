@@ -41,6 +41,8 @@ namespace CSBackend
 		void HttpRequestSystem::OnInit() noexcept
 		{
 			curl_global_init(CURL_GLOBAL_SSL);
+
+			m_engine = std::unique_ptr<CurlHttpEngine>(new CurlHttpEngine());
 		}
 
 		//--------------------------------------------------------------------------------------------------
@@ -80,11 +82,14 @@ namespace CSBackend
 			CS_ASSERT(delegate != nullptr, "Cannot make an http request with a null delegate");
 			CS_ASSERT(url.empty() == false, "Cannot make an http request to a blank url");
 
-			//TODO: Persistent connections. Don't close the connection but instead check if the next request is to the same server
-			//and reuse it. If not then close the connection and open a new one
+			//Connections are owned by the engine's multi handle rather than the easy handle, so are kept alive and reused
+			//between requests to the same host.
 			auto curl = curl_easy_init();
 			HttpRequest* httpRequest = new HttpRequest(type, url, body, headers, timeoutSecs, curl, GetMaxBufferSize(), delegate);
 			m_requests.push_back(httpRequest);
+
+			m_engine->SetMaxConnectionsPerHost(GetMaxConnectionsPerHost());
+			m_engine->AddRequest(httpRequest);
 			return httpRequest;
 		}
 
@@ -138,7 +143,7 @@ namespace CSBackend
 		{
 			CancelAllRequests();
 
-			HttpRequest::Shutdown();
+			m_engine.reset();
 
 			for (auto it = m_requests.begin(); it != m_requests.end(); ++it)
 			{
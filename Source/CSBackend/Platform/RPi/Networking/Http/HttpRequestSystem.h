@@ -28,6 +28,7 @@
 #define _CSBACKEND_PLATFORM_RPI_HTTP_HTTPREQUESTSYSTEM_H_
 
 #include <CSBackend/Platform/RPi/ForwardDeclarations.h>
+#include <CSBackend/Platform/RPi/Networking/Http/CurlHttpEngine.h>
 #include <CSBackend/Platform/RPi/Networking/Http/HttpRequest.h>
 #include <ChilliSource/Networking/Http/HttpRequestSystem.h>
 
@@ -38,7 +39,8 @@ namespace CSBackend
 	namespace RPi
 	{
 		/// Raspberry Pi implementation of the Http connection system. Responsible for making http GET and POST
-		/// requests to remote servers. Uses libCurl under the hood
+		/// requests to remote servers. Uses libCurl under the hood, with all requests multiplexed onto a
+		/// single thread by a CurlHttpEngine.
 		///
 		class HttpRequestSystem final : public ChilliSource::HttpRequestSystem
 		{
@@ -146,7 +148,7 @@ namespace CSBackend
 			///
 			HttpRequest* MakeRequest(HttpRequest::Type type, const std::string& url, const std::string& body, const ChilliSource::ParamDictionary& headers, const HttpRequest::Delegate& delegate, u32 timeoutSecs) noexcept;
 
-			/// Initialise libCurl
+			/// Initialise libCurl and start the http engine
 			///
 			void OnInit() noexcept override;
 
@@ -157,13 +159,14 @@ namespace CSBackend
 			///
 			void OnUpdate(f32 timeSinceLastUpdate) noexcept override;
 
-			/// Cleanup curl
+			/// Stop the http engine and cleanup curl
 			///
 			void OnDestroy() noexcept override;
 
 		private:
 
 			std::vector<HttpRequest*> m_requests;
+			std::unique_ptr<CurlHttpEngine> m_engine;
 		};
 	}
 }
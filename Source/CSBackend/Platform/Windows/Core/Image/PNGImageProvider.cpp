@@ -35,6 +35,7 @@
 #include <ChilliSource/Core/Image/Image.h>
 #include <ChilliSource/Core/Image/ImageCompression.h>
 #include <ChilliSource/Core/Image/ImageFormat.h>
+#include <ChilliSource/Core/Image/ImageResourceOptions.h>
 #include <ChilliSource/Core/String/StringUtils.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 
@@ -53,16 +54,23 @@ namespace CSBackend
 			///
 			/// @param The storage location.
 			/// @param The filepath.
+			/// @param The image load options. May be null.
 			/// @param Completion delegate
 			/// @param [Out] The output resource
 			//-----------------------------------------------------------
-			void CreatePNGImageFromFile(ChilliSource::StorageLocation in_storageLocation, const std::string& in_filepath, const ChilliSource::ResourceProvider::AsyncLoadDelegate& in_delegate, const ChilliSource::ResourceSPtr& out_resource)
+			void CreatePNGImageFromFile(ChilliSource::StorageLocation in_storageLocation, const std::string& in_filepath, const ChilliSource::IResourceOptionsBaseCSPtr& in_options, const ChilliSource::ResourceProvider::AsyncLoadDelegate& in_delegate, const ChilliSource::ResourceSPtr& out_resource)
 			{
 				ChilliSource::Image* imageResource = (ChilliSource::Image*)(out_resource.get());
 
 				//load the png image
+				auto preferredFormat = ChilliSource::ImageFormat::k_RGBA8888;
+				if (in_options != nullptr)
+				{
+					preferredFormat = static_cast<const ChilliSource::ImageResourceOptions*>(in_options.get())->GetPreferredFormat();
+				}
+
 				PngImage image;
-				image.Load(in_storageLocation, in_filepath);
+				image.Load(in_storageLocation, in_filepath, preferredFormat);
 
 				//check the image has loaded
 				if (image.IsLoaded() == false)
@@ -125,7 +133,7 @@ namespace CSBackend
 		//----------------------------------------------------------------
 		void PNGImageProvider::CreateResourceFromFile(ChilliSource::StorageLocation in_storageLocation, const std::string& in_filepath, const ChilliSource::IResourceOptionsBaseCSPtr& in_options, const ChilliSource::ResourceSPtr& out_resource)
 		{
-			CreatePNGImageFromFile(in_storageLocation, in_filepath, nullptr, out_resource);
+			CreatePNGImageFromFile(in_storageLocation, in_filepath, in_options, nullptr, out_resource);
 		}
 		//----------------------------------------------------
 		//----------------------------------------------------
@@ -133,7 +141,7 @@ namespace CSBackend
 		{
 			ChilliSource::Application::Get()->GetTaskScheduler()->ScheduleTask(ChilliSource::TaskType::k_file, [=](const ChilliSource::TaskContext&)
 			{
-				CreatePNGImageFromFile(in_storageLocation, in_filePath, in_delegate, out_resource);
+				CreatePNGImageFromFile(in_storageLocation, in_filePath, in_options, in_delegate, out_resource);
 			});
 		}
 	}
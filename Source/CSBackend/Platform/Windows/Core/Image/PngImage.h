@@ -33,6 +33,7 @@
 
 #include <CSBackend/Platform/Windows/ForwardDeclarations.h>
 #include <ChilliSource/Core/File/FileSystem.h>
+#include <ChilliSource/Core/Image/ImageFormat.h>
 
 namespace CSBackend
 {
@@ -60,8 +61,10 @@ namespace CSBackend
 			/// @param Storgae location of the file
 			/// @param std::string instrFilename - the path to the file relative to either
 			///									   documents or the package.
+			/// @param (Optional) The format RGBA8888 images should be converted to. Each
+			/// row is converted as it is decoded.
 			//----------------------------------------------------------------------------------
-			void Load(ChilliSource::StorageLocation ineLocation, const std::string& instrFilename);
+			void Load(ChilliSource::StorageLocation ineLocation, const std::string& instrFilename, ChilliSource::ImageFormat inePreferredFormat = ChilliSource::ImageFormat::k_RGBA8888);
 			//----------------------------------------------------------------------------------
 			/// Release
 			///
@@ -111,8 +114,9 @@ namespace CSBackend
 			///
 			/// Loads the png data using lib png
 			/// @param FileStreamSPtr inStream - the stream lib png should use to read the data.
+			/// @param The format RGBA8888 images should be converted to.
 			//----------------------------------------------------------------------------------
-			bool LoadWithLibPng(const ChilliSource::IBinaryInputStreamUPtr& inStream);
+			bool LoadWithLibPng(const ChilliSource::IBinaryInputStreamUPtr& inStream, ChilliSource::ImageFormat inePreferredFormat);
 
 			bool mbIsLoaded;
 			s32 mdwHeight;
@@ -40,7 +40,7 @@
 
 #include <Windows.h>
 #include <winhttp.h>
-#include <sstream>
+#include <memory>
 
 #pragma comment(lib, "winhttp")
 
@@ -56,6 +56,27 @@ namespace CSBackend
 		{
 			const u32 k_readBufferSize = 1024 * 50;
 
+			//-------------------------------------------------------------------
+			/// Calculates how much of the response buffer should be reserved
+			/// so that it won't be reallocated as data is read into it.
+			///
+			/// @param The number of bytes of the response which are still to
+			/// be read, or 0 if unknown.
+			/// @param Max buffer size before flush required (0 is unlimited)
+			///
+			/// @return The number of bytes to reserve.
+			//-------------------------------------------------------------------
+			u64 CalcResponseBufferReserveSize(u64 in_remainingSize, u32 in_bufferFlushSize)
+			{
+				u64 maxBlockSize = u64(in_bufferFlushSize) + k_readBufferSize;
+				if (in_bufferFlushSize != 0 && (in_remainingSize == 0 || in_remainingSize > maxBlockSize))
+				{
+					return maxBlockSize;
+				}
+
+				return in_remainingSize;
+			}
+
 			//-------------------------------------------------------------------
 			/// Split the WinHTTP blob header into key values
 			///
@@ -194,7 +215,8 @@ namespace CSBackend
 
 				if (m_isRequestCancelled == false)
 				{
-					m_completionDelegate(this, ChilliSource::HttpResponse(m_requestResult, m_responseCode, m_responseData));
+					ChilliSource::HttpResponse response(m_requestResult, m_responseCode, std::move(m_responseData));
+					m_completionDelegate(this, response);
 				}
 			}
 		}
@@ -271,6 +293,9 @@ namespace CSBackend
 			u32 responseCode = 0;
 			WinHttpQueryHeaders(in_requestHandle, WINHTTP_QUERY_STATUS_CODE | WINHTTP_QUERY_FLAG_NUMBER, nullptr, &responseCode, &headerSize, nullptr);
 			
+			//Set the response code up front so it can be reported along with any flushed data
+			m_responseCode = responseCode;
+			
 			ChilliSource::ParamDictionary headers = GetRequestHeaders(in_requestHandle);
 			std::string expectedSize;
 			headers.TryGetValue("Content-Length", expectedSize);
@@ -281,9 +306,11 @@ namespace CSBackend
 			DWORD bytesToBeRead = 0;
 			DWORD bytesRead = 0;
 			ChilliSource::HttpResponse::Result result = ChilliSource::HttpResponse::Result::k_failed;
-			u32 totalBytesReadThisBlock = 0;
 			s8 readBuffer[k_readBufferSize];
-			std::stringstream streamBuffer;
+
+			//Reserve the full response up front where possible to avoid reallocating as data arrives
+			std::string responseBuffer;
+			responseBuffer.reserve(CalcResponseBufferReserveSize(m_expectedSize, bufferFlushSize));
 
 			do
 			{
@@ -322,25 +349,27 @@ namespace CSBackend
 				//We have read some data
 				if (bytesRead > 0)
 				{
-					streamBuffer.write(readBuffer, bytesRead);
+					responseBuffer.append(readBuffer, bytesRead);
 					m_totalBytesRead += bytesRead;
-					totalBytesReadThisBlock += bytesRead;
 
-					if (bufferFlushSize != 0 && totalBytesReadThisBlock >= bufferFlushSize)
+					if (bufferFlushSize != 0 && responseBuffer.size() >= bufferFlushSize)
 					{
-						m_responseData = streamBuffer.str();
-						m_requestResult = ChilliSource::HttpResponse::Result::k_flushed;
+						//The flushed data is moved to the main thread so later reads can't overwrite it before it is delivered
+						auto flushedData = std::make_shared<std::string>(std::move(responseBuffer));
+						responseBuffer.clear();
+						responseBuffer.reserve(CalcResponseBufferReserveSize((m_expectedSize > m_totalBytesRead) ? m_expectedSize - m_totalBytesRead : 0, bufferFlushSize));
 
 						++m_flushesPending;
 						m_taskScheduler->ScheduleTask(ChilliSource::TaskType::k_mainThread, [=](const ChilliSource::TaskContext&)
 						{
 							--m_flushesPending;
-							m_completionDelegate(this, ChilliSource::HttpResponse(m_requestResult, m_responseCode, m_responseData));
-						});
 
-						streamBuffer.clear();
-						streamBuffer.str("");
-						totalBytesReadThisBlock = 0;
+							if (m_isRequestCancelled == false)
+							{
+								ChilliSource::HttpResponse response(ChilliSource::HttpResponse::Result::k_flushed, responseCode, std::move(*flushedData));
+								m_completionDelegate(this, response);
+							}
+						});
 					}
 				}
 
@@ -356,7 +385,7 @@ namespace CSBackend
 			m_isPollingComplete = true;
 			m_requestResult = result;
 			m_responseCode = responseCode;
-			m_responseData = streamBuffer.str();
+			m_responseData = std::move(responseBuffer);
 		}
 		//----------------------------------------------------------------------------------------
 		//----------------------------------------------------------------------------------------
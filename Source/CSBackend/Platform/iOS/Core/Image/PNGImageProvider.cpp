@@ -35,6 +35,8 @@
 #include <ChilliSource/Core/Image/Image.h>
 #include <ChilliSource/Core/Image/ImageCompression.h>
 #include <ChilliSource/Core/Image/ImageFormat.h>
+#include <ChilliSource/Core/Image/ImageFormatConverter.h>
+#include <ChilliSource/Core/Image/ImageResourceOptions.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 
 #import <UIKit/UIKit.h>
@@ -56,9 +58,10 @@ namespace CSBackend
 			/// @param Size of data in bytes
 			/// @param Whether the asset is high res
 			/// @param Image format
+			/// @param The format RGBA8888 images should be converted to
 			/// @param [Out] Image resource
             //-----------------------------------------------------------
-            void CreatePNGImageFromFile(const s8* in_data, u32 in_dataSize, ChilliSource::Image* out_image)
+            void CreatePNGImageFromFile(const s8* in_data, u32 in_dataSize, ChilliSource::ImageFormat in_preferredFormat, ChilliSource::Image* out_image)
             {
                 CFDataRef pData = CFDataCreateWithBytesNoCopy(nullptr, (u8*)in_data, in_dataSize, kCFAllocatorNull);
                 CGDataProviderRef imgDataProvider = CGDataProviderCreateWithCFData(pData);
@@ -118,6 +121,19 @@ namespace CSBackend
                 CGColorSpaceRelease(ColorSpaceInfo);
                 CGDataProviderRelease(imgDataProvider);
                 CFRelease(pData);
+                
+                // Core Graphics decodes the whole image at once so conversion to the preferred format has to happen afterwards.
+                if(format == ChilliSource::ImageFormat::k_RGBA8888 && in_preferredFormat != ChilliSource::ImageFormat::k_RGBA8888)
+                {
+                    u32 convertedDataSize = udwArea * ChilliSource::ImageFormatConverter::GetBytesPerPixel(in_preferredFormat);
+                    u8* pubyConvertedData = new u8[convertedDataSize];
+                    ChilliSource::ImageFormatConverter::ConvertRGBA8888(pubyBitmapData8888, udwArea, in_preferredFormat, pubyConvertedData);
+                    
+                    delete[] pubyBitmapData8888;
+                    pubyBitmapData8888 = pubyConvertedData;
+                    dataSize = convertedDataSize;
+                    format = in_preferredFormat;
+                }
 
                 ChilliSource::Image::Descriptor desc;
                 desc.m_compression = ChilliSource::ImageCompression::k_none;
@@ -134,10 +150,11 @@ namespace CSBackend
             ///
             /// @param The storage location.
             /// @param The filepath.
+            /// @param The image load options. May be null.
             /// @param Completion delegate
             /// @param [Out] The output resource
             //-----------------------------------------------------------
-            void LoadImage(ChilliSource::StorageLocation in_storageLocation, const std::string& in_filePath, const ChilliSource::ResourceProvider::AsyncLoadDelegate& in_delegate, const ChilliSource::ResourceSPtr& out_resource)
+            void LoadImage(ChilliSource::StorageLocation in_storageLocation, const std::string& in_filePath, const ChilliSource::IResourceOptionsBaseCSPtr& in_options, const ChilliSource::ResourceProvider::AsyncLoadDelegate& in_delegate, const ChilliSource::ResourceSPtr& out_resource)
             {
                 auto pImageFile = ChilliSource::Application::Get()->GetFileSystem()->CreateBinaryInputStream(in_storageLocation, in_filePath);
                 
@@ -157,7 +174,13 @@ namespace CSBackend
                 auto data = pImageFile->ReadAll();
                 
                 CS_ASSERT(data->GetLength() < static_cast<std::string::size_type>(std::numeric_limits<u32>::max()), "Image is too large. It cannot exceed " + ChilliSource::ToString(std::numeric_limits<u32>::max()) + " bytes.");
-                CreatePNGImageFromFile(reinterpret_cast<const s8*>(data->GetData()), data->GetLength(), (ChilliSource::Image*)out_resource.get());
+                auto preferredFormat = ChilliSource::ImageFormat::k_RGBA8888;
+                if(in_options != nullptr)
+                {
+                    preferredFormat = static_cast<const ChilliSource::ImageResourceOptions*>(in_options.get())->GetPreferredFormat();
+                }
+                
+                CreatePNGImageFromFile(reinterpret_cast<const s8*>(data->GetData()), data->GetLength(), preferredFormat, (ChilliSource::Image*)out_resource.get());
                 
                 out_resource->SetLoadState(ChilliSource::Resource::LoadState::k_loaded);
                 if(in_delegate != nullptr)
@@ -192,7 +215,7 @@ namespace CSBackend
 		//----------------------------------------------------------------
 		void PNGImageProvider::CreateResourceFromFile(ChilliSource::StorageLocation in_storageLocation, const std::string& in_filePath, const ChilliSource::IResourceOptionsBaseCSPtr& in_options, const ChilliSource::ResourceSPtr& out_resource)
 		{
-            LoadImage(in_storageLocation, in_filePath, nullptr, out_resource);
+            LoadImage(in_storageLocation, in_filePath, in_options, nullptr, out_resource);
 		}
         //----------------------------------------------------
         //----------------------------------------------------
@@ -200,7 +223,7 @@ namespace CSBackend
         {
             ChilliSource::Application::Get()->GetTaskScheduler()->ScheduleTask(ChilliSource::TaskType::k_file, [=](const ChilliSource::TaskContext&) noexcept
             {
-                LoadImage(in_storageLocation, in_filePath, in_delegate, out_resource);
+                LoadImage(in_storageLocation, in_filePath, in_options, in_delegate, out_resource);
             });
         }
 	}
@@ -1,70 +0,0 @@
-//
-//  RNGContainer.h
-//  ChilliSource
-//  Created by Ian Copland on 23/12/2014.
-//
-//  The MIT License (MIT)
-//
-//  Copyright (c) 2014 Tag Games Limited
-//
-//  Permission is hereby granted, free of charge, to any person obtaining a copy
-//  of this software and associated documentation files (the "Software"), to deal
-//  in the Software without restriction, including without limitation the rights
-//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
-//  copies of the Software, and to permit persons to whom the Software is
-//  furnished to do so, subject to the following conditions:
-//
-//  The above copyright notice and this permission notice shall be included in
-//  all copies or substantial portions of the Software.
-//
-//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
-//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
-//  THE SOFTWARE.
-//
-
-#ifdef CS_TARGETPLATFORM_IOS
-
-#import <ChilliSource/ChilliSource.h>
-
-#import <Foundation/Foundation.h>
-
-#include <random>
-
-//------------------------------------------------------------------------------
-/// An objective C container for a C++ random number generator. This is required
-/// to store the RNG in a NSDictionary without potential memory leaks.
-///
-/// @author Ian Copland.
-//------------------------------------------------------------------------------
-@interface RNGContainer : NSObject
-{
-    std::mt19937 m_rng;
-}
-//------------------------------------------------------------------------------
-/// Initialises the container with the given random number generator.
-///
-/// @author Ian Copland
-///
-/// @param The RNG.
-//------------------------------------------------------------------------------
--(id) initWithRNG: (const std::mt19937&)in_rng;
-//------------------------------------------------------------------------------
-/// @author Ian Copland
-///
-/// @return The RNG.
-//------------------------------------------------------------------------------
--(std::mt19937&) rng;
-//------------------------------------------------------------------------------
-/// Destroys the container and the RNG.
-///
-/// @author Ian Copland.
-//------------------------------------------------------------------------------
--(void) dealloc;
-
-@end
-
-#endif
@@ -102,7 +102,7 @@
         if(currentSize + appendSize >= m_maxBufferSize)
         {
             std::string data(reinterpret_cast<const s8*>([m_data bytes]), (s32)[m_data length]);
-            m_flushedDelegate(ChilliSource::HttpResponse::Result::k_flushed, m_responseCode, data);
+            m_flushedDelegate(ChilliSource::HttpResponse::Result::k_flushed, m_responseCode, std::move(data));
             
             [m_data setLength:0];
         }
@@ -125,7 +125,7 @@
     [m_data release];
     m_data = nil;
     
-    m_completeDelegate(ChilliSource::HttpResponse::Result::k_completed, m_responseCode, data);
+    m_completeDelegate(ChilliSource::HttpResponse::Result::k_completed, m_responseCode, std::move(data));
 }
 //-----------------------------------------------------------------------------
 /// Called if a connection fails.
@@ -90,30 +90,38 @@ namespace CSBackend
                     auto complete = m_complete;
                     auto cancelled = m_isCancelled;
                     
-                    auto connectionFlushedDelegate = [=](ChilliSource::HttpResponse::Result in_result, u32 in_responseCode, const std::string& in_data)
+                    auto connectionFlushedDelegate = [=](ChilliSource::HttpResponse::Result in_result, u32 in_responseCode, std::string in_data)
                     {
+                        //The data is moved through to the main thread rather than copied
+                        auto data = std::make_shared<std::string>(std::move(in_data));
+                        
                         ChilliSource::Application::Get()->GetTaskScheduler()->ScheduleTask(ChilliSource::TaskType::k_mainThread, [=](const ChilliSource::TaskContext& taskContext)
                         {
                             //Ensure that we only call the delegate when cancelled is false as (*this) may not be around
                             if(!*complete && !*cancelled)
                             {
-                                m_downloadedBytes += in_data.length();
-                                m_completionDelegate(this, ChilliSource::HttpResponse(in_result, in_responseCode, in_data));
+                                m_downloadedBytes += data->length();
+                                
+                                ChilliSource::HttpResponse response(in_result, in_responseCode, std::move(*data));
+                                m_completionDelegate(this, response);
                             }
                         });
                     };
                     
-                    auto connectionCompleteDelegate = [=](ChilliSource::HttpResponse::Result in_result, u32 in_responseCode, const std::string& in_data)
+                    auto connectionCompleteDelegate = [=](ChilliSource::HttpResponse::Result in_result, u32 in_responseCode, std::string in_data)
                     {
+                        auto data = std::make_shared<std::string>(std::move(in_data));
+                        
                         ChilliSource::Application::Get()->GetTaskScheduler()->ScheduleTask(ChilliSource::TaskType::k_mainThread, [=](const ChilliSource::TaskContext& taskContext)
                         {
                             //Ensure that we only call the delegate when cancelled is false as (*this) may not be around
                             if(!*complete && !*cancelled)
                             {
                                 *complete = true;
-                                m_downloadedBytes += in_data.length();
+                                m_downloadedBytes += data->length();
                                 
-                                m_completionDelegate(this, ChilliSource::HttpResponse(in_result, in_responseCode, in_data));
+                                ChilliSource::HttpResponse response(in_result, in_responseCode, std::move(*data));
+                                m_completionDelegate(this, response);
                             }
                         });
                     };
@@ -79,7 +79,7 @@ namespace CSBackend
             CS_ASSERT(in_delegate != nullptr, "Cannot make an http request with a null delegate");
             CS_ASSERT(in_url.empty() == false, "Cannot make an http request to a blank url");
             
-            HttpRequestUPtr request(new HttpRequest(in_type, in_url, in_body, in_headers, in_timeoutSecs, GetMaxBufferSize(), [=](const ChilliSource::HttpRequest* in_request, const ChilliSource::HttpResponse& in_response)
+            HttpRequestUPtr request(new HttpRequest(in_type, in_url, in_body, in_headers, in_timeoutSecs, GetMaxBufferSize(), [=](const ChilliSource::HttpRequest* in_request, ChilliSource::HttpResponse& in_response)
             {
                 //If flushed, we are not finished with the request yet
                 if(in_response.GetResult() != ChilliSource::HttpResponse::Result::k_flushed)
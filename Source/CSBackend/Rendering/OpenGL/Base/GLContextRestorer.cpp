@@ -35,6 +35,7 @@
 #include <ChilliSource/Rendering/Material/Material.h>
 #include <ChilliSource/Rendering/Model/Model.h>
 #include <ChilliSource/Rendering/Model/RenderMesh.h>
+#include <ChilliSource/Rendering/Model/RenderMeshManager.h>
 #include <ChilliSource/Rendering/Shader/RenderShader.h>
 #include <ChilliSource/Rendering/Shader/Shader.h>
 #include <ChilliSource/Rendering/Target/RenderTargetGroupManager.h>
@@ -106,17 +107,31 @@ namespace CSBackend
                 auto allModels = resourcePool->GetAllResources<ChilliSource::Model>();
                 for (const auto& model : allModels)
                 {
-                    for(u32 i = 0; i < model->GetNumMeshes(); ++i)
+                    for(u32 lod = 0; lod < model->GetNumLods(); ++lod)
                     {
-                        GLMesh* glMesh = static_cast<GLMesh*>(model->GetRenderMesh(i)->GetExtraData());
-                        
-                        if(glMesh)
+                        for(u32 i = 0; i < model->GetNumMeshes(); ++i)
                         {
-                            glMesh->Invalidate();
+                            GLMesh* glMesh = static_cast<GLMesh*>(model->GetRenderMesh(i, lod)->GetExtraData());
+                            
+                            if(glMesh)
+                            {
+                                glMesh->Invalidate();
+                            }
                         }
                     }
                 }
                 
+                //meshes which aren't owned by a model, such as static batches, are only known to the mesh manager.
+                auto renderMeshManager = ChilliSource::Application::Get()->GetSystem<ChilliSource::RenderMeshManager>();
+                for (const auto renderMesh : renderMeshManager->GetBackedUpRenderMeshes())
+                {
+                    GLMesh* glMesh = static_cast<GLMesh*>(renderMesh->GetExtraData());
+                    if(glMesh)
+                    {
+                        glMesh->Invalidate();
+                    }
+                }
+                
                 auto renderTargetGroupManager = ChilliSource::Application::Get()->GetSystem<ChilliSource::RenderTargetGroupManager>();
                 for(const auto renderTargetGroup : renderTargetGroupManager->GetRenderTargetGroups())
                 {
@@ -168,15 +183,25 @@ namespace CSBackend
                 {
                     if (model->GetStorageLocation() == ChilliSource::StorageLocation::k_none)
                     {
-                        for(u32 i = 0; i < model->GetNumMeshes(); ++i)
+                        for(u32 lod = 0; lod < model->GetNumLods(); ++lod)
                         {
-                            ChilliSource::RestoreMeshRenderCommand command(model->GetRenderMesh(i));
-                            m_pendingRestoreMeshCommands.push_back(std::move(command));
+                            for(u32 i = 0; i < model->GetNumMeshes(); ++i)
+                            {
+                                ChilliSource::RestoreMeshRenderCommand command(model->GetRenderMesh(i, lod));
+                                m_pendingRestoreMeshCommands.push_back(std::move(command));
+                            }
                         }
                     }
                 }
                 resourcePool->RefreshResources<ChilliSource::Model>();
                 
+                auto renderMeshManager = ChilliSource::Application::Get()->GetSystem<ChilliSource::RenderMeshManager>();
+                for (const auto renderMesh : renderMeshManager->GetBackedUpRenderMeshes())
+                {
+                    ChilliSource::RestoreMeshRenderCommand command(renderMesh);
+                    m_pendingRestoreMeshCommands.push_back(std::move(command));
+                }
+                
                 auto renderTargetGroupManager = ChilliSource::Application::Get()->GetSystem<ChilliSource::RenderTargetGroupManager>();
                 for(const auto renderTargetGroup : renderTargetGroupManager->GetRenderTargetGroups())
                 {
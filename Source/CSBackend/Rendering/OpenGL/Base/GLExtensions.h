@@ -36,6 +36,18 @@ extern PFNGLDELETEVERTEXARRAYSOESPROC glDeleteVertexArraysOESEXT;
 #   define glGenVertexArraysOES glGenVertexArraysOESEXT
 #   define glBindVertexArrayOES glBindVertexArrayOESEXT
 #   define glDeleteVertexArraysOES glDeleteVertexArraysOESEXT
+
+typedef void (GL_APIENTRYP CSPFNGLVERTEXATTRIBDIVISOREXTPROC) (GLuint index, GLuint divisor);
+typedef void (GL_APIENTRYP CSPFNGLDRAWARRAYSINSTANCEDEXTPROC) (GLenum mode, GLint first, GLsizei count, GLsizei instanceCount);
+typedef void (GL_APIENTRYP CSPFNGLDRAWELEMENTSINSTANCEDEXTPROC) (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instanceCount);
+
+extern CSPFNGLVERTEXATTRIBDIVISOREXTPROC glVertexAttribDivisorEXTEXT;
+extern CSPFNGLDRAWARRAYSINSTANCEDEXTPROC glDrawArraysInstancedEXTEXT;
+extern CSPFNGLDRAWELEMENTSINSTANCEDEXTPROC glDrawElementsInstancedEXTEXT;
+
+#   define glVertexAttribDivisorEXT glVertexAttribDivisorEXTEXT
+#   define glDrawArraysInstancedEXT glDrawArraysInstancedEXTEXT
+#   define glDrawElementsInstancedEXT glDrawElementsInstancedEXTEXT
 #endif
 
 #ifdef CS_OPENGLVERSION_ES
@@ -46,6 +58,10 @@ extern PFNGLDELETEVERTEXARRAYSOESPROC glDeleteVertexArraysOESEXT;
 #   define GL_WRITE_ONLY GL_WRITE_ONLY_OES
 #   define glMapBuffer glMapBufferOES
 #   define glUnmapBuffer glUnmapBufferOES
+
+#   define glVertexAttribDivisor glVertexAttribDivisorEXT
+#   define glDrawArraysInstanced glDrawArraysInstancedEXT
+#   define glDrawElementsInstanced glDrawElementsInstancedEXT
 #endif
 
 namespace CSBackend
@@ -29,7 +29,9 @@
 #include <CSBackend/Rendering/OpenGL/Lighting/GLAmbientLight.h>
 #include <CSBackend/Rendering/OpenGL/Lighting/GLDirectionalLight.h>
 #include <CSBackend/Rendering/OpenGL/Lighting/GLPointLight.h>
+#include <CSBackend/Rendering/OpenGL/Lighting/GLPointLights.h>
 #include <CSBackend/Rendering/OpenGL/Material/GLMaterial.h>
+#include <CSBackend/Rendering/OpenGL/Model/GLInstanceBuffer.h>
 #include <CSBackend/Rendering/OpenGL/Model/GLMesh.h>
 #include <CSBackend/Rendering/OpenGL/Model/GLSkinnedAnimation.h>
 #include <CSBackend/Rendering/OpenGL/Shader/GLShader.h>
@@ -37,6 +39,12 @@
 #include <CSBackend/Rendering/OpenGL/Texture/GLCubemap.h>
 #include <CSBackend/Rendering/OpenGL/Texture/GLTexture.h>
 
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Base/EngineCounters.h>
+#include <ChilliSource/Core/Time/Profiler.h>
+#include <ChilliSource/Rendering/Base/RenderCapabilities.h>
+#include <ChilliSource/Rendering/Material/RenderMaterial.h>
+#include <ChilliSource/Rendering/Material/RenderMaterialGroup.h>
 #include <ChilliSource/Rendering/Model/IndexFormat.h>
 #include <ChilliSource/Rendering/Model/PolygonType.h>
 #include <ChilliSource/Rendering/Model/RenderDynamicMesh.h>
@@ -50,6 +58,7 @@
 #include <ChilliSource/Rendering/RenderCommand/Commands/ApplyMeshRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/ApplyMeshBatchRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/ApplyPointLightRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/ApplyPointLightsRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/ApplySkinnedAnimationRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/BeginRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/BeginWithTargetGroupRenderCommand.h>
@@ -61,6 +70,7 @@
 #include <ChilliSource/Rendering/RenderCommand/Commands/LoadCubemapRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/LoadTextureRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/RenderInstanceRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/RenderInstancesRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/RestoreMeshRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/RestoreRenderTargetGroupCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/RestoreCubemapRenderCommand.h>
@@ -72,6 +82,8 @@
 #include <ChilliSource/Rendering/RenderCommand/Commands/UnloadCubemapRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/UnloadTextureRenderCommand.h>
 
+#include <algorithm>
+
 #ifdef CS_TARGETPLATFORM_IOS
 #   import <CSBackend/Platform/iOS/Core/Base/CSAppDelegate.h>
 #   import <CSBackend/Platform/iOS/Core/Base/CSGLViewController.h>
@@ -87,6 +99,9 @@ namespace CSBackend
             const std::string k_uniformWorldMat = "u_worldMat";
             const std::string k_uniformViewMat = "u_viewMat";
             const std::string k_uniformNormalMat = "u_normalMat";
+            const std::string k_uniformViewProjMat = "u_viewProjMat";
+            
+            constexpr u32 k_maxInstancesPerDraw = 256;
             
             /// Converts from a ChilliSource polygon type to a OpenGL polygon type.
             ///
@@ -134,6 +149,8 @@ namespace CSBackend
         //------------------------------------------------------------------------------
         void RenderCommandProcessor::Process(const ChilliSource::RenderCommandBuffer* renderCommandBuffer) noexcept
         {
+            CS_PROFILE_SCOPE("RenderCommandProcessor::Process");
+            
             if (m_initRequired)
             {
                 m_initRequired = false;
@@ -151,12 +168,14 @@ namespace CSBackend
                             break;
                         case ChilliSource::RenderCommand::Type::k_loadTexture:
                             LoadTexture(static_cast<const ChilliSource::LoadTextureRenderCommand*>(renderCommand));
+                            ChilliSource::EngineCounters::Increment(ChilliSource::EngineCounter::k_textureUploads);
                             break;
                         case ChilliSource::RenderCommand::Type::k_loadCubemap:
                             LoadCubemap(static_cast<const ChilliSource::LoadCubemapRenderCommand*>(renderCommand));
+                            ChilliSource::EngineCounters::Increment(ChilliSource::EngineCounter::k_textureUploads);
                             break;
                         case ChilliSource::RenderCommand::Type::k_loadMaterialGroup:
-                            // Do nothing in OpenGL 2.0 / ES 2.0
+                            LoadMaterialGroup(static_cast<const ChilliSource::LoadMaterialGroupRenderCommand*>(renderCommand));
                             break;
                         case ChilliSource::RenderCommand::Type::k_loadMesh:
                             LoadMesh(static_cast<const ChilliSource::LoadMeshRenderCommand*>(renderCommand));
@@ -194,6 +213,9 @@ namespace CSBackend
                         case ChilliSource::RenderCommand::Type::k_applyPointLight:
                             ApplyPointLight(static_cast<const ChilliSource::ApplyPointLightRenderCommand*>(renderCommand));
                             break;
+                        case ChilliSource::RenderCommand::Type::k_applyPointLights:
+                            ApplyPointLights(static_cast<const ChilliSource::ApplyPointLightsRenderCommand*>(renderCommand));
+                            break;
                         case ChilliSource::RenderCommand::Type::k_applyMaterial:
                             ApplyMaterial(static_cast<const ChilliSource::ApplyMaterialRenderCommand*>(renderCommand));
                             break;
@@ -212,6 +234,9 @@ namespace CSBackend
                         case ChilliSource::RenderCommand::Type::k_renderInstance:
                             RenderInstance(static_cast<const ChilliSource::RenderInstanceRenderCommand*>(renderCommand));
                             break;
+                        case ChilliSource::RenderCommand::Type::k_renderInstances:
+                            RenderInstances(static_cast<const ChilliSource::RenderInstancesRenderCommand*>(renderCommand));
+                            break;
                         case ChilliSource::RenderCommand::Type::k_end:
                             End();
                             break;
@@ -225,7 +250,7 @@ namespace CSBackend
                             UnloadCubemap(static_cast<const ChilliSource::UnloadCubemapRenderCommand*>(renderCommand));
                             break;
                         case ChilliSource::RenderCommand::Type::k_unloadMaterialGroup:
-                            // Do nothing in OpenGL 2.0 / ES 2.0
+                            UnloadMaterialGroup(static_cast<const ChilliSource::UnloadMaterialGroupRenderCommand*>(renderCommand));
                             break;
                         case ChilliSource::RenderCommand::Type::k_unloadMesh:
                             UnloadMesh(static_cast<const ChilliSource::UnloadMeshRenderCommand*>(renderCommand));
@@ -248,6 +273,11 @@ namespace CSBackend
             {
                 m_glDynamicMesh->Invalidate();
             }
+            
+            if(m_glInstanceBuffer)
+            {
+                m_glInstanceBuffer->Invalidate();
+            }
         }
         
         //------------------------------------------------------------------------------
@@ -257,6 +287,12 @@ namespace CSBackend
             
             m_glDynamicMesh.reset();
             m_glDynamicMesh = GLDynamicMeshUPtr(new GLDynamicMesh(ChilliSource::RenderDynamicMesh::k_maxVertexDataSize, ChilliSource::RenderDynamicMesh::k_maxIndexDataSize));
+            
+            if(m_glInstanceBuffer)
+            {
+                m_glInstanceBuffer.reset();
+                m_glInstanceBuffer = GLInstanceBufferUPtr(new GLInstanceBuffer(k_maxInstancesPerDraw));
+            }
         }
         
         //------------------------------------------------------------------------------
@@ -266,6 +302,12 @@ namespace CSBackend
             m_textureUnitManager = GLTextureUnitManagerUPtr(new GLTextureUnitManager());
             m_glDynamicMesh = GLDynamicMeshUPtr(new GLDynamicMesh(ChilliSource::RenderDynamicMesh::k_maxVertexDataSize, ChilliSource::RenderDynamicMesh::k_maxIndexDataSize));
             
+            auto renderCapabilities = ChilliSource::Application::Get()->GetSystem<ChilliSource::RenderCapabilities>();
+            if (renderCapabilities->IsInstancingSupported())
+            {
+                m_glInstanceBuffer = GLInstanceBufferUPtr(new GLInstanceBuffer(k_maxInstancesPerDraw));
+            }
+            
             ResetCache();
         }
         
@@ -308,6 +350,21 @@ namespace CSBackend
             renderTexture->SetExtraData(glCubemap);
         }
         
+        //------------------------------------------------------------------------------
+        void RenderCommandProcessor::LoadMaterialGroup(const ChilliSource::LoadMaterialGroupRenderCommand* renderCommand) noexcept
+        {
+            for (auto renderMaterial : renderCommand->GetRenderMaterialGroup()->GetRenderMaterials())
+            {
+                if (!renderMaterial->GetExtraData())
+                {
+                    //TODO: Should be pooled.
+                    auto glMaterial = new GLMaterial(renderMaterial);
+                    
+                    renderMaterial->SetExtraData(glMaterial);
+                }
+            }
+        }
+        
         //------------------------------------------------------------------------------
         void RenderCommandProcessor::LoadMesh(const ChilliSource::LoadMeshRenderCommand* renderCommand) noexcept
         {
@@ -338,8 +395,12 @@ namespace CSBackend
         //------------------------------------------------------------------------------
         void RenderCommandProcessor::RestoreMesh(const ChilliSource::RestoreMeshRenderCommand* renderCommand) noexcept
         {
+            //meshes which were created after the context was lost are still pending load, and will be built on the new context.
             GLMesh* glMesh = static_cast<GLMesh*>(renderCommand->GetRenderMesh()->GetExtraData());
-            glMesh->Restore();
+            if (glMesh)
+            {
+                glMesh->Restore();
+            }
         }
         
         //------------------------------------------------------------------------------
@@ -464,6 +525,14 @@ namespace CSBackend
             m_currentLight = GLLightUPtr(new GLPointLight(renderCommand->GetColour(), renderCommand->GetPosition(), renderCommand->GetAttenuation()));
         }
         
+        //------------------------------------------------------------------------------
+        void RenderCommandProcessor::ApplyPointLights(const ChilliSource::ApplyPointLightsRenderCommand* renderCommand) noexcept
+        {
+            m_currentMaterial = nullptr;
+            
+            m_currentLight = GLLightUPtr(new GLPointLights(renderCommand));
+        }
+        
         //------------------------------------------------------------------------------
         void RenderCommandProcessor::ApplyMaterial(const ChilliSource::ApplyMaterialRenderCommand* renderCommand) noexcept
         {
@@ -490,7 +559,10 @@ namespace CSBackend
                 
                 m_currentCamera.Apply(glShader);
                 
-                GLMaterial::Apply(renderMaterial, glShader);
+                auto glMaterial = static_cast<GLMaterial*>(m_currentMaterial->GetExtraData());
+                CS_ASSERT(glMaterial, "Material must be loaded before it is applied.");
+                
+                glMaterial->Apply(glShader);
                 
                 if (m_currentLight)
                 {
@@ -566,11 +638,12 @@ namespace CSBackend
             auto indexFormat = renderMeshBatch->GetIndexFormat();
             auto numVertices = renderMeshBatch->GetNumVertices();
             auto numIndices = renderMeshBatch->GetNumIndices();
+            auto vertexData = renderMeshBatch->GetVertexData();
             auto vertexDataSize = renderMeshBatch->GetVertexDataSize();
+            auto indexData = renderMeshBatch->GetIndexData();
             auto indexDataSize = renderMeshBatch->GetIndexDataSize();
-            const auto& meshes = renderMeshBatch->GetMeshes();
             
-            m_glDynamicMesh->Bind(glShader, polygonType, vertexFormat, indexFormat, numVertices, numIndices, vertexDataSize, indexDataSize, meshes);
+            m_glDynamicMesh->Bind(glShader, polygonType, vertexFormat, indexFormat, numVertices, numIndices, vertexData, vertexDataSize, indexData, indexDataSize);
         }
         
         //------------------------------------------------------------------------------
@@ -630,6 +703,62 @@ namespace CSBackend
             CS_ASSERT_NOGLERROR("An OpenGL error occurred while rendering an instance.");
         }
         
+        //------------------------------------------------------------------------------
+        void RenderCommandProcessor::RenderInstances(const ChilliSource::RenderInstancesRenderCommand* renderCommand) noexcept
+        {
+            CS_ASSERT(m_currentMaterial, "A material must be applied before rendering a mesh.");
+            CS_ASSERT(m_currentShader, "A shader must be applied before rendering a mesh.");
+            CS_ASSERT(m_currentMesh, "A static mesh must be applied before rendering instances.");
+            
+            auto glShader = static_cast<GLShader*>(m_currentShader->GetExtraData());
+            glShader->SetUniform(k_uniformViewMat, m_currentCamera.GetViewMatrix(), GLShader::FailurePolicy::k_silent);
+            
+            auto polygonType = ToGLPolygonType(m_currentMesh->GetPolygonType());
+            const auto& worldMatrices = renderCommand->GetWorldMatrices();
+            
+            if (m_glInstanceBuffer && glShader->GetInstanceWorldMatAttributeHandle() >= 0)
+            {
+                glShader->SetUniform(k_uniformViewProjMat, m_currentCamera.GetViewProjectionMatrix(), GLShader::FailurePolicy::k_silent);
+                
+                for (u32 offset = 0; offset < renderCommand->GetNumInstances(); offset += m_glInstanceBuffer->GetMaxInstances())
+                {
+                    auto numInstances = std::min(renderCommand->GetNumInstances() - offset, m_glInstanceBuffer->GetMaxInstances());
+                    m_glInstanceBuffer->Bind(glShader, worldMatrices.data() + offset, numInstances);
+                    
+                    if (m_currentMesh->GetNumIndices() > 0)
+                    {
+                        glDrawElementsInstanced(polygonType, m_currentMesh->GetNumIndices(), ToGLIndexType(m_currentMesh->GetIndexFormat()), 0, numInstances);
+                    }
+                    else
+                    {
+                        glDrawArraysInstanced(polygonType, 0, m_currentMesh->GetNumVertices(), numInstances);
+                    }
+                }
+                
+                m_glInstanceBuffer->Unbind(glShader);
+            }
+            else
+            {
+                for (const auto& worldMatrix : worldMatrices)
+                {
+                    glShader->SetUniform(k_uniformWorldMat, worldMatrix, GLShader::FailurePolicy::k_silent);
+                    glShader->SetUniform(k_uniformWVPMat, worldMatrix * m_currentCamera.GetViewProjectionMatrix(), GLShader::FailurePolicy::k_silent);
+                    glShader->SetUniform(k_uniformNormalMat, ChilliSource::Matrix4::Transpose(ChilliSource::Matrix4::Inverse(worldMatrix)), GLShader::FailurePolicy::k_silent);
+                    
+                    if (m_currentMesh->GetNumIndices() > 0)
+                    {
+                        glDrawElements(polygonType, m_currentMesh->GetNumIndices(), ToGLIndexType(m_currentMesh->GetIndexFormat()), 0);
+                    }
+                    else
+                    {
+                        glDrawArrays(polygonType, 0, m_currentMesh->GetNumVertices());
+                    }
+                }
+            }
+            
+            CS_ASSERT_NOGLERROR("An OpenGL error occurred while rendering instances.");
+        }
+        
         //------------------------------------------------------------------------------
         void RenderCommandProcessor::End() noexcept
         {
@@ -686,6 +815,20 @@ namespace CSBackend
             CS_SAFEDELETE(glCubemap);
         }
         
+        //------------------------------------------------------------------------------
+        void RenderCommandProcessor::UnloadMaterialGroup(const ChilliSource::UnloadMaterialGroupRenderCommand* renderCommand) noexcept
+        {
+            ResetCache();
+            
+            for (auto renderMaterial : renderCommand->GetRenderMaterialGroup()->GetRenderMaterials())
+            {
+                auto glMaterial = static_cast<GLMaterial*>(renderMaterial->GetExtraData());
+                renderMaterial->SetExtraData(nullptr);
+                
+                CS_SAFEDELETE(glMaterial);
+            }
+        }
+        
         //------------------------------------------------------------------------------
         void RenderCommandProcessor::UnloadMesh(const ChilliSource::UnloadMeshRenderCommand* renderCommand) noexcept
         {
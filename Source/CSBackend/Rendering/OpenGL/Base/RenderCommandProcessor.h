@@ -30,6 +30,7 @@
 #include <CSBackend/Rendering/OpenGL/Camera/GLCamera.h>
 #include <CSBackend/Rendering/OpenGL/Lighting/GLLight.h>
 #include <CSBackend/Rendering/OpenGL/Model/GLDynamicMesh.h>
+#include <CSBackend/Rendering/OpenGL/Model/GLInstanceBuffer.h>
 #include <CSBackend/Rendering/OpenGL/Texture/GLTextureUnitManager.h>
 
 #include <ChilliSource/ChilliSource.h>
@@ -95,6 +96,14 @@ namespace CSBackend
             ///
             void LoadCubemap(const ChilliSource::LoadCubemapRenderCommand* renderCommand) noexcept;
             
+            /// Creates the OpenGL material data for each material in the group described by the given
+            /// load command.
+            ///
+            /// @param renderCommand
+            ///     The render command
+            ///
+            void LoadMaterialGroup(const ChilliSource::LoadMaterialGroupRenderCommand* renderCommand) noexcept;
+            
             /// Loads the mesh described by the given load command
             ///
             /// @param renderCommand
@@ -189,6 +198,16 @@ namespace CSBackend
             ///
             void ApplyPointLight(const ChilliSource::ApplyPointLightRenderCommand* renderCommand) noexcept;
             
+            /// Caches the given group of point lights and invalidates all other light data. All applied
+            /// materials after this will use this data.
+            ///
+            /// The currently applied material will be invalidated and needs to be re-applied.
+            ///
+            /// @param renderCommand
+            ///     The render command
+            ///
+            void ApplyPointLights(const ChilliSource::ApplyPointLightsRenderCommand* renderCommand) noexcept;
+            
             /// Applies the given material to the OpenGL Context. The cached camera data will be used.
             ///
             /// @param renderCommand
@@ -233,6 +252,17 @@ namespace CSBackend
             ///
             void RenderInstance(const ChilliSource::RenderInstanceRenderCommand* renderCommand) noexcept;
             
+            /// Renders multiple instances of the mesh described by the current OpenGL context state. A
+            /// camera, material and static mesh must all currently be applied to the context. If the
+            /// device supports instancing and the current shader declares the instance world matrix
+            /// attribute then the instances are rendered with instanced draw calls, otherwise each
+            /// instance is drawn individually.
+            ///
+            /// @param renderCommand
+            ///     The render command
+            ///
+            void RenderInstances(const ChilliSource::RenderInstancesRenderCommand* renderCommand) noexcept;
+            
             /// Ends rendering to the current render target.
             ///
             void End() noexcept;
@@ -258,6 +288,14 @@ namespace CSBackend
             ///
             void UnloadCubemap(const ChilliSource::UnloadCubemapRenderCommand* renderCommand) noexcept;
             
+            /// Destroys the OpenGL material data for each material in the group described by the given
+            /// unload command.
+            ///
+            /// @param renderCommand
+            ///     The render command
+            ///
+            void UnloadMaterialGroup(const ChilliSource::UnloadMaterialGroupRenderCommand* renderCommand) noexcept;
+            
             /// Unloads the mesh described by the given unload command
             ///
             /// @param renderCommand
@@ -280,6 +318,7 @@ namespace CSBackend
             
             GLTextureUnitManagerUPtr m_textureUnitManager;
             GLDynamicMeshUPtr m_glDynamicMesh;
+            GLInstanceBufferUPtr m_glInstanceBuffer;
             
             GLCamera m_currentCamera;
             GLLightUPtr m_currentLight;
@@ -25,6 +25,7 @@
 #include <CSBackend/Rendering/OpenGL/Base/RenderInfoFactory.h>
 
 #include <CSBackend/Rendering/OpenGL/Base/GLError.h>
+#include <CSBackend/Rendering/OpenGL/Base/GLExtensions.h>
 #include <CSBackend/Rendering/OpenGL/Base/GLIncludes.h>
 
 namespace CSBackend
@@ -53,6 +54,7 @@ namespace CSBackend
             bool areHighPrecFragmentsSupported = true;
             bool areMapBuffersSupported = true;
             bool areVAOsSupported = true;
+            bool isInstancingSupported = false;
             bool areDepthTexturesSupported = false;
             bool areShadowMapsSupported = false;
             
@@ -85,13 +87,24 @@ namespace CSBackend
             areDepthTexturesSupported = CheckForOpenGLExtension("GL_OES_depth_texture");
 #endif
             areShadowMapsSupported = (areDepthTexturesSupported && areHighPrecFragmentsSupported);
+            
+#ifdef CS_OPENGLVERSION_STANDARD
+            isInstancingSupported = (glVertexAttribDivisor != nullptr && glDrawArraysInstanced != nullptr && glDrawElementsInstanced != nullptr);
+#elif defined(CS_TARGETPLATFORM_ANDROID) || defined(CS_TARGETPLATFORM_RPI)
+            // The render command processor hasn't been initialised yet, so the extension function pointers must be fetched here.
+            GLExtensions::InitExtensions();
+            isInstancingSupported = CheckForOpenGLExtension("GL_EXT_instanced_arrays") && glVertexAttribDivisorEXT != nullptr && glDrawArraysInstancedEXT != nullptr && glDrawElementsInstancedEXT != nullptr;
+#elif defined(CS_OPENGLVERSION_ES)
+            isInstancingSupported = CheckForOpenGLExtension("GL_EXT_instanced_arrays");
+#endif
+            
             glGetIntegerv(GL_MAX_TEXTURE_SIZE, (GLint*)&maxTextureSize);
             glGetIntegerv(GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS, (GLint*)&maxTextureUnits);
             glGetIntegerv(GL_MAX_VERTEX_ATTRIBS, (GLint*)&maxVertexAttribs);
             
             CS_ASSERT_NOGLERROR("An OpenGL error occurred while getting render capabilities.");
             
-            ChilliSource::RenderInfo renderInfo(areShadowMapsSupported, areDepthTexturesSupported, areMapBuffersSupported, areVAOsSupported, areHighPrecFragmentsSupported, maxTextureSize, maxTextureUnits, maxVertexAttribs);
+            ChilliSource::RenderInfo renderInfo(areShadowMapsSupported, areDepthTexturesSupported, areMapBuffersSupported, areVAOsSupported, isInstancingSupported, areHighPrecFragmentsSupported, maxTextureSize, maxTextureUnits, maxVertexAttribs);
             
             return renderInfo;
         }
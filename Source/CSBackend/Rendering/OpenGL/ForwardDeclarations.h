@@ -56,11 +56,13 @@ namespace CSBackend
         CS_FORWARDDECLARE_CLASS(GLDirectionalLight);
         CS_FORWARDDECLARE_CLASS(GLLight);
         CS_FORWARDDECLARE_CLASS(GLPointLight);
+        CS_FORWARDDECLARE_CLASS(GLPointLights);
         //----------------------------------------------------
         /// Model
         //----------------------------------------------------
         CS_FORWARDDECLARE_CLASS(GLMesh);
         CS_FORWARDDECLARE_CLASS(GLDynamicMesh);
+        CS_FORWARDDECLARE_CLASS(GLInstanceBuffer);
         //----------------------------------------------------
         /// Shader
         //----------------------------------------------------
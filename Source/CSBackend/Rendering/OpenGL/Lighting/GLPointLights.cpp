@@ -0,0 +1,72 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <CSBackend/Rendering/OpenGL/Lighting/GLPointLights.h>
+
+#include <CSBackend/Rendering/OpenGL/Shader/GLShader.h>
+
+#include <ChilliSource/Rendering/RenderCommand/Commands/ApplyPointLightsRenderCommand.h>
+
+namespace CSBackend
+{
+    namespace OpenGL
+    {
+        namespace
+        {
+            const std::string k_uniformNumLights = "u_numPointLights";
+            const std::string k_uniformLightCols = "u_pointLightCols";
+            const std::string k_uniformLightPositions = "u_pointLightPositions";
+            const std::string k_uniformAttenuations = "u_pointLightAttenuations";
+        }
+        
+        //------------------------------------------------------------------------------
+        GLPointLights::GLPointLights(const ChilliSource::ApplyPointLightsRenderCommand* renderCommand) noexcept
+            : m_numLights(renderCommand->GetNumLights())
+        {
+            CS_ASSERT(m_numLights <= ChilliSource::RenderPass::k_maxPointLights, "Too many point lights.");
+            
+            m_colours.fill(ChilliSource::Vector4::k_zero);
+            m_positions.fill(ChilliSource::Vector4::k_zero);
+            m_attenuations.fill(ChilliSource::Vector4::k_zero);
+            
+            for (u32 i = 0; i < m_numLights; ++i)
+            {
+                const auto& colour = renderCommand->GetColours()[i];
+                m_colours[i] = ChilliSource::Vector4(colour.r, colour.g, colour.b, colour.a);
+                m_positions[i] = ChilliSource::Vector4(renderCommand->GetPositions()[i], 1.0f);
+                m_attenuations[i] = ChilliSource::Vector4(renderCommand->GetAttenuations()[i], 0.0f);
+            }
+        }
+        
+        //------------------------------------------------------------------------------
+        void GLPointLights::Apply(GLShader* glShader, GLTextureUnitManager* glTextureUnitManager) const noexcept
+        {
+            glShader->SetUniform(k_uniformNumLights, s32(m_numLights), GLShader::FailurePolicy::k_silent);
+            glShader->SetUniform(k_uniformLightCols, m_colours.data(), u32(m_colours.size()), GLShader::FailurePolicy::k_silent);
+            glShader->SetUniform(k_uniformLightPositions, m_positions.data(), u32(m_positions.size()), GLShader::FailurePolicy::k_silent);
+            glShader->SetUniform(k_uniformAttenuations, m_attenuations.data(), u32(m_attenuations.size()), GLShader::FailurePolicy::k_silent);
+        }
+    }
+}
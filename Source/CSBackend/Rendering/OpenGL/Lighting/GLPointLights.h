@@ -0,0 +1,80 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CSBACKEND_RENDERING_OPENGL_LIGHTING_GLPOINTLIGHTS_H_
+#define _CSBACKEND_RENDERING_OPENGL_LIGHTING_GLPOINTLIGHTS_H_
+
+#include <CSBackend/Rendering/OpenGL/ForwardDeclarations.h>
+#include <CSBackend/Rendering/OpenGL/Lighting/GLLight.h>
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Math/Vector4.h>
+#include <ChilliSource/Rendering/Base/RenderPass.h>
+
+#include <array>
+
+namespace CSBackend
+{
+    namespace OpenGL
+    {
+        /// The OpenGL light object for a group of point lights which are applied in a single pass.
+        /// The lights are applied as uniform arrays of RenderPass::k_maxPointLights elements, along
+        /// with the number of lights which are in use.
+        ///
+        /// This is immutable and therefore thread-safe, but apply must be called on the render
+        /// thread.
+        ///
+        class GLPointLights final : public GLLight
+        {
+        public:
+            /// Creates a new instance with the given point light information.
+            ///
+            /// @param renderCommand
+            ///     The render command describing the lights.
+            ///
+            GLPointLights(const ChilliSource::ApplyPointLightsRenderCommand* renderCommand) noexcept;
+            
+            /// Applies the lights to the given shader.
+            ///
+            /// This must be called on the render thread.
+            ///
+            /// @param glShader
+            ///     The shader the light data should be applied to.
+            /// @param glTextureUnitManager
+            ///     The texture unit manager which can be used to bind additional textures required by a light
+            ///     such as a shadow map.
+            ///
+            void Apply(GLShader* glShader, GLTextureUnitManager* glTextureUnitManager) const noexcept override;
+            
+        private:
+            u32 m_numLights;
+            std::array<ChilliSource::Vector4, ChilliSource::RenderPass::k_maxPointLights> m_colours;
+            std::array<ChilliSource::Vector4, ChilliSource::RenderPass::k_maxPointLights> m_positions;
+            std::array<ChilliSource::Vector4, ChilliSource::RenderPass::k_maxPointLights> m_attenuations;
+        };
+    }
+}
+
+#endif
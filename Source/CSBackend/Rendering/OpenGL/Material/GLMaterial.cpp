@@ -24,6 +24,7 @@
 
 #include <CSBackend/Rendering/OpenGL/Material/GLMaterial.h>
 
+#include <CSBackend/Rendering/OpenGL/Base/GLError.h>
 #include <CSBackend/Rendering/OpenGL/Camera/GLCamera.h>
 #include <CSBackend/Rendering/OpenGL/Shader/GLShader.h>
 
@@ -33,6 +34,7 @@
 #include <ChilliSource/Rendering/Base/StencilOp.h>
 #include <ChilliSource/Rendering/Base/TestFunc.h>
 #include <ChilliSource/Rendering/Material/RenderMaterial.h>
+#include <ChilliSource/Rendering/Shader/RenderShaderVariables.h>
 
 namespace CSBackend
 {
@@ -171,118 +173,175 @@ namespace CSBackend
                 }
             }
             
-            /// Applies the given batch of custom shader variables to the given shader. If
-            /// any of the variables do not exist in the shader, this will assert.
+            /// Sets the colour uniform with the given handle, if it exists.
+            ///
+            /// @param handle
+            ///     The uniform handle. May be -1 if the uniform doesn't exist.
+            /// @param colour
+            ///     The colour to apply.
+            ///
+            void ApplyColour(GLint handle, const ChilliSource::Colour& colour) noexcept
+            {
+                if (handle >= 0)
+                {
+                    glUniform4fv(handle, 1, reinterpret_cast<const GLfloat*>(&colour));
+                }
+            }
+            
+            /// Applies the given block of custom shader variables using the given pre-resolved
+            /// uniform handles.
             ///
             /// @param renderShaderVariables
             ///     The shader variables to apply.
-            /// @param glShader
-            ///     The shader to apply the variables to.
+            /// @param handles
+            ///     The uniform handle of each variable, in the same order as the variables.
             ///
-            void ApplyCustomShaderVariables(const ChilliSource::RenderShaderVariables* renderShaderVariables, GLShader* glShader) noexcept
+            void ApplyCustomShaderVariables(const ChilliSource::RenderShaderVariables* renderShaderVariables, const std::vector<GLint>& handles) noexcept
             {
                 CS_ASSERT(renderShaderVariables, "Cannot apply null shader variables.");
-                CS_ASSERT(glShader, "Cannot apply shader variables to null shader.");
+                CS_ASSERT(handles.size() == renderShaderVariables->GetNumVariables(), "Shader variable handles are out of sync.");
                 
-                for (const auto& pair : renderShaderVariables->GetFloatVariables())
-                {
-                    glShader->SetUniform(pair.first, pair.second);
-                }
-                
-                for (const auto& pair : renderShaderVariables->GetVector2Variables())
-                {
-                    glShader->SetUniform(pair.first, pair.second);
-                }
-                
-                for (const auto& pair : renderShaderVariables->GetVector3Variables())
-                {
-                    glShader->SetUniform(pair.first, pair.second);
-                }
-                
-                for (const auto& pair : renderShaderVariables->GetVector4Variables())
-                {
-                    glShader->SetUniform(pair.first, pair.second);
-                }
-                
-                for (const auto& pair : renderShaderVariables->GetMatrix4Variables())
-                {
-                    glShader->SetUniform(pair.first, pair.second);
-                }
+                const auto& variables = renderShaderVariables->GetVariables();
+                const auto data = renderShaderVariables->GetData().data();
                 
-                for (const auto& pair : renderShaderVariables->GetColourVariables())
+                for (std::size_t i = 0; i < variables.size(); ++i)
                 {
-                    glShader->SetUniform(pair.first, pair.second);
+                    auto values = data + variables[i].m_dataOffset;
+                    
+                    switch (variables[i].m_type)
+                    {
+                        case ChilliSource::RenderShaderVariables::Type::k_float:
+                            glUniform1fv(handles[i], 1, values);
+                            break;
+                        case ChilliSource::RenderShaderVariables::Type::k_vector2:
+                            glUniform2fv(handles[i], 1, values);
+                            break;
+                        case ChilliSource::RenderShaderVariables::Type::k_vector3:
+                            glUniform3fv(handles[i], 1, values);
+                            break;
+                        case ChilliSource::RenderShaderVariables::Type::k_vector4:
+                        case ChilliSource::RenderShaderVariables::Type::k_colour:
+                            glUniform4fv(handles[i], 1, values);
+                            break;
+                        case ChilliSource::RenderShaderVariables::Type::k_matrix4:
+                            glUniformMatrix4fv(handles[i], 1, GL_FALSE, values);
+                            break;
+                        default:
+                            CS_LOG_FATAL("Invalid shader variable type.");
+                            break;
+                    }
                 }
             }
         }
         
         //------------------------------------------------------------------------------
-        void GLMaterial::Apply(const ChilliSource::RenderMaterial* renderMaterial, GLShader* glShader) noexcept
+        GLMaterial::GLMaterial(const ChilliSource::RenderMaterial* renderMaterial) noexcept
+            : m_renderMaterial(renderMaterial)
         {
-            renderMaterial->IsDepthWriteEnabled() ? glDepthMask(GL_TRUE) : glDepthMask(GL_FALSE);
-            renderMaterial->IsColourWriteEnabled() ? glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE) : glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+            CS_ASSERT(m_renderMaterial, "Cannot create GLMaterial with null render material.");
+        }
+        
+        //------------------------------------------------------------------------------
+        void GLMaterial::Apply(GLShader* glShader) noexcept
+        {
+            if (m_glShaderGeneration != glShader->GetGeneration() || m_glShaderProgramId != glShader->GetProgramId())
+            {
+                BuildUniformHandles(glShader);
+            }
+            
+            m_renderMaterial->IsDepthWriteEnabled() ? glDepthMask(GL_TRUE) : glDepthMask(GL_FALSE);
+            m_renderMaterial->IsColourWriteEnabled() ? glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE) : glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
 
-            if(renderMaterial->IsDepthTestEnabled())
+            if(m_renderMaterial->IsDepthTestEnabled())
             {
                 glEnable(GL_DEPTH_TEST);
-                glDepthFunc(ToGLTestFunc(renderMaterial->GetDepthTestFunc()));
+                glDepthFunc(ToGLTestFunc(m_renderMaterial->GetDepthTestFunc()));
             }
             else
             {
                 glDisable(GL_DEPTH_TEST);
             }
             
-            if (renderMaterial->IsFaceCullingEnabled())
+            if (m_renderMaterial->IsFaceCullingEnabled())
             {
                 glEnable(GL_CULL_FACE);
-                glCullFace(ToGLCullFace(renderMaterial->GetCullFace()));
+                glCullFace(ToGLCullFace(m_renderMaterial->GetCullFace()));
             }
             else
             {
                 glDisable(GL_CULL_FACE);
             }
             
-            if (renderMaterial->IsTransparencyEnabled())
+            if (m_renderMaterial->IsTransparencyEnabled())
             {
                 glEnable(GL_BLEND);
-                glBlendFunc(ToGLBlendMode(renderMaterial->GetSourceBlendMode()), ToGLBlendMode(renderMaterial->GetDestinationBlendMode()));
+                glBlendFunc(ToGLBlendMode(m_renderMaterial->GetSourceBlendMode()), ToGLBlendMode(m_renderMaterial->GetDestinationBlendMode()));
             }
             else
             {
                 glDisable(GL_BLEND);
             }
             
-            if(renderMaterial->IsStencilTestEnabled())
+            if(m_renderMaterial->IsStencilTestEnabled())
             {
                 glEnable(GL_STENCIL_TEST);
-                glStencilOp(ToGLStencilOp(renderMaterial->GetStencilFailOp()), ToGLStencilOp(renderMaterial->GetStencilDepthFailOp()), ToGLStencilOp(renderMaterial->GetStencilPassOp()));
-                glStencilFunc(ToGLTestFunc(renderMaterial->GetStencilTestFunc()), (GLint)renderMaterial->GetStencilTestFuncRef(), (GLuint)renderMaterial->GetStencilTestFuncMask());
+                glStencilOp(ToGLStencilOp(m_renderMaterial->GetStencilFailOp()), ToGLStencilOp(m_renderMaterial->GetStencilDepthFailOp()), ToGLStencilOp(m_renderMaterial->GetStencilPassOp()));
+                glStencilFunc(ToGLTestFunc(m_renderMaterial->GetStencilTestFunc()), (GLint)m_renderMaterial->GetStencilTestFuncRef(), (GLuint)m_renderMaterial->GetStencilTestFuncMask());
             }
             else
             {
                 glDisable(GL_STENCIL_TEST);
             }
             
-            s32 samplerNumber = 0;
+            for (std::size_t i = 0; i < m_samplerHandles.size(); ++i)
+            {
+                glUniform1i(m_samplerHandles[i], GLint(i));
+            }
             
-            for (std::size_t i = 0; i < renderMaterial->GetRenderTextures2D().size(); ++i, ++samplerNumber)
+            ApplyColour(m_emissiveHandle, m_renderMaterial->GetEmissiveColour());
+            ApplyColour(m_ambientHandle, m_renderMaterial->GetAmbientColour());
+            ApplyColour(m_diffuseHandle, m_renderMaterial->GetDiffuseColour());
+            ApplyColour(m_specularHandle, m_renderMaterial->GetSpecularColour());
+            
+            if (m_renderMaterial->GetRenderShaderVariables())
             {
-                glShader->SetUniform(k_uniformTexturePrefix + ChilliSource::ToString(i), samplerNumber);
+                ApplyCustomShaderVariables(m_renderMaterial->GetRenderShaderVariables(), m_shaderVariableHandles);
             }
             
-            for (std::size_t i = 0; i < renderMaterial->GetRenderTexturesCubemap().size(); ++i, ++samplerNumber)
+            CS_ASSERT_NOGLERROR("An OpenGL error occurred while applying material.");
+        }
+        
+        //------------------------------------------------------------------------------
+        void GLMaterial::BuildUniformHandles(GLShader* glShader) noexcept
+        {
+            CS_ASSERT(glShader, "Cannot build uniform handles for null shader.");
+            
+            m_glShaderProgramId = glShader->GetProgramId();
+            m_glShaderGeneration = glShader->GetGeneration();
+            
+            m_samplerHandles.clear();
+            for (std::size_t i = 0; i < m_renderMaterial->GetRenderTextures2D().size(); ++i)
             {
-                glShader->SetUniform(k_uniformCubemapPrefix + ChilliSource::ToString(i), samplerNumber);
+                m_samplerHandles.push_back(glShader->GetUniformHandle(k_uniformTexturePrefix + ChilliSource::ToString(i), GLShader::FailurePolicy::k_hard));
             }
             
-            glShader->SetUniform(k_uniformEmissive, renderMaterial->GetEmissiveColour(), GLShader::FailurePolicy::k_silent);
-            glShader->SetUniform(k_uniformAmbient, renderMaterial->GetAmbientColour(), GLShader::FailurePolicy::k_silent);
-            glShader->SetUniform(k_uniformDiffuse, renderMaterial->GetDiffuseColour(), GLShader::FailurePolicy::k_silent);
-            glShader->SetUniform(k_uniformSpecular, renderMaterial->GetSpecularColour(), GLShader::FailurePolicy::k_silent);
+            for (std::size_t i = 0; i < m_renderMaterial->GetRenderTexturesCubemap().size(); ++i)
+            {
+                m_samplerHandles.push_back(glShader->GetUniformHandle(k_uniformCubemapPrefix + ChilliSource::ToString(i), GLShader::FailurePolicy::k_hard));
+            }
+            
+            m_emissiveHandle = glShader->GetUniformHandle(k_uniformEmissive, GLShader::FailurePolicy::k_silent);
+            m_ambientHandle = glShader->GetUniformHandle(k_uniformAmbient, GLShader::FailurePolicy::k_silent);
+            m_diffuseHandle = glShader->GetUniformHandle(k_uniformDiffuse, GLShader::FailurePolicy::k_silent);
+            m_specularHandle = glShader->GetUniformHandle(k_uniformSpecular, GLShader::FailurePolicy::k_silent);
             
-            if (renderMaterial->GetRenderShaderVariables())
+            m_shaderVariableHandles.clear();
+            if (m_renderMaterial->GetRenderShaderVariables())
             {
-                ApplyCustomShaderVariables(renderMaterial->GetRenderShaderVariables(), glShader);
+                for (const auto& variable : m_renderMaterial->GetRenderShaderVariables()->GetVariables())
+                {
+                    m_shaderVariableHandles.push_back(glShader->GetUniformHandle(variable.m_name, GLShader::FailurePolicy::k_hard));
+                }
             }
         }
     }
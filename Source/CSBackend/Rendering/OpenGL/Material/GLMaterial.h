@@ -30,22 +30,60 @@
 
 #include <ChilliSource/ChilliSource.h>
 
+#include <vector>
+
 namespace CSBackend
 {
     namespace OpenGL
     {
-        /// A container for all functionality pertaining to materials in OpenGL.
+        /// A container for all OpenGL functionality relating to a single RenderMaterial. The
+        /// uniform handles used by the material, including those of its custom shader variables,
+        /// are resolved the first time the material is applied with a given shader. After this,
+        /// applying the material is a linear walk over the cached handles and the compiled shader
+        /// variable block, with no uniform name lookups.
+        ///
+        /// This is not thread-safe and should only be accessed from the render thread.
         ///
-        namespace GLMaterial
+        class GLMaterial final
         {
-            /// Applys the state described by the given RenderMaterial to the OpenGL context.
+        public:
+            CS_DECLARE_NOCOPY(GLMaterial);
+            
+            /// Creates a new instance for the given render material.
             ///
             /// @param renderMaterial
-            ///     The render material to apply.
+            ///     The render material this represents.
+            ///
+            GLMaterial(const ChilliSource::RenderMaterial* renderMaterial) noexcept;
+            
+            /// Applys the state described by the render material to the OpenGL context. If the
+            /// given shader differs from the shader the uniform handles were resolved against,
+            /// the handles are resolved again.
+            ///
             /// @param glShader
             ///     The currently active shader to apply uniforms to.
             ///
-            void Apply(const ChilliSource::RenderMaterial* renderMaterial, GLShader* glShader) noexcept;
+            void Apply(GLShader* glShader) noexcept;
+            
+        private:
+            /// Resolves and caches the handle of each uniform used by the render material in the
+            /// given shader.
+            ///
+            /// @param glShader
+            ///     The shader to resolve the uniform handles against.
+            ///
+            void BuildUniformHandles(GLShader* glShader) noexcept;
+            
+            const ChilliSource::RenderMaterial* m_renderMaterial;
+            GLuint m_glShaderProgramId = 0;
+            u64 m_glShaderGeneration = 0;
+            
+            GLint m_emissiveHandle = -1;
+            GLint m_ambientHandle = -1;
+            GLint m_diffuseHandle = -1;
+            GLint m_specularHandle = -1;
+            std::vector<GLint> m_samplerHandles;
+            std::vector<GLint> m_shaderVariableHandles;
         };
     }
 }
@@ -29,10 +29,11 @@
 #include <CSBackend/Rendering/OpenGL/Base/GLIncludes.h>
 
 #include <ChilliSource/ChilliSource.h>
-#include <ChilliSource/Core/Memory/LinearAllocator.h>
 #include <ChilliSource/Rendering/Model/IndexFormat.h>
 #include <ChilliSource/Rendering/Model/PolygonType.h>
-#include <ChilliSource/Rendering/Model/RenderMeshBatch.h>
+#include <ChilliSource/Rendering/Model/VertexFormat.h>
+
+#include <array>
 
 namespace CSBackend
 {
@@ -43,8 +44,6 @@ namespace CSBackend
         /// relevant shader attributes. A dynamic mesh does not have a fixed vertex or index format,
         /// instead this is set when the data is bound.
         ///
-        /// This also support batching of meshes.
-        ///
         /// This is not thread-safe and should only be accessed from the render thread.
         ///
         class GLDynamicMesh final
@@ -108,31 +107,6 @@ namespace CSBackend
             void Bind(GLShader* glShader, ChilliSource::PolygonType polygonType, const ChilliSource::VertexFormat& vertexFormat, ChilliSource::IndexFormat indexFormat, u32 numVertices, u32 numIndices,
                       const u8* vertexData, u32 vertexDataSize, const u8* indexData, u32 indexDataSize) noexcept;
             
-            /// Updates the vertex and index data stored in the dynamic mesh, binds the mesh batch for use
-            /// and applies attibutes to the given shader.
-            ///
-            /// @param glShader
-            ///     The shader to apply attributes to.
-            /// @param polygonType
-            ///     The polygon type of the batch.
-            /// @param vertexFormat
-            ///     The vertex format of the batch.
-            /// @param indexFormat
-            ///     The index format of the batch.
-            /// @param numVertices
-            ///     The number of vertices in the batch.
-            /// @param numIndices
-            ///     The number of indices in the batch.
-            /// @param vertexDataSize
-            ///     The total size of the vertex data in the batch.
-            /// @param indexDataSize
-            ///     The total size of the index data in the batch.
-            /// @param batchMeshDescs
-            ///     The list of meshes that should be batched.
-            ///
-            void Bind(GLShader* glShader, ChilliSource::PolygonType polygonType, const ChilliSource::VertexFormat& vertexFormat, ChilliSource::IndexFormat indexFormat, u32 numVertices, u32 numIndices,
-                      u32 vertexDataSize, u32 indexDataSize, const std::vector<ChilliSource::RenderMeshBatch::Mesh>& meshes) noexcept;
-            
             /// Called when graphics memory is lost, usually through the GLContext being destroyed
             /// on Android. Function will set a flag to handle safe destructing of this object, preventing
             /// us from trying to delete invalid memory.
@@ -157,14 +131,11 @@ namespace CSBackend
             ///
             void ApplyVertexAttributes(GLShader* glShader) const noexcept;
             
-            ChilliSource::LinearAllocator m_allocator;
-            
             u32 m_maxVertexDataSize;
             u32 m_maxIndexDataSize;
             u32 m_maxVertexAttributes;
             
             bool m_areVAOsSupported = false;
-            bool m_useMapBuffer = false;
             
             static const u32 k_numBuffers = 3;
             std::array<GLuint, k_numBuffers> m_vertexBufferHandles;
@@ -0,0 +1,111 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <CSBackend/Rendering/OpenGL/Model/GLInstanceBuffer.h>
+
+#include <CSBackend/Rendering/OpenGL/Base/GLError.h>
+#include <CSBackend/Rendering/OpenGL/Base/GLExtensions.h>
+#include <CSBackend/Rendering/OpenGL/Shader/GLShader.h>
+
+#include <ChilliSource/Core/Math/Matrix4.h>
+
+namespace CSBackend
+{
+    namespace OpenGL
+    {
+        //------------------------------------------------------------------------------
+        GLInstanceBuffer::GLInstanceBuffer(u32 maxInstances) noexcept
+            : m_maxInstances(maxInstances)
+        {
+            CS_ASSERT(m_maxInstances > 0, "Instance buffer must hold at least one instance.");
+            
+            glGenBuffers(1, &m_bufferHandle);
+            CS_ASSERT(m_bufferHandle != 0, "Invalid instance buffer.");
+            
+            glBindBuffer(GL_ARRAY_BUFFER, m_bufferHandle);
+            glBufferData(GL_ARRAY_BUFFER, m_maxInstances * sizeof(ChilliSource::Matrix4), nullptr, GL_STREAM_DRAW);
+            
+            CS_ASSERT_NOGLERROR("An OpenGL error occurred while creating GLInstanceBuffer.");
+        }
+        
+        //------------------------------------------------------------------------------
+        void GLInstanceBuffer::Bind(GLShader* glShader, const ChilliSource::Matrix4* worldMatrices, u32 numInstances) noexcept
+        {
+            CS_ASSERT(numInstances > 0 && numInstances <= m_maxInstances, "Invalid number of instances.");
+            
+            auto handle = glShader->GetInstanceWorldMatAttributeHandle();
+            CS_ASSERT(handle >= 0, "Shader doesn't contain an instance world matrix attribute.");
+            
+            glBindBuffer(GL_ARRAY_BUFFER, m_bufferHandle);
+            
+            // Orphan the previous contents so the upload doesn't stall on draws still using them.
+            auto dataSize = GLsizeiptr(numInstances * sizeof(ChilliSource::Matrix4));
+            glBufferData(GL_ARRAY_BUFFER, m_maxInstances * sizeof(ChilliSource::Matrix4), nullptr, GL_STREAM_DRAW);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, dataSize, worldMatrices);
+            
+            // Matrix4 is row major, and each row is applied to one column of the GLSL mat4. This
+            // matches the layout of matrix uniforms.
+            for (u32 i = 0; i < k_numWorldMatAttributes; ++i)
+            {
+                auto location = GLuint(handle) + i;
+                auto offset = reinterpret_cast<const GLvoid*>(u64(i * 4 * sizeof(f32)));
+                
+                glEnableVertexAttribArray(location);
+                glVertexAttribPointer(location, 4, GL_FLOAT, GL_FALSE, sizeof(ChilliSource::Matrix4), offset);
+                glVertexAttribDivisor(location, 1);
+            }
+            
+            CS_ASSERT_NOGLERROR("An OpenGL error occurred while binding GLInstanceBuffer.");
+        }
+        
+        //------------------------------------------------------------------------------
+        void GLInstanceBuffer::Unbind(GLShader* glShader) noexcept
+        {
+            auto handle = glShader->GetInstanceWorldMatAttributeHandle();
+            CS_ASSERT(handle >= 0, "Shader doesn't contain an instance world matrix attribute.");
+            
+            for (u32 i = 0; i < k_numWorldMatAttributes; ++i)
+            {
+                auto location = GLuint(handle) + i;
+                
+                glVertexAttribDivisor(location, 0);
+                glDisableVertexAttribArray(location);
+            }
+            
+            CS_ASSERT_NOGLERROR("An OpenGL error occurred while unbinding GLInstanceBuffer.");
+        }
+        
+        //------------------------------------------------------------------------------
+        GLInstanceBuffer::~GLInstanceBuffer() noexcept
+        {
+            if(!m_invalidData)
+            {
+                glDeleteBuffers(1, &m_bufferHandle);
+                
+                CS_ASSERT_NOGLERROR("An OpenGL error occurred while deleting GLInstanceBuffer.");
+            }
+        }
+    }
+}
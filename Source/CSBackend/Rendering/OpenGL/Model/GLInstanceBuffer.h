@@ -0,0 +1,106 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CSBACKEND_RENDERING_OPENGL_MODEL_GLINSTANCEBUFFER_H_
+#define _CSBACKEND_RENDERING_OPENGL_MODEL_GLINSTANCEBUFFER_H_
+
+#include <CSBackend/Rendering/OpenGL/ForwardDeclarations.h>
+#include <CSBackend/Rendering/OpenGL/Base/GLIncludes.h>
+
+#include <ChilliSource/ChilliSource.h>
+
+namespace CSBackend
+{
+    namespace OpenGL
+    {
+        /// A container for the per-instance vertex buffer used for hardware instancing. Each frame
+        /// the world matrices of the instances are uploaded to the buffer and bound to the instance
+        /// world matrix attribute of the current shader, with an attribute divisor of 1 so that
+        /// each instance reads the next matrix.
+        ///
+        /// This should only be used if instancing is supported by the device.
+        ///
+        /// This is not thread-safe and should only be accessed from the render thread.
+        ///
+        class GLInstanceBuffer final
+        {
+        public:
+            CS_DECLARE_NOCOPY(GLInstanceBuffer);
+            
+            /// The number of attribute locations occupied by the instance world matrix.
+            ///
+            static constexpr u32 k_numWorldMatAttributes = 4;
+            
+            /// Creates a new OpenGL instance buffer which can hold up to the given number of instances.
+            ///
+            /// @param maxInstances
+            ///     The maximum number of instances which can be bound at once.
+            ///
+            GLInstanceBuffer(u32 maxInstances) noexcept;
+            
+            /// @return The maximum number of instances which can be bound at once.
+            ///
+            u32 GetMaxInstances() const noexcept { return m_maxInstances; }
+            
+            /// Uploads the given world matrices to the instance buffer, and binds them to the instance
+            /// world matrix attribute of the given shader. The shader must contain the attribute.
+            ///
+            /// @param glShader
+            ///     The shader to apply the instance attributes to.
+            /// @param worldMatrices
+            ///     The world matrices of the instances.
+            /// @param numInstances
+            ///     The number of instances. Must not exceed the maximum number of instances.
+            ///
+            void Bind(GLShader* glShader, const ChilliSource::Matrix4* worldMatrices, u32 numInstances) noexcept;
+            
+            /// Disables the instance attributes of the given shader and resets their divisors, so that
+            /// the attribute locations can be safely reused by regular per-vertex data.
+            ///
+            /// @param glShader
+            ///     The shader whose instance attributes should be disabled.
+            ///
+            void Unbind(GLShader* glShader) noexcept;
+            
+            /// Called when graphics memory is lost, usually through the GLContext being destroyed
+            /// on Android. Function will set a flag to handle safe destructing of this object, preventing
+            /// us from trying to delete invalid memory.
+            ///
+            void Invalidate() noexcept { m_invalidData = true; }
+            
+            /// Destroys the OpenGL instance buffer.
+            ///
+            ~GLInstanceBuffer() noexcept;
+            
+        private:
+            u32 m_maxInstances;
+            GLuint m_bufferHandle = 0;
+            
+            bool m_invalidData = false;
+        };
+    }
+}
+
+#endif
@@ -34,6 +34,8 @@ namespace CSBackend
     {
         namespace
         {
+            u64 g_nextShaderGeneration = 1;
+            
             /// Compiles the given GLSL shader source.
             ///
             /// @param source
@@ -127,6 +129,7 @@ namespace CSBackend
         const std::string GLShader::k_attributeColour = "a_colour";
         const std::string GLShader::k_attributeWeights = "a_weights";
         const std::string GLShader::k_attributeJointIndices = "a_jointIndices";
+        const std::string GLShader::k_attributeInstanceWorldMat = "a_instanceWorldMat";
     
         //------------------------------------------------------------------------------
         GLShader::GLShader(const std::string& vertexShader, const std::string& fragmentShader) noexcept
@@ -134,6 +137,7 @@ namespace CSBackend
             m_vertexShaderId = CompileShader(vertexShader, GL_VERTEX_SHADER);
             m_fragmentShaderId = CompileShader(fragmentShader, GL_FRAGMENT_SHADER);
             m_programId = CreateProgram(m_vertexShaderId, m_fragmentShaderId);
+            m_generation = g_nextShaderGeneration++;
             
             BuildAttributeHandleMap();
         }
@@ -286,6 +290,8 @@ namespace CSBackend
 				}
             }
             
+            m_instanceWorldMatAttributeHandle = glGetAttribLocation(m_programId, k_attributeInstanceWorldMat.c_str());
+            
             CS_ASSERT_NOGLERROR("An OpenGL error occurred while populating attribute handles.");
         }
         
@@ -315,6 +321,13 @@ namespace CSBackend
             return uniformHandle;
         }
         
+        //------------------------------------------------------------------------------
+        void GLShader::Invalidate() noexcept
+        {
+            m_invalidData = true;
+            m_generation = g_nextShaderGeneration++;
+        }
+        
         //------------------------------------------------------------------------------
         GLShader::~GLShader() noexcept
         {
@@ -61,6 +61,7 @@ namespace CSBackend
             static const std::string k_attributeColour;
             static const std::string k_attributeWeights;
             static const std::string k_attributeJointIndices;
+            static const std::string k_attributeInstanceWorldMat;
             
             /// An enum describing the different types of failure policy. This is used when setting
             /// uniforms to judge if an assertion should occur when the uniform doesn't exist.
@@ -182,6 +183,21 @@ namespace CSBackend
             ///
             void SetUniform(const std::string& name, const ChilliSource::Vector4* values, u32 numValues, FailurePolicy failurePolicy = FailurePolicy::k_hard) noexcept;
             
+            /// Finds the handle of the uniform with the given name. Uniform handles are cached by
+            /// name, but callers which apply the same uniforms repeatedly should store the handle to
+            /// avoid the lookup. This will assert if the uniform doesn't exist and the hard failure
+            /// policy is specified.
+            ///
+            /// @param name
+            ///     The name of the uniform.
+            /// @param failurePolicy
+            ///     The failure policy.
+            ///
+            /// @return The uniform handle, or -1 if it doesn't exist in the shader and a silent failure
+            ///     policy was requested.
+            ///
+            GLint GetUniformHandle(const std::string& name, FailurePolicy failurePolicy) noexcept;
+            
             /// @param index
             ///     Index of the attribute as defined in vertex format
             ///
@@ -189,6 +205,27 @@ namespace CSBackend
             ///
             GLint GetAttributeHandle(u32 index) const noexcept { return m_attributeHandles[index]; }
             
+            /// The instance world matrix attribute is a mat4, and therefore occupies four consecutive
+            /// attribute locations, one per matrix row. Shaders which declare it can be rendered
+            /// using hardware instancing.
+            ///
+            /// @return Handle of the instance world matrix attribute in the shader. -1 if it doesn't
+            ///     exist.
+            ///
+            GLint GetInstanceWorldMatAttributeHandle() const noexcept { return m_instanceWorldMatAttributeHandle; }
+            
+            /// @return The OpenGL program id of the shader.
+            ///
+            GLuint GetProgramId() const noexcept { return m_programId; }
+            
+            /// Every shader is given a new generation when it is created or invalidated. Unlike the
+            /// address of the shader or the program id, this is never reused, so anything which caches
+            /// handles resolved against a shader should key the cache on the generation.
+            ///
+            /// @return The generation of the shader.
+            ///
+            u64 GetGeneration() const noexcept { return m_generation; }
+            
             /// Sets the attribute with the given name and data information. If the attribute doesn't
             /// exist then it will be ignored.
             ///
@@ -211,7 +248,7 @@ namespace CSBackend
             /// on Android. Function will set a flag to handle safe destructing of this object, preventing
             /// us from trying to delete invalid memory.
             ///
-            void Invalidate() noexcept { m_invalidData = true; }
+            void Invalidate() noexcept;
             
             /// Unloads the opengl shader.
             ///
@@ -222,24 +259,13 @@ namespace CSBackend
             ///
             void BuildAttributeHandleMap() noexcept;
             
-            /// Finds the handle of the shader with the given name. Uniform handles are cached. This
-            /// will assert if the uniform doesn't exist and the hard failure policy is specified.
-            ///
-            /// @param name
-            ///     The name of the uniform.
-            /// @param failurePolicy
-            ///     The failure policy.
-            ///
-            /// @return The uniform handle, or -1 if it doesn't exist in the shader and a silent failure
-            ///     policy was requested.
-            ///
-            GLint GetUniformHandle(const std::string& name, FailurePolicy failurePolicy) noexcept;
-            
             GLuint m_vertexShaderId = 0;
             GLuint m_fragmentShaderId = 0;
             GLuint m_programId = 0;
             std::unordered_map<std::string, GLint> m_uniformHandles;
             std::array<GLint, k_numAttributes> m_attributeHandles;
+            GLint m_instanceWorldMatAttributeHandle = -1;
+            u64 m_generation = 0;
             
             bool m_invalidData = false;
         };
@@ -39,12 +39,14 @@
 #include <ChilliSource/Core/Base/ColourUtils.h>
 #include <ChilliSource/Core/Base/CursorType.h>
 #include <ChilliSource/Core/Base/Device.h>
+#include <ChilliSource/Core/Base/EngineCounters.h>
 #include <ChilliSource/Core/Base/LifecycleManager.h>
 #include <ChilliSource/Core/Base/Logging.h>
 #include <ChilliSource/Core/Base/MakeSharedArray.h>
 #include <ChilliSource/Core/Base/PlatformSystem.h>
 #include <ChilliSource/Core/Base/QueryableInterface.h>
 #include <ChilliSource/Core/Base/Screen.h>
+#include <ChilliSource/Core/Base/SIMD.h>
 #include <ChilliSource/Core/Base/Singleton.h>
 #include <ChilliSource/Core/Base/StandardMacros.h>
 #include <ChilliSource/Core/Base/Utils.h>
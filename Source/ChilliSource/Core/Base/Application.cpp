@@ -30,6 +30,7 @@
 
 #include <ChilliSource/Core/Base/AppConfig.h>
 #include <ChilliSource/Core/Base/Device.h>
+#include <ChilliSource/Core/Base/EngineCounters.h>
 #include <ChilliSource/Core/Base/Logging.h>
 #include <ChilliSource/Core/Base/PlatformSystem.h>
 #include <ChilliSource/Core/Base/Screen.h>
@@ -46,6 +47,7 @@
 #include <ChilliSource/Core/State/StateManager.h>
 #include <ChilliSource/Core/String/StringParser.h>
 #include <ChilliSource/Core/Time/CoreTimer.h>
+#include <ChilliSource/Core/Time/Profiler.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
 
 #include <ChilliSource/Input/DeviceButtons/DeviceButtonSystem.h>
@@ -116,7 +118,16 @@ namespace ChilliSource
                 CS_ASSERT(cameraEntity, "Active CameraComponent must be attached to an entity.");
                 
                 const auto& transform = cameraEntity->GetTransform();
-                renderCamera = RenderCamera(transform.GetWorldTransform(), camera->GetProjection(), transform.GetWorldOrientation());
+                auto interpolationFactor = Application::Get()->GetInterpolationFactor();
+                if (interpolationFactor < 1.0f)
+                {
+                    auto worldTransform = transform.GetInterpolatedWorldTransform(interpolationFactor);
+                    renderCamera = RenderCamera(worldTransform, camera->GetProjection(), Quaternion(worldTransform));
+                }
+                else
+                {
+                    renderCamera = RenderCamera(transform.GetWorldTransform(), camera->GetProjection(), transform.GetWorldOrientation());
+                }
             }
             
             return renderCamera;
@@ -188,6 +199,32 @@ namespace ChilliSource
         return k_updateIntervalMax;
     }
 
+    //------------------------------------------------------------------------------
+    void Application::SetInterpolationEnabled(bool enabled) noexcept
+    {
+        if (enabled && !m_isInterpolationEnabled && m_stateManager->GetActiveState() != nullptr)
+        {
+            //Discard any state stored when interpolation was last enabled.
+            for (auto scene : m_stateManager->GetActiveState()->GetScenes())
+            {
+                scene->StoreEntityInterpolationStates();
+            }
+        }
+        
+        m_isInterpolationEnabled = enabled;
+    }
+    
+    //------------------------------------------------------------------------------
+    f32 Application::GetInterpolationFactor() const noexcept
+    {
+        if (!m_isInterpolationEnabled)
+        {
+            return 1.0f;
+        }
+        
+        return std::min(m_updateIntervalRemainder / GetUpdateInterval(), 1.0f);
+    }
+    
     //------------------------------------------------------------------------------
     void Application::SetUpdateSpeed(f32 speed) noexcept
     {
@@ -388,6 +425,8 @@ namespace ChilliSource
     //------------------------------------------------------------------------------
     void Application::ProcessRenderSnapshotEvent() noexcept
     {
+        CS_PROFILE_SCOPE("Application::ProcessRenderSnapshotEvent");
+        
         CS_RELEASE_ASSERT(ChilliSource::Application::Get()->GetTaskScheduler()->IsMainThread(), "Tried to render to target from background thread.");
         
         auto activeState = m_stateManager->GetActiveState();
@@ -414,6 +453,8 @@ namespace ChilliSource
     //------------------------------------------------------------------------------
     void Application::RenderScene(Scene* scene, TargetGroup* target) noexcept
     {
+        CS_PROFILE_SCOPE("Application::RenderScene");
+        
         CS_RELEASE_ASSERT(GetTaskScheduler()->IsMainThread(), "Tried to render scene from background thread.");
         
         auto targetToUse = target == nullptr ? scene->GetRenderTarget() : target;
@@ -423,6 +464,8 @@ namespace ChilliSource
         TargetType targetType;
         const RenderTargetGroup* targetGroup;
         
+        auto waitStartTime = Profiler::GetTimestamp();
+        
         if(targetToUse == nullptr)
         {
             // Main (screen) render target
@@ -443,7 +486,9 @@ namespace ChilliSource
             targetType = TargetType::k_offscreen;
             targetGroup = targetToUse->GetRenderTargetGroup();
         }
-
+        
+        auto snapshotStartTime = Profiler::GetTimestamp();
+        m_frameRenderPipelineWaitTime += snapshotStartTime - waitStartTime;
         
         RenderSnapshot renderSnapshot = m_renderer->CreateRenderSnapshot(targetGroup, resolution, clearColour, GenerateRenderCamera(scene));
         
@@ -455,10 +500,14 @@ namespace ChilliSource
         m_stateManager->RenderSnapshotStates(targetType, renderSnapshot, frameAllocator);
         scene->RenderSnapshotEntities(renderSnapshot, frameAllocator);
         
+        waitStartTime = Profiler::GetTimestamp();
+        m_frameSnapshotTime += waitStartTime - snapshotStartTime;
+        
         if(targetToUse == nullptr)
         {
             // The renderer takes ownership of the frame allocator and will return it to the allocator queue
             m_renderer->ProcessRenderSnapshots(frameAllocator, std::move(renderSnapshot), std::move(m_pendingRenderSnapshots));
+            m_frameRenderPipelineWaitTime += Profiler::GetTimestamp() - waitStartTime;
         }
         else
         {
@@ -474,6 +523,8 @@ namespace ChilliSource
         
         Logging::Create();
         
+        CS_PROFILE_THREAD_NAME("Main");
+        
         //Create all application systems.
         m_isSystemCreationAllowed = true;
         CreateDefaultSystems();
@@ -524,6 +575,9 @@ namespace ChilliSource
     //------------------------------------------------------------------------------
     void Application::Update(f32 deltaTime, TimeIntervalSecs timestamp) noexcept
     {
+        CS_PROFILE_SCOPE("Application::Update");
+        
+        auto updateStartTime = Profiler::GetTimestamp();
 
 #if CS_ENABLE_DEBUG
         //When debugging we may have breakpoints so restrict the time between
@@ -553,8 +607,18 @@ namespace ChilliSource
         bool isFirstFrame = (m_frameIndex == 0);
         while((m_updateIntervalRemainder >= GetUpdateInterval()) || isFirstFrame)
         {
+            CS_PROFILE_SCOPE("Application::FixedUpdate");
+            
             m_updateIntervalRemainder -= GetUpdateInterval();
             
+            if (m_isInterpolationEnabled)
+            {
+                for (auto scene : m_stateManager->GetActiveState()->GetScenes())
+                {
+                    scene->StoreEntityInterpolationStates();
+                }
+            }
+            
             //update all of the application systems
             for (const AppSystemUPtr& system : m_systems)
             {
@@ -576,16 +640,35 @@ namespace ChilliSource
         
         m_stateManager->UpdateStates(deltaTime);
         
-        m_taskScheduler->ExecuteMainThreadTasks();
+        {
+            CS_PROFILE_SCOPE("Application::ExecuteMainThreadTasks");
+            m_taskScheduler->ExecuteMainThreadTasks();
+        }
+        
+        //Any scenes rendered to targets during the update are timed separately.
+        auto updateTime = Profiler::GetTimestamp() - updateStartTime - m_frameSnapshotTime - m_frameRenderPipelineWaitTime;
         
         ProcessRenderSnapshotEvent();
         
         ++m_frameIndex;
+        
+        EngineCounters::Set(EngineCounter::k_updateTime, s64(updateTime));
+        EngineCounters::Set(EngineCounter::k_snapshotTime, s64(m_frameSnapshotTime));
+        EngineCounters::Set(EngineCounter::k_renderPipelineWaitTime, s64(m_frameRenderPipelineWaitTime));
+        m_frameSnapshotTime = 0;
+        m_frameRenderPipelineWaitTime = 0;
+        
+        EngineCounters::Set(EngineCounter::k_droppedLogMessages, Logging::Get()->GetNumDroppedMessages());
+        EngineCounters::EndFrame();
+        
+        CS_PROFILE_END_FRAME();
     }
     
     //------------------------------------------------------------------------------
     void Application::Render() noexcept
     {
+        CS_PROFILE_SCOPE("Application::Render");
+        
         m_renderer->ProcessRenderCommandBuffer();
     }
     
@@ -650,7 +733,11 @@ namespace ChilliSource
         //Needs to be destroyed after the resource pool as materials rely on this system
         m_renderMaterialGroupManager->Destroy();
         
+        //Queued log messages may be written to file, so must be output while the file system still exists.
+        Logging::Get()->StopFlushThread();
+        
         m_systems.clear();
+        m_fileSystem = nullptr;
         
         Logging::Destroy();
         
@@ -180,6 +180,34 @@ namespace ChilliSource
         ///
         f32 GetUpdateIntervalMax() const noexcept;
 
+        /// Sets whether or not presentation is decoupled from simulation. When enabled, the fixed
+        /// update drives simulation and each rendered frame presents entity transforms interpolated
+        /// between their state before and after the last fixed update, using the fraction of the
+        /// update interval which has accumulated since. This keeps motion smooth when the frame rate
+        /// differs from the fixed update rate, at the cost of up to one update interval of latency.
+        /// Objects should be moved in OnFixedUpdate() while this is enabled. Defaults to disabled.
+        ///
+        /// This is not thread-safe and should only be called on the main thread.
+        ///
+        /// @param enabled
+        ///     Whether or not interpolation should be enabled.
+        ///
+        void SetInterpolationEnabled(bool enabled) noexcept;
+        
+        /// This is not thread-safe and should only be called on the main thread.
+        ///
+        /// @return Whether or not presentation is interpolated between fixed updates.
+        ///
+        bool IsInterpolationEnabled() const noexcept { return m_isInterpolationEnabled; }
+        
+        /// This is not thread-safe and should only be called on the main thread.
+        ///
+        /// @return The factor, in the range 0 - 1, by which rendered transforms should be interpolated
+        ///     between the previous and current fixed update. This is always 1 if interpolation is
+        ///     disabled.
+        ///
+        f32 GetInterpolationFactor() const noexcept;
+        
         /// Sets a multiplier for slowing or speeding up the delta time passed to
         /// each system and state.
         ///
@@ -469,7 +497,10 @@ namespace ChilliSource
         f32 m_updateInterval;
         f32 m_updateSpeed = 1.0f;
         f32 m_updateIntervalRemainder = 0.0f;
+        u64 m_frameSnapshotTime = 0;
+        u64 m_frameRenderPipelineWaitTime = 0;
         bool m_isSystemCreationAllowed = false;
+        bool m_isInterpolationEnabled = false;
         std::string m_appVersion;
         
         static Application* s_application;
@@ -0,0 +1,181 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Core/Base/EngineCounters.h>
+
+#include <chrono>
+#include <mutex>
+
+namespace ChilliSource
+{
+    namespace
+    {
+        const char* k_counterNames[] =
+        {
+            "ResourcesLoaded",
+            "RenderObjects",
+            "RenderPasses",
+            "DrawCalls",
+            "MeshBatches",
+            "BatchedObjects",
+            "MaterialSwitches",
+            "TextureUploads",
+            "FrameAllocatorPages",
+            "FrameAllocatorBytes",
+            "PoolAllocations",
+            "PoolCapacity",
+            "CachedResources",
+            "SmallTaskQueueDepth",
+            "LargeTaskQueueDepth",
+            "MainThreadTaskQueueDepth",
+            "FileTaskQueueDepth",
+            "DroppedLogMessages",
+            "UpdateTimeMicroS",
+            "SnapshotTimeMicroS",
+            "RenderPrepTimeMicroS",
+            "RenderSubmitTimeMicroS",
+            "RenderPipelineWaitTimeMicroS"
+        };
+        
+        static_assert(sizeof(k_counterNames) / sizeof(k_counterNames[0]) == static_cast<u32>(EngineCounter::k_total), "A name must be provided for every counter.");
+        
+        std::atomic<u32> g_logIntervalMs(0);
+        std::chrono::steady_clock::time_point g_lastLogTime;
+        
+        //Held while the per rendered frame values are published, so a report always contains a complete set.
+        std::mutex g_renderedFrameMutex;
+    }
+    
+    //------------------------------------------------------------------------------
+    void EngineCounterValues::Add(const EngineCounterValues& other) noexcept
+    {
+        for (u32 i = 0; i < static_cast<u32>(EngineCounter::k_total); ++i)
+        {
+            m_values[i] += other.m_values[i];
+        }
+    }
+    
+    std::atomic<s64> EngineCounters::s_currentValues[static_cast<u32>(EngineCounter::k_total)];
+    std::atomic<s64> EngineCounters::s_lastFrameValues[static_cast<u32>(EngineCounter::k_total)];
+    
+    //------------------------------------------------------------------------------
+    s64 EngineCounters::GetValue(EngineCounter counter) noexcept
+    {
+        CS_ASSERT(counter != EngineCounter::k_total, "Invalid counter.");
+        
+        return s_lastFrameValues[static_cast<u32>(counter)].load(std::memory_order_relaxed);
+    }
+    
+    //------------------------------------------------------------------------------
+    const char* EngineCounters::GetName(EngineCounter counter) noexcept
+    {
+        CS_ASSERT(counter != EngineCounter::k_total, "Invalid counter.");
+        
+        return k_counterNames[static_cast<u32>(counter)];
+    }
+    
+    //------------------------------------------------------------------------------
+    bool EngineCounters::IsPerFrame(EngineCounter counter) noexcept
+    {
+        return static_cast<u32>(counter) < static_cast<u32>(EngineCounter::k_frameAllocatorPages);
+    }
+    
+    //------------------------------------------------------------------------------
+    bool EngineCounters::IsPerRenderedFrame(EngineCounter counter) noexcept
+    {
+        return static_cast<u32>(counter) >= static_cast<u32>(EngineCounter::k_renderObjects) && static_cast<u32>(counter) < static_cast<u32>(EngineCounter::k_frameAllocatorPages);
+    }
+    
+    //------------------------------------------------------------------------------
+    std::string EngineCounters::CreateReport() noexcept
+    {
+        std::string report;
+        
+        std::unique_lock<std::mutex> lock(g_renderedFrameMutex);
+        for (u32 i = 0; i < static_cast<u32>(EngineCounter::k_total); ++i)
+        {
+            report += k_counterNames[i];
+            report += "=";
+            report += ToString(s_lastFrameValues[i].load(std::memory_order_relaxed));
+            report += "\n";
+        }
+        
+        return report;
+    }
+    
+    //------------------------------------------------------------------------------
+    void EngineCounters::SetLogInterval(f32 interval) noexcept
+    {
+        CS_ASSERT(interval >= 0.0f, "Log interval cannot be negative.");
+        
+        g_logIntervalMs = u32(interval * 1000.0f);
+    }
+    
+    //------------------------------------------------------------------------------
+    void EngineCounters::EndFrame() noexcept
+    {
+        for (u32 i = 0; i < static_cast<u32>(EngineCounter::k_total); ++i)
+        {
+            if (IsPerRenderedFrame(EngineCounter(i)))
+            {
+                continue;
+            }
+            
+            if (IsPerFrame(EngineCounter(i)))
+            {
+                s_lastFrameValues[i].store(s_currentValues[i].exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+            }
+            else
+            {
+                s_lastFrameValues[i].store(s_currentValues[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+            }
+        }
+        
+        auto logIntervalMs = g_logIntervalMs.load();
+        if (logIntervalMs > 0)
+        {
+            auto now = std::chrono::steady_clock::now();
+            if (now - g_lastLogTime >= std::chrono::milliseconds(logIntervalMs))
+            {
+                g_lastLogTime = now;
+                CS_LOG_VERBOSE("Engine counters:\n" + CreateReport());
+            }
+        }
+    }
+    
+    //------------------------------------------------------------------------------
+    void EngineCounters::EndRenderedFrame(const EngineCounterValues& renderedFrameValues) noexcept
+    {
+        std::unique_lock<std::mutex> lock(g_renderedFrameMutex);
+        for (u32 i = 0; i < static_cast<u32>(EngineCounter::k_total); ++i)
+        {
+            if (IsPerRenderedFrame(EngineCounter(i)))
+            {
+                auto value = renderedFrameValues.GetValue(EngineCounter(i)) + s_currentValues[i].exchange(0, std::memory_order_relaxed);
+                s_lastFrameValues[i].store(value, std::memory_order_relaxed);
+            }
+        }
+    }
+}
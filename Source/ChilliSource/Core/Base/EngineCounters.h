@@ -0,0 +1,230 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_BASE_ENGINECOUNTERS_H_
+#define _CHILLISOURCE_CORE_BASE_ENGINECOUNTERS_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <array>
+#include <atomic>
+#include <string>
+
+namespace ChilliSource
+{
+    /// The counters published by the engine.
+    ///
+    /// Per-frame counters accumulate over a frame and are reset at the end of each frame,
+    /// while gauges hold their value until it is next changed. Per rendered frame counters
+    /// are gathered by the render pipeline for each frame it prepares, and are published
+    /// together once that frame has been rendered.
+    ///
+    /// The timing gauges hold the duration of the most recently completed update, render
+    /// snapshot, render preparation and render command processing stages in microseconds,
+    /// along with the time the main thread spent blocked waiting on the render pipeline in
+    /// the last frame.
+    ///
+    enum class EngineCounter
+    {
+        //Per-frame
+        k_resourcesLoaded,
+        
+        //Per rendered frame
+        k_renderObjects,
+        k_renderPasses,
+        k_drawCalls,
+        k_meshBatches,
+        k_batchedObjects,
+        k_materialSwitches,
+        k_textureUploads,
+        
+        //Gauges
+        k_frameAllocatorPages,
+        k_frameAllocatorBytes,
+        k_poolAllocations,
+        k_poolCapacity,
+        k_cachedResources,
+        k_smallTaskQueueDepth,
+        k_largeTaskQueueDepth,
+        k_mainThreadTaskQueueDepth,
+        k_fileTaskQueueDepth,
+        k_droppedLogMessages,
+        k_updateTime,
+        k_snapshotTime,
+        k_renderPrepTime,
+        k_renderSubmitTime,
+        k_renderPipelineWaitTime,
+        
+        k_total
+    };
+    
+    /// A set of counter values gathered for a single frame. The render pipeline uses this to
+    /// accumulate the counts for a frame as it moves between threads, so they can be published
+    /// together once the frame has been rendered.
+    ///
+    /// This is not thread-safe.
+    ///
+    class EngineCounterValues final
+    {
+    public:
+        /// Adds to the given counter.
+        ///
+        /// @param counter
+        ///     The counter.
+        /// @param amount
+        ///     (Optional) The amount to add. Defaults to 1.
+        ///
+        void Increment(EngineCounter counter, s64 amount = 1) noexcept { m_values[static_cast<u32>(counter)] += amount; }
+        
+        /// Adds all values in the given set to this one.
+        ///
+        /// @param other
+        ///     The values to add.
+        ///
+        void Add(const EngineCounterValues& other) noexcept;
+        
+        /// @param counter
+        ///     The counter.
+        ///
+        /// @return The value of the counter.
+        ///
+        s64 GetValue(EngineCounter counter) const noexcept { return m_values[static_cast<u32>(counter)]; }
+        
+    private:
+        std::array<s64, static_cast<u32>(EngineCounter::k_total)> m_values = {{}};
+    };
+    
+    /// A registry of counters which engine systems publish into each frame, allowing the
+    /// number of render objects, draw calls, allocator pages, queued tasks and so on used
+    /// by a frame to be queried from within the app.
+    ///
+    /// Counters can be updated from any thread without locking. Values are queried for the
+    /// last completed frame, so are stable while the current frame is in progress. Per
+    /// rendered frame counters are instead queried for the last frame the render thread
+    /// finished, so every value in the set describes the same frame regardless of how far
+    /// the render pipeline runs behind the main thread. A report of all counters can optionally
+    /// be logged periodically, which is useful for catching regressions in automated runs.
+    ///
+    class EngineCounters final
+    {
+    public:
+        /// Adds to the given counter.
+        ///
+        /// @param counter
+        ///     The counter.
+        /// @param amount
+        ///     (Optional) The amount to add. May be negative for gauges. Defaults to 1.
+        ///
+        static void Increment(EngineCounter counter, s64 amount = 1) noexcept
+        {
+            s_currentValues[static_cast<u32>(counter)].fetch_add(amount, std::memory_order_relaxed);
+        }
+        
+        /// Sets the value of the given counter.
+        ///
+        /// @param counter
+        ///     The counter.
+        /// @param value
+        ///     The new value.
+        ///
+        static void Set(EngineCounter counter, s64 value) noexcept
+        {
+            s_currentValues[static_cast<u32>(counter)].store(value, std::memory_order_relaxed);
+        }
+        
+        /// @param counter
+        ///     The counter.
+        ///
+        /// @return The value of the counter at the end of the last completed frame.
+        ///
+        static s64 GetValue(EngineCounter counter) noexcept;
+        
+        /// @param counter
+        ///     The counter.
+        ///
+        /// @return The name of the counter, e.g. "DrawCalls".
+        ///
+        static const char* GetName(EngineCounter counter) noexcept;
+        
+        /// @param counter
+        ///     The counter.
+        ///
+        /// @return Whether the counter is reset at the end of each frame, rather than being a gauge.
+        ///     This includes per rendered frame counters.
+        ///
+        static bool IsPerFrame(EngineCounter counter) noexcept;
+        
+        /// @param counter
+        ///     The counter.
+        ///
+        /// @return Whether the counter is gathered by the render pipeline and published once each
+        ///     frame has been rendered.
+        ///
+        static bool IsPerRenderedFrame(EngineCounter counter) noexcept;
+        
+        /// Creates a report of the value of every counter for the last completed frame. Each
+        /// counter is output on its own line in the form "Name=Value" so it can be easily parsed.
+        ///
+        /// @return The report.
+        ///
+        static std::string CreateReport() noexcept;
+        
+        /// Sets how often a report of all counters is logged. Defaults to 0, which disables
+        /// logging.
+        ///
+        /// @param interval
+        ///     The interval between reports in seconds, or 0 to disable logging.
+        ///
+        static void SetLogInterval(f32 interval) noexcept;
+        
+    private:
+        friend class Application;
+        friend class Renderer;
+        
+        EngineCounters() = delete;
+        
+        /// Stores the current values as the last frame's values and resets all per-frame
+        /// counters, logging a report if the log interval has elapsed. This should be called
+        /// once at the end of each frame by the Application.
+        ///
+        static void EndFrame() noexcept;
+        
+        /// Publishes the per rendered frame counters for a frame which has just been rendered.
+        /// Any increments made to those counters with Increment() on the render thread while the
+        /// frame was processed, such as texture uploads, are added to the given values. This
+        /// should be called on the render thread by the Renderer once each frame has been
+        /// processed.
+        ///
+        /// @param renderedFrameValues
+        ///     The values gathered while preparing the frame.
+        ///
+        static void EndRenderedFrame(const EngineCounterValues& renderedFrameValues) noexcept;
+        
+        static std::atomic<s64> s_currentValues[static_cast<u32>(EngineCounter::k_total)];
+        static std::atomic<s64> s_lastFrameValues[static_cast<u32>(EngineCounter::k_total)];
+    };
+}
+
+#endif
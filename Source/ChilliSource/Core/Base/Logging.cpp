@@ -29,8 +29,10 @@
 #include <ChilliSource/Core/Base/Logging.h>
 
 #include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Container/concurrent_spsc_queue.h>
 #include <ChilliSource/Core/File/FileSystem.h>
 
+#include <chrono>
 #include <iostream>
 
 #ifdef CS_TARGETPLATFORM_ANDROID
@@ -51,6 +53,7 @@ extern "C"
 
 #ifdef CS_TARGETPLATFORM_IOS
 #include <Foundation/NSThread.h>
+#include <pthread.h>
 #endif
 
 #ifdef CS_ENABLE_DEBUG
@@ -69,6 +72,61 @@ namespace ChilliSource
 #ifdef CS_ENABLE_LOGTOFILE
         const u32 k_maxLogBufferSize = 2048;
         const std::string k_logFileName = "ChilliSourceLog.txt";
+#endif
+        const u32 k_threadLogBufferCapacity = 256;
+        const std::chrono::milliseconds k_flushInterval(10);
+        
+        /// The buffer for the current thread. The generation is used to identify buffers
+        /// which belong to a previous instance of the logger.
+        ///
+        struct ThreadLogBuffer final
+        {
+            u32 m_generation = 0;
+            std::shared_ptr<void> m_buffer;
+        };
+        
+        std::atomic<u32> g_nextGeneration(1);
+        
+#ifdef CS_TARGETPLATFORM_IOS
+        /// iOS doesn't support C++ thread_local so a pthread key is used instead.
+        ///
+        pthread_key_t g_threadLogBufferKey;
+        pthread_once_t g_threadLogBufferKeyOnce = PTHREAD_ONCE_INIT;
+        
+        //------------------------------------------------------------------------------
+        void DeleteThreadLogBuffer(void* threadLogBuffer) noexcept
+        {
+            delete static_cast<ThreadLogBuffer*>(threadLogBuffer);
+        }
+        
+        //------------------------------------------------------------------------------
+        void CreateThreadLogBufferKey() noexcept
+        {
+            pthread_key_create(&g_threadLogBufferKey, DeleteThreadLogBuffer);
+        }
+        
+        //------------------------------------------------------------------------------
+        ThreadLogBuffer& GetThreadLogBufferStorage() noexcept
+        {
+            pthread_once(&g_threadLogBufferKeyOnce, CreateThreadLogBufferKey);
+            
+            auto threadLogBuffer = static_cast<ThreadLogBuffer*>(pthread_getspecific(g_threadLogBufferKey));
+            if (threadLogBuffer == nullptr)
+            {
+                threadLogBuffer = new ThreadLogBuffer();
+                pthread_setspecific(g_threadLogBufferKey, threadLogBuffer);
+            }
+            
+            return *threadLogBuffer;
+        }
+#else
+        thread_local ThreadLogBuffer g_threadLogBuffer;
+        
+        //------------------------------------------------------------------------------
+        ThreadLogBuffer& GetThreadLogBufferStorage() noexcept
+        {
+            return g_threadLogBuffer;
+        }
 #endif
     }
     
@@ -81,6 +139,12 @@ namespace ChilliSource
         assert(s_logging == nullptr);
 #endif
         s_logging = new Logging();
+        
+        //The flusher thread takes the flush mutex before doing anything else, so holding it here ensures
+        //the thread id is set before the thread can read it.
+        std::unique_lock<std::mutex> lock(s_logging->m_flushMutex);
+        s_logging->m_flushThread = std::thread(&Logging::FlushThreadMain, s_logging);
+        s_logging->m_flushThreadId = s_logging->m_flushThread.get_id();
     }
     //-----------------------------------------------
     //-----------------------------------------------
@@ -94,9 +158,11 @@ namespace ChilliSource
     //----------------------------------------------
     //----------------------------------------------
     Logging::Logging()
+        :
 #ifdef CS_ENABLE_LOGTOFILE
-        : m_isFirstLog(true)
+        m_isFirstLog(true),
 #endif
+        m_generation(g_nextGeneration++), m_numDroppedMessages(0), m_numUnreportedDroppedMessages(0), m_isFlushThreadRunning(true)
     {
     }
     //----------------------------------------------
@@ -104,7 +170,7 @@ namespace ChilliSource
     void Logging::LogVerbose(const std::string &in_message)
     {
 #if defined CS_LOGLEVEL_VERBOSE
-        LogMessage(LogLevel::k_verbose, in_message);
+        LogMessage(LogLevel::k_verbose, "", in_message);
 #endif
     }
     //----------------------------------------------
@@ -112,7 +178,7 @@ namespace ChilliSource
     void Logging::LogWarning(const std::string &in_message)
     {
 #if defined CS_LOGLEVEL_VERBOSE || defined CS_LOGLEVEL_WARNING
-        LogMessage(LogLevel::k_warning, "WARNING: " + in_message);
+        LogMessage(LogLevel::k_warning, "WARNING: ", in_message);
 #endif
     }
     //----------------------------------------------
@@ -120,7 +186,7 @@ namespace ChilliSource
     void Logging::LogError(const std::string &in_message)
     {
 #if defined CS_LOGLEVEL_VERBOSE || defined CS_LOGLEVEL_WARNING || defined CS_LOGLEVEL_ERROR
-        LogMessage(LogLevel::k_error, "ERROR: " + in_message);
+        LogMessage(LogLevel::k_error, "ERROR: ", in_message);
 #endif
     }
     //----------------------------------------------
@@ -128,8 +194,12 @@ namespace ChilliSource
     void Logging::LogFatal(const std::string &in_message)
     {
 #if defined CS_LOGLEVEL_VERBOSE || defined CS_LOGLEVEL_WARNING || defined CS_LOGLEVEL_ERROR || defined CS_LOGLEVEL_FATAL
-        LogMessage(LogLevel::k_error, "FATAL: " + in_message);
-        LogMessage(LogLevel::k_error, "ChilliSource is exiting...");
+        //Output everything logged before the fatal error, then stop the flusher thread so the
+        //fatal message is output immediately.
+        StopFlushThread();
+        
+        LogMessage(LogLevel::k_error, "FATAL: ", in_message);
+        LogMessage(LogLevel::k_error, "", "ChilliSource is exiting...");
 #endif
 
 #ifdef CS_TARGETPLATFORM_ANDROID
@@ -142,45 +212,215 @@ namespace ChilliSource
 #endif
 #endif
     }
+    //------------------------------------------------------------------------------
+    void Logging::Flush() noexcept
+    {
+        if (std::this_thread::get_id() == m_flushThreadId)
+        {
+            return;
+        }
+        
+        std::unique_lock<std::mutex> lock(m_flushMutex);
+        if (m_isStopRequested == true)
+        {
+            return;
+        }
+        
+        auto flushRequestId = ++m_flushRequestId;
+        m_flushCondition.notify_one();
+        m_flushCompleteCondition.wait(lock, [this, flushRequestId]()
+        {
+            return m_flushCompleteId >= flushRequestId || m_isStopRequested == true;
+        });
+    }
+    
+    //------------------------------------------------------------------------------
+    u32 Logging::GetNumDroppedMessages() const noexcept
+    {
+        return m_numDroppedMessages.load();
+    }
+    
     //-----------------------------------------------------
     //-----------------------------------------------------
     void Logging::Destroy()
     {
         CS_SAFEDELETE(s_logging);
     }
-    //-----------------------------------------------------
-    //-----------------------------------------------------
-    void Logging::LogMessage(LogLevel in_logLevel, const std::string& in_message)
+    
+    //------------------------------------------------------------------------------
+    void Logging::LogMessage(LogLevel logLevel, const char* prefix, std::string message, std::function<std::string()> formatter) noexcept
+    {
+        //Messages logged on the flusher thread itself, for example by the file system while
+        //writing the log file, or after it has stopped are output immediately.
+        if (m_isFlushThreadRunning.load(std::memory_order_acquire) == false || std::this_thread::get_id() == m_flushThreadId)
+        {
+            OutputMessage(logLevel, prefix + (formatter ? formatter() : message));
+            return;
+        }
+        
+        LogEntry entry;
+        entry.m_logLevel = logLevel;
+        entry.m_prefix = prefix;
+        entry.m_message = std::move(message);
+        entry.m_formatter = std::move(formatter);
+        
+        if (GetThreadLogBuffer()->try_push(std::move(entry)) == false)
+        {
+            ++m_numDroppedMessages;
+            ++m_numUnreportedDroppedMessages;
+        }
+    }
+    
+    //------------------------------------------------------------------------------
+    Logging::LogBuffer* Logging::GetThreadLogBuffer() noexcept
+    {
+        auto& threadLogBuffer = GetThreadLogBufferStorage();
+        
+        if (threadLogBuffer.m_generation != m_generation)
+        {
+            auto logBuffer = std::make_shared<LogBuffer>(k_threadLogBufferCapacity);
+            
+            std::unique_lock<std::mutex> lock(m_logBuffersMutex);
+            m_logBuffers.push_back(logBuffer);
+            lock.unlock();
+            
+            threadLogBuffer.m_generation = m_generation;
+            threadLogBuffer.m_buffer = std::move(logBuffer);
+        }
+        
+        return static_cast<LogBuffer*>(threadLogBuffer.m_buffer.get());
+    }
+    
+    //------------------------------------------------------------------------------
+    void Logging::FlushThreadMain() noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_flushMutex);
+        
+        while (m_isStopRequested == false)
+        {
+            m_flushCondition.wait_for(lock, k_flushInterval, [this]()
+            {
+                return m_flushRequestId != m_flushCompleteId || m_isStopRequested == true;
+            });
+            
+            auto flushRequestId = m_flushRequestId;
+            lock.unlock();
+            
+            DrainLogBuffers();
+            
+            lock.lock();
+            m_flushCompleteId = flushRequestId;
+            m_flushCompleteCondition.notify_all();
+        }
+        
+        lock.unlock();
+        DrainLogBuffers();
+    }
+    
+    //------------------------------------------------------------------------------
+    void Logging::DrainLogBuffers() noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_logBuffersMutex);
+        
+        LogEntry entry;
+        for (auto it = m_logBuffers.begin(); it != m_logBuffers.end();)
+        {
+            while ((*it)->try_pop(entry) == true)
+            {
+                OutputMessage(entry.m_logLevel, entry.m_prefix + (entry.m_formatter ? entry.m_formatter() : entry.m_message));
+                entry.m_formatter = nullptr;
+            }
+            
+            //If this is the only reference the owning thread has exited and everything it
+            //logged has now been output.
+            if (it->use_count() == 1)
+            {
+                it = m_logBuffers.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        
+        lock.unlock();
+        
+        auto numDroppedMessages = m_numUnreportedDroppedMessages.exchange(0);
+        if (numDroppedMessages > 0)
+        {
+            OutputMessage(LogLevel::k_warning, "WARNING: " + ToString(numDroppedMessages) + " log message(s) were dropped as the log buffer was full.");
+        }
+        
+#ifdef CS_TARGETPLATFORM_RPI
+        std::cout.flush();
+#endif
+    }
+    
+    //------------------------------------------------------------------------------
+    void Logging::StopFlushThread() noexcept
+    {
+        if (std::this_thread::get_id() == m_flushThreadId)
+        {
+            m_isFlushThreadRunning = false;
+            return;
+        }
+        
+        std::unique_lock<std::mutex> lock(m_flushMutex);
+        m_isStopRequested = true;
+        m_flushCondition.notify_one();
+        m_flushCompleteCondition.notify_all();
+        lock.unlock();
+        
+        if (m_flushThread.joinable() == true)
+        {
+            m_flushThread.join();
+        }
+        
+        m_isFlushThreadRunning = false;
+        
+        //Anything queued by other threads while the flusher thread was stopping is output here.
+        DrainLogBuffers();
+    }
+    
+    //------------------------------------------------------------------------------
+    void Logging::OutputMessage(LogLevel logLevel, const std::string& message) noexcept
     {
 #ifdef CS_TARGETPLATFORM_ANDROID
-        switch (in_logLevel)
+        switch (logLevel)
         {
             case LogLevel::k_verbose:
-                CS_ANDROID_LOG_VERBOSE(in_message.c_str());
+                CS_ANDROID_LOG_VERBOSE(message.c_str());
                 break;
             case LogLevel::k_warning:
-                CS_ANDROID_LOG_WARNING(in_message.c_str());
+                CS_ANDROID_LOG_WARNING(message.c_str());
                 break;
             case LogLevel::k_error:
-                CS_ANDROID_LOG_ERROR(in_message.c_str());
+                CS_ANDROID_LOG_ERROR(message.c_str());
                 break;
             
         }
 #elif defined (CS_TARGETPLATFORM_IOS)
-        NSString* message = [NSStringUtils newNSStringWithUTF8String:in_message];
-        NSLog(@"[ChilliSource] %@", message);
-        [message release];
+        NSString* nsMessage = [NSStringUtils newNSStringWithUTF8String:message];
+        NSLog(@"[ChilliSource] %@", nsMessage);
+        [nsMessage release];
 #elif defined (CS_TARGETPLATFORM_WINDOWS)
-        OutputDebugString(CSBackend::Windows::WindowsStringUtils::UTF8ToUTF16("[ChilliSource] " + in_message + "\n").c_str());
+        OutputDebugString(CSBackend::Windows::WindowsStringUtils::UTF8ToUTF16("[ChilliSource] " + message + "\n").c_str());
 #elif defined (CS_TARGETPLATFORM_RPI)
-        std::cout << "[ChilliSource] " << in_message << std::endl;
+        //Flushed once per batch rather than per line.
+        std::cout << "[ChilliSource] " << message << '\n';
 #endif
         
 #ifdef CS_ENABLE_LOGTOFILE
-        LogToFile(in_message);
+        LogToFile(message);
 #endif
     }
     
+    //------------------------------------------------------------------------------
+    Logging::~Logging() noexcept
+    {
+        StopFlushThread();
+    }
+    
 #ifdef CS_ENABLE_LOGTOFILE
     //-----------------------------------------------
     //-----------------------------------------------
@@ -31,12 +31,16 @@
 
 #include <ChilliSource/ChilliSource.h>
 
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <type_traits>
 #include <utility>
-
-#ifdef CS_ENABLE_LOGTOFILE
-#include <mutex>
-#endif
+#include <vector>
 
 namespace ChilliSource
 {
@@ -46,6 +50,15 @@ namespace ChilliSource
     /// implements the singleton pattern but does not inherit
     /// from singleton. This is because singleton uses Logging.
     ///
+    /// Messages are not output on the calling thread. Each thread
+    /// which logs is given its own fixed size lock-free buffer,
+    /// which is drained by a background flusher thread. If a
+    /// thread's buffer is full the message is dropped rather than
+    /// blocking, and the number of dropped messages is reported.
+    /// Formatting for the *Formatted() methods is also deferred
+    /// to the flusher thread. Fatal messages are always output
+    /// immediately, after all pending messages.
+    ///
     /// @author S Downie
     //------------------------------------------------------------
     class Logging final
@@ -165,6 +178,19 @@ namespace ChilliSource
         ///
         template <typename... TArgs> void LogFatalFormatted(char const * const format, TArgs&&... args) noexcept;
         
+        /// Blocks until all messages logged prior to this call have been output. This is
+        /// not needed during normal use, but can be useful prior to a known crash or when
+        /// debugging log order across threads.
+        ///
+        void Flush() noexcept;
+        
+        /// @return The total number of messages which have been dropped because the logging
+        ///     thread's buffer was full.
+        ///
+        u32 GetNumDroppedMessages() const noexcept;
+        
+        ~Logging() noexcept;
+        
     private:
         friend class Application;
         
@@ -179,6 +205,86 @@ namespace ChilliSource
             k_warning,
             k_error
         };
+        
+        ///
+        /// A single message waiting to be output by the flusher thread. If a formatter
+        /// is provided the message is created by it on the flusher thread.
+        ///
+        struct LogEntry final
+        {
+            LogLevel m_logLevel = LogLevel::k_verbose;
+            const char* m_prefix = "";
+            std::string m_message;
+            std::function<std::string()> m_formatter;
+        };
+        
+        using LogBuffer = concurrent_spsc_queue<LogEntry>;
+        using LogBufferSPtr = std::shared_ptr<LogBuffer>;
+        
+        ///
+        /// Converts a printf argument into a form that can be safely stored until the
+        /// message is formatted. C strings are copied as they may not outlive the call.
+        ///
+        /// @param value
+        ///     The argument.
+        ///
+        /// @return The argument in storable form.
+        ///
+        template <typename T> static typename std::decay<T>::type ToDeferredArg(T&& value) noexcept
+        {
+            return std::forward<T>(value);
+        }
+        
+        ///
+        /// @param value
+        ///     C string argument.
+        ///
+        /// @return A copy of the given C string.
+        ///
+        static std::string ToDeferredArg(const char* value) noexcept
+        {
+            return value != nullptr ? value : "(null)";
+        }
+        
+        ///
+        /// @param value
+        ///     C string argument.
+        ///
+        /// @return A copy of the given C string.
+        ///
+        static std::string ToDeferredArg(char* value) noexcept
+        {
+            return value != nullptr ? value : "(null)";
+        }
+        
+        ///
+        /// Formats a message from previously stored arguments.
+        ///
+        /// @param format
+        ///     The format of the string.
+        /// @param args
+        ///     The stored arguments.
+        ///
+        /// @return The formatted message.
+        ///
+        template <typename... TArgs> static std::string FormatDeferredMessage(const std::string& format, const TArgs&... args) noexcept
+        {
+            return CreateFormattedMessage(format.c_str(), args...);
+        }
+        
+        ///
+        /// Creates a function which will format the given message when called, storing
+        /// copies of the format string and the arguments.
+        ///
+        /// @param format
+        ///     The format of the string.
+        /// @param args
+        ///     Variadic list of arguments to inject into the format in order
+        ///
+        /// @return The formatter.
+        ///
+        template <typename... TArgs> static std::function<std::string()> CreateDeferredFormatter(char const * const format, TArgs&&... args) noexcept;
+        
         //-----------------------------------------------------
         /// Creates the singleton instance of the Logger.
         ///
@@ -199,16 +305,55 @@ namespace ChilliSource
         /// @author Ian Copland
         //-----------------------------------------------------
         Logging();
-        //-----------------------------------------------------
-        /// Logs the given message to file. How this is logged
-        /// is dependant on platform.
         ///
-        /// @author Ian Copland
+        /// Queues the given message for output on the flusher thread. If the calling
+        /// thread's buffer is full the message is dropped.
         ///
-        /// @param The logging level.
-        /// @param The message to log.
-        //-----------------------------------------------------
-        void LogMessage(LogLevel in_logLevel, const std::string& in_message);
+        /// @param logLevel
+        ///     The logging level.
+        /// @param prefix
+        ///     A literal prefix for the message, e.g. "ERROR: ".
+        /// @param message
+        ///     The message to log. Ignored if a formatter is given.
+        /// @param formatter
+        ///     (Optional) Creates the message on the flusher thread.
+        ///
+        void LogMessage(LogLevel logLevel, const char* prefix, std::string message, std::function<std::string()> formatter = nullptr) noexcept;
+        
+        ///
+        /// @return The calling thread's log buffer, creating and registering it if
+        ///     this is the first message the thread has logged.
+        ///
+        LogBuffer* GetThreadLogBuffer() noexcept;
+        
+        ///
+        /// The entry point for the flusher thread. This drains all thread buffers
+        /// periodically, or when a flush is requested, until the logger shuts down.
+        ///
+        void FlushThreadMain() noexcept;
+        
+        ///
+        /// Outputs all queued messages. This must only be called on the flusher
+        /// thread, or once it has been stopped.
+        ///
+        void DrainLogBuffers() noexcept;
+        
+        ///
+        /// Stops the flusher thread, outputting any queued messages. After this all
+        /// messages are output immediately on the calling thread. Calling this again
+        /// has no further effect.
+        ///
+        void StopFlushThread() noexcept;
+        
+        ///
+        /// Outputs the given message. How this is output is dependant on platform.
+        ///
+        /// @param logLevel
+        ///     The logging level.
+        /// @param message
+        ///     The message to output.
+        ///
+        void OutputMessage(LogLevel logLevel, const std::string& message) noexcept;
         
         ///
         /// Method that can be overloaded to printf complex objects.
@@ -220,7 +365,7 @@ namespace ChilliSource
         ///
         /// @return Given value
         ///
-        template <typename T> T ToPrintfFormat(T value) noexcept
+        template <typename T> static T ToPrintfFormat(T value) noexcept
         {
             return value;
         }
@@ -233,7 +378,7 @@ namespace ChilliSource
         ///
         /// @return String as c-string
         ///
-        template <typename T> T const* ToPrintfFormat(const std::basic_string<T>& value) noexcept
+        template <typename T> static T const* ToPrintfFormat(const std::basic_string<T>& value) noexcept
         {
             return value.c_str();
         }
@@ -246,7 +391,7 @@ namespace ChilliSource
         /// @param args
         ///     Variadic list of arguments to inject into the format in order
         ///
-        template <typename... TArgs> std::string CreateFormattedMessage(char const * const format, TArgs&&... args) noexcept;
+        template <typename... TArgs> static std::string CreateFormattedMessage(char const * const format, TArgs&&... args) noexcept;
         
 #ifdef CS_ENABLE_LOGTOFILE
         //-----------------------------------------------------
@@ -268,6 +413,24 @@ namespace ChilliSource
         std::string m_logBuffer;
         std::mutex m_mutex;
 #endif
+        u32 m_generation;
+        
+        std::mutex m_logBuffersMutex;
+        std::vector<LogBufferSPtr> m_logBuffers;
+        
+        std::atomic<u32> m_numDroppedMessages;
+        std::atomic<u32> m_numUnreportedDroppedMessages;
+        
+        std::thread m_flushThread;
+        std::thread::id m_flushThreadId;
+        std::atomic<bool> m_isFlushThreadRunning;
+        std::mutex m_flushMutex;
+        std::condition_variable m_flushCondition;
+        std::condition_variable m_flushCompleteCondition;
+        u64 m_flushRequestId = 0;
+        u64 m_flushCompleteId = 0;
+        bool m_isStopRequested = false;
+        
         static Logging* s_logging;
     };
     
@@ -287,11 +450,17 @@ namespace ChilliSource
         return result;
     }
     
+    //------------------------------------------------------------------------------
+    template <typename... TArgs> std::function<std::string()> Logging::CreateDeferredFormatter(char const * const format, TArgs&&... args) noexcept
+    {
+        return std::bind(&Logging::FormatDeferredMessage<decltype(ToDeferredArg(std::forward<TArgs>(args)))...>, std::string(format), ToDeferredArg(std::forward<TArgs>(args))...);
+    }
+    
     //------------------------------------------------------------------------------
     template <typename... TArgs> void Logging::LogVerboseFormatted(char const * const format, TArgs&&... args) noexcept
     {
 #if defined CS_LOGLEVEL_VERBOSE
-        LogVerbose(CreateFormattedMessage(format, std::forward<TArgs>(args)...));
+        LogMessage(LogLevel::k_verbose, "", std::string(), CreateDeferredFormatter(format, std::forward<TArgs>(args)...));
 #endif
     }
     
@@ -299,7 +468,7 @@ namespace ChilliSource
     template <typename... TArgs> void Logging::LogWarningFormatted(char const * const format, TArgs&&... args) noexcept
     {
 #if defined CS_LOGLEVEL_VERBOSE || defined CS_LOGLEVEL_WARNING
-        LogWarning(CreateFormattedMessage(format, std::forward<TArgs>(args)...));
+        LogMessage(LogLevel::k_warning, "WARNING: ", std::string(), CreateDeferredFormatter(format, std::forward<TArgs>(args)...));
 #endif
     }
     
@@ -307,7 +476,7 @@ namespace ChilliSource
     template <typename... TArgs> void Logging::LogErrorFormatted(char const * const format, TArgs&&... args) noexcept
     {
 #if defined CS_LOGLEVEL_VERBOSE || defined CS_LOGLEVEL_WARNING || defined CS_LOGLEVEL_ERROR
-        LogError(CreateFormattedMessage(format, std::forward<TArgs>(args)...));
+        LogMessage(LogLevel::k_error, "ERROR: ", std::string(), CreateDeferredFormatter(format, std::forward<TArgs>(args)...));
 #endif
     }
     
@@ -45,6 +45,8 @@ namespace ChilliSource
         ///         Whether or not map buffer is supported.
         /// @param isVAOSupported
         ///     Whether vertex array objects are supported
+        /// @param isInstancingSupported
+        ///         Whether or not instanced draw calls are supported.
         /// @param isHighPrecisionFloatsSupported
         ///         Whether or not the fragment shader supports highp floats.
         /// @param maxTextureSize
@@ -54,7 +56,7 @@ namespace ChilliSource
         /// @param maxVertexAttribs
         ///         The max. number of vertex attributes supported by this device.
         ///
-        RenderInfo(bool isShadowMapsSupported, bool isDepthTexturesSupported, bool isMapBuffersSupported, bool isVAOSupported, bool isHighPrecisionFloatsSupported, u32 maxTextureSize, u32 numTextureUnits, u32 maxVertexAttribs) noexcept;
+        RenderInfo(bool isShadowMapsSupported, bool isDepthTexturesSupported, bool isMapBuffersSupported, bool isVAOSupported, bool isInstancingSupported, bool isHighPrecisionFloatsSupported, u32 maxTextureSize, u32 numTextureUnits, u32 maxVertexAttribs) noexcept;
        
         /// @return Whether or not shadow mapping is supported.
         ///
@@ -72,6 +74,10 @@ namespace ChilliSource
         ///
         bool IsVAOSupported() const noexcept { return m_isVAOSupported; }
         
+        /// @return Whether or not instanced draw calls are supported.
+        ///
+        bool IsInstancingSupported() const noexcept { return m_isInstancingSupported; }
+        
         /// @return Whether or not the fragment shader supports highp floats.
         ///
         bool IsHighPrecisionFloatsSupported() const noexcept { return m_isHighPrecisionFloatsSupported; }
@@ -94,6 +100,7 @@ namespace ChilliSource
         bool m_isDepthTexturesSupported;
         bool m_isMapBuffersSupported;
         bool m_isVAOSupported;
+        bool m_isInstancingSupported;
         bool m_isHighPrecisionFloatsSupported;
         
         u32 m_maxTextureSize;
@@ -33,6 +33,7 @@
 #include <ChilliSource/Core/Container/HashedArray.h>
 #include <ChilliSource/Core/Container/concurrent_vector.h>
 #include <ChilliSource/Core/Container/concurrent_blocking_queue.h>
+#include <ChilliSource/Core/Container/concurrent_spsc_queue.h>
 #include <ChilliSource/Core/Container/dynamic_array.h>
 #include <ChilliSource/Core/Container/ParamDictionary.h>
 #include <ChilliSource/Core/Container/ParamDictionarySerialiser.h>
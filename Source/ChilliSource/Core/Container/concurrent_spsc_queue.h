@@ -0,0 +1,221 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_CONTAINER_CONCURRENTSPSCQUEUE_H_
+#define _CHILLISOURCE_CORE_CONTAINER_CONCURRENTSPSCQUEUE_H_
+
+#include <ChilliSource/ChilliSource.h>
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+namespace ChilliSource
+{
+    /// A queue which can be pushed to by one thread and popped from by another without
+    /// locking. Objects are stored in a fixed size ring buffer; if the ring fills up, for
+    /// example because the consumer has stalled, further objects are pushed to a locked
+    /// overflow queue until the consumer catches up, so nothing is ever dropped and the
+    /// producer never waits on the consumer.
+    ///
+    /// Only a single thread may push at a time, and only a single thread may pop at a time,
+    /// though these may be the same thread. TType must be default constructible.
+    ///
+    template <typename TType> class concurrent_spsc_queue final
+    {
+    public:
+        CS_DECLARE_NOCOPY(concurrent_spsc_queue);
+        
+        using size_type = std::size_t;
+        
+        /// @param capacity
+        ///     The number of objects which can be stored before the queue overflows. This
+        ///     is rounded up to the next power of two.
+        ///
+        explicit concurrent_spsc_queue(size_type capacity) noexcept;
+        
+        /// @return The number of objects which can be stored before the queue overflows.
+        ///
+        size_type capacity() const noexcept { return m_capacity; }
+        
+        /// Pushes an object onto the back of the queue. This should only be called from the
+        /// producer thread.
+        ///
+        /// @param object
+        ///     The object to push.
+        ///
+        void push(TType object) noexcept;
+        
+        /// Pushes an object onto the back of the queue only if there is room for it in the
+        /// ring buffer. Unlike push() this never takes a lock, so is suitable for bounded
+        /// queues where excess objects should be discarded. This should only be called from
+        /// the producer thread.
+        ///
+        /// @param object
+        ///     The object to push. This is only moved from if the push succeeds.
+        ///
+        /// @return Whether or not the object was pushed.
+        ///
+        bool try_push(TType&& object) noexcept;
+        
+        /// Pops the object from the front of the queue if there is one. This should only be
+        /// called from the consumer thread.
+        ///
+        /// @param outObject
+        ///     [Out] The popped object. This is only set if an object was popped.
+        ///
+        /// @return Whether or not an object was popped.
+        ///
+        bool try_pop(TType& outObject) noexcept;
+        
+        /// Pops all objects currently in the queue. This should only be called from the
+        /// consumer thread.
+        ///
+        void clear() noexcept;
+        
+    private:
+        std::unique_ptr<TType[]> m_ring;
+        size_type m_capacity;
+        size_type m_mask;
+        
+        std::atomic<size_type> m_head;
+        std::atomic<size_type> m_tail;
+        
+        std::atomic<bool> m_hasOverflowed;
+        std::mutex m_overflowMutex;
+        std::deque<TType> m_overflow;
+    };
+    
+    //------------------------------------------------------------------------------
+    template <typename TType> concurrent_spsc_queue<TType>::concurrent_spsc_queue(size_type capacity) noexcept
+        : m_capacity(1), m_head(0), m_tail(0), m_hasOverflowed(false)
+    {
+        CS_ASSERT(capacity > 0, "Queue capacity must be greater than zero.");
+        
+        while (m_capacity < capacity)
+        {
+            m_capacity <<= 1;
+        }
+        
+        m_mask = m_capacity - 1;
+        m_ring.reset(new TType[m_capacity]);
+    }
+    
+    //------------------------------------------------------------------------------
+    template <typename TType> void concurrent_spsc_queue<TType>::push(TType object) noexcept
+    {
+        //Once the queue has overflowed everything must go to the overflow queue until the consumer
+        //has emptied it, otherwise newer objects could be popped before older ones.
+        if (m_hasOverflowed.load(std::memory_order_acquire) == false)
+        {
+            auto tail = m_tail.load(std::memory_order_relaxed);
+            auto head = m_head.load(std::memory_order_acquire);
+            
+            if (tail - head < m_capacity)
+            {
+                m_ring[tail & m_mask] = std::move(object);
+                m_tail.store(tail + 1, std::memory_order_release);
+                return;
+            }
+        }
+        
+        std::unique_lock<std::mutex> lock(m_overflowMutex);
+        m_overflow.push_back(std::move(object));
+        m_hasOverflowed.store(true, std::memory_order_release);
+    }
+    
+    //------------------------------------------------------------------------------
+    template <typename TType> bool concurrent_spsc_queue<TType>::try_push(TType&& object) noexcept
+    {
+        if (m_hasOverflowed.load(std::memory_order_acquire) == true)
+        {
+            return false;
+        }
+        
+        auto tail = m_tail.load(std::memory_order_relaxed);
+        auto head = m_head.load(std::memory_order_acquire);
+        
+        if (tail - head >= m_capacity)
+        {
+            return false;
+        }
+        
+        m_ring[tail & m_mask] = std::move(object);
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+    
+    //------------------------------------------------------------------------------
+    template <typename TType> bool concurrent_spsc_queue<TType>::try_pop(TType& outObject) noexcept
+    {
+        while (true)
+        {
+            auto head = m_head.load(std::memory_order_relaxed);
+            auto tail = m_tail.load(std::memory_order_acquire);
+            
+            if (head != tail)
+            {
+                outObject = std::move(m_ring[head & m_mask]);
+                m_head.store(head + 1, std::memory_order_release);
+                return true;
+            }
+            
+            if (m_hasOverflowed.load(std::memory_order_acquire) == false)
+            {
+                return false;
+            }
+            
+            std::unique_lock<std::mutex> lock(m_overflowMutex);
+            
+            //The producer doesn't push to the ring while the queue is overflowed, so anything
+            //now in it was pushed before the overflow began and has to be popped first.
+            if (m_head.load(std::memory_order_relaxed) != m_tail.load(std::memory_order_acquire))
+            {
+                continue;
+            }
+            
+            outObject = std::move(m_overflow.front());
+            m_overflow.pop_front();
+            
+            if (m_overflow.empty())
+            {
+                m_hasOverflowed.store(false, std::memory_order_release);
+            }
+            
+            return true;
+        }
+    }
+    
+    //------------------------------------------------------------------------------
+    template <typename TType> void concurrent_spsc_queue<TType>::clear() noexcept
+    {
+        TType object;
+        while (try_pop(object))
+        {
+        }
+    }
+}
+
+#endif
@@ -57,6 +57,20 @@ namespace ChilliSource
         /// @return CRC 32 hash code
         //-------------------------------------------------------------
         u32 GenerateHashCode(const s8* inbyVal, u32 inudwSizeInBytes);
+        //-------------------------------------------------------------
+        /// Continues a hash with more data, allowing data which is
+        /// not held in a single contiguous buffer, such as a file
+        /// read in chunks, to be hashed incrementally. Hashing data
+        /// in any number of parts gives the same result as hashing
+        /// it in one go with GenerateHashCode().
+        ///
+        /// @param The hash of the data so far, or 0 if this is the
+        /// first part.
+        /// @param Data to hash
+        /// @param Size of data in bytes
+        /// @return CRC 32 hash code of all data so far
+        //-------------------------------------------------------------
+        u32 UpdateHashCode(u32 in_hashCode, const s8* in_data, u32 in_dataSize);
     }
 }
 
@@ -37,7 +37,7 @@ namespace ChilliSource
     ///
     /// Default
     //----------------------------------------------------------------
-    Transform::Transform() : mbIsTransformCacheValid(false), mbIsParentTransformCacheValid(false), mvScale(1,1,1), mpParentTransform(nullptr)
+    Transform::Transform() : mbIsTransformCacheValid(false), mbIsParentTransformCacheValid(false), mvScale(1,1,1), mpParentTransform(nullptr), mbHasInterpolationState(false)
     {
     
     }
@@ -467,6 +467,66 @@ namespace ChilliSource
         return mmatWorldTransform;
     }
     //----------------------------------------------------------------
+    /// Get Interpolated World Transform
+    ///
+    /// @param Interpolation factor in the range 0 - 1. 1 returns
+    /// the current world transform.
+    /// @return The interpolated world transform
+    //----------------------------------------------------------------
+    Matrix4 Transform::GetInterpolatedWorldTransform(f32 infFactor) const
+    {
+        if(infFactor >= 1.0f)
+        {
+            return GetWorldTransform();
+        }
+        
+        Matrix4 matLocal;
+        if(mbHasInterpolationState)
+        {
+            matLocal = Matrix4::CreateTransform(Vector3::Lerp(mvPreviousPosition, mvPosition, infFactor), Vector3::Lerp(mvPreviousScale, mvScale, infFactor),
+                                                Quaternion::Slerp(mqPreviousOrientation, mqOrientation, infFactor));
+        }
+        else if(mpParentTransform == nullptr)
+        {
+            return GetWorldTransform();
+        }
+        else
+        {
+            matLocal = GetLocalTransform();
+        }
+        
+        if(mpParentTransform)
+        {
+            return matLocal * mpParentTransform->GetInterpolatedWorldTransform(infFactor);
+        }
+        
+        return matLocal;
+    }
+    //----------------------------------------------------------------
+    /// Reset Interpolation
+    ///
+    /// Discards the state stored before the last fixed update so
+    /// the transform is presented at its current value until the
+    /// next fixed update.
+    //----------------------------------------------------------------
+    void Transform::ResetInterpolation()
+    {
+        mbHasInterpolationState = false;
+    }
+    //----------------------------------------------------------------
+    /// Store Interpolation State
+    ///
+    /// Stores the current local position, scale and orientation
+    /// for interpolating between.
+    //----------------------------------------------------------------
+    void Transform::StoreInterpolationState()
+    {
+        mvPreviousPosition = mvPosition;
+        mvPreviousScale = mvScale;
+        mqPreviousOrientation = mqOrientation;
+        mbHasInterpolationState = true;
+    }
+    //----------------------------------------------------------------
     /// Set World Transform
     ///
     /// This will overwrite any parent or previous transformations
@@ -641,6 +701,7 @@ namespace ChilliSource
         mvScale = Vector3::k_one;
         mqWorldOrientation = Quaternion::k_identity;
         mpParentTransform = nullptr;
+        mbHasInterpolationState = false;
         mChildTransforms.clear();
         mTransformChangedEvent.CloseAllConnections();
     }
@@ -283,6 +283,29 @@ namespace ChilliSource
         //----------------------------------------------------------------
         bool IsTransformValid() const;
         
+        //----------------------------------------------------------------
+        /// Get Interpolated World Transform
+        ///
+        /// Blends between the local position, scale and orientation
+        /// stored before the last fixed update and the current values,
+        /// applying the interpolated parent transform. Used when the
+        /// Application decouples simulation from presentation.
+        ///
+        /// @param Interpolation factor in the range 0 - 1. 1 returns
+        /// the current world transform.
+        /// @return The interpolated world transform
+        //----------------------------------------------------------------
+        Matrix4 GetInterpolatedWorldTransform(f32 infFactor) const;
+        //----------------------------------------------------------------
+        /// Reset Interpolation
+        ///
+        /// Discards the state stored before the last fixed update so
+        /// the transform is presented at its current value until the
+        /// next fixed update. Call this after teleporting an object to
+        /// prevent it being blended across the jump.
+        //----------------------------------------------------------------
+        void ResetInterpolation();
+        
         //----------------------------------------------------------------
         /// Get Parent Transform
         /// @return what it says on tin
@@ -310,6 +333,7 @@ namespace ChilliSource
     private:
         
         friend class Entity;
+        friend class Scene;
         
         //----------------------------------------------------------------
         /// Set Parent Transform
@@ -362,6 +386,14 @@ namespace ChilliSource
         /// recalculate our transform
         //----------------------------------------------------------------
         void OnParentTransformChanged();
+        //----------------------------------------------------------------
+        /// Store Interpolation State
+        ///
+        /// Stores the current local position, scale and orientation
+        /// for interpolating between. Called by the Scene prior to
+        /// each fixed update when interpolation is enabled.
+        //----------------------------------------------------------------
+        void StoreInterpolationState();
         
     private:
         
@@ -376,6 +408,10 @@ namespace ChilliSource
         mutable Vector3 mvWorldScale;
         mutable Quaternion mqWorldOrientation;
         
+        Vector3 mvPreviousPosition;
+        Vector3 mvPreviousScale;
+        Quaternion mqPreviousOrientation;
+        
         Event<TransformChangedDelegate> mTransformChangedEvent;
         
         Transform* mpParentTransform;
@@ -384,6 +420,7 @@ namespace ChilliSource
         
         mutable bool mbIsTransformCacheValid;
         mutable bool mbIsParentTransformCacheValid;
+        bool mbHasInterpolationState;
     };
 }
 
@@ -61,7 +61,7 @@ namespace ChilliSource
         const std::string k_defaultPackageDLCDirectory = "DLC/";
         constexpr u32 k_maxSHA1Length = 80;
         const u32 k_md5ChunkSize = 256;
-        const u32 k_sha1ChunkSize = 256;
+        const u32 k_checksumChunkSize = 64 * 1024;
     }
     CS_DEFINE_NAMEDTYPE(FileSystem);
     
@@ -186,24 +186,18 @@ namespace ChilliSource
         CS_ASSERT(fileStream, "Could not open file: " + in_filePath);
 
         u64 currentPosition = fileStream->GetReadPosition();
-        u32 length = u32(fileStream->GetLength());
-        u8 data[k_sha1ChunkSize];
+        u64 length = fileStream->GetLength();
+        std::unique_ptr<u8[]> data(new u8[k_checksumChunkSize]);
         CSHA1 Hash;
         Hash.Reset();
 
-        while(length >= k_sha1ChunkSize)
+        while(length > 0)
         {
-            fileStream->Read(data, k_sha1ChunkSize);
+            u32 chunkSize = u32(std::min(length, u64(k_checksumChunkSize)));
+            fileStream->Read(data.get(), chunkSize);
             
-            Hash.Update(reinterpret_cast<u8*>(data), k_sha1ChunkSize);
-            length -= k_sha1ChunkSize;
-        }
-        
-        // Last chunk
-        if(length > 0)
-        {
-            fileStream->Read(data, length);
-            Hash.Update(reinterpret_cast<u8*>(data), length);
+            Hash.Update(data.get(), chunkSize);
+            length -= chunkSize;
         }
         
         fileStream->SetReadPosition(currentPosition);
@@ -230,7 +224,7 @@ namespace ChilliSource
         auto fileStream = CreateBinaryInputStream(in_storageLocation, in_filePath);
         CS_ASSERT(fileStream, "Could not open file: " + in_filePath);
         
-        u32 length = u32(fileStream->GetLength());
+        u64 length = fileStream->GetLength();
 
         if(length == 0)
         {
@@ -240,22 +234,16 @@ namespace ChilliSource
         SHA256 hash;
         hash.reset();
         
-        u8 fileData[SHA256::BlockSize];
+        //read in large chunks to keep the number of stream reads down for big files.
+        std::unique_ptr<u8[]> fileData(new u8[k_checksumChunkSize]);
         
-        // Read chunks
-        while(length >= SHA256::BlockSize)
+        while(length > 0)
         {
-            fileStream->Read(fileData, SHA256::BlockSize);
+            u32 chunkSize = u32(std::min(length, u64(k_checksumChunkSize)));
+            fileStream->Read(fileData.get(), chunkSize);
             
-            hash.add(reinterpret_cast<const u8*>(fileData), SHA256::BlockSize);
-            length -= SHA256::BlockSize;
-        }
-        
-        // Last Chunk
-        if(length > 0)
-        {
-            fileStream->Read(fileData, length);
-            hash.add(reinterpret_cast<const u8*>(fileData), length);
+            hash.add(fileData.get(), chunkSize);
+            length -= chunkSize;
         }
 
         return hash.getHash();
@@ -333,15 +321,21 @@ namespace ChilliSource
     //--------------------------------------------------------------
     u32 FileSystem::GetFileChecksumCRC32(StorageLocation storageLocation, const std::string& filePath) const
     {
-        u32 output = 0;
-
         auto fileStream = CreateBinaryInputStream(storageLocation, filePath);
         CS_ASSERT(fileStream, "Could not open file: " + filePath);
 
-        auto contents = fileStream->ReadAll();
+        //hash the file in chunks rather than reading it all into memory.
+        u64 length = fileStream->GetLength();
+        std::unique_ptr<u8[]> data(new u8[k_checksumChunkSize]);
+        u32 output = 0;
 
-        //get the hash
-        output = HashCRC32::GenerateHashCode(reinterpret_cast<const s8*>(contents->GetData()), u32(contents->GetLength()));
+        while (length > 0)
+        {
+            u32 chunkSize = u32(std::min(length, u64(k_checksumChunkSize)));
+            fileStream->Read(data.get(), chunkSize);
+            output = HashCRC32::UpdateHashCode(output, reinterpret_cast<const s8*>(data.get()), chunkSize);
+            length -= chunkSize;
+        }
 
         return output;
     }
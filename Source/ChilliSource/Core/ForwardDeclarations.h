@@ -43,6 +43,8 @@ namespace ChilliSource
     CS_FORWARDDECLARE_CLASS(Colour);
     CS_FORWARDDECLARE_CLASS(Device);
     CS_FORWARDDECLARE_CLASS(DeviceInfo);
+    CS_FORWARDDECLARE_CLASS(EngineCounters);
+    CS_FORWARDDECLARE_CLASS(EngineCounterValues);
     CS_FORWARDDECLARE_CLASS(LifecycleManager);
     CS_FORWARDDECLARE_CLASS(Logging);
     CS_FORWARDDECLARE_CLASS(PlatformSystem);
@@ -52,6 +54,7 @@ namespace ChilliSource
     CS_FORWARDDECLARE_CLASS(SystemInfo);
     CS_FORWARDDECLARE_CLASS(AppConfig);
     enum class CursorType;
+    enum class EngineCounter;
     //---------------------------------------------------------
     /// Container
     //---------------------------------------------------------
@@ -61,6 +64,7 @@ namespace ChilliSource
     CS_FORWARDDECLARE_CLASS(PropertyMap);
     template <typename TKey, typename TValue> class HashedArray;
     template <typename TType> class concurrent_blocking_queue;
+    template <typename TType> class concurrent_spsc_queue;
     template <typename TType> class concurrent_vector;
     template <typename TType> class dynamic_array;
     template <typename TType> class Property;
@@ -113,6 +117,7 @@ namespace ChilliSource
     CS_FORWARDDECLARE_CLASS(CSImageProvider);
     CS_FORWARDDECLARE_CLASS(ETC1ImageProvider);
     CS_FORWARDDECLARE_CLASS(Image);
+    CS_FORWARDDECLARE_CLASS(ImageResourceOptions);
     CS_FORWARDDECLARE_CLASS(PNGImageProvider);
     CS_FORWARDDECLARE_CLASS(PVRImageProvider);
     enum class ImageFormat;
@@ -136,6 +141,7 @@ namespace ChilliSource
     CS_FORWARDDECLARE_CLASS(Line);
     CS_FORWARDDECLARE_CLASS(Plane);
     CS_FORWARDDECLARE_CLASS(Frustum);
+    CS_FORWARDDECLARE_CLASS(RandomStream);
     CS_FORWARDDECLARE_STRUCT(UnifiedScalar);
     CS_FORWARDDECLARE_STRUCT(UnifiedVector2);
     CS_FORWARDDECLARE_STRUCT(UnifiedRectangle);
@@ -189,6 +195,7 @@ namespace ChilliSource
     /// Resource
     //---------------------------------------------------------
     CS_FORWARDDECLARE_CLASS(Resource);
+    CS_FORWARDDECLARE_CLASS(ResourceManifest);
     CS_FORWARDDECLARE_CLASS(ResourcePool);
     CS_FORWARDDECLARE_CLASS(ResourceProvider);
     CS_FORWARDDECLARE_TEMPLATECLASS(IResourceOptions, TResourceType);
@@ -227,6 +234,8 @@ namespace ChilliSource
     //---------------------------------------------------------
     CS_FORWARDDECLARE_CLASS(CoreTimer);
     CS_FORWARDDECLARE_CLASS(PerformanceTimer);
+    CS_FORWARDDECLARE_CLASS(Profiler);
+    CS_FORWARDDECLARE_CLASS(ProfileZone);
     CS_FORWARDDECLARE_CLASS(Timer);
     //---------------------------------------------------------
     /// Tween
@@ -36,6 +36,7 @@
 #include <ChilliSource/Core/Image/ImageCompression.h>
 #include <ChilliSource/Core/Image/ImageFormat.h>
 #include <ChilliSource/Core/Image/ImageFormatConverter.h>
+#include <ChilliSource/Core/Image/ImageResourceOptions.h>
 #include <ChilliSource/Core/Image/PNGImageProvider.h>
 #include <ChilliSource/Core/Image/PVRImageProvider.h>
 
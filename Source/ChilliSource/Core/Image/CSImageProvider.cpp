@@ -34,6 +34,7 @@
 #include <ChilliSource/Core/Image/ImageCompression.h>
 #include <ChilliSource/Core/Image/ImageFormat.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
+#include <ChilliSource/Core/Time/Profiler.h>
 
 #include <minizip/unzip.h>
 
@@ -207,6 +208,8 @@ namespace ChilliSource
         //----------------------------------------------------
         void LoadImage(StorageLocation in_storageLocation, const std::string& in_filepath, const ResourceProvider::AsyncLoadDelegate& in_delegate, const ResourceSPtr& out_resource)
         {
+            CS_PROFILE_SCOPE("CSImageProvider::LoadImage");
+            
             auto pImageFile = Application::Get()->GetFileSystem()->CreateBinaryInputStream(in_storageLocation, in_filepath);
             
             if(pImageFile == nullptr)
@@ -28,29 +28,454 @@
 
 #include <ChilliSource/Core/Image/ImageFormatConverter.h>
 
-#include <ChilliSource/Core/Base/ByteColour.h>
+#include <ChilliSource/Core/Base/SIMD.h>
 #include <ChilliSource/Core/Image/ImageCompression.h>
 #include <ChilliSource/Core/Image/ImageFormat.h>
+#include <ChilliSource/Core/Threading/TaskContext.h>
+
+#include <algorithm>
+#include <cstring>
 
 namespace ChilliSource
 {
     namespace ImageFormatConverter
     {
+        namespace
+        {
+            const u32 k_inputBytesPerPixel = 4;
+            const u32 k_pixelsPerTask = 64 * 1024;
+            
+            //---------------------------------------------------
+            /// @param The pointer to read from. This does not
+            /// need to be aligned.
+            ///
+            /// @return The RGBA8888 pixel at the given pointer,
+            /// packed as R | G << 8 | B << 16 | A << 24.
+            //---------------------------------------------------
+            inline u32 ReadPixel(const u8* in_source)
+            {
+                u32 pixel;
+                memcpy(&pixel, in_source, sizeof(u32));
+                return pixel;
+            }
+            //---------------------------------------------------
+            /// @param The RGBA8888 pixel.
+            ///
+            /// @return The pixel in RGBA4444 format.
+            //---------------------------------------------------
+            inline u16 ToRGBA4444(u32 in_pixel)
+            {
+                return u16(((in_pixel & 0xF0) << 8) | // R
+                    ((in_pixel & 0xF000) >> 4) | // G
+                    ((in_pixel >> 16) & 0xF0) | // B
+                    (in_pixel >> 28)); // A
+            }
+            //---------------------------------------------------
+            /// @param The RGBA8888 pixel.
+            ///
+            /// @return The pixel in RGB565 format.
+            //---------------------------------------------------
+            inline u16 ToRGB565(u32 in_pixel)
+            {
+                return u16(((in_pixel & 0xF8) << 8) | // R
+                    ((in_pixel & 0xFC00) >> 5) | // G
+                    ((in_pixel >> 19) & 0x1F)); // B
+            }
+            //---------------------------------------------------
+            /// @param The RGBA8888 pixel.
+            ///
+            /// @return The pixel in LumA88 format.
+            //---------------------------------------------------
+            inline u16 ToLumA88(u32 in_pixel)
+            {
+                return u16((in_pixel & 0xFF) | // L
+                    ((in_pixel >> 16) & 0xFF00)); // A
+            }
+            //---------------------------------------------------
+            /// Converts RGBA8888 pixels to RGB888. Four pixels
+            /// are packed into three words at a time as SSE2
+            /// lacks a byte shuffle.
+            ///
+            /// @param The RGBA8888 source pixels.
+            /// @param The number of pixels to convert.
+            /// @param [Out] The RGB888 destination.
+            //---------------------------------------------------
+            void ConvertToRGB888(const u8* in_source, u32 in_numPixels, u8* out_destination)
+            {
+                u32 i = 0;
+                
+#if defined(CS_SIMD_NEON)
+                for (; i + 16 <= in_numPixels; i += 16, in_source += 64, out_destination += 48)
+                {
+                    uint8x16x4_t rgba = vld4q_u8(in_source);
+                    uint8x16x3_t rgb = { { rgba.val[0], rgba.val[1], rgba.val[2] } };
+                    vst3q_u8(out_destination, rgb);
+                }
+#endif
+                for (; i + 4 <= in_numPixels; i += 4, in_source += 16, out_destination += 12)
+                {
+                    u32 p0 = ReadPixel(in_source);
+                    u32 p1 = ReadPixel(in_source + 4);
+                    u32 p2 = ReadPixel(in_source + 8);
+                    u32 p3 = ReadPixel(in_source + 12);
+                    
+                    u32 words[3];
+                    words[0] = (p0 & 0xFFFFFF) | (p1 << 24);
+                    words[1] = ((p1 >> 8) & 0xFFFF) | (p2 << 16);
+                    words[2] = ((p2 >> 16) & 0xFF) | (p3 << 8);
+                    memcpy(out_destination, words, sizeof(words));
+                }
+                
+                for (; i < in_numPixels; ++i, in_source += 4, out_destination += 3)
+                {
+                    out_destination[0] = in_source[0];
+                    out_destination[1] = in_source[1];
+                    out_destination[2] = in_source[2];
+                }
+            }
+            //---------------------------------------------------
+            /// Converts RGBA8888 pixels to RGBA4444.
+            ///
+            /// @param The RGBA8888 source pixels.
+            /// @param The number of pixels to convert.
+            /// @param [Out] The RGBA4444 destination.
+            //---------------------------------------------------
+            void ConvertToRGBA4444(const u8* in_source, u32 in_numPixels, u8* out_destination)
+            {
+                u32 i = 0;
+                
+#if defined(CS_SIMD_SSE2)
+                const __m128i highNibble = _mm_set1_epi32(0xF0);
+                const __m128i greenMask = _mm_set1_epi32(0xF000);
+                const __m128i bias32 = _mm_set1_epi32(0x8000);
+                const __m128i bias16 = _mm_set1_epi16(-0x8000);
+                
+                for (; i + 8 <= in_numPixels; i += 8, in_source += 32, out_destination += 16)
+                {
+                    __m128i result[2];
+                    for (u32 j = 0; j < 2; ++j)
+                    {
+                        __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in_source + j * 16));
+                        __m128i r = _mm_slli_epi32(_mm_and_si128(pixels, highNibble), 8);
+                        __m128i g = _mm_srli_epi32(_mm_and_si128(pixels, greenMask), 4);
+                        __m128i b = _mm_and_si128(_mm_srli_epi32(pixels, 16), highNibble);
+                        __m128i a = _mm_srli_epi32(pixels, 28);
+                        
+                        // Bias into signed range so the saturating pack preserves all 16 bits.
+                        result[j] = _mm_sub_epi32(_mm_or_si128(_mm_or_si128(r, g), _mm_or_si128(b, a)), bias32);
+                    }
+                    
+                    __m128i packed = _mm_add_epi16(_mm_packs_epi32(result[0], result[1]), bias16);
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out_destination), packed);
+                }
+#elif defined(CS_SIMD_NEON)
+                const uint8x16_t highNibble = vdupq_n_u8(0xF0);
+                
+                for (; i + 16 <= in_numPixels; i += 16, in_source += 64, out_destination += 32)
+                {
+                    uint8x16x4_t rgba = vld4q_u8(in_source);
+                    uint8x16x2_t result;
+                    result.val[0] = vorrq_u8(vandq_u8(rgba.val[2], highNibble), vshrq_n_u8(rgba.val[3], 4));
+                    result.val[1] = vorrq_u8(vandq_u8(rgba.val[0], highNibble), vshrq_n_u8(rgba.val[1], 4));
+                    vst2q_u8(out_destination, result);
+                }
+#endif
+                for (; i < in_numPixels; ++i, in_source += 4, out_destination += 2)
+                {
+                    u16 pixel = ToRGBA4444(ReadPixel(in_source));
+                    memcpy(out_destination, &pixel, sizeof(u16));
+                }
+            }
+            //---------------------------------------------------
+            /// Converts RGBA8888 pixels to RGB565.
+            ///
+            /// @param The RGBA8888 source pixels.
+            /// @param The number of pixels to convert.
+            /// @param [Out] The RGB565 destination.
+            //---------------------------------------------------
+            void ConvertToRGB565(const u8* in_source, u32 in_numPixels, u8* out_destination)
+            {
+                u32 i = 0;
+                
+#if defined(CS_SIMD_SSE2)
+                const __m128i redMask = _mm_set1_epi32(0xF8);
+                const __m128i greenMask = _mm_set1_epi32(0xFC00);
+                const __m128i blueMask = _mm_set1_epi32(0x1F);
+                const __m128i bias32 = _mm_set1_epi32(0x8000);
+                const __m128i bias16 = _mm_set1_epi16(-0x8000);
+                
+                for (; i + 8 <= in_numPixels; i += 8, in_source += 32, out_destination += 16)
+                {
+                    __m128i result[2];
+                    for (u32 j = 0; j < 2; ++j)
+                    {
+                        __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in_source + j * 16));
+                        __m128i r = _mm_slli_epi32(_mm_and_si128(pixels, redMask), 8);
+                        __m128i g = _mm_srli_epi32(_mm_and_si128(pixels, greenMask), 5);
+                        __m128i b = _mm_and_si128(_mm_srli_epi32(pixels, 19), blueMask);
+                        
+                        // Bias into signed range so the saturating pack preserves all 16 bits.
+                        result[j] = _mm_sub_epi32(_mm_or_si128(_mm_or_si128(r, g), b), bias32);
+                    }
+                    
+                    __m128i packed = _mm_add_epi16(_mm_packs_epi32(result[0], result[1]), bias16);
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out_destination), packed);
+                }
+#elif defined(CS_SIMD_NEON)
+                const uint8x16_t redMask = vdupq_n_u8(0xF8);
+                const uint8x16_t greenMask = vdupq_n_u8(0xE0);
+                
+                for (; i + 16 <= in_numPixels; i += 16, in_source += 64, out_destination += 32)
+                {
+                    uint8x16x4_t rgba = vld4q_u8(in_source);
+                    uint8x16x2_t result;
+                    result.val[0] = vorrq_u8(vandq_u8(vshlq_n_u8(rgba.val[1], 3), greenMask), vshrq_n_u8(rgba.val[2], 3));
+                    result.val[1] = vorrq_u8(vandq_u8(rgba.val[0], redMask), vshrq_n_u8(rgba.val[1], 5));
+                    vst2q_u8(out_destination, result);
+                }
+#endif
+                for (; i < in_numPixels; ++i, in_source += 4, out_destination += 2)
+                {
+                    u16 pixel = ToRGB565(ReadPixel(in_source));
+                    memcpy(out_destination, &pixel, sizeof(u16));
+                }
+            }
+            //---------------------------------------------------
+            /// Converts RGBA8888 pixels to LumA88. The red
+            /// channel is used as the luminance.
+            ///
+            /// @param The RGBA8888 source pixels.
+            /// @param The number of pixels to convert.
+            /// @param [Out] The LumA88 destination.
+            //---------------------------------------------------
+            void ConvertToLumA88(const u8* in_source, u32 in_numPixels, u8* out_destination)
+            {
+                u32 i = 0;
+                
+#if defined(CS_SIMD_SSE2)
+                const __m128i lumMask = _mm_set1_epi32(0xFF);
+                const __m128i alphaMask = _mm_set1_epi32(0xFF00);
+                const __m128i bias32 = _mm_set1_epi32(0x8000);
+                const __m128i bias16 = _mm_set1_epi16(-0x8000);
+                
+                for (; i + 8 <= in_numPixels; i += 8, in_source += 32, out_destination += 16)
+                {
+                    __m128i result[2];
+                    for (u32 j = 0; j < 2; ++j)
+                    {
+                        __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in_source + j * 16));
+                        __m128i lum = _mm_and_si128(pixels, lumMask);
+                        __m128i alpha = _mm_and_si128(_mm_srli_epi32(pixels, 16), alphaMask);
+                        
+                        // Bias into signed range so the saturating pack preserves all 16 bits.
+                        result[j] = _mm_sub_epi32(_mm_or_si128(lum, alpha), bias32);
+                    }
+                    
+                    __m128i packed = _mm_add_epi16(_mm_packs_epi32(result[0], result[1]), bias16);
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out_destination), packed);
+                }
+#elif defined(CS_SIMD_NEON)
+                for (; i + 16 <= in_numPixels; i += 16, in_source += 64, out_destination += 32)
+                {
+                    uint8x16x4_t rgba = vld4q_u8(in_source);
+                    uint8x16x2_t result = { { rgba.val[0], rgba.val[3] } };
+                    vst2q_u8(out_destination, result);
+                }
+#endif
+                for (; i < in_numPixels; ++i, in_source += 4, out_destination += 2)
+                {
+                    u16 pixel = ToLumA88(ReadPixel(in_source));
+                    memcpy(out_destination, &pixel, sizeof(u16));
+                }
+            }
+            //---------------------------------------------------
+            /// Converts RGBA8888 pixels to Lum8. The red channel
+            /// is used as the luminance.
+            ///
+            /// @param The RGBA8888 source pixels.
+            /// @param The number of pixels to convert.
+            /// @param [Out] The Lum8 destination.
+            //---------------------------------------------------
+            void ConvertToLum8(const u8* in_source, u32 in_numPixels, u8* out_destination)
+            {
+                u32 i = 0;
+                
+#if defined(CS_SIMD_SSE2)
+                const __m128i lumMask = _mm_set1_epi32(0xFF);
+                
+                for (; i + 16 <= in_numPixels; i += 16, in_source += 64, out_destination += 16)
+                {
+                    __m128i p0 = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in_source)), lumMask);
+                    __m128i p1 = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in_source + 16)), lumMask);
+                    __m128i p2 = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in_source + 32)), lumMask);
+                    __m128i p3 = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in_source + 48)), lumMask);
+                    
+                    __m128i packed = _mm_packus_epi16(_mm_packs_epi32(p0, p1), _mm_packs_epi32(p2, p3));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out_destination), packed);
+                }
+#elif defined(CS_SIMD_NEON)
+                for (; i + 16 <= in_numPixels; i += 16, in_source += 64, out_destination += 16)
+                {
+                    uint8x16x4_t rgba = vld4q_u8(in_source);
+                    vst1q_u8(out_destination, rgba.val[0]);
+                }
+#endif
+                for (; i < in_numPixels; ++i, in_source += 4, ++out_destination)
+                {
+                    *out_destination = in_source[0];
+                }
+            }
+            //---------------------------------------------------
+            /// Builds the image with the given converted image
+            /// data, retaining the dimensions of the original.
+            ///
+            /// @param The image to rebuild.
+            /// @param The converted image data.
+            /// @param The format of the converted data.
+            //---------------------------------------------------
+            void RebuildImage(Image* in_image, ImageBuffer in_buffer, ImageFormat in_format)
+            {
+                Image::Descriptor desc;
+                desc.m_width = in_image->GetWidth();
+                desc.m_height = in_image->GetHeight();
+                desc.m_dataSize = in_buffer.m_size;
+                desc.m_compression = in_image->GetCompression();
+                desc.m_format = in_format;
+                in_image->Build(desc, std::move(in_buffer.m_data));
+            }
+            //---------------------------------------------------
+            /// Allocates the output buffer for converting the
+            /// given RGBA8888 image data to the target format.
+            ///
+            /// @param The size of the RGBA8888 image data.
+            /// @param The target format.
+            ///
+            /// @return The uninitialised output buffer.
+            //---------------------------------------------------
+            ImageBuffer CreateOutputBuffer(u32 in_imageDataSize, ImageFormat in_targetFormat)
+            {
+                CS_ASSERT(in_imageDataSize > 0 && in_imageDataSize % k_inputBytesPerPixel == 0, "Invalid input image data size.");
+                
+                ImageBuffer outputBuffer;
+                outputBuffer.m_size = (in_imageDataSize / k_inputBytesPerPixel) * GetBytesPerPixel(in_targetFormat);
+                outputBuffer.m_data = std::unique_ptr<u8[]>(new u8[outputBuffer.m_size]);
+                return outputBuffer;
+            }
+        }
+        
+        //---------------------------------------------------
+        //---------------------------------------------------
+        u32 GetBytesPerPixel(ImageFormat in_format)
+        {
+            switch (in_format)
+            {
+                case ImageFormat::k_RGBA8888:
+                case ImageFormat::k_Depth32:
+                    return 4;
+                case ImageFormat::k_RGB888:
+                    return 3;
+                case ImageFormat::k_RGBA4444:
+                case ImageFormat::k_RGB565:
+                case ImageFormat::k_LumA88:
+                case ImageFormat::k_Depth16:
+                    return 2;
+                case ImageFormat::k_Lum8:
+                    return 1;
+                default:
+                    CS_LOG_FATAL("Invalid image format.");
+                    return 0;
+            }
+        }
+        //---------------------------------------------------
+        //---------------------------------------------------
+        void ConvertRGBA8888(const u8* in_source, u32 in_numPixels, ImageFormat in_targetFormat, u8* out_destination)
+        {
+            switch (in_targetFormat)
+            {
+                case ImageFormat::k_RGBA8888:
+                    memcpy(out_destination, in_source, in_numPixels * k_inputBytesPerPixel);
+                    break;
+                case ImageFormat::k_RGB888:
+                    ConvertToRGB888(in_source, in_numPixels, out_destination);
+                    break;
+                case ImageFormat::k_RGBA4444:
+                    ConvertToRGBA4444(in_source, in_numPixels, out_destination);
+                    break;
+                case ImageFormat::k_RGB565:
+                    ConvertToRGB565(in_source, in_numPixels, out_destination);
+                    break;
+                case ImageFormat::k_LumA88:
+                    ConvertToLumA88(in_source, in_numPixels, out_destination);
+                    break;
+                case ImageFormat::k_Lum8:
+                    ConvertToLum8(in_source, in_numPixels, out_destination);
+                    break;
+                default:
+                    CS_LOG_FATAL("Cannot convert RGBA8888 to the requested image format.");
+                    break;
+            }
+        }
+        //---------------------------------------------------
+        //---------------------------------------------------
+        ImageBuffer ConvertRGBA8888(const TaskContext& in_taskContext, const u8* in_imageData, u32 in_imageDataSize, ImageFormat in_targetFormat)
+        {
+            ImageBuffer outputBuffer = CreateOutputBuffer(in_imageDataSize, in_targetFormat);
+            
+            const u32 numPixels = in_imageDataSize / k_inputBytesPerPixel;
+            const u32 outputBytesPerPixel = GetBytesPerPixel(in_targetFormat);
+            u8* output = outputBuffer.m_data.get();
+            
+            if (numPixels < 2 * k_pixelsPerTask)
+            {
+                ConvertRGBA8888(in_imageData, numPixels, in_targetFormat, output);
+                return outputBuffer;
+            }
+            
+            std::vector<Task> tasks;
+            for (u32 first = 0; first < numPixels; first += k_pixelsPerTask)
+            {
+                u32 count = std::min(k_pixelsPerTask, numPixels - first);
+                tasks.push_back([=](const TaskContext&) noexcept
+                {
+                    ConvertRGBA8888(in_imageData + first * k_inputBytesPerPixel, count, in_targetFormat, output + first * outputBytesPerPixel);
+                });
+            }
+            
+            in_taskContext.ProcessChildTasks(tasks);
+            
+            return outputBuffer;
+        }
+        //---------------------------------------------------
+        //---------------------------------------------------
+        void ConvertRGBA8888(const TaskContext& in_taskContext, Image* in_image, ImageFormat in_targetFormat)
+        {
+            CS_ASSERT(in_image->GetFormat() == ImageFormat::k_RGBA8888 && in_image->GetCompression() == ImageCompression::k_none, "Cannot convert an image that is not in uncompressed RGBA8888 format.");
+            
+            if (in_targetFormat != ImageFormat::k_RGBA8888)
+            {
+                RebuildImage(in_image, ConvertRGBA8888(in_taskContext, in_image->GetData(), in_image->GetDataSize(), in_targetFormat), in_targetFormat);
+            }
+        }
+        //---------------------------------------------------
+        //---------------------------------------------------
+        void ConvertRGBA8888(Image* in_image, ImageFormat in_targetFormat)
+        {
+            CS_ASSERT(in_image->GetFormat() == ImageFormat::k_RGBA8888 && in_image->GetCompression() == ImageCompression::k_none, "Cannot convert an image that is not in uncompressed RGBA8888 format.");
+            
+            if (in_targetFormat != ImageFormat::k_RGBA8888)
+            {
+                ImageBuffer outputBuffer = CreateOutputBuffer(in_image->GetDataSize(), in_targetFormat);
+                ConvertRGBA8888(in_image->GetData(), in_image->GetDataSize() / k_inputBytesPerPixel, in_targetFormat, outputBuffer.m_data.get());
+                RebuildImage(in_image, std::move(outputBuffer), in_targetFormat);
+            }
+        }
         //---------------------------------------------------
         //---------------------------------------------------
         void RGBA8888ToRGB888(Image* in_image)
         {
             CS_ASSERT(in_image->GetFormat() == ImageFormat::k_RGBA8888 && in_image->GetCompression() == ImageCompression::k_none, "Cannot convert an image that is not in uncompressed RGBA8888 format.");
             
-            ImageBuffer rawBuffer = RGBA8888ToRGB888(in_image->GetData(), in_image->GetDataSize());
-        
-            Image::Descriptor desc;
-            desc.m_width = in_image->GetWidth();
-            desc.m_height = in_image->GetHeight();
-            desc.m_dataSize = rawBuffer.m_size;
-            desc.m_compression = in_image->GetCompression();
-            desc.m_format = ImageFormat::k_RGB888;
-            in_image->Build(desc, std::move(rawBuffer.m_data));
+            RebuildImage(in_image, RGBA8888ToRGB888(in_image->GetData(), in_image->GetDataSize()), ImageFormat::k_RGB888);
         }
         //---------------------------------------------------
         //---------------------------------------------------
@@ -58,15 +483,7 @@ namespace ChilliSource
         {
             CS_ASSERT(in_image->GetFormat() == ImageFormat::k_RGBA8888 && in_image->GetCompression() == ImageCompression::k_none, "Cannot convert an image that is not in uncompressed RGBA8888 format.");
             
-            ImageBuffer rawBuffer = RGBA8888ToRGBA4444(in_image->GetData(), in_image->GetDataSize());
-
-            Image::Descriptor desc;
-            desc.m_width = in_image->GetWidth();
-            desc.m_height = in_image->GetHeight();
-            desc.m_dataSize = rawBuffer.m_size;
-            desc.m_compression = in_image->GetCompression();
-            desc.m_format = ImageFormat::k_RGBA4444;
-            in_image->Build(desc, std::move(rawBuffer.m_data));
+            RebuildImage(in_image, RGBA8888ToRGBA4444(in_image->GetData(), in_image->GetDataSize()), ImageFormat::k_RGBA4444);
         }
         //---------------------------------------------------
         //---------------------------------------------------
@@ -74,15 +491,7 @@ namespace ChilliSource
         {
             CS_ASSERT(in_image->GetFormat() == ImageFormat::k_RGBA8888 && in_image->GetCompression() == ImageCompression::k_none, "Cannot convert an image that is not in uncompressed RGBA8888 format.");
             
-            ImageBuffer rawBuffer = RGBA8888ToRGB565(in_image->GetData(), in_image->GetDataSize());
-
-            Image::Descriptor desc;
-            desc.m_width = in_image->GetWidth();
-            desc.m_height = in_image->GetHeight();
-            desc.m_dataSize = rawBuffer.m_size;
-            desc.m_compression = in_image->GetCompression();
-            desc.m_format = ImageFormat::k_RGB565;
-            in_image->Build(desc, std::move(rawBuffer.m_data));
+            RebuildImage(in_image, RGBA8888ToRGB565(in_image->GetData(), in_image->GetDataSize()), ImageFormat::k_RGB565);
         }
         //---------------------------------------------------
         //---------------------------------------------------
@@ -90,15 +499,7 @@ namespace ChilliSource
         {
             CS_ASSERT(in_image->GetFormat() == ImageFormat::k_RGBA8888 && in_image->GetCompression() == ImageCompression::k_none, "Cannot convert an image that is not in uncompressed RGBA8888 format.");
             
-            ImageBuffer rawBuffer = RGBA8888ToLumA88(in_image->GetData(), in_image->GetDataSize());
-
-            Image::Descriptor desc;
-            desc.m_width = in_image->GetWidth();
-            desc.m_height = in_image->GetHeight();
-            desc.m_dataSize = rawBuffer.m_size;
-            desc.m_compression = in_image->GetCompression();
-            desc.m_format = ImageFormat::k_LumA88;
-            in_image->Build(desc, std::move(rawBuffer.m_data));
+            RebuildImage(in_image, RGBA8888ToLumA88(in_image->GetData(), in_image->GetDataSize()), ImageFormat::k_LumA88);
         }
         //---------------------------------------------------
         //---------------------------------------------------
@@ -106,144 +507,46 @@ namespace ChilliSource
         {
             CS_ASSERT(in_image->GetFormat() == ImageFormat::k_RGBA8888 && in_image->GetCompression() == ImageCompression::k_none, "Cannot convert an image that is not in uncompressed RGBA8888 format.");
             
-            ImageBuffer rawBuffer = RGBA8888ToLum8(in_image->GetData(), in_image->GetDataSize());
-
-            Image::Descriptor desc;
-            desc.m_width = in_image->GetWidth();
-            desc.m_height = in_image->GetHeight();
-            desc.m_dataSize = rawBuffer.m_size;
-            desc.m_compression = in_image->GetCompression();
-            desc.m_format = ImageFormat::k_Lum8;
-            in_image->Build(desc, std::move(rawBuffer.m_data));
+            RebuildImage(in_image, RGBA8888ToLum8(in_image->GetData(), in_image->GetDataSize()), ImageFormat::k_Lum8);
         }
         //---------------------------------------------------
         //---------------------------------------------------
         ImageBuffer RGBA8888ToRGB888(const u8* in_imageData, u32 in_imageDataSize)
         {
-            CS_ASSERT(in_imageDataSize > 0 && in_imageDataSize % 4 == 0, "Invalid input image data size.");
-
-            struct PixelRGB888
-            {
-                u8 m_r;
-                u8 m_g;
-                u8 m_b;
-            };
-
-            const u32 k_outputBytesPerPixel = 3;
-            const u32 area = in_imageDataSize / 4;
-
-            ImageBuffer outputBuffer;
-            outputBuffer.m_size = area * k_outputBytesPerPixel;
-            outputBuffer.m_data = std::unique_ptr<u8[]>(new u8[outputBuffer.m_size]);
-
-            const ByteColour* pixel32 = reinterpret_cast<const ByteColour*>(in_imageData);
-            PixelRGB888* pixel24 = reinterpret_cast<PixelRGB888*>(outputBuffer.m_data.get());
-
-            for(u32 i = 0; i < area; ++i, ++pixel32, ++pixel24)
-            {
-                pixel24->m_r = pixel32->r;
-                pixel24->m_g = pixel32->g;
-                pixel24->m_b = pixel32->b;
-            }
-
+            ImageBuffer outputBuffer = CreateOutputBuffer(in_imageDataSize, ImageFormat::k_RGB888);
+            ConvertToRGB888(in_imageData, in_imageDataSize / k_inputBytesPerPixel, outputBuffer.m_data.get());
             return outputBuffer;
         }
         //---------------------------------------------------
         //---------------------------------------------------
         ImageBuffer RGBA8888ToRGBA4444(const u8* in_imageData, u32 in_imageDataSize)
         {
-            CS_ASSERT(in_imageDataSize > 0 && in_imageDataSize % 4 == 0, "Invalid input image data size.");
-
-            const u32 k_outputBytesPerPixel = 2;
-            const u32 area = in_imageDataSize / 4;
-
-            ImageBuffer outputBuffer;
-            outputBuffer.m_size = area * k_outputBytesPerPixel;
-            outputBuffer.m_data = std::unique_ptr<u8[]>(new u8[outputBuffer.m_size]);
-
-            const u32* pixel32 = reinterpret_cast<const u32*>(in_imageData);
-            u16* pixel16 = reinterpret_cast<u16*>(outputBuffer.m_data.get());
-
-            for(u32 i = 0; i < area; ++i, ++pixel32, ++pixel16)
-            {
-                *pixel16 = ((((*pixel32 >> 0) & 0xFF) >> 4) << 12) | // R
-                    ((((*pixel32 >> 8) & 0xFF) >> 4) << 8) | // G
-                    ((((*pixel32 >> 16) & 0xFF) >> 4) << 4) | // B
-                    ((((*pixel32 >> 24) & 0xFF) >> 4) << 0); // A
-            }
-
+            ImageBuffer outputBuffer = CreateOutputBuffer(in_imageDataSize, ImageFormat::k_RGBA4444);
+            ConvertToRGBA4444(in_imageData, in_imageDataSize / k_inputBytesPerPixel, outputBuffer.m_data.get());
             return outputBuffer;
         }
         //---------------------------------------------------
         //---------------------------------------------------
         ImageBuffer RGBA8888ToRGB565(const u8* in_imageData, u32 in_imageDataSize)
         {
-            CS_ASSERT(in_imageDataSize > 0 && in_imageDataSize % 4 == 0, "Invalid input image data size.");
-
-            const u32 k_outputBytesPerPixel = 2;
-            const u32 area = in_imageDataSize / 4;
-
-            ImageBuffer outputBuffer;
-            outputBuffer.m_size = area * k_outputBytesPerPixel;
-            outputBuffer.m_data = std::unique_ptr<u8[]>(new u8[outputBuffer.m_size]);
-
-            const u32* pixel32 = reinterpret_cast<const u32*>(in_imageData);
-            u16* pixel16 = reinterpret_cast<u16*>(outputBuffer.m_data.get());
-
-            for(u32 i = 0; i < area; ++i, ++pixel32, ++pixel16)
-            {
-                *pixel16 = ((((*pixel32 >> 0) & 0xFF) >> 3) << 11) |
-                    ((((*pixel32 >> 8) & 0xFF) >> 2) << 5) |
-                    ((((*pixel32 >> 16) & 0xFF) >> 3) << 0);
-            }
-
+            ImageBuffer outputBuffer = CreateOutputBuffer(in_imageDataSize, ImageFormat::k_RGB565);
+            ConvertToRGB565(in_imageData, in_imageDataSize / k_inputBytesPerPixel, outputBuffer.m_data.get());
             return outputBuffer;
         }
         //---------------------------------------------------
         //---------------------------------------------------
         ImageBuffer RGBA8888ToLumA88(const u8* in_imageData, u32 in_imageDataSize)
         {
-            CS_ASSERT(in_imageDataSize > 0 && in_imageDataSize % 4 == 0, "Invalid input image data size.");
-
-            const u32 k_outputBytesPerPixel = 2;
-            const u32 area = in_imageDataSize / 4;
-
-            ImageBuffer outputBuffer;
-            outputBuffer.m_size = area * k_outputBytesPerPixel;
-            outputBuffer.m_data = std::unique_ptr<u8[]>(new u8[outputBuffer.m_size]);
-
-            const u32* pixel32 = reinterpret_cast<const u32*>(in_imageData);
-            u16* pixel16 = reinterpret_cast<u16*>(outputBuffer.m_data.get());
-
-            for(u32 i = 0; i < area; ++i, ++pixel32, ++pixel16)
-            {
-                *pixel16 = ((*pixel32) & 0xFF) | // L
-                    ((*pixel32 >> 16) & 0xFF00); // A
-            }
-
+            ImageBuffer outputBuffer = CreateOutputBuffer(in_imageDataSize, ImageFormat::k_LumA88);
+            ConvertToLumA88(in_imageData, in_imageDataSize / k_inputBytesPerPixel, outputBuffer.m_data.get());
             return outputBuffer;
         }
         //---------------------------------------------------
         //---------------------------------------------------
         ImageBuffer RGBA8888ToLum8(const u8* in_imageData, u32 in_imageDataSize)
         {
-            CS_ASSERT(in_imageDataSize > 0 && in_imageDataSize % 4 == 0, "Invalid input image data size.");
-
-            const u32 k_outputBytesPerPixel = 1;
-            const u32 area = in_imageDataSize / 4;
-
-            ImageBuffer outputBuffer;
-            outputBuffer.m_size = area * k_outputBytesPerPixel;
-            outputBuffer.m_data = std::unique_ptr<u8[]>(new u8[outputBuffer.m_size]);
-
-            const u32* pixel32 = reinterpret_cast<const u32*>(in_imageData);
-            u8* pixel8 = outputBuffer.m_data.get();
-
-            for(u32 i = 0; i < area; ++i, ++pixel32, ++pixel8)
-            {
-                *pixel8 = ((*pixel32)& 0xFF);
-            }
-
+            ImageBuffer outputBuffer = CreateOutputBuffer(in_imageDataSize, ImageFormat::k_Lum8);
+            ConvertToLum8(in_imageData, in_imageDataSize / k_inputBytesPerPixel, outputBuffer.m_data.get());
             return outputBuffer;
         }
     }
@@ -54,6 +54,68 @@ namespace ChilliSource
             u32 m_size = 0;
         };
         //---------------------------------------------------
+        /// This is thread-safe.
+        ///
+        /// @param An uncompressed image format.
+        ///
+        /// @return The number of bytes used to store a single
+        /// pixel in the given format.
+        //---------------------------------------------------
+        u32 GetBytesPerPixel(ImageFormat in_format);
+        //---------------------------------------------------
+        /// Converts a run of RGBA8888 pixels to the target
+        /// format, writing into memory provided by the
+        /// caller. SSE2 or NEON is used where available. As
+        /// no intermediate buffer is required this can be
+        /// applied to each row as it is produced by an image
+        /// decoder.
+        ///
+        /// This is thread-safe so long as the destination
+        /// ranges of concurrent calls do not overlap.
+        ///
+        /// @param The RGBA8888 source pixels.
+        /// @param The number of pixels to convert.
+        /// @param The target format.
+        /// @param [Out] The destination, which must be at
+        /// least GetBytesPerPixel(target) * num pixels bytes.
+        //---------------------------------------------------
+        void ConvertRGBA8888(const u8* in_source, u32 in_numPixels, ImageFormat in_targetFormat, u8* out_destination);
+        //---------------------------------------------------
+        /// Creates new image data in the target format from
+        /// RGBA8888 image data. Large images are split into
+        /// bands which are converted in parallel as child
+        /// tasks of the given context.
+        ///
+        /// @param The context of the task performing the
+        /// conversion.
+        /// @param The input RGBA8888 image data buffer.
+        /// @param The size of the RGBA8888 image data buffer.
+        /// @param The target format.
+        ///
+        /// @return The output image data.
+        //---------------------------------------------------
+        ImageBuffer ConvertRGBA8888(const TaskContext& in_taskContext, const u8* in_imageData, u32 in_imageDataSize, ImageFormat in_targetFormat);
+        //---------------------------------------------------
+        /// Converts an Image in format RGBA8888 to the target
+        /// format. Large images are split into bands which
+        /// are converted in parallel as child tasks of the
+        /// given context.
+        ///
+        /// @param The context of the task performing the
+        /// conversion.
+        /// @param A pointer to the image to convert.
+        /// @param The target format.
+        //---------------------------------------------------
+        void ConvertRGBA8888(const TaskContext& in_taskContext, Image* in_image, ImageFormat in_targetFormat);
+        //---------------------------------------------------
+        /// Converts an Image in format RGBA8888 to the target
+        /// format on the calling thread.
+        ///
+        /// @param A pointer to the image to convert.
+        /// @param The target format.
+        //---------------------------------------------------
+        void ConvertRGBA8888(Image* in_image, ImageFormat in_targetFormat);
+        //---------------------------------------------------
         /// Converts an Image in format RGBA8888 to RGB888
         /// format. This will allocate a new buffer for the
         /// target format data and release the previous
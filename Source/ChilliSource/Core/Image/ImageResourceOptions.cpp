@@ -1,11 +1,7 @@
 //
-//  RNGContainer.cpp
-//  ChilliSource
-//  Created by Ian Copland on 23/12/2014.
-//
 //  The MIT License (MIT)
 //
-//  Copyright (c) 2012 Tag Games Limited
+//  Copyright (c) 2017 Tag Games Limited
 //
 //  Permission is hereby granted, free of charge, to any person obtaining a copy
 //  of this software and associated documentation files (the "Software"), to deal
@@ -26,36 +22,22 @@
 //  THE SOFTWARE.
 //
 
-#ifdef CS_TARGETPLATFORM_IOS
 
-#import <CSBackend/Platform/iOS/Core/Math/RNGContainer.h>
+#include <ChilliSource/Core/Image/ImageResourceOptions.h>
 
-@implementation RNGContainer
+#include <ChilliSource/Core/Cryptographic/HashCRC32.h>
 
-//------------------------------------------------------------------------------
-//------------------------------------------------------------------------------
--(id) initWithRNG: (const std::mt19937&)in_rng
+namespace ChilliSource
 {
-    if(self = [super init])
-	{
-        m_rng = in_rng;
-		return self;
-	}
+    //------------------------------------------------------------------------------
+    ImageResourceOptions::ImageResourceOptions(ImageFormat preferredFormat) noexcept
+        : m_preferredFormat(preferredFormat)
+    {
+    }
     
-    return nil;
-}
-//------------------------------------------------------------------------------
-//------------------------------------------------------------------------------
--(std::mt19937&) rng
-{
-    return m_rng;
+    //------------------------------------------------------------------------------
+    u32 ImageResourceOptions::GenerateHash() const
+    {
+        return HashCRC32::GenerateHashCode(reinterpret_cast<const s8*>(&m_preferredFormat), sizeof(ImageFormat));
+    }
 }
-//------------------------------------------------------------------------------
-//------------------------------------------------------------------------------
--(void) dealloc
-{
-    [super dealloc];
-}
-@end
-
-#endif
@@ -0,0 +1,66 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_IMAGE_IMAGERESOURCEOPTIONS_H_
+#define _CHILLISOURCE_CORE_IMAGE_IMAGERESOURCEOPTIONS_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Image/Image.h>
+#include <ChilliSource/Core/Image/ImageFormat.h>
+#include <ChilliSource/Core/Resource/IResourceOptions.h>
+
+namespace ChilliSource
+{
+    /// Custom options for loading an image.
+    ///
+    /// The preferred format allows an image to be converted to a smaller format as it is
+    /// decoded. Providers which decode to RGBA8888 will convert each row as it is produced,
+    /// avoiding a full size RGBA8888 intermediate. Images which decode to any other format,
+    /// or which are compressed, are unaffected.
+    ///
+    /// This is immutable and therefore thread-safe.
+    ///
+    class ImageResourceOptions final : public IResourceOptions<Image>
+    {
+    public:
+        /// @param preferredFormat
+        ///     The format RGBA8888 images should be converted to on load.
+        ///
+        ImageResourceOptions(ImageFormat preferredFormat = ImageFormat::k_RGBA8888) noexcept;
+        
+        /// @return Hash of the options contents
+        ///
+        u32 GenerateHash() const override;
+        
+        /// @return The format RGBA8888 images should be converted to on load.
+        ///
+        ImageFormat GetPreferredFormat() const noexcept { return m_preferredFormat; }
+        
+    private:
+        ImageFormat m_preferredFormat;
+    };
+}
+
+#endif
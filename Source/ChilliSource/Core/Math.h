@@ -36,6 +36,8 @@
 #include <ChilliSource/Core/Math/Matrix4.h>
 #include <ChilliSource/Core/Math/Quaternion.h>
 #include <ChilliSource/Core/Math/Random.h>
+#include <ChilliSource/Core/Math/RandomStream.h>
+#include <ChilliSource/Core/Math/SIMDMath.h>
 #include <ChilliSource/Core/Math/UnifiedCoordinates.h>
 #include <ChilliSource/Core/Math/Vector2.h>
 #include <ChilliSource/Core/Math/Vector3.h>
@@ -355,6 +355,32 @@ namespace ChilliSource
         //------------------------------------------------------
         static GenericMatrix4<TType> Rotate(const GenericMatrix4<TType>& in_a, const GenericVector3<TType>& in_axis, TType in_angle);
         //------------------------------------------------------
+        /// Multiplies each matrix in the given array by the
+        /// given matrix, i.e out_c[i] = in_a[i] * in_b. This is
+        /// useful for concatenating a list of world matrices with
+        /// a single view or projection matrix, and is faster than
+        /// multiplying them individually for f32 matrices.
+        ///
+        /// @param The array of left hand matrices.
+        /// @param The right hand matrix. This cannot be an element
+        /// of the output array.
+        /// @param [Out] The output array. This can be the same as
+        /// the input array.
+        /// @param The number of matrices in the arrays.
+        //------------------------------------------------------
+        static void Multiply(const GenericMatrix4<TType>* in_a, const GenericMatrix4<TType>& in_b, GenericMatrix4<TType>* out_c, std::size_t in_count);
+        //------------------------------------------------------
+        /// Multiplies the matrices in the two given arrays pair
+        /// wise, i.e out_c[i] = in_a[i] * in_b[i].
+        ///
+        /// @param The array of left hand matrices.
+        /// @param The array of right hand matrices.
+        /// @param [Out] The output array. This can be the same as
+        /// either input array.
+        /// @param The number of matrices in the arrays.
+        //------------------------------------------------------
+        static void MultiplyPairwise(const GenericMatrix4<TType>* in_a, const GenericMatrix4<TType>* in_b, GenericMatrix4<TType>* out_c, std::size_t in_count);
+        //------------------------------------------------------
         /// Constructor. Sets the contents of the matrix to the
         /// identity matrix.
         ///
@@ -656,6 +682,7 @@ namespace ChilliSource
 // which is enough for the classes included to use it.
 //----------------------------------------------------
 #include <ChilliSource/Core/Math/Quaternion.h>
+#include <ChilliSource/Core/Math/SIMDMath.h>
 #include <ChilliSource/Core/Math/Vector3.h>
 #include <ChilliSource/Core/Math/Vector4.h>
 
@@ -988,6 +1015,24 @@ namespace ChilliSource
     }
     //------------------------------------------------------
     //------------------------------------------------------
+    template <typename TType> void GenericMatrix4<TType>::Multiply(const GenericMatrix4<TType>* in_a, const GenericMatrix4<TType>& in_b, GenericMatrix4<TType>* out_c, std::size_t in_count)
+    {
+        for (std::size_t i = 0; i < in_count; ++i)
+        {
+            out_c[i] = in_a[i] * in_b;
+        }
+    }
+    //------------------------------------------------------
+    //------------------------------------------------------
+    template <typename TType> void GenericMatrix4<TType>::MultiplyPairwise(const GenericMatrix4<TType>* in_a, const GenericMatrix4<TType>* in_b, GenericMatrix4<TType>* out_c, std::size_t in_count)
+    {
+        for (std::size_t i = 0; i < in_count; ++i)
+        {
+            out_c[i] = in_a[i] * in_b[i];
+        }
+    }
+    //------------------------------------------------------
+    //------------------------------------------------------
     template <typename TType> GenericMatrix4<TType>::GenericMatrix4()
     {
         Identity();
@@ -1340,6 +1385,46 @@ namespace ChilliSource
     {
         return !(in_a == in_b);
     }
+    //------------------------------------------------------
+    /// f32 specialisations. These are backed by the SSE2 or
+    /// NEON kernels in SIMDMath where available.
+    //------------------------------------------------------
+    template <> inline GenericMatrix4<f32> GenericMatrix4<f32>::Inverse(const GenericMatrix4<f32>& in_a)
+    {
+        GenericMatrix4<f32> b = in_a;
+        SIMDMath::InverseMatrix4(in_a.m, b.m);
+        return b;
+    }
+    //------------------------------------------------------
+    //------------------------------------------------------
+    template <> inline void GenericMatrix4<f32>::Multiply(const GenericMatrix4<f32>* in_a, const GenericMatrix4<f32>& in_b, GenericMatrix4<f32>* out_c, std::size_t in_count)
+    {
+        SIMDMath::MultiplyMatrix4Array(in_a->m, in_b.m, out_c->m, in_count);
+    }
+    //------------------------------------------------------
+    //------------------------------------------------------
+    template <> inline void GenericMatrix4<f32>::MultiplyPairwise(const GenericMatrix4<f32>* in_a, const GenericMatrix4<f32>* in_b, GenericMatrix4<f32>* out_c, std::size_t in_count)
+    {
+        for (std::size_t i = 0; i < in_count; ++i)
+        {
+            SIMDMath::MultiplyMatrix4(in_a[i].m, in_b[i].m, out_c[i].m);
+        }
+    }
+    //------------------------------------------------------
+    //------------------------------------------------------
+    template <> inline GenericMatrix4<f32>& GenericMatrix4<f32>::operator*=(const GenericMatrix4<f32>& in_b)
+    {
+        SIMDMath::MultiplyMatrix4(m, in_b.m, m);
+        return *this;
+    }
+    //------------------------------------------------------
+    //------------------------------------------------------
+    template <> inline GenericMatrix4<f32> operator*(const GenericMatrix4<f32>& in_a, const GenericMatrix4<f32>& in_b)
+    {
+        GenericMatrix4<f32> c = in_a;
+        SIMDMath::MultiplyMatrix4(in_a.m, in_b.m, c.m);
+        return c;
+    }
 }
 
 #endif
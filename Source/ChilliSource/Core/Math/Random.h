@@ -31,19 +31,33 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Math/NumericLimits.h>
-
-#include <random>
+#include <ChilliSource/Core/Math/RandomStream.h>
 
 namespace ChilliSource
 {
     //------------------------------------------------------------------------------
     /// A collection of thread-safe methods which can be used to generate pseudo
-    /// random numbers.
+    /// random numbers. Each thread generates numbers from its own RandomStream,
+    /// so no locking is required.
+    ///
+    /// When generating many values, or when results must be reproducible, prefer
+    /// using a RandomStream directly.
     ///
     /// @author Ian Copland
     //------------------------------------------------------------------------------
     namespace Random
     {
+        //------------------------------------------------------------------------------
+        /// Returns the random stream for the current thread. This is created with a
+        /// unique seed the first time it is requested on each thread. Fetching the
+        /// stream once and using it for a batch of values avoids repeated thread
+        /// local lookups.
+        ///
+        /// The stream must only be used on the thread it was fetched from.
+        ///
+        /// @return The random stream for the current thread.
+        //------------------------------------------------------------------------------
+        RandomStream& GetThreadStream() noexcept;
         //------------------------------------------------------------------------------
         /// Generates a pseudo-random value of the requested type within the given range.
         /// Defaults to the maximum possible range for the given type.
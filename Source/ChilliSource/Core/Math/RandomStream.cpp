@@ -0,0 +1,246 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Core/Math/RandomStream.h>
+
+#include <ChilliSource/Core/Base/Colour.h>
+#include <ChilliSource/Core/Math/Matrix3.h>
+#include <ChilliSource/Core/Math/Matrix4.h>
+#include <ChilliSource/Core/Math/Quaternion.h>
+#include <ChilliSource/Core/Math/Vector4.h>
+
+#include <atomic>
+#include <random>
+
+namespace ChilliSource
+{
+    namespace
+    {
+        /// Mixes the bits of the given value, so that similar inputs produce very different
+        /// outputs. This is the SplitMix64 finaliser.
+        ///
+        /// @param value
+        ///     The value to mix.
+        ///
+        /// @return The mixed value.
+        ///
+        u64 Mix(u64 value) noexcept
+        {
+            value = (value ^ (value >> 30u)) * 0xbf58476d1ce4e5b9ull;
+            value = (value ^ (value >> 27u)) * 0x94d049bb133111ebull;
+            return value ^ (value >> 31u);
+        }
+        
+        /// @return A value read from the system's source of entropy. This is only read once, the
+        ///     first time it is requested.
+        ///
+        u64 GetEntropy() noexcept
+        {
+            static const u64 entropy = []()
+            {
+                std::random_device randomDevice;
+                u64 high = randomDevice();
+                return (high << 32u) | randomDevice();
+            }();
+            
+            return entropy;
+        }
+        
+        std::atomic<u64> g_nextStreamId(0);
+    }
+    
+    //------------------------------------------------------------------------------
+    RandomStream::RandomStream() noexcept
+    {
+        auto streamId = g_nextStreamId.fetch_add(1, std::memory_order_relaxed);
+        Seed(Mix(GetEntropy() + streamId), streamId);
+    }
+    
+    //------------------------------------------------------------------------------
+    RandomStream::RandomStream(u64 seed, u64 streamId) noexcept
+    {
+        Seed(seed, streamId);
+    }
+    
+    //------------------------------------------------------------------------------
+    void RandomStream::Seed(u64 seed, u64 streamId) noexcept
+    {
+        m_state = 0;
+        m_increment = (streamId << 1u) | 1u;
+        NextU32();
+        m_state += seed;
+        NextU32();
+    }
+    
+    //------------------------------------------------------------------------------
+    RandomStream RandomStream::Fork(u64 streamId) noexcept
+    {
+        return RandomStream(NextU64(), streamId);
+    }
+    
+    //------------------------------------------------------------------------------
+    u64 RandomStream::NextBounded(u64 upper) noexcept
+    {
+        if (upper < u64(NumericLimits::Highest<u32>()))
+        {
+            //Lemire's multiply-shift method, rejecting the few values which would introduce bias.
+            u32 range = u32(upper) + 1;
+            u64 product = u64(NextU32()) * range;
+            
+            if (u32(product) < range)
+            {
+                u32 threshold = (0u - range) % range;
+                while (u32(product) < threshold)
+                {
+                    product = u64(NextU32()) * range;
+                }
+            }
+            
+            return product >> 32u;
+        }
+        else if (upper == u64(NumericLimits::Highest<u32>()))
+        {
+            return NextU32();
+        }
+        else if (upper == NumericLimits::Highest<u64>())
+        {
+            return NextU64();
+        }
+        
+        u64 range = upper + 1;
+        u64 threshold = (0ull - range) % range;
+        
+        u64 value = NextU64();
+        while (value < threshold)
+        {
+            value = NextU64();
+        }
+        
+        return value % range;
+    }
+    
+    //------------------------------------------------------------------------------
+    void RandomStream::FillNormalised(f32* values, u32 numValues) noexcept
+    {
+        for (u32 i = 0; i < numValues; ++i)
+        {
+            values[i] = NextNormalisedF32();
+        }
+    }
+    
+    //------------------------------------------------------------------------------
+    void RandomStream::FillDirection2D(Vector2* values, u32 numValues) noexcept
+    {
+        for (u32 i = 0; i < numValues; ++i)
+        {
+            values[i] = GenerateDirection2D<f32>();
+        }
+    }
+    
+    //------------------------------------------------------------------------------
+    void RandomStream::FillDirection3D(Vector3* values, u32 numValues) noexcept
+    {
+        for (u32 i = 0; i < numValues; ++i)
+        {
+            values[i] = GenerateDirection3D<f32>();
+        }
+    }
+    
+    //------------------------------------------------------------------------------
+    template <> Vector2 RandomStream::GenerateComponentwise(Vector2 lower, Vector2 upper) noexcept
+    {
+        f32 x = Generate(lower.x, upper.x);
+        f32 y = Generate(lower.y, upper.y);
+        
+        return Vector2(x, y);
+    }
+    
+    //------------------------------------------------------------------------------
+    template <> Vector3 RandomStream::GenerateComponentwise(Vector3 lower, Vector3 upper) noexcept
+    {
+        f32 x = Generate(lower.x, upper.x);
+        f32 y = Generate(lower.y, upper.y);
+        f32 z = Generate(lower.z, upper.z);
+        
+        return Vector3(x, y, z);
+    }
+    
+    //------------------------------------------------------------------------------
+    template <> Vector4 RandomStream::GenerateComponentwise(Vector4 lower, Vector4 upper) noexcept
+    {
+        f32 x = Generate(lower.x, upper.x);
+        f32 y = Generate(lower.y, upper.y);
+        f32 z = Generate(lower.z, upper.z);
+        f32 w = Generate(lower.w, upper.w);
+        
+        return Vector4(x, y, z, w);
+    }
+    
+    //------------------------------------------------------------------------------
+    template <> Matrix3 RandomStream::GenerateComponentwise(Matrix3 lower, Matrix3 upper) noexcept
+    {
+        Matrix3 output;
+        for (u32 i = 0; i < 9; ++i)
+        {
+            output.m[i] = Generate(lower.m[i], upper.m[i]);
+        }
+        
+        return output;
+    }
+    
+    //------------------------------------------------------------------------------
+    template <> Matrix4 RandomStream::GenerateComponentwise(Matrix4 lower, Matrix4 upper) noexcept
+    {
+        Matrix4 output;
+        for (u32 i = 0; i < 16; ++i)
+        {
+            output.m[i] = Generate(lower.m[i], upper.m[i]);
+        }
+        
+        return output;
+    }
+    
+    //------------------------------------------------------------------------------
+    template <> Quaternion RandomStream::GenerateComponentwise(Quaternion lower, Quaternion upper) noexcept
+    {
+        f32 x = Generate(lower.x, upper.x);
+        f32 y = Generate(lower.y, upper.y);
+        f32 z = Generate(lower.z, upper.z);
+        f32 w = Generate(lower.w, upper.w);
+        
+        return Quaternion(x, y, z, w);
+    }
+    
+    //------------------------------------------------------------------------------
+    template <> Colour RandomStream::GenerateComponentwise(Colour lower, Colour upper) noexcept
+    {
+        f32 r = Generate(lower.r, upper.r);
+        f32 g = Generate(lower.g, upper.g);
+        f32 b = Generate(lower.b, upper.b);
+        f32 a = Generate(lower.a, upper.a);
+        
+        return Colour(r, g, b, a);
+    }
+}
@@ -0,0 +1,359 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_MATH_RANDOMSTREAM_H_
+#define _CHILLISOURCE_CORE_MATH_RANDOMSTREAM_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Math/NumericLimits.h>
+#include <ChilliSource/Core/Math/Vector2.h>
+#include <ChilliSource/Core/Math/Vector3.h>
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
+namespace ChilliSource
+{
+    /// A small, fast pseudo random number generator based on PCG32. The full state is 16 bytes
+    /// so streams are cheap to create, copy and store alongside the data they are used with.
+    ///
+    /// A stream created from a seed and stream Id will always produce the same sequence, and
+    /// streams with different Ids produce independent sequences even when given the same seed.
+    /// This allows deterministic results when work is split across tasks: each task can be
+    /// given its own stream, either created explicitly or forked from a parent stream.
+    ///
+    /// This meets the requirements of a uniform random bit generator so it can also be used
+    /// with the standard library distributions.
+    ///
+    /// This is not thread-safe; each thread should use its own stream. Random provides a
+    /// stream per thread for general use.
+    ///
+    class RandomStream final
+    {
+    public:
+        using result_type = u32;
+        
+        /// @return The smallest value that can be returned by operator().
+        ///
+        static constexpr u32 min() noexcept { return 0; }
+        
+        /// @return The largest value that can be returned by operator().
+        ///
+        static constexpr u32 max() noexcept { return 0xffffffff; }
+        
+        /// Creates a new stream with a unique, non-deterministic seed and stream Id.
+        ///
+        RandomStream() noexcept;
+        
+        /// Creates a new stream with the given seed and stream Id.
+        ///
+        /// @param seed
+        ///     The seed.
+        /// @param streamId
+        ///     (Optional) The stream Id. Streams with different Ids produce independent
+        ///     sequences. Defaults to 0.
+        ///
+        explicit RandomStream(u64 seed, u64 streamId = 0) noexcept;
+        
+        /// Resets the stream with the given seed and stream Id.
+        ///
+        /// @param seed
+        ///     The seed.
+        /// @param streamId
+        ///     (Optional) The stream Id. Defaults to 0.
+        ///
+        void Seed(u64 seed, u64 streamId = 0) noexcept;
+        
+        /// Creates a new stream seeded from this one. The sequence produced by the new stream
+        /// depends only on the current state of this stream and the given stream Id, so forking
+        /// a stream once per task gives deterministic results regardless of which thread each
+        /// task runs on.
+        ///
+        /// @param streamId
+        ///     The stream Id of the new stream, typically the index of the task.
+        ///
+        /// @return The new stream.
+        ///
+        RandomStream Fork(u64 streamId) noexcept;
+        
+        /// @return The next 32-bit value in the sequence.
+        ///
+        u32 operator()() noexcept { return NextU32(); }
+        
+        /// @return The next 32-bit value in the sequence.
+        ///
+        u32 NextU32() noexcept;
+        
+        /// @return The next 64-bit value in the sequence. This consumes two 32-bit values.
+        ///
+        u64 NextU64() noexcept;
+        
+        /// @param upper
+        ///     The upper value, inclusive.
+        ///
+        /// @return A value in the range 0 to upper, inclusive, without modulo bias.
+        ///
+        u64 NextBounded(u64 upper) noexcept;
+        
+        /// @return A value in the range 0.0 (inclusive) to 1.0 (exclusive).
+        ///
+        f32 NextNormalisedF32() noexcept;
+        
+        /// @return A value in the range 0.0 (inclusive) to 1.0 (exclusive).
+        ///
+        f64 NextNormalisedF64() noexcept;
+        
+        /// Generates a value of the requested type within the given range. Defaults to the maximum
+        /// possible range for the given type. Integer values are inclusive of both bounds. Other
+        /// types are interpolated between the bounds using a single normalised value.
+        ///
+        /// @param lower
+        ///     (Optional) The lower value.
+        /// @param upper
+        ///     (Optional) The upper value.
+        ///
+        /// @return A value within the range.
+        ///
+        template <typename TType> TType Generate(TType lower = NumericLimits::Lowest<TType>(), TType upper = NumericLimits::Highest<TType>()) noexcept;
+        
+        /// @return A value in the range 0.0 to 1.0 for the given type.
+        ///
+        template <typename TType> TType GenerateNormalised() noexcept;
+        
+        /// Generates a value between the two given values. If the value has multiple components,
+        /// each is randomised individually, otherwise this is identical to Generate().
+        ///
+        /// @param lower
+        ///     The lower value.
+        /// @param upper
+        ///     The upper value.
+        ///
+        /// @return The value in the given range.
+        ///
+        template <typename TType> TType GenerateComponentwise(TType lower, TType upper) noexcept;
+        
+        /// @return A direction vector in 2 dimensions with uniform distribution.
+        ///
+        template <typename TType> GenericVector2<TType> GenerateDirection2D() noexcept;
+        
+        /// @return A direction vector in 3 dimensions with uniform distribution.
+        ///
+        template <typename TType> GenericVector3<TType> GenerateDirection3D() noexcept;
+        
+        /// Fills the given array with values in the range 0.0 (inclusive) to 1.0 (exclusive).
+        ///
+        /// @param values
+        ///     The output array.
+        /// @param numValues
+        ///     The number of values to generate.
+        ///
+        void FillNormalised(f32* values, u32 numValues) noexcept;
+        
+        /// Fills the given array with values within the given range, as per Generate().
+        ///
+        /// @param lower
+        ///     The lower value.
+        /// @param upper
+        ///     The upper value.
+        /// @param values
+        ///     The output array.
+        /// @param numValues
+        ///     The number of values to generate.
+        ///
+        template <typename TType> void Fill(TType lower, TType upper, TType* values, u32 numValues) noexcept;
+        
+        /// Fills the given array with values within the given range, as per GenerateComponentwise().
+        ///
+        /// @param lower
+        ///     The lower value.
+        /// @param upper
+        ///     The upper value.
+        /// @param values
+        ///     The output array.
+        /// @param numValues
+        ///     The number of values to generate.
+        ///
+        template <typename TType> void FillComponentwise(TType lower, TType upper, TType* values, u32 numValues) noexcept;
+        
+        /// Fills the given array with direction vectors in 2 dimensions with uniform distribution.
+        ///
+        /// @param values
+        ///     The output array.
+        /// @param numValues
+        ///     The number of values to generate.
+        ///
+        void FillDirection2D(Vector2* values, u32 numValues) noexcept;
+        
+        /// Fills the given array with direction vectors in 3 dimensions with uniform distribution.
+        ///
+        /// @param values
+        ///     The output array.
+        /// @param numValues
+        ///     The number of values to generate.
+        ///
+        void FillDirection3D(Vector3* values, u32 numValues) noexcept;
+        
+    private:
+        u64 m_state = 0;
+        u64 m_increment = 1;
+    };
+    
+    template <> Vector2 RandomStream::GenerateComponentwise(Vector2 lower, Vector2 upper) noexcept;
+    template <> Vector3 RandomStream::GenerateComponentwise(Vector3 lower, Vector3 upper) noexcept;
+    template <> Vector4 RandomStream::GenerateComponentwise(Vector4 lower, Vector4 upper) noexcept;
+    template <> Matrix3 RandomStream::GenerateComponentwise(Matrix3 lower, Matrix3 upper) noexcept;
+    template <> Matrix4 RandomStream::GenerateComponentwise(Matrix4 lower, Matrix4 upper) noexcept;
+    template <> Quaternion RandomStream::GenerateComponentwise(Quaternion lower, Quaternion upper) noexcept;
+    template <> Colour RandomStream::GenerateComponentwise(Colour lower, Colour upper) noexcept;
+    
+    namespace RandomStreamImpl
+    {
+        constexpr f64 k_twoPi = 6.28318530717958647692;
+        
+        /// Uses template specialisation to determine which of the 3 generation types should be
+        /// used: Integer, Floating point or Generic.
+        ///
+        template <typename TType, bool = std::is_integral<TType>::value, bool = std::is_floating_point<TType>::value> struct Generator
+        {
+            static TType Generate(RandomStream& stream, TType lower, TType upper) noexcept
+            {
+                return lower + (upper - lower) * stream.NextNormalisedF32();
+            }
+        };
+        
+        template <typename TType> struct Generator<TType, true, false>
+        {
+            static TType Generate(RandomStream& stream, TType lower, TType upper) noexcept
+            {
+                TType min = std::min(lower, upper);
+                TType max = std::max(lower, upper);
+                
+                //Unsigned arithmetic is used so that ranges spanning the full width of signed types don't overflow.
+                return TType(u64(min) + stream.NextBounded(u64(max) - u64(min)));
+            }
+        };
+        
+        template <typename TType> struct Generator<TType, false, true>
+        {
+            static TType Generate(RandomStream& stream, TType lower, TType upper) noexcept
+            {
+                return lower + (upper - lower) * TType(stream.NextNormalisedF64());
+            }
+        };
+        
+        template <> struct Generator<f32, false, true>
+        {
+            static f32 Generate(RandomStream& stream, f32 lower, f32 upper) noexcept
+            {
+                return lower + (upper - lower) * stream.NextNormalisedF32();
+            }
+        };
+    }
+    
+    //------------------------------------------------------------------------------
+    inline u32 RandomStream::NextU32() noexcept
+    {
+        u64 oldState = m_state;
+        m_state = oldState * 6364136223846793005ull + m_increment;
+        
+        u32 xorShifted = u32(((oldState >> 18u) ^ oldState) >> 27u);
+        u32 rotation = u32(oldState >> 59u);
+        return (xorShifted >> rotation) | (xorShifted << ((32u - rotation) & 31u));
+    }
+    
+    //------------------------------------------------------------------------------
+    inline u64 RandomStream::NextU64() noexcept
+    {
+        u64 high = NextU32();
+        return (high << 32u) | NextU32();
+    }
+    
+    //------------------------------------------------------------------------------
+    inline f32 RandomStream::NextNormalisedF32() noexcept
+    {
+        return f32(NextU32() >> 8u) * (1.0f / 16777216.0f);
+    }
+    
+    //------------------------------------------------------------------------------
+    inline f64 RandomStream::NextNormalisedF64() noexcept
+    {
+        return f64(NextU64() >> 11u) * (1.0 / 9007199254740992.0);
+    }
+    
+    //------------------------------------------------------------------------------
+    template <typename TType> TType RandomStream::Generate(TType lower, TType upper) noexcept
+    {
+        return RandomStreamImpl::Generator<TType>::Generate(*this, lower, upper);
+    }
+    
+    //------------------------------------------------------------------------------
+    template <typename TType> TType RandomStream::GenerateNormalised() noexcept
+    {
+        return Generate<TType>(TType(0), TType(1));
+    }
+    
+    //------------------------------------------------------------------------------
+    template <typename TType> TType RandomStream::GenerateComponentwise(TType lower, TType upper) noexcept
+    {
+        return Generate(lower, upper);
+    }
+    
+    //------------------------------------------------------------------------------
+    template <typename TType> GenericVector2<TType> RandomStream::GenerateDirection2D() noexcept
+    {
+        TType angle = TType(RandomStreamImpl::k_twoPi) * GenerateNormalised<TType>();
+        return GenericVector2<TType>(std::cos(angle), std::sin(angle));
+    }
+    
+    //------------------------------------------------------------------------------
+    template <typename TType> GenericVector3<TType> RandomStream::GenerateDirection3D() noexcept
+    {
+        TType z = TType(2) * GenerateNormalised<TType>() - TType(1);
+        TType angle = TType(RandomStreamImpl::k_twoPi) * GenerateNormalised<TType>();
+        TType radius = std::sqrt(std::max(TType(0), TType(1) - z * z));
+        return GenericVector3<TType>(radius * std::cos(angle), radius * std::sin(angle), z);
+    }
+    
+    //------------------------------------------------------------------------------
+    template <typename TType> void RandomStream::Fill(TType lower, TType upper, TType* values, u32 numValues) noexcept
+    {
+        for (u32 i = 0; i < numValues; ++i)
+        {
+            values[i] = Generate(lower, upper);
+        }
+    }
+    
+    //------------------------------------------------------------------------------
+    template <typename TType> void RandomStream::FillComponentwise(TType lower, TType upper, TType* values, u32 numValues) noexcept
+    {
+        for (u32 i = 0; i < numValues; ++i)
+        {
+            values[i] = GenerateComponentwise(lower, upper);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,169 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_MATH_SIMDMATH_H_
+#define _CHILLISOURCE_CORE_MATH_SIMDMATH_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Base/SIMD.h>
+
+namespace ChilliSource
+{
+    /// A collection of low level f32 kernels which back the f32 specialisations
+    /// of the matrix and vector types. Each kernel has an SSE2 and a
+    /// NEON implementation, with a scalar fallback which is used when neither is
+    /// available or CS_DISABLE_SIMD is defined.
+    ///
+    /// Matrices are 16 consecutive floats in the same row major layout used by
+    /// GenericMatrix4, and vectors are transformed as row vectors, i.e v * M.
+    /// Unaligned loads and stores are used throughout so the kernels can be used
+    /// with tightly packed arrays of the math types. Unless stated otherwise the
+    /// output of a kernel may alias its input.
+    ///
+    namespace SIMDMath
+    {
+        /// Calculates out = a * b for two 4x4 matrices.
+        ///
+        /// @param a
+        ///     The left hand matrix.
+        /// @param b
+        ///     The right hand matrix.
+        /// @param out
+        ///     (Out) The resulting matrix.
+        ///
+        inline void MultiplyMatrix4(const f32* a, const f32* b, f32* out) noexcept;
+
+        /// Calculates out[i] = a[i] * b for an array of 4x4 matrices. The rows of b
+        /// are only loaded once, making this cheaper than multiplying each matrix in
+        /// turn.
+        ///
+        /// @param a
+        ///     The array of left hand matrices.
+        /// @param b
+        ///     The right hand matrix. This cannot alias the output.
+        /// @param out
+        ///     (Out) The array of resulting matrices.
+        /// @param count
+        ///     The number of matrices.
+        ///
+        inline void MultiplyMatrix4Array(const f32* a, const f32* b, f32* out, std::size_t count) noexcept;
+
+        /// Calculates the inverse of a 4x4 matrix. The 2x2 sub-determinants are
+        /// shared between the cofactors, so this needs considerably fewer multiplies
+        /// than expanding each cofactor individually. This is scalar on all targets.
+        ///
+        /// @param a
+        ///     The matrix to invert.
+        /// @param out
+        ///     (Out) The inverse. This is left untouched if a cannot be inverted.
+        ///
+        /// @return Whether or not the matrix could be inverted.
+        ///
+        inline bool InverseMatrix4(const f32* a, f32* out) noexcept;
+
+        /// Calculates out = v * m for a 4D vector.
+        ///
+        /// @param v
+        ///     The vector.
+        /// @param m
+        ///     The matrix.
+        /// @param out
+        ///     (Out) The transformed vector.
+        ///
+        inline void TransformVector4(const f32* v, const f32* m, f32* out) noexcept;
+
+        /// Calculates out[i] = v[i] * m for an array of 4D vectors.
+        ///
+        /// @param v
+        ///     The array of vectors.
+        /// @param m
+        ///     The matrix. This cannot alias the output.
+        /// @param out
+        ///     (Out) The array of transformed vectors.
+        /// @param count
+        ///     The number of vectors.
+        ///
+        inline void TransformVector4Array(const f32* v, const f32* m, f32* out, std::size_t count) noexcept;
+
+        /// Calculates out[i] = v[i] * m for a series of 4D vectors which are interleaved
+        /// with other data, such as the positions in an array of vertices.
+        ///
+        /// @param v
+        ///     The first vector.
+        /// @param m
+        ///     The matrix. This cannot alias the output.
+        /// @param out
+        ///     (Out) The first output vector.
+        /// @param count
+        ///     The number of vectors.
+        /// @param stride
+        ///     The distance in bytes between consecutive vectors, in both the input and
+        ///     the output.
+        ///
+        inline void TransformVector4Strided(const u8* v, const f32* m, u8* out, std::size_t count, std::size_t stride) noexcept;
+
+        /// Transforms a 3D point by the upper 3x4 part of the matrix, i.e w is
+        /// assumed to be 1 and there is no perspective divide.
+        ///
+        /// @param v
+        ///     The point.
+        /// @param m
+        ///     The matrix.
+        /// @param out
+        ///     (Out) The transformed point.
+        ///
+        inline void TransformPoint3x4(const f32* v, const f32* m, f32* out) noexcept;
+
+        /// Transforms an array of tightly packed 3D points by the upper 3x4 part of
+        /// the matrix.
+        ///
+        /// @param v
+        ///     The array of points.
+        /// @param m
+        ///     The matrix. This cannot alias the output.
+        /// @param out
+        ///     (Out) The array of transformed points.
+        /// @param count
+        ///     The number of points.
+        ///
+        inline void TransformPoint3x4Array(const f32* v, const f32* m, f32* out, std::size_t count) noexcept;
+
+        /// Transforms a 3D point by the full matrix, with w assumed to be 1, and
+        /// then performs the perspective divide.
+        ///
+        /// @param v
+        ///     The point.
+        /// @param m
+        ///     The matrix.
+        /// @param out
+        ///     (Out) The transformed point.
+        ///
+        inline void TransformPoint(const f32* v, const f32* m, f32* out) noexcept;
+    }
+}
+
+#include <ChilliSource/Core/Math/SIMDMathImpl.h>
+
+#endif
@@ -0,0 +1,384 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_MATH_SIMDMATHIMPL_H_
+#define _CHILLISOURCE_CORE_MATH_SIMDMATHIMPL_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Math/SIMDMath.h>
+
+namespace ChilliSource
+{
+    namespace SIMDMath
+    {
+#if defined(CS_SIMD_SSE2)
+        /// @return The given row vector multiplied by the matrix with rows m0 to m3.
+        ///
+        inline __m128 TransformRow(__m128 v, __m128 m0, __m128 m1, __m128 m2, __m128 m3) noexcept
+        {
+            __m128 out = _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)), m0);
+            out = _mm_add_ps(out, _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)), m1));
+            out = _mm_add_ps(out, _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2)), m2));
+            out = _mm_add_ps(out, _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3)), m3));
+            return out;
+        }
+
+        /// @return The given point, with an implicit w of 1, multiplied by the matrix
+        /// with rows m0 to m3.
+        ///
+        inline __m128 TransformPointRow(const f32* v, __m128 m0, __m128 m1, __m128 m2, __m128 m3) noexcept
+        {
+            __m128 out = _mm_mul_ps(_mm_set1_ps(v[0]), m0);
+            out = _mm_add_ps(out, _mm_mul_ps(_mm_set1_ps(v[1]), m1));
+            out = _mm_add_ps(out, _mm_mul_ps(_mm_set1_ps(v[2]), m2));
+            return _mm_add_ps(out, m3);
+        }
+
+        /// Stores the first three lanes of the given register.
+        ///
+        inline void StoreXYZ(__m128 v, f32* out) noexcept
+        {
+            _mm_storel_pi(reinterpret_cast<__m64*>(out), v);
+            _mm_store_ss(out + 2, _mm_movehl_ps(v, v));
+        }
+#elif defined(CS_SIMD_NEON)
+        /// @return The given row vector multiplied by the matrix with rows m0 to m3.
+        ///
+        inline float32x4_t TransformRow(float32x4_t v, float32x4_t m0, float32x4_t m1, float32x4_t m2, float32x4_t m3) noexcept
+        {
+            float32x2_t low = vget_low_f32(v);
+            float32x2_t high = vget_high_f32(v);
+            float32x4_t out = vmulq_lane_f32(m0, low, 0);
+            out = vmlaq_lane_f32(out, m1, low, 1);
+            out = vmlaq_lane_f32(out, m2, high, 0);
+            out = vmlaq_lane_f32(out, m3, high, 1);
+            return out;
+        }
+
+        /// @return The given point, with an implicit w of 1, multiplied by the matrix
+        /// with rows m0 to m3.
+        ///
+        inline float32x4_t TransformPointRow(const f32* v, float32x4_t m0, float32x4_t m1, float32x4_t m2, float32x4_t m3) noexcept
+        {
+            float32x4_t out = vmulq_n_f32(m0, v[0]);
+            out = vmlaq_n_f32(out, m1, v[1]);
+            out = vmlaq_n_f32(out, m2, v[2]);
+            return vaddq_f32(out, m3);
+        }
+
+        /// Stores the first three lanes of the given register.
+        ///
+        inline void StoreXYZ(float32x4_t v, f32* out) noexcept
+        {
+            vst1_f32(out, vget_low_f32(v));
+            vst1q_lane_f32(out + 2, v, 2);
+        }
+#endif
+
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        inline void MultiplyMatrix4(const f32* a, const f32* b, f32* out) noexcept
+        {
+#if defined(CS_SIMD_SSE2)
+            __m128 b0 = _mm_loadu_ps(b);
+            __m128 b1 = _mm_loadu_ps(b + 4);
+            __m128 b2 = _mm_loadu_ps(b + 8);
+            __m128 b3 = _mm_loadu_ps(b + 12);
+            __m128 c0 = TransformRow(_mm_loadu_ps(a), b0, b1, b2, b3);
+            __m128 c1 = TransformRow(_mm_loadu_ps(a + 4), b0, b1, b2, b3);
+            __m128 c2 = TransformRow(_mm_loadu_ps(a + 8), b0, b1, b2, b3);
+            __m128 c3 = TransformRow(_mm_loadu_ps(a + 12), b0, b1, b2, b3);
+            _mm_storeu_ps(out, c0);
+            _mm_storeu_ps(out + 4, c1);
+            _mm_storeu_ps(out + 8, c2);
+            _mm_storeu_ps(out + 12, c3);
+#elif defined(CS_SIMD_NEON)
+            float32x4_t b0 = vld1q_f32(b);
+            float32x4_t b1 = vld1q_f32(b + 4);
+            float32x4_t b2 = vld1q_f32(b + 8);
+            float32x4_t b3 = vld1q_f32(b + 12);
+            float32x4_t c0 = TransformRow(vld1q_f32(a), b0, b1, b2, b3);
+            float32x4_t c1 = TransformRow(vld1q_f32(a + 4), b0, b1, b2, b3);
+            float32x4_t c2 = TransformRow(vld1q_f32(a + 8), b0, b1, b2, b3);
+            float32x4_t c3 = TransformRow(vld1q_f32(a + 12), b0, b1, b2, b3);
+            vst1q_f32(out, c0);
+            vst1q_f32(out + 4, c1);
+            vst1q_f32(out + 8, c2);
+            vst1q_f32(out + 12, c3);
+#else
+            f32 c[16];
+            for (u32 row = 0; row < 16; row += 4)
+            {
+                c[row + 0] = a[row] * b[0] + a[row + 1] * b[4] + a[row + 2] * b[8] + a[row + 3] * b[12];
+                c[row + 1] = a[row] * b[1] + a[row + 1] * b[5] + a[row + 2] * b[9] + a[row + 3] * b[13];
+                c[row + 2] = a[row] * b[2] + a[row + 1] * b[6] + a[row + 2] * b[10] + a[row + 3] * b[14];
+                c[row + 3] = a[row] * b[3] + a[row + 1] * b[7] + a[row + 2] * b[11] + a[row + 3] * b[15];
+            }
+            for (u32 i = 0; i < 16; ++i)
+            {
+                out[i] = c[i];
+            }
+#endif
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        inline void MultiplyMatrix4Array(const f32* a, const f32* b, f32* out, std::size_t count) noexcept
+        {
+#if defined(CS_SIMD_SSE2)
+            __m128 b0 = _mm_loadu_ps(b);
+            __m128 b1 = _mm_loadu_ps(b + 4);
+            __m128 b2 = _mm_loadu_ps(b + 8);
+            __m128 b3 = _mm_loadu_ps(b + 12);
+            for (std::size_t i = 0; i < count * 16; i += 16)
+            {
+                __m128 c0 = TransformRow(_mm_loadu_ps(a + i), b0, b1, b2, b3);
+                __m128 c1 = TransformRow(_mm_loadu_ps(a + i + 4), b0, b1, b2, b3);
+                __m128 c2 = TransformRow(_mm_loadu_ps(a + i + 8), b0, b1, b2, b3);
+                __m128 c3 = TransformRow(_mm_loadu_ps(a + i + 12), b0, b1, b2, b3);
+                _mm_storeu_ps(out + i, c0);
+                _mm_storeu_ps(out + i + 4, c1);
+                _mm_storeu_ps(out + i + 8, c2);
+                _mm_storeu_ps(out + i + 12, c3);
+            }
+#elif defined(CS_SIMD_NEON)
+            float32x4_t b0 = vld1q_f32(b);
+            float32x4_t b1 = vld1q_f32(b + 4);
+            float32x4_t b2 = vld1q_f32(b + 8);
+            float32x4_t b3 = vld1q_f32(b + 12);
+            for (std::size_t i = 0; i < count * 16; i += 16)
+            {
+                float32x4_t c0 = TransformRow(vld1q_f32(a + i), b0, b1, b2, b3);
+                float32x4_t c1 = TransformRow(vld1q_f32(a + i + 4), b0, b1, b2, b3);
+                float32x4_t c2 = TransformRow(vld1q_f32(a + i + 8), b0, b1, b2, b3);
+                float32x4_t c3 = TransformRow(vld1q_f32(a + i + 12), b0, b1, b2, b3);
+                vst1q_f32(out + i, c0);
+                vst1q_f32(out + i + 4, c1);
+                vst1q_f32(out + i + 8, c2);
+                vst1q_f32(out + i + 12, c3);
+            }
+#else
+            for (std::size_t i = 0; i < count * 16; i += 16)
+            {
+                MultiplyMatrix4(a + i, b, out + i);
+            }
+#endif
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        inline bool InverseMatrix4(const f32* a, f32* out) noexcept
+        {
+            f32 s0 = a[0] * a[5] - a[4] * a[1];
+            f32 s1 = a[0] * a[6] - a[4] * a[2];
+            f32 s2 = a[0] * a[7] - a[4] * a[3];
+            f32 s3 = a[1] * a[6] - a[5] * a[2];
+            f32 s4 = a[1] * a[7] - a[5] * a[3];
+            f32 s5 = a[2] * a[7] - a[6] * a[3];
+
+            f32 c0 = a[8] * a[13] - a[12] * a[9];
+            f32 c1 = a[8] * a[14] - a[12] * a[10];
+            f32 c2 = a[8] * a[15] - a[12] * a[11];
+            f32 c3 = a[9] * a[14] - a[13] * a[10];
+            f32 c4 = a[9] * a[15] - a[13] * a[11];
+            f32 c5 = a[10] * a[15] - a[14] * a[11];
+
+            f32 det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+            if (det == 0.0f)
+            {
+                return false;
+            }
+
+            f32 b[16];
+            b[0] = (a[5] * c5 - a[6] * c4 + a[7] * c3) / det;
+            b[1] = (-a[1] * c5 + a[2] * c4 - a[3] * c3) / det;
+            b[2] = (a[13] * s5 - a[14] * s4 + a[15] * s3) / det;
+            b[3] = (-a[9] * s5 + a[10] * s4 - a[11] * s3) / det;
+            b[4] = (-a[4] * c5 + a[6] * c2 - a[7] * c1) / det;
+            b[5] = (a[0] * c5 - a[2] * c2 + a[3] * c1) / det;
+            b[6] = (-a[12] * s5 + a[14] * s2 - a[15] * s1) / det;
+            b[7] = (a[8] * s5 - a[10] * s2 + a[11] * s1) / det;
+            b[8] = (a[4] * c4 - a[5] * c2 + a[7] * c0) / det;
+            b[9] = (-a[0] * c4 + a[1] * c2 - a[3] * c0) / det;
+            b[10] = (a[12] * s4 - a[13] * s2 + a[15] * s0) / det;
+            b[11] = (-a[8] * s4 + a[9] * s2 - a[11] * s0) / det;
+            b[12] = (-a[4] * c3 + a[5] * c1 - a[6] * c0) / det;
+            b[13] = (a[0] * c3 - a[1] * c1 + a[2] * c0) / det;
+            b[14] = (-a[12] * s3 + a[13] * s1 - a[14] * s0) / det;
+            b[15] = (a[8] * s3 - a[9] * s1 + a[10] * s0) / det;
+
+            for (u32 i = 0; i < 16; ++i)
+            {
+                out[i] = b[i];
+            }
+            return true;
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        inline void TransformVector4(const f32* v, const f32* m, f32* out) noexcept
+        {
+#if defined(CS_SIMD_SSE2)
+            _mm_storeu_ps(out, TransformRow(_mm_loadu_ps(v), _mm_loadu_ps(m), _mm_loadu_ps(m + 4), _mm_loadu_ps(m + 8), _mm_loadu_ps(m + 12)));
+#elif defined(CS_SIMD_NEON)
+            vst1q_f32(out, TransformRow(vld1q_f32(v), vld1q_f32(m), vld1q_f32(m + 4), vld1q_f32(m + 8), vld1q_f32(m + 12)));
+#else
+            f32 x = v[0] * m[0] + v[1] * m[4] + v[2] * m[8] + v[3] * m[12];
+            f32 y = v[0] * m[1] + v[1] * m[5] + v[2] * m[9] + v[3] * m[13];
+            f32 z = v[0] * m[2] + v[1] * m[6] + v[2] * m[10] + v[3] * m[14];
+            f32 w = v[0] * m[3] + v[1] * m[7] + v[2] * m[11] + v[3] * m[15];
+            out[0] = x;
+            out[1] = y;
+            out[2] = z;
+            out[3] = w;
+#endif
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        inline void TransformVector4Array(const f32* v, const f32* m, f32* out, std::size_t count) noexcept
+        {
+#if defined(CS_SIMD_SSE2)
+            __m128 m0 = _mm_loadu_ps(m);
+            __m128 m1 = _mm_loadu_ps(m + 4);
+            __m128 m2 = _mm_loadu_ps(m + 8);
+            __m128 m3 = _mm_loadu_ps(m + 12);
+            for (std::size_t i = 0; i < count * 4; i += 4)
+            {
+                _mm_storeu_ps(out + i, TransformRow(_mm_loadu_ps(v + i), m0, m1, m2, m3));
+            }
+#elif defined(CS_SIMD_NEON)
+            float32x4_t m0 = vld1q_f32(m);
+            float32x4_t m1 = vld1q_f32(m + 4);
+            float32x4_t m2 = vld1q_f32(m + 8);
+            float32x4_t m3 = vld1q_f32(m + 12);
+            for (std::size_t i = 0; i < count * 4; i += 4)
+            {
+                vst1q_f32(out + i, TransformRow(vld1q_f32(v + i), m0, m1, m2, m3));
+            }
+#else
+            for (std::size_t i = 0; i < count * 4; i += 4)
+            {
+                TransformVector4(v + i, m, out + i);
+            }
+#endif
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        inline void TransformVector4Strided(const u8* v, const f32* m, u8* out, std::size_t count, std::size_t stride) noexcept
+        {
+#if defined(CS_SIMD_SSE2)
+            __m128 m0 = _mm_loadu_ps(m);
+            __m128 m1 = _mm_loadu_ps(m + 4);
+            __m128 m2 = _mm_loadu_ps(m + 8);
+            __m128 m3 = _mm_loadu_ps(m + 12);
+            for (std::size_t i = 0; i < count * stride; i += stride)
+            {
+                _mm_storeu_ps(reinterpret_cast<f32*>(out + i), TransformRow(_mm_loadu_ps(reinterpret_cast<const f32*>(v + i)), m0, m1, m2, m3));
+            }
+#elif defined(CS_SIMD_NEON)
+            float32x4_t m0 = vld1q_f32(m);
+            float32x4_t m1 = vld1q_f32(m + 4);
+            float32x4_t m2 = vld1q_f32(m + 8);
+            float32x4_t m3 = vld1q_f32(m + 12);
+            for (std::size_t i = 0; i < count * stride; i += stride)
+            {
+                vst1q_f32(reinterpret_cast<f32*>(out + i), TransformRow(vld1q_f32(reinterpret_cast<const f32*>(v + i)), m0, m1, m2, m3));
+            }
+#else
+            for (std::size_t i = 0; i < count * stride; i += stride)
+            {
+                TransformVector4(reinterpret_cast<const f32*>(v + i), m, reinterpret_cast<f32*>(out + i));
+            }
+#endif
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        inline void TransformPoint3x4(const f32* v, const f32* m, f32* out) noexcept
+        {
+#if defined(CS_SIMD_SSE2)
+            StoreXYZ(TransformPointRow(v, _mm_loadu_ps(m), _mm_loadu_ps(m + 4), _mm_loadu_ps(m + 8), _mm_loadu_ps(m + 12)), out);
+#elif defined(CS_SIMD_NEON)
+            StoreXYZ(TransformPointRow(v, vld1q_f32(m), vld1q_f32(m + 4), vld1q_f32(m + 8), vld1q_f32(m + 12)), out);
+#else
+            f32 x = v[0] * m[0] + v[1] * m[4] + v[2] * m[8] + m[12];
+            f32 y = v[0] * m[1] + v[1] * m[5] + v[2] * m[9] + m[13];
+            f32 z = v[0] * m[2] + v[1] * m[6] + v[2] * m[10] + m[14];
+            out[0] = x;
+            out[1] = y;
+            out[2] = z;
+#endif
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        inline void TransformPoint3x4Array(const f32* v, const f32* m, f32* out, std::size_t count) noexcept
+        {
+#if defined(CS_SIMD_SSE2)
+            __m128 m0 = _mm_loadu_ps(m);
+            __m128 m1 = _mm_loadu_ps(m + 4);
+            __m128 m2 = _mm_loadu_ps(m + 8);
+            __m128 m3 = _mm_loadu_ps(m + 12);
+            for (std::size_t i = 0; i < count * 3; i += 3)
+            {
+                StoreXYZ(TransformPointRow(v + i, m0, m1, m2, m3), out + i);
+            }
+#elif defined(CS_SIMD_NEON)
+            float32x4_t m0 = vld1q_f32(m);
+            float32x4_t m1 = vld1q_f32(m + 4);
+            float32x4_t m2 = vld1q_f32(m + 8);
+            float32x4_t m3 = vld1q_f32(m + 12);
+            for (std::size_t i = 0; i < count * 3; i += 3)
+            {
+                StoreXYZ(TransformPointRow(v + i, m0, m1, m2, m3), out + i);
+            }
+#else
+            for (std::size_t i = 0; i < count * 3; i += 3)
+            {
+                TransformPoint3x4(v + i, m, out + i);
+            }
+#endif
+        }
+        //------------------------------------------------------------------------------
+        //------------------------------------------------------------------------------
+        inline void TransformPoint(const f32* v, const f32* m, f32* out) noexcept
+        {
+#if defined(CS_SIMD_SSE2)
+            __m128 point = TransformPointRow(v, _mm_loadu_ps(m), _mm_loadu_ps(m + 4), _mm_loadu_ps(m + 8), _mm_loadu_ps(m + 12));
+            __m128 oneOverW = _mm_div_ps(_mm_set1_ps(1.0f), _mm_shuffle_ps(point, point, _MM_SHUFFLE(3, 3, 3, 3)));
+            StoreXYZ(_mm_mul_ps(point, oneOverW), out);
+#elif defined(CS_SIMD_NEON)
+            float32x4_t point = TransformPointRow(v, vld1q_f32(m), vld1q_f32(m + 4), vld1q_f32(m + 8), vld1q_f32(m + 12));
+            f32 oneOverW = 1.0f / vgetq_lane_f32(point, 3);
+            StoreXYZ(vmulq_n_f32(point, oneOverW), out);
+#else
+            f32 x = v[0] * m[0] + v[1] * m[4] + v[2] * m[8] + m[12];
+            f32 y = v[0] * m[1] + v[1] * m[5] + v[2] * m[9] + m[13];
+            f32 z = v[0] * m[2] + v[1] * m[6] + v[2] * m[10] + m[14];
+            f32 oneOverW = 1.0f / (v[0] * m[3] + v[1] * m[7] + v[2] * m[11] + m[15]);
+            out[0] = x * oneOverW;
+            out[1] = y * oneOverW;
+            out[2] = z * oneOverW;
+#endif
+        }
+    }
+}
+
+#endif
@@ -181,6 +181,20 @@ namespace ChilliSource
         /// @param The transform matrix.
         //-----------------------------------------------------
         static GenericVector3<TType> Transform3x4(const GenericVector3<TType>& in_a, const GenericMatrix4<TType>& in_transform);
+        //-----------------------------------------------------
+        /// Transforms each point in the given array by the
+        /// given regular transform matrix, as described by
+        /// Transform3x4(). The matrix is only loaded once, so
+        /// for f32 vectors this is considerably faster than
+        /// transforming each point individually.
+        ///
+        /// @param The array of points.
+        /// @param The transform matrix.
+        /// @param [Out] The output array. This can be the same as
+        /// the input array.
+        /// @param The number of points in the arrays.
+        //-----------------------------------------------------
+        static void Transform3x4(const GenericVector3<TType>* in_points, const GenericMatrix4<TType>& in_transform, GenericVector3<TType>* out_points, std::size_t in_count);
         
         ///
         /// @param a
@@ -526,6 +540,7 @@ namespace ChilliSource
 #include <ChilliSource/Core/Math/Matrix3.h>
 #include <ChilliSource/Core/Math/Matrix4.h>
 #include <ChilliSource/Core/Math/Quaternion.h>
+#include <ChilliSource/Core/Math/SIMDMath.h>
 #include <ChilliSource/Core/Math/Vector2.h>
 
 #include <algorithm>
@@ -652,6 +667,15 @@ namespace ChilliSource
         return b;
     }
     //-----------------------------------------------------
+    template <typename TType> void GenericVector3<TType>::Transform3x4(const GenericVector3<TType>* in_points, const GenericMatrix4<TType>& in_transform, GenericVector3<TType>* out_points, std::size_t in_count)
+    {
+        for (std::size_t i = 0; i < in_count; ++i)
+        {
+            out_points[i] = Transform3x4(in_points[i], in_transform);
+        }
+    }
+    //-----------------------------------------------------
+    //-----------------------------------------------------
     template <typename TType> TType GenericVector3<TType>::Distance(const GenericVector3<TType>& a, const GenericVector3<TType>& b)
     {
         return (b - a).Length();
@@ -953,6 +977,43 @@ namespace ChilliSource
         in_a.z = -in_a.z;
         return in_a;
     }
+    //-----------------------------------------------------
+    /// f32 specialisations. These are backed by the SSE2 or
+    /// NEON kernels in SIMDMath where available.
+    //-----------------------------------------------------
+    template <> inline GenericVector3<f32> GenericVector3<f32>::Transform3x4(const GenericVector3<f32>& in_a, const GenericMatrix4<f32>& in_transform)
+    {
+        GenericVector3<f32> b;
+        SIMDMath::TransformPoint3x4(&in_a.x, in_transform.m, &b.x);
+        return b;
+    }
+    //-----------------------------------------------------
+    //-----------------------------------------------------
+    template <> inline void GenericVector3<f32>::Transform3x4(const GenericVector3<f32>* in_points, const GenericMatrix4<f32>& in_transform, GenericVector3<f32>* out_points, std::size_t in_count)
+    {
+        SIMDMath::TransformPoint3x4Array(&in_points->x, in_transform.m, &out_points->x, in_count);
+    }
+    //-----------------------------------------------------
+    //-----------------------------------------------------
+    template <> inline void GenericVector3<f32>::Transform3x4(const GenericMatrix4<f32>& in_transform)
+    {
+        SIMDMath::TransformPoint3x4(&x, in_transform.m, &x);
+    }
+    //-----------------------------------------------------
+    //-----------------------------------------------------
+    template <> inline GenericVector3<f32>& GenericVector3<f32>::operator*=(const GenericMatrix4<f32>& in_b)
+    {
+        SIMDMath::TransformPoint(&x, in_b.m, &x);
+        return *this;
+    }
+    //-----------------------------------------------------
+    //-----------------------------------------------------
+    template <> inline GenericVector3<f32> operator*(const GenericVector3<f32>& in_a, const GenericMatrix4<f32>& in_b)
+    {
+        GenericVector3<f32> c;
+        SIMDMath::TransformPoint(&in_a.x, in_b.m, &c.x);
+        return c;
+    }
 }
 
 #endif
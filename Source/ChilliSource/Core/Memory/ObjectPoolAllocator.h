@@ -26,6 +26,7 @@
 #define _CHILLISOURCE_CORE_MEMORY_OBJECTPOOLALLOCATOR_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Base/EngineCounters.h>
 #include <ChilliSource/Core/Memory/IAllocator.h>
 
 #include <mutex>
@@ -170,6 +171,8 @@ namespace ChilliSource
         
         m_freeStore = (T**)malloc(sizeof(T*) * numObjects);
         
+        EngineCounters::Increment(EngineCounter::k_poolCapacity, s64(numObjects));
+        
         Reset();
     }
     
@@ -200,6 +203,8 @@ namespace ChilliSource
         T* free = *m_freeStoreHead;
         m_freeStoreHead += numToAllocate;
         m_activeAllocationCount += numToAllocate;
+        
+        EngineCounters::Increment(EngineCounter::k_poolAllocations, s64(numToAllocate));
         return free;
     }
     
@@ -226,6 +231,8 @@ namespace ChilliSource
         m_freeStoreHead -= numObjects;
         m_activeAllocationCount -= numObjects;
         *m_freeStoreHead = (T*)pointer;
+        
+        EngineCounters::Increment(EngineCounter::k_poolAllocations, -s64(numObjects));
     }
     
     //-----------------------------------------------------------------------------
@@ -283,6 +290,8 @@ namespace ChilliSource
         m_capacities.push_back(numObjects);
         m_capacityObjects += numObjects;
         
+        EngineCounters::Increment(EngineCounter::k_poolCapacity, s64(numObjects));
+        
         //Delete the old free store and rebuild with the new buffer appended
         auto headOffset = m_freeStoreHead - m_freeStore;
         free(m_freeStore);
@@ -312,6 +321,8 @@ namespace ChilliSource
     {
         Reset();
         
+        EngineCounters::Increment(EngineCounter::k_poolCapacity, -s64(m_capacityObjects));
+        
         free(m_freeStore);
         
         for(u32 i=0; i<m_buffers.size(); ++i)
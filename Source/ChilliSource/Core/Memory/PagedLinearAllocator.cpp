@@ -24,6 +24,8 @@
 
 #include <ChilliSource/Core/Memory/PagedLinearAllocator.h>
 
+#include <ChilliSource/Core/Base/EngineCounters.h>
+
 #include <cassert>
 
 namespace ChilliSource
@@ -33,6 +35,7 @@ namespace ChilliSource
         : m_pageSize(pageSize), m_freeStoreLinearAllocators()
     {
         m_freeStoreLinearAllocators.push_back(std::unique_ptr<LinearAllocator>(new LinearAllocator(m_pageSize)));
+        PublishPagesChanged(1);
     }
 
     //------------------------------------------------------------------------------
@@ -40,6 +43,7 @@ namespace ChilliSource
         : m_pageSize(pageSize), m_parentAllocator(&parentAllocator), m_parentAllocatorLinearAllocators()
     {
         m_parentAllocatorLinearAllocators.push_back(MakeUnique<LinearAllocator>(*m_parentAllocator, *m_parentAllocator, m_pageSize));
+        PublishPagesChanged(1);
     }
 
     //------------------------------------------------------------------------------
@@ -71,6 +75,7 @@ namespace ChilliSource
             }
 
             m_parentAllocatorLinearAllocators.push_back(MakeUnique<LinearAllocator>(*m_parentAllocator, *m_parentAllocator, m_pageSize));
+            PublishPagesChanged(1);
             return m_parentAllocatorLinearAllocators.back()->Allocate(allocationSize);
         }
         else
@@ -84,6 +89,7 @@ namespace ChilliSource
             }
 
             m_freeStoreLinearAllocators.push_back(std::unique_ptr<LinearAllocator>(new LinearAllocator(m_pageSize)));
+            PublishPagesChanged(1);
             return m_freeStoreLinearAllocators.back()->Allocate(allocationSize);
         }
     }
@@ -115,6 +121,13 @@ namespace ChilliSource
         CS_LOG_FATAL("Cannot deallocate a pointer that did not originate from this allocator.");
     }
 
+    //------------------------------------------------------------------------------
+    void PagedLinearAllocator::PublishPagesChanged(s64 numPagesChanged) noexcept
+    {
+        EngineCounters::Increment(EngineCounter::k_frameAllocatorPages, numPagesChanged);
+        EngineCounters::Increment(EngineCounter::k_frameAllocatorBytes, numPagesChanged * s64(m_pageSize));
+    }
+
     //------------------------------------------------------------------------------
     void PagedLinearAllocator::Reset() noexcept
     {
@@ -138,6 +151,8 @@ namespace ChilliSource
     void PagedLinearAllocator::ResetAndShrink() noexcept
     {
         Reset();
+        
+        PublishPagesChanged(1 - s64(GetNumPages()));
 
         if (m_parentAllocator)
         {
@@ -159,6 +174,8 @@ namespace ChilliSource
     PagedLinearAllocator::~PagedLinearAllocator() noexcept
     {
         Reset();
+        
+        PublishPagesChanged(-s64(GetNumPages()));
 
         if (m_parentAllocator)
         {
@@ -124,6 +124,13 @@ namespace ChilliSource
         PagedLinearAllocator(PagedLinearAllocator&&) = delete;
         PagedLinearAllocator& operator=(PagedLinearAllocator&&) = delete;
 
+        /// Publishes a change in the number of pages to the engine counters.
+        ///
+        /// @param numPagesChanged
+        ///     The number of pages added, or negative if pages were removed.
+        ///
+        void PublishPagesChanged(s64 numPagesChanged) noexcept;
+
         const std::size_t m_pageSize;
 
         IAllocator* m_parentAllocator = nullptr;
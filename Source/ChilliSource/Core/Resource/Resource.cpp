@@ -55,6 +55,24 @@ namespace ChilliSource
     }
     //-------------------------------------------------------
     //-------------------------------------------------------
+    u64 Resource::GetCpuMemoryUsage() const
+    {
+        return 0;
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
+    u64 Resource::GetGpuMemoryUsage() const
+    {
+        return 0;
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
+    u64 Resource::GetMemoryUsage() const
+    {
+        return GetCpuMemoryUsage() + GetGpuMemoryUsage();
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
     void Resource::SetFilePath(const std::string& in_filePath)
     {
         m_filePath = in_filePath;
@@ -132,6 +132,31 @@ namespace ChilliSource
         //-------------------------------------------------------
         LoadState GetLoadState() const;
         //-------------------------------------------------------
+        /// Resources that hold a significant amount of data in
+        /// main memory should override this so that the resource
+        /// pool can account for them when enforcing memory
+        /// budgets. The value is an estimate.
+        ///
+        /// @return The number of bytes of main memory held by
+        /// the resource.
+        //-------------------------------------------------------
+        virtual u64 GetCpuMemoryUsage() const;
+        //-------------------------------------------------------
+        /// Resources that hold data in graphics memory should
+        /// override this so that the resource pool can account
+        /// for them when enforcing memory budgets. The value is
+        /// an estimate.
+        ///
+        /// @return The number of bytes of graphics memory held
+        /// by the resource.
+        //-------------------------------------------------------
+        virtual u64 GetGpuMemoryUsage() const;
+        //-------------------------------------------------------
+        /// @return The total number of bytes of main and
+        /// graphics memory held by the resource.
+        //-------------------------------------------------------
+        u64 GetMemoryUsage() const;
+        //-------------------------------------------------------
         /// Virtual desctructor
         ///
         /// @author S Downie
@@ -0,0 +1,88 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_CORE_RESOURCE_RESOURCEMANIFEST_H_
+#define _CHILLISOURCE_CORE_RESOURCE_RESOURCEMANIFEST_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/File/StorageLocation.h>
+#include <ChilliSource/Core/Resource/IResourceOptions.h>
+#include <ChilliSource/Core/Resource/ResourcePool.h>
+
+#include <functional>
+#include <vector>
+
+namespace ChilliSource
+{
+    /// A list of resources, of any type, which should be loaded together. This is typically
+    /// used to describe everything required by a state or loading screen so that it can all
+    /// be loaded with a single call to ResourcePool::LoadResourcesAsync().
+    ///
+    /// This is not thread safe and should only be accessed from one thread at a time.
+    ///
+    class ResourceManifest final
+    {
+    public:
+        /// Adds a resource to the manifest. Resources are loaded in parallel, so the order in
+        /// which they are added only determines the order in which they are returned on
+        /// completion.
+        ///
+        /// @param location
+        ///     The storage location of the resource.
+        /// @param filePath
+        ///     The file path of the resource.
+        /// @param options
+        ///     (Optional) The load options for the resource.
+        ///
+        template <typename TResourceType> void Add(StorageLocation location, const std::string& filePath, const IResourceOptionsCSPtr<TResourceType>& options = nullptr) noexcept;
+        
+        /// @return The number of resources in the manifest.
+        ///
+        u32 GetNumResources() const noexcept;
+        
+    private:
+        friend class ResourcePool;
+        
+        using LoadCompleteDelegate = std::function<void(const ResourceCSPtr&)>;
+        using Loader = std::function<void(ResourcePool*, const LoadCompleteDelegate&)>;
+        
+        std::vector<Loader> m_loaders;
+    };
+    
+    //------------------------------------------------------------------------------
+    template <typename TResourceType> void ResourceManifest::Add(StorageLocation location, const std::string& filePath, const IResourceOptionsCSPtr<TResourceType>& options) noexcept
+    {
+        CS_ASSERT(filePath.empty() == false, "Cannot add a resource with no file path to a manifest.");
+        
+        m_loaders.push_back([=](ResourcePool* resourcePool, const LoadCompleteDelegate& delegate)
+        {
+            resourcePool->LoadResourceAsync<TResourceType>(location, filePath, options, [=](const std::shared_ptr<const TResourceType>& resource)
+            {
+                delegate(resource);
+            });
+        });
+    }
+}
+
+#endif
@@ -28,8 +28,11 @@
 
 #include <ChilliSource/Core/Resource/ResourcePool.h>
 
+#include <ChilliSource/Core/Resource/ResourceManifest.h>
 #include <ChilliSource/Core/Resource/ResourceProvider.h>
 
+#include <algorithm>
+
 namespace ChilliSource
 {
     CS_DEFINE_NAMEDTYPE(ResourcePool);
@@ -95,8 +98,9 @@ namespace ChilliSource
     //------------------------------------------------------------------------------------
     Resource::ResourceId ResourcePool::GenerateResourceId(StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsBaseCSPtr& in_options) const
     {
-        std::string combined(ToString((u32)in_location) + in_filePath);
-        u32 fileHash = HashCRC32::GenerateHashCode(combined);
+        //hashed incrementally to avoid building the combined location and path string.
+        u32 fileHash = HashCRC32::GenerateHashCode(ToString((u32)in_location));
+        fileHash = HashCRC32::UpdateHashCode(fileHash, in_filePath.c_str(), u32(in_filePath.length()));
         
         if(in_options == nullptr)
         {
@@ -109,6 +113,50 @@ namespace ChilliSource
         return HashCRC32::GenerateHashCode((const s8*)&combinedHash, sizeof(u64));
     }
     //-------------------------------------------------------------------------------------
+    /// All loads are kicked off up front. Each completion is reported on the main thread, so
+    /// the shared batch state doesn't need to be guarded.
+    //-------------------------------------------------------------------------------------
+    void ResourcePool::LoadResourcesAsync(const ResourceManifest& in_manifest, const BatchProgressDelegate& in_progressDelegate, const BatchLoadDelegate& in_completionDelegate)
+    {
+        CS_RELEASE_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Batch loads can only be started on the main thread");
+        CS_ASSERT(in_completionDelegate != nullptr, "Cannot load resources async with null delegate");
+        
+        struct BatchState
+        {
+            std::vector<ResourceCSPtr> m_resources;
+            u32 m_numLoaded = 0;
+        };
+        
+        const u32 numResources = in_manifest.GetNumResources();
+        if(numResources == 0)
+        {
+            in_completionDelegate(std::vector<ResourceCSPtr>());
+            return;
+        }
+        
+        auto batchState = std::make_shared<BatchState>();
+        batchState->m_resources.resize(numResources);
+        
+        for(u32 i = 0; i < numResources; ++i)
+        {
+            in_manifest.m_loaders[i](this, [=](const ResourceCSPtr& in_resource)
+            {
+                batchState->m_resources[i] = in_resource;
+                batchState->m_numLoaded++;
+                
+                if(in_progressDelegate != nullptr)
+                {
+                    in_progressDelegate(batchState->m_numLoaded, numResources);
+                }
+                
+                if(batchState->m_numLoaded == numResources)
+                {
+                    in_completionDelegate(batchState->m_resources);
+                }
+            });
+        }
+    }
+    //-------------------------------------------------------------------------------------
     /// Resources often have references to other resources and therefore multiple release passes
     /// are required until no more resources are released
     //-------------------------------------------------------------------------------------
@@ -125,10 +173,10 @@ namespace ChilliSource
             {
                 for(auto itResource = descEntry.second.m_cachedResources.begin(); itResource != descEntry.second.m_cachedResources.end(); /*NO INCREMENT*/)
                 {
-                    if(itResource->second.use_count() == 1)
+                    if(itResource->second.m_resource.use_count() == 1)
                     {
                         //The pool is the sole owner so we can safely release the object
-                        CS_LOG_VERBOSE("Releasing resource from pool " + itResource->second->GetName());
+                        CS_LOG_VERBOSE("Releasing resource from pool " + itResource->second.m_resource->GetName());
                         itResource = descEntry.second.m_cachedResources.erase(itResource);
                         numReleased++;
                     }
@@ -157,9 +205,9 @@ namespace ChilliSource
         
         for(auto itResource = cachedResources.begin(); itResource != cachedResources.end(); /*NO INCREMENT*/)
         {
-            if(itResource->second.get() == in_resource)
+            if(itResource->second.m_resource.get() == in_resource)
             {
-                ResourceSPtr& resource = itResource->second;
+                ResourceSPtr& resource = itResource->second.m_resource;
                 CS_ASSERT((resource.use_count() <= 1), "Cannot release a resource if it is owned by another object (i.e. use_count > 0) : (" + resource->GetName() + ")");
                 CS_LOG_VERBOSE("Releasing resource from pool " + resource->GetName());
                 cachedResources.erase(itResource);
@@ -171,6 +219,144 @@ namespace ChilliSource
             }
         }
     }
+    //-------------------------------------------------------------------------------------
+    //-------------------------------------------------------------------------------------
+    u64 ResourcePool::GetTotalMemoryUsage() const
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        
+        u64 total = 0;
+        for(const auto& descEntry : m_descriptors)
+        {
+            total += CalcMemoryUsage(descEntry.second);
+        }
+        
+        return total;
+    }
+    //------------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------------
+    void ResourcePool::OnUpdate(f32 in_deltaTime)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        
+        s64 numCachedResources = 0;
+        for(auto& descEntry : m_descriptors)
+        {
+            if(descEntry.second.m_memoryBudget > 0 && descEntry.second.m_budgetCheckRequired == true)
+            {
+                EnforceMemoryBudget(descEntry.second);
+            }
+            
+            numCachedResources += s64(descEntry.second.m_cachedResources.size());
+        }
+        
+        EngineCounters::Set(EngineCounter::k_cachedResources, numCachedResources);
+    }
+    //------------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------------
+    void ResourcePool::Touch(const CachedResource& in_cachedResource) const
+    {
+        in_cachedResource.m_lastAccessed = ++m_accessCounter;
+    }
+    //------------------------------------------------------------------------------------
+    /// Resources which are still loading are skipped as they may be being built on
+    /// another thread.
+    //------------------------------------------------------------------------------------
+    u64 ResourcePool::CalcMemoryUsage(const PoolDesc& in_desc) const
+    {
+        u64 usage = 0;
+        for(const auto& resourceEntry : in_desc.m_cachedResources)
+        {
+            const ResourceSPtr& resource(resourceEntry.second.m_resource);
+            if(resource->GetLoadState() == Resource::LoadState::k_loaded)
+            {
+                usage += resource->GetMemoryUsage();
+            }
+        }
+        
+        return usage;
+    }
+    //------------------------------------------------------------------------------------
+    /// Only resources that were loaded from file are candidates for eviction as they can
+    /// simply be loaded again the next time they are requested. Resources created by the
+    /// application cannot be rebuilt by the pool.
+    //------------------------------------------------------------------------------------
+    void ResourcePool::EnforceMemoryBudget(PoolDesc& in_desc)
+    {
+        CS_ASSERT(in_desc.m_memoryBudget > 0, "Cannot enforce a memory budget of zero.");
+        
+        in_desc.m_budgetCheckRequired = false;
+        
+        u64 usage = CalcMemoryUsage(in_desc);
+        if(usage <= in_desc.m_memoryBudget)
+        {
+            return;
+        }
+        
+        using CachedResourceIterator = std::unordered_map<Resource::ResourceId, CachedResource>::iterator;
+        std::vector<CachedResourceIterator> candidates;
+        for(auto itResource = in_desc.m_cachedResources.begin(); itResource != in_desc.m_cachedResources.end(); ++itResource)
+        {
+            const ResourceSPtr& resource(itResource->second.m_resource);
+            if(resource.use_count() == 1 && resource->GetStorageLocation() != StorageLocation::k_none && resource->GetLoadState() != Resource::LoadState::k_loading)
+            {
+                candidates.push_back(itResource);
+            }
+        }
+        
+        std::sort(candidates.begin(), candidates.end(), [](const CachedResourceIterator& in_a, const CachedResourceIterator& in_b)
+        {
+            return in_a->second.m_lastAccessed < in_b->second.m_lastAccessed;
+        });
+        
+        for(const auto& itResource : candidates)
+        {
+            if(usage <= in_desc.m_memoryBudget)
+            {
+                break;
+            }
+            
+            const ResourceSPtr& resource(itResource->second.m_resource);
+            u64 resourceUsage = (resource->GetLoadState() == Resource::LoadState::k_loaded) ? resource->GetMemoryUsage() : 0;
+            usage -= std::min(usage, resourceUsage);
+            
+            CS_LOG_VERBOSE("Evicting resource from pool " + resource->GetName());
+            in_desc.m_cachedResources.erase(itResource);
+            in_desc.m_statistics.m_numEvictions++;
+        }
+        
+        //Anything still over budget is in use, so try again once the references have been released.
+        in_desc.m_budgetCheckRequired = (usage > in_desc.m_memoryBudget);
+    }
+    //------------------------------------------------------------------------------------
+    /// The waiting delegates are called outside of the lock as they are free to make
+    /// further requests of the pool.
+    //------------------------------------------------------------------------------------
+    void ResourcePool::OnAsyncLoadComplete(InterfaceIDType in_interfaceId, Resource::ResourceId in_resourceId, const ResourceSPtr& in_resource)
+    {
+        std::vector<ResourceProvider::AsyncLoadDelegate> delegates;
+        
+        std::unique_lock<std::mutex> lock(m_mutex);
+        auto itDescriptor = m_descriptors.find(in_interfaceId);
+        CS_ASSERT(itDescriptor != m_descriptors.end(), "Failed to find resource pool for completed load.");
+        
+        PoolDesc& desc(itDescriptor->second);
+        auto itPending = desc.m_pendingLoads.find(in_resourceId);
+        if(itPending != desc.m_pendingLoads.end())
+        {
+            delegates = std::move(itPending->second);
+            desc.m_pendingLoads.erase(itPending);
+        }
+        
+        //The size of the resource wasn't known until now so check the budget on the next update.
+        desc.m_budgetCheckRequired = (desc.m_memoryBudget > 0);
+        lock.unlock();
+        
+        for(const auto& delegate : delegates)
+        {
+            delegate(in_resource);
+        }
+    }
     //------------------------------------------------------------------------------------
     /// At this stage in the app lifecycle all app and system references to resource
     /// should have been released. If the resource pool still has resources then this
@@ -187,7 +373,7 @@ namespace ChilliSource
             for(auto itResource = descEntry.second.m_cachedResources.begin(); itResource != descEntry.second.m_cachedResources.end(); ++itResource)
             {
                 //The pool is the sole owner so we can safely release the object
-                CS_LOG_ERROR("Resource still in use: " + itResource->second->GetName());
+                CS_LOG_ERROR("Resource still in use: " + itResource->second.m_resource->GetName());
                 error = true;
             }
         }
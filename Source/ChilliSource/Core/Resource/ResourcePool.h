@@ -31,12 +31,14 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Base/EngineCounters.h>
 #include <ChilliSource/Core/File/TaggedFilePathResolver.h>
 #include <ChilliSource/Core/Resource/IResourceOptions.h>
 #include <ChilliSource/Core/Resource/Resource.h>
 #include <ChilliSource/Core/Resource/ResourceProvider.h>
 #include <ChilliSource/Core/System/AppSystem.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
+#include <ChilliSource/Core/Time/Profiler.h>
 
 #include <functional>
 #include <mutex>
@@ -58,6 +60,36 @@ namespace ChilliSource
         
         CS_DECLARE_NAMEDTYPE(ResourcePool);
         
+        //-------------------------------------------------------------------------------------
+        /// Counters describing how effectively the pool is caching a single resource type.
+        ///
+        /// A hit is a request that was satisfied by an already cached resource, a miss is a
+        /// request that required the resource to be loaded and an eviction is a resource
+        /// that was released by the pool in order to stay within the memory budget.
+        //-------------------------------------------------------------------------------------
+        struct CacheStatistics
+        {
+            u32 m_numHits = 0;
+            u32 m_numMisses = 0;
+            u32 m_numEvictions = 0;
+        };
+        
+        //-------------------------------------------------------------------------------------
+        /// Delegate called each time a resource in a batch load finishes loading, either
+        /// successfully or not.
+        ///
+        /// @param The number of resources in the batch which have finished loading
+        /// @param The total number of resources in the batch
+        //-------------------------------------------------------------------------------------
+        using BatchProgressDelegate = std::function<void(u32 in_numLoaded, u32 in_numResources)>;
+        //-------------------------------------------------------------------------------------
+        /// Delegate called when every resource in a batch load has finished loading.
+        ///
+        /// @param The loaded resources, in the order they were added to the manifest. Check
+        /// the load state of each for success or failure; failed resources may also be null.
+        //-------------------------------------------------------------------------------------
+        using BatchLoadDelegate = std::function<void(const std::vector<ResourceCSPtr>& in_resources)>;
+        
         //------------------------------------------------------------------------------------
         /// Factory method for creating the system
         ///
@@ -179,6 +211,9 @@ namespace ChilliSource
         /// if it has loaded successfully or not. NOTE: The resource may be null which also
         /// indicates failure
         ///
+        /// If the resource is already being loaded asynchronously the request is attached to
+        /// the in-flight load and the delegate is called once it finishes.
+        ///
         /// @author S Downie
         ///
         /// @param Storage location
@@ -209,6 +244,20 @@ namespace ChilliSource
         /// called on the main thread
         //-------------------------------------------------------------------------------------
         template <typename TResourceType> void LoadResourceAsync(StorageLocation in_location, const std::string& in_filePath, const std::function<void(const std::shared_ptr<const TResourceType>&)>& in_delegate);
+        //------------------------------------------------------------------------------------
+        /// Loads every resource in the given manifest asynchronously. All of the loads are
+        /// started immediately so that they can run in parallel. Resources which are already
+        /// cached or already being loaded are shared rather than loaded again.
+        ///
+        /// This must be called on the main thread.
+        ///
+        /// @param The manifest describing the resources to load
+        /// @param (Optional) Delegate called each time a resource finishes loading. Always
+        /// called on the main thread
+        /// @param Delegate called once all resources have finished loading. Always called on
+        /// the main thread
+        //-------------------------------------------------------------------------------------
+        void LoadResourcesAsync(const ResourceManifest& in_manifest, const BatchProgressDelegate& in_progressDelegate, const BatchLoadDelegate& in_completionDelegate);
         //-------------------------------------------------------------------------------------
         /// Forces the pool to release its handle to any unused resources of the given type.
         /// If a resource is still in use the pool will keep it in the cache. The pool is
@@ -243,6 +292,41 @@ namespace ChilliSource
         /// @param Resource to release
         //-------------------------------------------------------------------------------------
         void Release(const Resource* in_resource);
+        //-------------------------------------------------------------------------------------
+        /// Sets the maximum amount of memory that cached resources of the given type should
+        /// occupy. Whenever the budget is exceeded the pool will release unused resources
+        /// that were loaded from file, least recently used first, until the type is back
+        /// within budget. Resources that are still in use or that were created by the
+        /// application are never evicted, so the budget is a target rather than a hard
+        /// limit.
+        ///
+        /// A budget of zero, the default, disables eviction for the type.
+        ///
+        /// @param The budget in bytes of combined CPU and GPU memory
+        //-------------------------------------------------------------------------------------
+        template <typename TResourceType> void SetMemoryBudget(u64 in_budget);
+        //-------------------------------------------------------------------------------------
+        /// @return The memory budget for the given resource type. Zero if unbudgeted.
+        //-------------------------------------------------------------------------------------
+        template <typename TResourceType> u64 GetMemoryBudget() const;
+        //-------------------------------------------------------------------------------------
+        /// Calculates the memory currently held by loaded resources of the given type.
+        /// This iterates the cache so should not be called every frame.
+        ///
+        /// @return The combined CPU and GPU memory usage in bytes
+        //-------------------------------------------------------------------------------------
+        template <typename TResourceType> u64 GetMemoryUsage() const;
+        //-------------------------------------------------------------------------------------
+        /// Calculates the memory currently held by all loaded resources in the pool. This
+        /// iterates the cache so should not be called every frame.
+        ///
+        /// @return The combined CPU and GPU memory usage in bytes
+        //-------------------------------------------------------------------------------------
+        u64 GetTotalMemoryUsage() const;
+        //-------------------------------------------------------------------------------------
+        /// @return The cache hit, miss and eviction counts for the given resource type.
+        //-------------------------------------------------------------------------------------
+        template <typename TResourceType> CacheStatistics GetCacheStatistics() const;
         //------------------------------------------------------------------------------------
         /// Called when the system is destroyed after the system lifecycle destroy.
         /// Flushes the resource caches and errors if any resources are still in use
@@ -253,6 +337,15 @@ namespace ChilliSource
         
     private:
         
+        //-------------------------------------------------------------------------------------
+        /// A single cached resource along with the time at which it was last requested, which
+        /// is used to determine eviction order.
+        //-------------------------------------------------------------------------------------
+        struct CachedResource
+        {
+            ResourceSPtr m_resource;
+            mutable u64 m_lastAccessed;
+        };
         //-------------------------------------------------------------------------------------
         /// Descriptor that holds the providers and cached resources for a given type
         ///
@@ -261,9 +354,55 @@ namespace ChilliSource
         struct PoolDesc
         {
             std::vector<ResourceProvider*> m_providers;
-            std::unordered_map<Resource::ResourceId, ResourceSPtr> m_cachedResources;
+            std::unordered_map<Resource::ResourceId, CachedResource> m_cachedResources;
+            std::unordered_map<Resource::ResourceId, std::vector<ResourceProvider::AsyncLoadDelegate>> m_pendingLoads;
+            
+            u64 m_memoryBudget = 0;
+            bool m_budgetCheckRequired = false;
+            mutable CacheStatistics m_statistics;
         };
         //------------------------------------------------------------------------------------
+        /// Enforces the memory budgets of any resource types that have changed since they
+        /// were last checked, and publishes the number of cached resources to the engine
+        /// counters.
+        ///
+        /// @param Time since last update in seconds
+        //------------------------------------------------------------------------------------
+        void OnUpdate(f32 in_deltaTime) override;
+        //------------------------------------------------------------------------------------
+        /// Marks the given cached resource as the most recently used. The pool mutex must be
+        /// held by the caller.
+        ///
+        /// @param Cached resource
+        //------------------------------------------------------------------------------------
+        void Touch(const CachedResource& in_cachedResource) const;
+        //------------------------------------------------------------------------------------
+        /// The pool mutex must be held by the caller.
+        ///
+        /// @param Descriptor
+        ///
+        /// @return The combined memory usage of all loaded resources in the descriptor
+        //------------------------------------------------------------------------------------
+        u64 CalcMemoryUsage(const PoolDesc& in_desc) const;
+        //------------------------------------------------------------------------------------
+        /// Releases the least recently used unreferenced resources in the descriptor until it
+        /// is within its memory budget. If the budget still cannot be met the descriptor is
+        /// flagged to be checked again on the next update. The pool mutex must be held by the
+        /// caller.
+        ///
+        /// @param Descriptor
+        //------------------------------------------------------------------------------------
+        void EnforceMemoryBudget(PoolDesc& in_desc);
+        //------------------------------------------------------------------------------------
+        /// Called when an async load started by the pool finishes. Notifies every request
+        /// that is waiting on the load.
+        ///
+        /// @param The interface Id of the resource type
+        /// @param The resource Id
+        /// @param The resource
+        //------------------------------------------------------------------------------------
+        void OnAsyncLoadComplete(InterfaceIDType in_interfaceId, Resource::ResourceId in_resourceId, const ResourceSPtr& in_resource);
+        //------------------------------------------------------------------------------------
         /// @author S Downie
         ///
         /// @param File path
@@ -295,6 +434,7 @@ namespace ChilliSource
         
         std::unordered_map<InterfaceIDType, PoolDesc> m_descriptors;
         mutable std::mutex m_mutex;
+        mutable u64 m_accessCounter = 0;
     };
     //------------------------------------------------------------------------------------
     //-------------------------------------------------------------------------------------
@@ -319,7 +459,9 @@ namespace ChilliSource
         auto itResource = desc.m_cachedResources.find(resourceId);
         if(itResource != desc.m_cachedResources.end())
         {
-            return std::static_pointer_cast<const TResourceType>(itResource->second);
+            Touch(itResource->second);
+            desc.m_statistics.m_numHits++;
+            return std::static_pointer_cast<const TResourceType>(itResource->second.m_resource);
         }
         
         return nullptr;
@@ -338,7 +480,7 @@ namespace ChilliSource
             const PoolDesc& desc(itDescriptor->second);
             for (const auto& resource : desc.m_cachedResources)
             {
-                output.push_back(std::static_pointer_cast<const TResourceType>(resource.second));
+                output.push_back(std::static_pointer_cast<const TResourceType>(resource.second.m_resource));
             }
         }
         
@@ -361,7 +503,7 @@ namespace ChilliSource
         if(itDescriptor == m_descriptors.end())
         {
             PoolDesc desc;
-            desc.m_cachedResources.insert(std::make_pair(resourceId, resource));
+            desc.m_cachedResources.insert(std::make_pair(resourceId, CachedResource{resource, ++m_accessCounter}));
             m_descriptors.insert(std::make_pair(TResourceType::InterfaceID, desc));
             return resource;
         }
@@ -369,7 +511,7 @@ namespace ChilliSource
         //Check to make sure this doesn't already exist
         PoolDesc& desc(itDescriptor->second);
         CS_ASSERT(desc.m_cachedResources.find(resourceId) == desc.m_cachedResources.end(), "Resource with Id: " + in_uniqueId + " already exists");
-        desc.m_cachedResources.insert(std::make_pair(resourceId, resource));
+        desc.m_cachedResources.insert(std::make_pair(resourceId, CachedResource{resource, ++m_accessCounter}));
         
         return resource;
     }
@@ -377,6 +519,8 @@ namespace ChilliSource
     //-------------------------------------------------------------------------------------
     template <typename TResourceType> std::shared_ptr<const TResourceType> ResourcePool::LoadResource(StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsCSPtr<TResourceType>& in_options)
     {
+        CS_PROFILE_SCOPE("ResourcePool::LoadResource");
+        
         CS_RELEASE_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Resources can only be loaded on the main thread - use LoadResourceAsync");
         CS_ASSERT(in_filePath.empty() == false, "Cannot load resource with no file path");
         
@@ -412,8 +556,12 @@ namespace ChilliSource
         auto itResource = desc.m_cachedResources.find(resourceId);
         if(itResource != desc.m_cachedResources.end())
         {
-            return std::static_pointer_cast<TResourceType>(itResource->second);
+            Touch(itResource->second);
+            desc.m_statistics.m_numHits++;
+            return std::static_pointer_cast<TResourceType>(itResource->second.m_resource);
         }
+        desc.m_statistics.m_numMisses++;
+        EngineCounters::Increment(EngineCounter::k_resourcesLoaded);
         lock.unlock();
         
         //Load the resource
@@ -437,11 +585,17 @@ namespace ChilliSource
         itResource = desc.m_cachedResources.find(resourceId);
         if(itResource == desc.m_cachedResources.end())
         {
-            desc.m_cachedResources.insert(std::make_pair(resourceId, resource));
+            desc.m_cachedResources.insert(std::make_pair(resourceId, CachedResource{resource, ++m_accessCounter}));
+            
+            if(desc.m_memoryBudget > 0)
+            {
+                EnforceMemoryBudget(desc);
+            }
         }
         else
         {
-            resource = itResource->second;
+            Touch(itResource->second);
+            resource = itResource->second.m_resource;
         }
         lock.unlock();
         
@@ -491,7 +645,7 @@ namespace ChilliSource
         }
         
         //Load the resource
-        ResourceSPtr resource(itResource->second);
+        ResourceSPtr resource(itResource->second.m_resource);
         
         lock.unlock();
         
@@ -526,7 +680,7 @@ namespace ChilliSource
         
         for(auto& resourceEntry : desc.m_cachedResources)
         {
-            ResourceSPtr& resource(resourceEntry.second);
+            ResourceSPtr& resource(resourceEntry.second.m_resource);
             
             if(resource->GetStorageLocation() != StorageLocation::k_none)
             {
@@ -589,6 +743,11 @@ namespace ChilliSource
             options = provider->GetDefaultOptions();
         }
         
+        ResourceProvider::AsyncLoadDelegate convertDelegate([=](const ResourceSPtr& in_resource)
+        {
+            in_delegate(std::static_pointer_cast<const TResourceType>(in_resource));
+        });
+        
         //Check descriptor and see if this resource already exists
         Resource::ResourceId resourceId = GenerateResourceId(in_location, in_filePath, options);
         
@@ -596,9 +755,26 @@ namespace ChilliSource
         auto itResource = desc.m_cachedResources.find(resourceId);
         if(itResource != desc.m_cachedResources.end())
         {
-            in_delegate(std::static_pointer_cast<const TResourceType>(itResource->second));
+            Touch(itResource->second);
+            desc.m_statistics.m_numHits++;
+            
+            //If the resource is still being loaded wait for the load to finish rather than
+            //returning a resource which isn't ready yet.
+            auto itPending = desc.m_pendingLoads.find(resourceId);
+            if(itPending != desc.m_pendingLoads.end())
+            {
+                itPending->second.push_back(convertDelegate);
+                return;
+            }
+            
+            ResourceCSPtr resource(itResource->second.m_resource);
+            lock.unlock();
+            
+            in_delegate(std::static_pointer_cast<const TResourceType>(resource));
             return;
         }
+        desc.m_statistics.m_numMisses++;
+        EngineCounters::Increment(EngineCounter::k_resourcesLoaded);
         
         //Load the resource
         ResourceSPtr resource(TResourceType::Create());
@@ -608,17 +784,18 @@ namespace ChilliSource
         resource->SetOptions(options);
         resource->SetId(resourceId);
 
-        //Add it to the cache
-        desc.m_cachedResources.insert(std::make_pair(resourceId, resource));
+        //Add it to the cache and track the load so that any further requests can wait on it
+        desc.m_cachedResources.insert(std::make_pair(resourceId, CachedResource{resource, ++m_accessCounter}));
+        desc.m_pendingLoads[resourceId].push_back(convertDelegate);
         lock.unlock();
         
-        ResourceProvider::AsyncLoadDelegate convertDelegate([=](const ResourceSPtr& in_resource)
+        ResourceProvider::AsyncLoadDelegate completionDelegate([=](const ResourceSPtr& in_resource)
         {
-            in_delegate(std::static_pointer_cast<const TResourceType>(in_resource));
+            OnAsyncLoadComplete(TResourceType::InterfaceID, resourceId, in_resource);
         });
 
         std::string deviceFilePath = Application::Get()->GetTaggedFilePathResolver()->ResolveFilePath(in_location, in_filePath);
-        provider->CreateResourceFromFileAsync(in_location, deviceFilePath, options, convertDelegate, resource);
+        provider->CreateResourceFromFileAsync(in_location, deviceFilePath, options, completionDelegate, resource);
     }
     //-------------------------------------------------------------------------------------
     /// Resources often have references to other resources and therefore multiple release passes
@@ -643,10 +820,10 @@ namespace ChilliSource
             
             for(auto itResource = cachedResources.begin(); itResource != cachedResources.end(); /*NO INCREMENT*/)
             {
-                if(itResource->second.use_count() == 1)
+                if(itResource->second.m_resource.use_count() == 1)
                 {
                     //The pool is the sole owner so we can safely release the object
-                    CS_LOG_VERBOSE("Releasing resource from pool " + itResource->second->GetName());
+                    CS_LOG_VERBOSE("Releasing resource from pool " + itResource->second.m_resource->GetName());
                     itResource = cachedResources.erase(itResource);
                     numReleased++;
                 }
@@ -658,6 +835,60 @@ namespace ChilliSource
         }
         while(numReleased > 0);
     }
+    //-------------------------------------------------------------------------------------
+    //-------------------------------------------------------------------------------------
+    template <typename TResourceType> void ResourcePool::SetMemoryBudget(u64 in_budget)
+    {
+        CS_RELEASE_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Memory budgets can only be set on the main thread");
+        
+        std::unique_lock<std::mutex> lock(m_mutex);
+        
+        PoolDesc& desc(m_descriptors[TResourceType::InterfaceID]);
+        desc.m_memoryBudget = in_budget;
+        desc.m_budgetCheckRequired = (in_budget > 0);
+    }
+    //-------------------------------------------------------------------------------------
+    //-------------------------------------------------------------------------------------
+    template <typename TResourceType> u64 ResourcePool::GetMemoryBudget() const
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        
+        auto itDescriptor = m_descriptors.find(TResourceType::InterfaceID);
+        if(itDescriptor == m_descriptors.end())
+        {
+            return 0;
+        }
+        
+        return itDescriptor->second.m_memoryBudget;
+    }
+    //-------------------------------------------------------------------------------------
+    //-------------------------------------------------------------------------------------
+    template <typename TResourceType> u64 ResourcePool::GetMemoryUsage() const
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        
+        auto itDescriptor = m_descriptors.find(TResourceType::InterfaceID);
+        if(itDescriptor == m_descriptors.end())
+        {
+            return 0;
+        }
+        
+        return CalcMemoryUsage(itDescriptor->second);
+    }
+    //-------------------------------------------------------------------------------------
+    //-------------------------------------------------------------------------------------
+    template <typename TResourceType> ResourcePool::CacheStatistics ResourcePool::GetCacheStatistics() const
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        
+        auto itDescriptor = m_descriptors.find(TResourceType::InterfaceID);
+        if(itDescriptor == m_descriptors.end())
+        {
+            return CacheStatistics();
+        }
+        
+        return itDescriptor->second.m_statistics;
+    }
 }
 
 #endif
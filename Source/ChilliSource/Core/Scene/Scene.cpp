@@ -105,6 +105,18 @@ namespace ChilliSource
     }
     //-------------------------------------------------------
     //-------------------------------------------------------
+    void Scene::StoreEntityInterpolationStates()
+    {
+        if(m_enabled)
+        {
+            for(u32 i=0; i<m_entities.size(); ++i)
+            {
+                m_entities[i]->GetTransform().StoreInterpolationState();
+            }
+        }
+    }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
     void Scene::RenderSnapshotEntities(RenderSnapshot& renderSnapshot, IAllocator* frameAllocator) noexcept
     {
         for(u32 i=0; i<m_entities.size(); ++i)
@@ -147,6 +159,9 @@ namespace ChilliSource
                   + ToString(std::numeric_limits<u32>::max()) + ".");
         
         m_entities.push_back(in_entity);
+        
+        //The entity may have moved since it was last in a scene, so it shouldn't be blended from its old position
+        in_entity->GetTransform().ResetInterpolation();
 
         in_entity->SetScene(this);
         in_entity->OnAddedToScene();
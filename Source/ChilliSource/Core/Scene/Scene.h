@@ -178,6 +178,12 @@ namespace ChilliSource
         //-------------------------------------------------------
         void FixedUpdateEntities(f32 in_timeSinceLastUpdate);
         //-------------------------------------------------------
+        /// Stores the current transform of every entity in the
+        /// scene so it can be interpolated from when presenting.
+        /// This should be called prior to each fixed update.
+        //-------------------------------------------------------
+        void StoreEntityInterpolationStates();
+        //-------------------------------------------------------
         /// Sends the render snapshot event to all entities in
         /// the scene.
         ///
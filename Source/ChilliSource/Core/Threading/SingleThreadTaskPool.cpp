@@ -30,6 +30,7 @@
 
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
+#include <ChilliSource/Core/Time/Profiler.h>
 
 namespace ChilliSource
 {
@@ -48,6 +49,13 @@ namespace ChilliSource
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
+    u32 SingleThreadTaskPool::GetNumPendingTasks() const noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_taskQueueMutex);
+        return u32(m_taskQueue.size());
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
     void SingleThreadTaskPool::PerformTasks() noexcept
     {
         std::unique_lock<std::mutex> lock(m_taskQueueMutex);
@@ -57,6 +65,7 @@ namespace ChilliSource
 
         for (const auto& task : localTaskQueue)
         {
+            CS_PROFILE_SCOPE("SingleThreadTaskPool::Task");
             task(m_taskContext);
         }
     }
@@ -67,6 +67,10 @@ namespace ChilliSource
         //------------------------------------------------------------------------------
         void AddTasks(const std::vector<Task>& in_tasks) noexcept;
         //------------------------------------------------------------------------------
+        /// @return The number of tasks which are waiting to be performed.
+        //------------------------------------------------------------------------------
+        u32 GetNumPendingTasks() const noexcept;
+        //------------------------------------------------------------------------------
         /// Performs all tasks in the task pool. The task queue is copied locally and
         /// cleared before processing all tasks. This means that any tasks queued while
         /// performing single thread tasks will be perfomed during the next call to
@@ -81,7 +85,7 @@ namespace ChilliSource
         const TaskContext m_taskContext;
         
         std::vector<Task> m_taskQueue;
-        std::mutex m_taskQueueMutex;
+        mutable std::mutex m_taskQueueMutex;
     };
 }
 
@@ -30,6 +30,7 @@
 
 #include <ChilliSource/Core/Delegate/MakeDelegate.h>
 #include <ChilliSource/Core/Threading/TaskType.h>
+#include <ChilliSource/Core/Time/Profiler.h>
 
 #ifdef CS_TARGETPLATFORM_ANDROID
 #   include <CSBackend/Platform/Android/Main/JNI/Core/Java/JavaVirtualMachine.h>
@@ -59,6 +60,12 @@ namespace ChilliSource
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
+    u32 TaskPool::GetNumPendingTasks() const noexcept
+    {
+        return m_taskCountHeuristic;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
     void TaskPool::AddTasks(const std::vector<Task>& in_tasks) noexcept
     {
         std::unique_lock<std::mutex> queueLock(m_taskQueueMutex);
@@ -126,6 +133,7 @@ namespace ChilliSource
             
         queueLock.unlock();
         
+        CS_PROFILE_SCOPE("TaskPool::Task");
         task(m_taskContext);
     }
     //------------------------------------------------------------------------------
@@ -135,6 +143,8 @@ namespace ChilliSource
 #ifdef CS_TARGETPLATFORM_ANDROID
         CSBackend::Android::JavaVirtualMachine::Get()->AttachCurrentThread();
 #endif
+        
+        CS_PROFILE_THREAD_NAME(m_taskContext.GetType() == TaskType::k_small ? "Small Task Pool" : "Large Task Pool");
 
         while (!m_isFinished || m_taskCountHeuristic > 0)
         {
@@ -74,6 +74,11 @@ namespace ChilliSource
         //------------------------------------------------------------------------------
         u32 GetNumThreads() const noexcept;
         //------------------------------------------------------------------------------
+        /// @return The number of tasks which are waiting to be performed. This is
+        /// approximate as tasks may be added or started at any time.
+        //------------------------------------------------------------------------------
+        u32 GetNumPendingTasks() const noexcept;
+        //------------------------------------------------------------------------------
         /// Adds a series of tasks to the pool. These task will be executed as soon as a
         /// thread becomes free.
         ///
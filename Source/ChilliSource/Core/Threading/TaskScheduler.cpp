@@ -30,6 +30,7 @@
 
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Base/Device.h>
+#include <ChilliSource/Core/Base/EngineCounters.h>
 #include <ChilliSource/Core/Threading/TaskContext.h>
 #include <ChilliSource/Core/Threading/TaskType.h>
 
@@ -174,10 +175,23 @@ namespace ChilliSource
         
         lock.unlock();
         
+        PublishCounters();
+        
         m_mainThreadTaskPool->PerformTasks();
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
+    void TaskScheduler::PublishCounters() noexcept
+    {
+        EngineCounters::Set(EngineCounter::k_smallTaskQueueDepth, m_smallTaskPool->GetNumPendingTasks());
+        EngineCounters::Set(EngineCounter::k_largeTaskQueueDepth, m_largeTaskPool->GetNumPendingTasks());
+        EngineCounters::Set(EngineCounter::k_mainThreadTaskQueueDepth, m_mainThreadTaskPool->GetNumPendingTasks());
+        
+        std::unique_lock<std::mutex> fileLock(m_fileTaskMutex);
+        EngineCounters::Set(EngineCounter::k_fileTaskQueueDepth, s64(m_fileTaskQueue.size()));
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
     void TaskScheduler::ExecuteSystemThreadTasks() noexcept
     {
         m_systemThreadTaskPool->PerformTasks();
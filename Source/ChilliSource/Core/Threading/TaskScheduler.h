@@ -160,6 +160,10 @@ namespace ChilliSource
         //------------------------------------------------------------------------------
         void StartNextFileTask(const Task& in_task) noexcept;
         //------------------------------------------------------------------------------
+        /// Publishes the depth of each task queue to the engine counters.
+        //------------------------------------------------------------------------------
+        void PublishCounters() noexcept;
+        //------------------------------------------------------------------------------
         /// Cleans up the Task Scheduler, joining on all existing threads and then
         /// destroying them.
         ///
@@ -0,0 +1,342 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Core/Time/Profiler.h>
+
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/File/FileSystem.h>
+#include <ChilliSource/Core/File/FileStream/TextOutputStream.h>
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#ifdef CS_TARGETPLATFORM_IOS
+#include <pthread.h>
+#endif
+
+namespace ChilliSource
+{
+    namespace
+    {
+        /// A single recorded zone.
+        ///
+        struct Zone final
+        {
+            const char* m_name = nullptr;
+            u64 m_startTime = 0;
+            u64 m_duration = 0;
+        };
+        
+        /// The zones recorded by a single thread. Only the owning thread writes zones;
+        /// the number of zones is published atomically so they can be read while the
+        /// thread is still recording.
+        ///
+        struct ThreadZoneBuffer final
+        {
+            u32 m_threadIndex = 0;
+            std::atomic<const char*> m_threadName { nullptr };
+            std::atomic<u32> m_captureId { 0 };
+            std::atomic<u32> m_numZones { 0 };
+            std::unique_ptr<Zone[]> m_zones;
+        };
+        
+        using ThreadZoneBufferSPtr = std::shared_ptr<ThreadZoneBuffer>;
+        
+        std::mutex g_threadZoneBuffersMutex;
+        std::vector<ThreadZoneBufferSPtr> g_threadZoneBuffers;
+        
+        std::atomic<u32> g_captureId(0);
+        std::atomic<u32> g_numDroppedZones(0);
+        u32 g_numFramesRemaining = 0;
+        
+        std::mutex g_frameTimesMutex;
+        std::vector<u64> g_frameTimes;
+        
+#ifdef CS_TARGETPLATFORM_IOS
+        /// iOS doesn't support C++ thread_local so a pthread key is used instead.
+        ///
+        pthread_key_t g_threadZoneBufferKey;
+        pthread_once_t g_threadZoneBufferKeyOnce = PTHREAD_ONCE_INIT;
+        
+        //------------------------------------------------------------------------------
+        void DeleteThreadZoneBuffer(void* threadZoneBuffer) noexcept
+        {
+            delete static_cast<ThreadZoneBufferSPtr*>(threadZoneBuffer);
+        }
+        
+        //------------------------------------------------------------------------------
+        void CreateThreadZoneBufferKey() noexcept
+        {
+            pthread_key_create(&g_threadZoneBufferKey, DeleteThreadZoneBuffer);
+        }
+        
+        //------------------------------------------------------------------------------
+        ThreadZoneBufferSPtr& GetThreadZoneBufferStorage() noexcept
+        {
+            pthread_once(&g_threadZoneBufferKeyOnce, CreateThreadZoneBufferKey);
+            
+            auto threadZoneBuffer = static_cast<ThreadZoneBufferSPtr*>(pthread_getspecific(g_threadZoneBufferKey));
+            if (threadZoneBuffer == nullptr)
+            {
+                threadZoneBuffer = new ThreadZoneBufferSPtr();
+                pthread_setspecific(g_threadZoneBufferKey, threadZoneBuffer);
+            }
+            
+            return *threadZoneBuffer;
+        }
+#else
+        thread_local ThreadZoneBufferSPtr g_threadZoneBuffer;
+        
+        //------------------------------------------------------------------------------
+        ThreadZoneBufferSPtr& GetThreadZoneBufferStorage() noexcept
+        {
+            return g_threadZoneBuffer;
+        }
+#endif
+        
+        /// Gets the calling thread's zone buffer, creating and registering it the first
+        /// time it is requested. The buffer outlives the thread so that its zones can
+        /// still be exported.
+        ///
+        /// @return The calling thread's zone buffer.
+        ///
+        ThreadZoneBuffer* GetThreadZoneBuffer() noexcept
+        {
+            auto& threadZoneBuffer = GetThreadZoneBufferStorage();
+            
+            if (threadZoneBuffer == nullptr)
+            {
+                threadZoneBuffer = std::make_shared<ThreadZoneBuffer>();
+                
+                std::unique_lock<std::mutex> lock(g_threadZoneBuffersMutex);
+                threadZoneBuffer->m_threadIndex = u32(g_threadZoneBuffers.size());
+                g_threadZoneBuffers.push_back(threadZoneBuffer);
+            }
+            
+            return threadZoneBuffer.get();
+        }
+        
+        /// Appends the given string to the output, escaping it for use as a JSON string.
+        ///
+        /// @param string
+        ///     The string to append.
+        /// @param out
+        ///     [Out] The output string.
+        ///
+        void AppendJsonString(const char* string, std::string& out) noexcept
+        {
+            out += '"';
+            for (auto character = string; *character != '\0'; ++character)
+            {
+                if (*character == '"' || *character == '\\')
+                {
+                    out += '\\';
+                }
+                out += *character;
+            }
+            out += '"';
+        }
+    }
+    
+    std::atomic<bool> Profiler::s_isCapturing(false);
+    constexpr u32 Profiler::k_maxZonesPerThread;
+    
+    //------------------------------------------------------------------------------
+    void Profiler::StartCapture(u32 numFrames) noexcept
+    {
+        CS_ASSERT(numFrames > 0, "Must capture at least one frame.");
+        
+        std::unique_lock<std::mutex> lock(g_frameTimesMutex);
+        g_frameTimes.clear();
+        g_frameTimes.push_back(GetTimestamp());
+        g_numFramesRemaining = numFrames;
+        lock.unlock();
+        
+        g_numDroppedZones = 0;
+        ++g_captureId;
+        s_isCapturing = true;
+    }
+    
+    //------------------------------------------------------------------------------
+    void Profiler::EndFrame() noexcept
+    {
+        if (IsCapturing() == false)
+        {
+            return;
+        }
+        
+        std::unique_lock<std::mutex> lock(g_frameTimesMutex);
+        g_frameTimes.push_back(GetTimestamp());
+        
+        if (--g_numFramesRemaining == 0)
+        {
+            s_isCapturing = false;
+        }
+    }
+    
+    //------------------------------------------------------------------------------
+    void Profiler::SetThreadName(const char* name) noexcept
+    {
+        GetThreadZoneBuffer()->m_threadName = name;
+    }
+    
+    //------------------------------------------------------------------------------
+    void Profiler::RecordZone(const char* name, u64 startTime, u64 endTime) noexcept
+    {
+        auto threadZoneBuffer = GetThreadZoneBuffer();
+        
+        //The first zone recorded in a new capture resets the buffer. This is done by the owning
+        //thread so that the zones never need to be locked.
+        auto captureId = g_captureId.load(std::memory_order_acquire);
+        if (threadZoneBuffer->m_captureId.load(std::memory_order_relaxed) != captureId)
+        {
+            if (threadZoneBuffer->m_zones == nullptr)
+            {
+                threadZoneBuffer->m_zones.reset(new Zone[k_maxZonesPerThread]);
+            }
+            
+            threadZoneBuffer->m_numZones.store(0, std::memory_order_relaxed);
+            threadZoneBuffer->m_captureId.store(captureId, std::memory_order_release);
+        }
+        
+        auto numZones = threadZoneBuffer->m_numZones.load(std::memory_order_relaxed);
+        if (numZones >= k_maxZonesPerThread)
+        {
+            ++g_numDroppedZones;
+            return;
+        }
+        
+        auto& zone = threadZoneBuffer->m_zones[numZones];
+        zone.m_name = name;
+        zone.m_startTime = startTime;
+        zone.m_duration = endTime - startTime;
+        threadZoneBuffer->m_numZones.store(numZones + 1, std::memory_order_release);
+    }
+    
+    //------------------------------------------------------------------------------
+    u64 Profiler::GetTimestamp() noexcept
+    {
+        return u64(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+    
+    //------------------------------------------------------------------------------
+    u32 Profiler::GetNumDroppedZones() noexcept
+    {
+        return g_numDroppedZones.load();
+    }
+    
+    //------------------------------------------------------------------------------
+    std::string Profiler::CreateChromeTrace() noexcept
+    {
+        std::unique_lock<std::mutex> frameTimesLock(g_frameTimesMutex);
+        auto frameTimes = g_frameTimes;
+        frameTimesLock.unlock();
+        
+        std::unique_lock<std::mutex> buffersLock(g_threadZoneBuffersMutex);
+        auto threadZoneBuffers = g_threadZoneBuffers;
+        buffersLock.unlock();
+        
+        auto captureId = g_captureId.load(std::memory_order_acquire);
+        u64 baseTime = frameTimes.empty() ? 0 : frameTimes.front();
+        
+        std::string out;
+        out.reserve(1024 * 1024);
+        out += "{\"traceEvents\":[\n";
+        
+        bool isFirstEvent = true;
+        auto beginEvent = [&]()
+        {
+            out += isFirstEvent ? "{" : ",\n{";
+            isFirstEvent = false;
+        };
+        
+        //Frames are displayed on their own track above the threads.
+        beginEvent();
+        out += "\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":0,\"args\":{\"name\":\"Frames\"}}";
+        
+        for (std::size_t i = 1; i < frameTimes.size(); ++i)
+        {
+            beginEvent();
+            out += "\"name\":\"Frame " + ToString(u32(i - 1)) + "\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":" + ToString(frameTimes[i - 1] - baseTime) + ",\"dur\":" + ToString(frameTimes[i] - frameTimes[i - 1]) + "}";
+        }
+        
+        for (const auto& threadZoneBuffer : threadZoneBuffers)
+        {
+            auto tid = ToString(threadZoneBuffer->m_threadIndex + 1);
+            
+            auto threadName = threadZoneBuffer->m_threadName.load();
+            if (threadName != nullptr)
+            {
+                beginEvent();
+                out += "\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" + tid + ",\"args\":{\"name\":";
+                AppendJsonString(threadName, out);
+                out += "}}";
+            }
+            
+            if (threadZoneBuffer->m_captureId.load(std::memory_order_acquire) != captureId)
+            {
+                continue;
+            }
+            
+            auto numZones = threadZoneBuffer->m_numZones.load(std::memory_order_acquire);
+            for (u32 i = 0; i < numZones; ++i)
+            {
+                const auto& zone = threadZoneBuffer->m_zones[i];
+                
+                beginEvent();
+                out += "\"name\":";
+                AppendJsonString(zone.m_name, out);
+                out += ",\"ph\":\"X\",\"pid\":0,\"tid\":" + tid + ",\"ts\":" + ToString(zone.m_startTime >= baseTime ? zone.m_startTime - baseTime : 0) + ",\"dur\":" + ToString(zone.m_duration) + "}";
+            }
+        }
+        
+        out += "\n],\"displayTimeUnit\":\"ms\"}\n";
+        return out;
+    }
+    
+    //------------------------------------------------------------------------------
+    bool Profiler::SaveChromeTrace(StorageLocation storageLocation, const std::string& filePath) noexcept
+    {
+        auto fileStream = Application::Get()->GetFileSystem()->CreateTextOutputStream(storageLocation, filePath);
+        
+        if (fileStream == nullptr || fileStream->IsValid() == false)
+        {
+            CS_LOG_ERROR("Could not create profiler trace file: " + filePath);
+            return false;
+        }
+        
+        fileStream->Write(CreateChromeTrace());
+        
+        auto numDroppedZones = GetNumDroppedZones();
+        if (numDroppedZones > 0)
+        {
+            CS_LOG_WARNING("Profiler trace is incomplete: " + ToString(numDroppedZones) + " zone(s) were dropped.");
+        }
+        
+        return true;
+    }
+}
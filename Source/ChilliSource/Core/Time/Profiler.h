@@ -0,0 +1,182 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_CORE_TIME_PROFILER_H_
+#define _CHILLISOURCE_CORE_TIME_PROFILER_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/File/StorageLocation.h>
+
+#include <atomic>
+#include <string>
+
+//------------------------------------------------------------------------------
+/// Profiling macros. These compile to nothing unless CS_ENABLE_PROFILER is
+/// defined.
+///
+/// CS_PROFILE_SCOPE(name) - Times the enclosing scope as a zone with the given
+/// name. The name must be a string literal.
+///
+/// CS_PROFILE_THREAD_NAME(name) - Names the calling thread in exported traces.
+/// The name must be a string literal.
+///
+/// CS_PROFILE_END_FRAME() - Marks the end of a frame. This is called by the
+/// Application once per frame, so should not need to be called elsewhere.
+//------------------------------------------------------------------------------
+#ifdef CS_ENABLE_PROFILER
+#define CS_PROFILE_CONCAT_IMPL(a, b) a##b
+#define CS_PROFILE_CONCAT(a, b) CS_PROFILE_CONCAT_IMPL(a, b)
+#define CS_PROFILE_SCOPE(name) ChilliSource::ProfileZone CS_PROFILE_CONCAT(csProfileZone, __LINE__)(name)
+#define CS_PROFILE_THREAD_NAME(name) (ChilliSource::Profiler::SetThreadName(name))
+#define CS_PROFILE_END_FRAME() (ChilliSource::Profiler::EndFrame())
+#else
+#define CS_PROFILE_SCOPE(name)
+#define CS_PROFILE_THREAD_NAME(name)
+#define CS_PROFILE_END_FRAME()
+#endif
+
+namespace ChilliSource
+{
+    /// A low overhead profiler which records named, timed zones from any thread over
+    /// a window of frames. Zones are recorded into a fixed size buffer owned by each
+    /// thread so recording never takes a lock, and nothing is recorded at all unless a
+    /// capture is in progress. Once a capture is complete it can be exported in the
+    /// Chrome trace event format, which can be viewed in chrome://tracing.
+    ///
+    /// Zones are usually recorded with the CS_PROFILE_SCOPE macro, which compiles to
+    /// nothing unless CS_ENABLE_PROFILER is defined.
+    ///
+    /// Exporting should not be performed while a new capture is being started.
+    ///
+    class Profiler final
+    {
+    public:
+        /// The maximum number of zones which will be recorded for a single thread during
+        /// a capture. Zones beyond this are dropped.
+        ///
+        static constexpr u32 k_maxZonesPerThread = 16384;
+        
+        /// Starts capturing zones for the given number of frames. Any previously captured
+        /// zones are discarded.
+        ///
+        /// @param numFrames
+        ///     The number of frames to capture.
+        ///
+        static void StartCapture(u32 numFrames) noexcept;
+        
+        /// @return Whether or not zones are currently being captured.
+        ///
+        static bool IsCapturing() noexcept { return s_isCapturing.load(std::memory_order_relaxed); }
+        
+        /// Marks the end of a frame, stopping the capture once the requested number of
+        /// frames have been captured. This should only be called from the main thread.
+        ///
+        static void EndFrame() noexcept;
+        
+        /// Sets the name of the calling thread, as displayed in exported traces.
+        ///
+        /// @param name
+        ///     The name of the thread. This must be a string literal.
+        ///
+        static void SetThreadName(const char* name) noexcept;
+        
+        /// Records a zone on the calling thread. This is typically called by ProfileZone
+        /// rather than directly.
+        ///
+        /// @param name
+        ///     The name of the zone. This must be a string literal.
+        /// @param startTime
+        ///     The time the zone started in microseconds, as returned by GetTimestamp().
+        /// @param endTime
+        ///     The time the zone ended in microseconds, as returned by GetTimestamp().
+        ///
+        static void RecordZone(const char* name, u64 startTime, u64 endTime) noexcept;
+        
+        /// @return The current time in microseconds from a monotonic clock.
+        ///
+        static u64 GetTimestamp() noexcept;
+        
+        /// @return The number of zones which were dropped during the last capture because
+        ///     a thread's buffer was full.
+        ///
+        static u32 GetNumDroppedZones() noexcept;
+        
+        /// Creates a Chrome trace event JSON document from the zones recorded during the
+        /// last capture.
+        ///
+        /// @return The trace JSON.
+        ///
+        static std::string CreateChromeTrace() noexcept;
+        
+        /// Writes the Chrome trace event JSON for the last capture to the given file.
+        ///
+        /// @param storageLocation
+        ///     The storage location to write to.
+        /// @param filePath
+        ///     The file path to write to.
+        ///
+        /// @return Whether or not the file was successfully written.
+        ///
+        static bool SaveChromeTrace(StorageLocation storageLocation, const std::string& filePath) noexcept;
+        
+    private:
+        Profiler() = delete;
+        
+        static std::atomic<bool> s_isCapturing;
+    };
+    
+    /// Records a profiler zone spanning its own lifetime. This should typically be
+    /// created through the CS_PROFILE_SCOPE macro.
+    ///
+    class ProfileZone final
+    {
+    public:
+        CS_DECLARE_NOCOPY(ProfileZone);
+        
+        /// @param name
+        ///     The name of the zone. This must be a string literal.
+        ///
+        explicit ProfileZone(const char* name) noexcept
+            : m_name(name), m_startTime(Profiler::IsCapturing() ? Profiler::GetTimestamp() : 0)
+        {
+        }
+        
+        ~ProfileZone() noexcept
+        {
+            //Zones which started during a capture are recorded even if the capture ended
+            //while they were open.
+            if (m_startTime != 0)
+            {
+                Profiler::RecordZone(m_name, m_startTime, Profiler::GetTimestamp());
+            }
+        }
+        
+    private:
+        const char* m_name;
+        u64 m_startTime;
+    };
+}
+
+#endif
@@ -278,17 +278,10 @@ namespace ChilliSource
     //------------------------------------------------------------------------------
     void GamepadSystem::ProcessQueuedInput() noexcept
     {
+        //Creation events are rare so are queued under a lock. These are always processed first.
         std::unique_lock<std::mutex> lock(m_mutex);
-        std::queue<GamepadCreateEventData> createEventQueue = m_createEventQueue;
-        std::queue<GamepadEventData> eventQueue = m_eventQueue;
-        while (m_createEventQueue.empty() == false)
-        {
-            m_createEventQueue.pop();
-        }
-        while (m_eventQueue.empty() == false)
-        {
-            m_eventQueue.pop();
-        }
+        std::queue<GamepadCreateEventData> createEventQueue;
+        std::swap(createEventQueue, m_createEventQueue);
         lock.unlock();
         
         while (createEventQueue.empty() == false)
@@ -299,9 +292,9 @@ namespace ChilliSource
             createEventQueue.pop();
         }
         
-        while (eventQueue.empty() == false)
+        GamepadEventData event;
+        while (m_eventQueue.try_pop(event))
         {
-            const GamepadEventData& event = eventQueue.front();
             
             switch (event.m_type)
             {
@@ -318,8 +311,6 @@ namespace ChilliSource
                     CS_LOG_FATAL("Something has gone very wrong while processing gamepad queued input");
                     break;
             }
-            
-            eventQueue.pop();
         }
     }
     
@@ -337,35 +328,25 @@ namespace ChilliSource
     //------------------------------------------------------------------------------
     void GamepadSystem::AddButtonPressureChangedEvent(Gamepad::Id uniqueId, u32 buttonIndex, f32 pressure) noexcept
     {
-        std::unique_lock<std::mutex> lock(m_mutex);
         m_eventQueue.push(GamepadEventData(EventType::k_buttonPressure, uniqueId, buttonIndex, pressure, ((f64)Application::Get()->GetSystemTimeInMilliseconds()) / 1000.0));
     }
     
     //------------------------------------------------------------------------------
     void GamepadSystem::AddAxisPositionChangedEvent(Gamepad::Id uniqueId, GamepadAxis axis, f32 position) noexcept
     {
-        std::unique_lock<std::mutex> lock(m_mutex);
         m_eventQueue.push(GamepadEventData(EventType::k_axisPosition, uniqueId, (u32)axis, position, ((f64)Application::Get()->GetSystemTimeInMilliseconds()) / 1000.0));
     }
     
     //------------------------------------------------------------------------------
     void GamepadSystem::AddGamepadRemoveEvent(Gamepad::Id uniqueId) noexcept
     {
-        std::unique_lock<std::mutex> lock(m_mutex);
         m_eventQueue.push(GamepadEventData(EventType::k_remove, uniqueId, 0, 0.0f, ((f64)Application::Get()->GetSystemTimeInMilliseconds()) / 1000.0));
     }
 
     //------------------------------------------------------------------------------
     void GamepadSystem::RemoveAllGamepads() noexcept
     {
-        std::unique_lock<std::mutex> lock(m_mutex);
-        
-        while (m_eventQueue.empty() == false)
-        {
-            m_eventQueue.pop();
-        }
-        
-        lock.unlock();
+        m_eventQueue.clear();
         
         m_gamepads.clear();
     }
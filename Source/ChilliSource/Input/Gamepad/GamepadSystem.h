@@ -26,11 +26,13 @@
 #define _CHILLISOURCE_INPUT_GAMEPAD_GAMEPADSYSTEM_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Container/concurrent_spsc_queue.h>
 #include <ChilliSource/Core/Event/Event.h>
 #include <ChilliSource/Core/Math/Vector2.h>
 #include <ChilliSource/Core/System/AppSystem.h>
 #include <ChilliSource/Input/Gamepad/Gamepad.h>
 
+#include <functional>
 #include <mutex>
 #include <queue>
 
@@ -255,7 +257,7 @@ namespace ChilliSource
         
         /// Called by the concrete system implementation to inject a create event
         ///
-        /// This method is thread safe and can be called on any thread.
+        /// This method is thread safe, but must only be called from a single thread.
         ///
         /// @param name
         ///     Device name of the controller
@@ -270,7 +272,7 @@ namespace ChilliSource
         
         /// Called by the concrete system implementation to inject a pressure changed event
         ///
-        /// This method is thread safe and can be called on any thread.
+        /// This method is thread safe, but must only be called from a single thread.
         ///
         /// @param uniqueId
         ///     The unique Id of the gamepad on which button pressure has changed.
@@ -283,7 +285,7 @@ namespace ChilliSource
         
         /// Called by the concrete system implementation to inject an axis changed event
         ///
-        /// This method is thread safe and can be called on any thread.
+        /// This method is thread safe, but must only be called from a single thread.
         ///
         /// @param uniqueId
         ///     The unique Id of the gamepad on which an axis (analogue stick) has moved.
@@ -296,7 +298,7 @@ namespace ChilliSource
         
         /// Called by the concrete system implementation to inject a remove event
         ///
-        /// This method is thread safe and can be called on any thread.
+        /// This method is thread safe, but must only be called from a single thread.
         ///
         /// @param uniqueId
         ///     The unique Id of the gamepad to disconnect.
@@ -314,6 +316,11 @@ namespace ChilliSource
         ///
         static GamepadSystemUPtr Create() noexcept;
         
+        /// The number of events which can be queued between updates before the queue overflows
+        /// and has to fall back on locking.
+        ///
+        static const u32 k_eventQueueCapacity = 256;
+        
         enum class EventType
         {
             k_buttonPressure,
@@ -323,6 +330,7 @@ namespace ChilliSource
         
         struct GamepadEventData
         {
+            GamepadEventData() = default;
             GamepadEventData(EventType type, Gamepad::Id uid, u32 index, f32 contextVal, f64 timestamp)
             : m_type(type), m_uniqueId(uid), m_index(index), m_value(contextVal), m_timestamp(timestamp) {}
 
@@ -382,7 +390,7 @@ namespace ChilliSource
         
         std::mutex m_mutex;
         std::vector<Gamepad> m_gamepads;
-        std::queue<GamepadEventData> m_eventQueue;
+        concurrent_spsc_queue<GamepadEventData> m_eventQueue { k_eventQueueCapacity };
         std::queue<GamepadCreateEventData> m_createEventQueue;
         std::vector<std::tuple<u32, u32, f32>> m_axisMappings;
         std::vector<std::pair<u32, u32>> m_buttonMappings;
@@ -52,6 +52,24 @@
 
 namespace ChilliSource
 {
+    namespace
+    {
+        /// The number of events which can be queued between updates before the queue overflows
+        /// and has to fall back on locking.
+        const u32 k_eventQueueCapacity = 1024;
+        
+        const std::vector<PointerSystem::PointerMoveSample> k_noMoveSamples;
+        
+        //------------------------------------------------------------------------------
+        /// @return The current time in seconds, in the same time frame as the input
+        /// event timestamps.
+        //------------------------------------------------------------------------------
+        f64 GetCurrentTimestamp()
+        {
+            return ((f64)Application::Get()->GetSystemTimeInMilliseconds()) / 1000.0;
+        }
+    }
+    
     CS_DEFINE_NAMEDTYPE(PointerSystem);
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
@@ -72,7 +90,7 @@ namespace ChilliSource
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
     PointerSystem::PointerSystem()
-        : m_nextUniqueId(0)
+        : m_eventQueue(k_eventQueueCapacity), m_nextUniqueId(0)
     {
     }
     //------------------------------------------------------------------------------
@@ -179,19 +197,84 @@ namespace ChilliSource
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
+    const std::vector<PointerSystem::PointerMoveSample>& PointerSystem::GetCoalescedMoves(Pointer::Id in_uniqueId) const
+    {
+        auto it = m_coalescedMoves.find(in_uniqueId);
+        if (it != m_coalescedMoves.end())
+        {
+            return it->second;
+        }
+        
+        return k_noMoveSamples;
+    }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
     void PointerSystem::ProcessQueuedInput()
     {
-        std::unique_lock<std::mutex> lock(m_mutex);
-        std::queue<PointerEvent> eventQueue = m_eventQueue;
-        while (m_eventQueue.empty() == false)
+        m_pendingEvents.clear();
+        
+        PointerEvent queuedEvent;
+        while (m_eventQueue.try_pop(queuedEvent))
+        {
+            m_pendingEvents.push_back(queuedEvent);
+        }
+        
+        //Only the last move of each pointer in a run of consecutive moves is dispatched, as the
+        //earlier ones would be immediately superseded. Mark them working backwards.
+        m_supersededEvents.assign(m_pendingEvents.size(), false);
+        m_pointersMovedInRun.clear();
+        for (std::size_t i = m_pendingEvents.size(); i-- > 0;)
         {
-            m_eventQueue.pop();
+            const PointerEvent& event = m_pendingEvents[i];
+            if (event.m_type != PointerEventType::k_move)
+            {
+                m_pointersMovedInRun.clear();
+            }
+            else if (std::find(m_pointersMovedInRun.begin(), m_pointersMovedInRun.end(), event.m_pointerUniqueId) != m_pointersMovedInRun.end())
+            {
+                m_supersededEvents[i] = true;
+            }
+            else
+            {
+                m_pointersMovedInRun.push_back(event.m_pointerUniqueId);
+            }
         }
-        lock.unlock();
         
-        while (eventQueue.empty() == false)
+        m_inputMetrics = InputMetrics();
+        m_inputMetrics.m_numEventsReceived = (u32)m_pendingEvents.size();
+        
+        const f64 dispatchTimestamp = GetCurrentTimestamp();
+        f64 totalLatency = 0.0;
+        u32 numTimedEvents = 0;
+        
+        for (std::size_t i = 0; i < m_pendingEvents.size(); ++i)
         {
-            PointerEvent& event = eventQueue.front();
+            const PointerEvent& event = m_pendingEvents[i];
+            
+            if (event.m_type == PointerEventType::k_move)
+            {
+                PointerMoveSample sample;
+                sample.m_position = event.m_position;
+                sample.m_timestamp = event.m_timestamp;
+                m_coalescedMoves[event.m_pointerUniqueId].push_back(sample);
+                
+                if (m_supersededEvents[i])
+                {
+                    ++m_inputMetrics.m_numMovesCoalesced;
+                    continue;
+                }
+            }
+            
+            //Add and remove events aren't timestamped, so can't be included in latency
+            if (event.m_timestamp > 0.0)
+            {
+                f64 latency = std::max(dispatchTimestamp - event.m_timestamp, 0.0);
+                m_inputMetrics.m_maxLatency = std::max(m_inputMetrics.m_maxLatency, latency);
+                totalLatency += latency;
+                ++numTimedEvents;
+            }
+            
+            ++m_inputMetrics.m_numEventsDispatched;
             
             switch (event.m_type)
             {
@@ -203,6 +286,7 @@ namespace ChilliSource
                     break;
                 case PointerEventType::k_move:
                     PointerMoved(event.m_pointerUniqueId, event.m_timestamp, event.m_position);
+                    m_coalescedMoves[event.m_pointerUniqueId].clear();
                     break;
                 case PointerEventType::k_up:
                     PointerUp(event.m_pointerUniqueId, event.m_timestamp, event.m_InputType);
@@ -217,16 +301,17 @@ namespace ChilliSource
                     CS_LOG_FATAL("Something has gone very wrong while processing buffered input");
                     break;
             }
-            
-            eventQueue.pop();
+        }
+        
+        if (numTimedEvents > 0)
+        {
+            m_inputMetrics.m_averageLatency = totalLatency / numTimedEvents;
         }
     }
     //------------------------------------------------------------------------------
     //------------------------------------------------------------------------------
     Pointer::Id PointerSystem::AddPointerCreateEvent(const Vector2& in_position)
     {
-        std::unique_lock<std::mutex> lock(m_mutex);
-        
         PointerEvent event;
         auto uniqueId = m_nextUniqueId++;
         event.m_type = PointerEventType::k_add;
@@ -243,14 +328,12 @@ namespace ChilliSource
     //------------------------------------------------------------------------------
     void PointerSystem::AddPointerDownEvent(Pointer::Id in_pointerUniqueId, Pointer::InputType in_inputType)
     {
-        std::unique_lock<std::mutex> lock(m_mutex);
-        
         PointerEvent event;
         event.m_type = PointerEventType::k_down;
         event.m_pointerUniqueId = in_pointerUniqueId;
         event.m_InputType = in_inputType;
         event.m_position = Vector2::k_zero;
-        event.m_timestamp = ((f64)Application::Get()->GetSystemTimeInMilliseconds()) / 1000.0;
+        event.m_timestamp = GetCurrentTimestamp();
         
         m_eventQueue.push(std::move(event));
     }
@@ -258,14 +341,12 @@ namespace ChilliSource
     //------------------------------------------------------------------------------
     void PointerSystem::AddPointerMovedEvent(Pointer::Id in_pointerUniqueId, const Vector2& in_position)
     {
-        std::unique_lock<std::mutex> lock(m_mutex);
-        
         PointerEvent event;
         event.m_type = PointerEventType::k_move;
         event.m_pointerUniqueId = in_pointerUniqueId;
         event.m_InputType = Pointer::InputType::k_none;
         event.m_position = in_position;
-        event.m_timestamp = ((f64)Application::Get()->GetSystemTimeInMilliseconds()) / 1000.0;
+        event.m_timestamp = GetCurrentTimestamp();
         
         m_eventQueue.push(std::move(event));
     }
@@ -273,14 +354,12 @@ namespace ChilliSource
     //------------------------------------------------------------------------------
     void PointerSystem::AddPointerUpEvent(Pointer::Id in_pointerUniqueId, Pointer::InputType in_inputType)
     {
-        std::unique_lock<std::mutex> lock(m_mutex);
-        
         PointerEvent event;
         event.m_type = PointerEventType::k_up;
         event.m_pointerUniqueId = in_pointerUniqueId;
         event.m_InputType = in_inputType;
         event.m_position = Vector2::k_zero;
-        event.m_timestamp = ((f64)Application::Get()->GetSystemTimeInMilliseconds()) / 1000.0;
+        event.m_timestamp = GetCurrentTimestamp();
         
         m_eventQueue.push(std::move(event));
     }
@@ -288,13 +367,11 @@ namespace ChilliSource
     //------------------------------------------------------------------------------
     void PointerSystem::AddPointerScrollEvent(Pointer::Id in_pointerUniqueId, const Vector2& in_delta)
     {
-        std::unique_lock<std::mutex> lock(m_mutex);
-        
         PointerEvent event;
         event.m_type = PointerEventType::k_scroll;
         event.m_pointerUniqueId = in_pointerUniqueId;
         event.m_InputType = Pointer::InputType::k_none;
-        event.m_timestamp = ((f64)Application::Get()->GetSystemTimeInMilliseconds()) / 1000.0;
+        event.m_timestamp = GetCurrentTimestamp();
         event.m_position = in_delta;
         
         m_eventQueue.push(std::move(event));
@@ -303,8 +380,6 @@ namespace ChilliSource
     //-------------------------------------------------------------------------------
     void PointerSystem::AddPointerRemoveEvent(Pointer::Id in_pointerUniqueId)
     {
-        std::unique_lock<std::mutex> lock(m_mutex);
-        
         PointerEvent event;
         event.m_type = PointerEventType::k_remove;
         event.m_pointerUniqueId = in_pointerUniqueId;
@@ -318,16 +393,10 @@ namespace ChilliSource
     //------------------------------------------------------------------------------
     void PointerSystem::RemoveAllPointers()
     {
-        std::unique_lock<std::mutex> lock(m_mutex);
-        
-        while (m_eventQueue.empty() == false)
-        {
-            m_eventQueue.pop();
-        }
-        
-        lock.unlock();
+        m_eventQueue.clear();
         
         m_pointers.clear();
+        m_coalescedMoves.clear();
     }
     //------------------------------------------------------------------------------
     //-------------------------------------------------------------------------------
@@ -506,6 +575,7 @@ namespace ChilliSource
         CS_ASSERT(filteredInputIt != m_filteredPointerInput.end(), "Filtered input doesn't exist!");
         
         m_filteredPointerInput.erase(filteredInputIt);
+        m_coalescedMoves.erase(in_uniqueId);
         
         //find the pointer.
         auto pointerIt = std::find_if(m_pointers.begin(), m_pointers.end(), [in_uniqueId](const Pointer& in_pointer)
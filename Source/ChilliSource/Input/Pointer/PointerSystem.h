@@ -30,15 +30,17 @@
 #define _CHILLISOURCE_INPUT_POINTER_POINTERSYSTEM_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Container/concurrent_spsc_queue.h>
 #include <ChilliSource/Core/Event/Event.h>
 #include <ChilliSource/Core/Math/Vector2.h>
 #include <ChilliSource/Core/System/AppSystem.h>
 #include <ChilliSource/Input/Pointer/Pointer.h>
 
-#include <mutex>
-#include <queue>
+#include <atomic>
+#include <functional>
 #include <set>
 #include <unordered_map>
+#include <vector>
 
 namespace ChilliSource
 {
@@ -46,6 +48,11 @@ namespace ChilliSource
     /// A system that provides a generic API for working with pointer devices.
     /// Pointers include touches on a touch screen and the mouse on a PC.
     ///
+    /// Input is received from the OS on a single platform thread and queued without
+    /// locking until it is processed on the main thread. When processed, consecutive
+    /// moves of the same pointer are coalesced into a single moved event; the
+    /// individual moves can be retrieved with GetCoalescedMoves().
+    ///
     /// @author Ian Copland
     //------------------------------------------------------------------------------
     class PointerSystem : public AppSystem
@@ -53,6 +60,27 @@ namespace ChilliSource
     public:
         CS_DECLARE_NAMEDTYPE(PointerSystem);
         //------------------------------------------------------------------------------
+        /// A single position of a pointer, as received from the OS.
+        //------------------------------------------------------------------------------
+        struct PointerMoveSample
+        {
+            Vector2 m_position;
+            f64 m_timestamp;
+        };
+        //------------------------------------------------------------------------------
+        /// Statistics on the input handled in the last call to ProcessQueuedInput().
+        /// Latencies are the time in seconds between the OS input event being
+        /// received and it being dispatched.
+        //------------------------------------------------------------------------------
+        struct InputMetrics
+        {
+            u32 m_numEventsReceived = 0;
+            u32 m_numEventsDispatched = 0;
+            u32 m_numMovesCoalesced = 0;
+            f64 m_averageLatency = 0.0;
+            f64 m_maxLatency = 0.0;
+        };
+        //------------------------------------------------------------------------------
         /// A delegate that is used to receive pointer added events.
         ///
         /// On platforms which use a mouse this occurs once: when the mouse is first
@@ -80,6 +108,10 @@ namespace ChilliSource
         /// A delegate that is used to receive pointer moved events. This could be
         /// dragging a touch on screen or moving the mouse cursor.
         ///
+        /// If multiple moves were received since the last event, only the latest
+        /// is notified. GetCoalescedMoves() can be used to retrieve all of them
+        /// during the event.
+        ///
         /// @author Ian Copland
         ///
         /// @param in_pointer - The pointer
@@ -247,6 +279,24 @@ namespace ChilliSource
         ///
         u32 GetNumPointers() const noexcept { return (u32)m_pointers.size(); }
         
+        //------------------------------------------------------------------------------
+        /// Gets all of the moves which were coalesced into the pointer moved event
+        /// currently being notified, oldest first, including the latest. This is
+        /// only valid during the pointer moved event; at any other time it will be
+        /// empty.
+        ///
+        /// @param in_uniqueId - The unique Id of the pointer.
+        ///
+        /// @return The coalesced moves.
+        //------------------------------------------------------------------------------
+        const std::vector<PointerMoveSample>& GetCoalescedMoves(Pointer::Id in_uniqueId) const;
+        //------------------------------------------------------------------------------
+        /// @return Statistics on the input handled in the last call to
+        /// ProcessQueuedInput().
+        //------------------------------------------------------------------------------
+        const InputMetrics& GetInputMetrics() const { return m_inputMetrics; }
+        
+        
         //------------------------------------------------------------------------------
         /// Hide the pointer cursor if one exists
         ///
@@ -282,7 +332,7 @@ namespace ChilliSource
         //------------------------------------------------------------------------------
         /// Adds a new Create Pointer event.
         ///
-        /// This method is thread safe and can be called on any thread.
+        /// This method is thread safe, but must only be called from a single thread.
         ///
         /// @author Ian Copland
         ///
@@ -294,7 +344,7 @@ namespace ChilliSource
         //------------------------------------------------------------------------------
         /// Adds a new pointer down event.
         ///
-        /// This method is thread safe and can be called on any thread.
+        /// This method is thread safe, but must only be called from a single thread.
         ///
         /// @author Ian Copland
         ///
@@ -305,7 +355,7 @@ namespace ChilliSource
         //------------------------------------------------------------------------------
         /// Adds a new pointer moved event.
         ///
-        /// This method is threadsafe and can be called on any thread.
+        /// This method is thread safe, but must only be called from a single thread.
         ///
         /// @author Ian Copland
         ///
@@ -316,7 +366,7 @@ namespace ChilliSource
         //------------------------------------------------------------------------------
         /// Adds a new pointer up event.
         ///
-        /// This method is thread safe and can be called on any thread.
+        /// This method is thread safe, but must only be called from a single thread.
         ///
         /// @author Ian Copland
         ///
@@ -327,7 +377,7 @@ namespace ChilliSource
         //------------------------------------------------------------------------------
         /// Adds a new pointer scroll event.
         ///
-        /// This method is thread safe and can be called on any thread.
+        /// This method is thread safe, but must only be called from a single thread.
         ///
         /// @author Ian Copland
         ///
@@ -338,7 +388,7 @@ namespace ChilliSource
         //------------------------------------------------------------------------------
         /// Adds a new remove pointer event.
         ///
-        /// This method is thread safe and can be called on any thread.
+        /// This method is thread safe, but must only be called from a single thread.
         ///
         /// @author Ian Copland
         ///
@@ -516,10 +566,15 @@ namespace ChilliSource
         Event<PointerDownDelegateInternal> m_pointerDownEventInternal;
         Event<PointerScrollDelegateInternal> m_pointerScrolledEventInternal;
         
-        std::mutex m_mutex;
         std::vector<Pointer> m_pointers;
-        std::queue<PointerEvent> m_eventQueue;
-        Pointer::Id m_nextUniqueId;
+        concurrent_spsc_queue<PointerEvent> m_eventQueue;
+        std::atomic<Pointer::Id> m_nextUniqueId;
+        
+        std::vector<PointerEvent> m_pendingEvents;
+        std::vector<bool> m_supersededEvents;
+        std::vector<Pointer::Id> m_pointersMovedInRun;
+        std::unordered_map<Pointer::Id, std::vector<PointerMoveSample>> m_coalescedMoves;
+        InputMetrics m_inputMetrics;
         
         std::unordered_map<Pointer::Id, std::set<Pointer::InputType>> m_filteredPointerInput;
     };
@@ -40,6 +40,14 @@
 
 #include <minizip/unzip.h>
 
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+#include <memory>
+#include <sstream>
+
 namespace ChilliSource
 {
     namespace
@@ -51,9 +59,53 @@ namespace ChilliSource
         const char k_tempManifestFile[] = "ContentManifestTemp.moman";
         const char k_packageExtension[] = "packzip";
         const char k_packageExtensionFull[] = ".packzip";
+        const char k_checksumIndexFile[] = "ContentChecksumIndex.dat";
+        const char k_checksumIndexVersion[] = "1";
+#ifdef CS_USE_SHA1_CHECKSUMS
+        const char k_checksumIndexAlgorithm[] = "SHA1";
+#else
+        const char k_checksumIndexAlgorithm[] = "SHA256";
+#endif
+        
+        /// Files modified this recently are not added to the checksum index. The modification time
+        /// only has a resolution of a second, so a file rewritten with the same size within the same
+        /// second as it was hashed would otherwise appear unchanged.
+        const s64 k_checksumIndexMinFileAge = 2;
+        
+        const char k_stagingDirectorySuffix[] = "-Staged/";
+        
+        /// The size of the buffer used to stream files out of a package while unzipping.
+        const u32 k_extractionChunkSize = 64 * 1024;
         
         const std::string k_tempManifestFilePath = std::string(k_tempDirectory) + k_tempManifestFile;
         
+        //-----------------------------------------------------------
+        /// @param in_packageId - The package Id.
+        ///
+        /// @return The path to the package's temp download file,
+        /// relative to the DLC storage location.
+        //-----------------------------------------------------------
+        std::string GetTempPackageFilePath(const std::string& in_packageId)
+        {
+            return k_tempDirectory + in_packageId + k_packageExtensionFull;
+        }
+        //-----------------------------------------------------------
+        /// Each download attempt stages to its own directory, so an
+        /// extraction left running by a cancelled attempt can't
+        /// interfere with the next one.
+        ///
+        /// @param in_packageId - The package Id.
+        /// @param in_generation - The download generation.
+        ///
+        /// @return The path to the directory which the package is
+        /// unzipped to before it is installed, relative to the DLC
+        /// storage location.
+        //-----------------------------------------------------------
+        std::string GetStagingDirectoryPath(const std::string& in_packageId, u32 in_generation)
+        {
+            return k_tempDirectory + in_packageId + "-" + ToString(in_generation) + k_stagingDirectorySuffix;
+        }
+        
         //--------------------------------------------------------
         /// @author S Downie
         ///
@@ -131,6 +183,53 @@ namespace ChilliSource
             return XMLUtils::WriteDocument(doc->GetDocument(), StorageLocation::k_DLC, in_filePath);
         }
         //-----------------------------------------------------------
+        /// Reads the size and modification time of the file at the
+        /// given absolute path.
+        ///
+        /// @param in_absolutePath - The absolute file path.
+        /// @param out_size - [Out] The size of the file in bytes.
+        /// @param out_modificationTime - [Out] The modification time
+        /// of the file in seconds since the epoch.
+        ///
+        /// @return Whether or not the file could be queried. This
+        /// fails for files which don't exist or which aren't on the
+        /// real file system, such as those inside an APK.
+        //-----------------------------------------------------------
+        bool GetFileStats(const std::string& in_absolutePath, u64& out_size, s64& out_modificationTime)
+        {
+            struct stat fileStats;
+            if(stat(in_absolutePath.c_str(), &fileStats) != 0 || (fileStats.st_mode & S_IFMT) != S_IFREG)
+            {
+                return false;
+            }
+            
+            out_size = u64(fileStats.st_size);
+            out_modificationTime = s64(fileStats.st_mtime);
+            return true;
+        }
+        //-----------------------------------------------------------
+        /// @param in_location - The storage location of the file.
+        /// @param in_filePath - The file path relative to the
+        /// storage location.
+        ///
+        /// @return The key used for the file in the checksum index.
+        //-----------------------------------------------------------
+        std::string GetChecksumIndexKey(StorageLocation in_location, const std::string& in_filePath)
+        {
+            return ToString(u32(in_location)) + ":" + in_filePath;
+        }
+        //-----------------------------------------------------------
+        /// @param in_location - The storage location of the file.
+        /// @param in_filePath - The file path relative to the
+        /// storage location.
+        ///
+        /// @return The absolute path to the file.
+        //-----------------------------------------------------------
+        std::string GetAbsoluteFilePath(StorageLocation in_location, const std::string& in_filePath)
+        {
+            return Application::Get()->GetFileSystem()->GetAbsolutePathToStorageLocation(in_location) + in_filePath;
+        }
+        //-----------------------------------------------------------
         /// Deletes a directory from the DLC Storage Location.
         ///
         /// @author S Downie
@@ -169,6 +268,8 @@ namespace ChilliSource
     void ContentManagementSystem::OnInit()
     {
         m_contentDirectory = Application::Get()->GetFileSystem()->GetAbsolutePathToStorageLocation(StorageLocation::k_DLC);
+        
+        LoadChecksumIndex();
     }
     //-----------------------------------------------------------
     //-----------------------------------------------------------
@@ -211,6 +312,40 @@ namespace ChilliSource
             return m_checksumDelegate(in_location, in_filePath);
         }
         
+        u64 size = 0;
+        s64 modificationTime = 0;
+        bool hasStats = GetFileStats(GetAbsoluteFilePath(in_location, in_filePath), size, modificationTime);
+        const std::string key = GetChecksumIndexKey(in_location, in_filePath);
+        
+        if(hasStats)
+        {
+            std::unique_lock<std::mutex> lock(m_checksumIndexMutex);
+            auto it = m_checksumIndex.find(key);
+            if(it != m_checksumIndex.end() && it->second.m_size == size && it->second.m_modificationTime == modificationTime)
+            {
+                return it->second.m_checksum;
+            }
+        }
+        
+        std::string checksum = CalculateFileChecksum(in_location, in_filePath);
+        
+        if(hasStats && modificationTime < s64(std::time(nullptr)) - k_checksumIndexMinFileAge)
+        {
+            std::unique_lock<std::mutex> lock(m_checksumIndexMutex);
+            
+            ChecksumIndexEntry& entry = m_checksumIndex[key];
+            entry.m_size = size;
+            entry.m_modificationTime = modificationTime;
+            entry.m_checksum = checksum;
+            m_checksumIndexDirty = true;
+        }
+        
+        return checksum;
+    }
+    //-----------------------------------------------------------
+    //-----------------------------------------------------------
+    std::string ContentManagementSystem::CalculateFileChecksum(StorageLocation in_location, const std::string& in_filePath) const
+    {
 #ifdef CS_USE_SHA1_CHECKSUMS
         std::string checksum = Application::Get()->GetFileSystem()->GetFileChecksumSHA1(in_location, in_filePath);
 #else
@@ -225,11 +360,15 @@ namespace ChilliSource
     //-----------------------------------------------------------
     void ContentManagementSystem::ClearDownloadData()
     {
-        //Clear the old crap
+        //Clear the old crap. Any downloads still in flight belong to a stale generation and will be ignored.
         m_serverManifest.reset();
         m_removePackageIds.clear();
         m_packageDetails.clear();
         m_cachedPackageDetails.clear();
+        m_packageDownloads.clear();
+        
+        ++m_downloadGeneration;
+        m_downloadInProgress = false;
     }
     //-----------------------------------------------------------
     //-----------------------------------------------------------
@@ -256,61 +395,118 @@ namespace ChilliSource
         m_onDownloadCompleteDelegate = in_delegate;
         m_onDownloadProgressDelegate = in_progressDelegate;
         
-        m_currentPackageDownload = 0;
+        ++m_downloadGeneration;
         m_downloadInProgress = true;
+        m_downloadFailed = false;
+        
+        m_packageDownloads.clear();
+        m_packageDownloads.resize(m_packageDetails.size());
 
         if(!m_packageDetails.empty())
         {
             //Add a temp directory so that the packages are stored atomically and only overwrite
             //the originals on full success
             Application::Get()->GetFileSystem()->CreateDirectoryPath(StorageLocation::k_DLC, k_tempDirectory);
-            DownloadPackage(m_currentPackageDownload);
-        }
-        else
-        {
-            m_downloadInProgress = false;
-            m_onDownloadCompleteDelegate(Result::k_succeeded);
         }
+        
+        DownloadNextPackages();
     }
     //-----------------------------------------------------------
     //-----------------------------------------------------------
-    void ContentManagementSystem::DownloadNextPackage()
+    void ContentManagementSystem::DownloadNextPackages()
     {
-        m_currentPackageDownload++;
-        DownloadPackage(m_currentPackageDownload);
+        const u32 maxConcurrentDownloads = m_contentDownloader->SupportsConcurrentDownloads() ? m_maxConcurrentDownloads : 1;
+        
+        u32 numDownloading = 0;
+        for(const auto& packageDownload : m_packageDownloads)
+        {
+            if(packageDownload.m_state == PackageState::k_downloading)
+            {
+                ++numDownloading;
+            }
+        }
+        
+        for(u32 i = 0; i < m_packageDownloads.size() && numDownloading < maxConcurrentDownloads && !m_downloadFailed; ++i)
+        {
+            if(m_packageDownloads[i].m_state == PackageState::k_pending)
+            {
+                DownloadPackage(i);
+                
+                if(m_packageDownloads[i].m_state == PackageState::k_downloading)
+                {
+                    ++numDownloading;
+                }
+            }
+        }
+        
+        CheckDownloadUpdatesComplete();
     }
     //-----------------------------------------------------------
     //-----------------------------------------------------------
-    void ContentManagementSystem::DownloadPackage(u32 in_packageIndex, bool in_checkCached)
+    void ContentManagementSystem::DownloadPackage(u32 in_packageIndex)
     {
         CS_ASSERT(in_packageIndex < m_packageDetails.size(), "Package index out of range");
         
         const auto& package = m_packageDetails[in_packageIndex];
-        bool existsInCache = VectorUtils::Contains<PackageDetails>(m_cachedPackageDetails, package);
+        auto& packageDownload = m_packageDownloads[in_packageIndex];
         
-        if(in_checkCached && existsInCache)
+        if(VectorUtils::Contains<PackageDetails>(m_cachedPackageDetails, package))
         {
-            //We call the progress function for this index
-            OnContentDownloadProgress(package.m_url, 1.0f);
-            
+            //The package was fully downloaded and verified in a previous session, so only needs extracting
             m_runningDownloadedTotal += package.m_size;
-            
-            //Check if this is the last download
-            if(in_packageIndex >= (m_packageDetails.size() - 1))
+            OnContentDownloadProgress(in_packageIndex, 1.0f);
+            ProcessPackage(in_packageIndex, false);
+            return;
+        }
+        
+        //Resume from any partial download left by a previous attempt
+        auto fileSystem = Application::Get()->GetFileSystem();
+        const std::string tempFilePath = GetTempPackageFilePath(package.m_id);
+        
+        packageDownload.m_resumeOffset = 0;
+        if(m_contentDownloader->SupportsResume() && fileSystem->DoesFileExist(StorageLocation::k_DLC, tempFilePath))
+        {
+            u64 downloadedSize = fileSystem->GetFileSize(StorageLocation::k_DLC, tempFilePath);
+            if(downloadedSize < package.m_size)
             {
-                m_downloadInProgress = false;
-                m_onDownloadCompleteDelegate(Result::k_succeeded);
+                packageDownload.m_resumeOffset = downloadedSize;
             }
-            else
+        }
+        
+        packageDownload.m_fileStream = fileSystem->CreateBinaryOutputStream(StorageLocation::k_DLC, tempFilePath, packageDownload.m_resumeOffset > 0 ? FileWriteMode::k_append : FileWriteMode::k_overwrite);
+        if(packageDownload.m_fileStream == nullptr)
+        {
+            CS_LOG_ERROR("CMS: " + package.m_id + " Couldn't write package.");
+            packageDownload.m_state = PackageState::k_failed;
+            m_downloadFailed = true;
+            return;
+        }
+        
+        packageDownload.m_state = PackageState::k_downloading;
+        
+        const u32 generation = m_downloadGeneration;
+        auto completionDelegate = [=](IContentDownloader::Result in_result, const std::string& in_data)
+        {
+            if(generation == m_downloadGeneration)
             {
-                //Else move on to next package
-                DownloadNextPackage();
+                OnContentDownloadComplete(in_packageIndex, in_result, in_data);
             }
+        };
+        auto progressDelegate = [=](const std::string& in_url, f32 in_progress)
+        {
+            if(generation == m_downloadGeneration)
+            {
+                OnContentDownloadProgress(in_packageIndex, in_progress);
+            }
+        };
+        
+        if(packageDownload.m_resumeOffset > 0)
+        {
+            m_contentDownloader->ResumePackageDownload(package.m_url, packageDownload.m_resumeOffset, completionDelegate, progressDelegate);
         }
         else
         {
-            m_contentDownloader->DownloadPackage(package.m_url, MakeDelegate(this, &ContentManagementSystem::OnContentDownloadComplete),
-                                                 MakeDelegate(this, &ContentManagementSystem::OnContentDownloadProgress));
+            m_contentDownloader->DownloadPackage(package.m_url, completionDelegate, progressDelegate);
         }
     }
     //-----------------------------------------------------------
@@ -323,10 +519,28 @@ namespace ChilliSource
         {
             if(!m_packageDetails.empty())
             {
-                //Unzip all the files and overwrite the old manifest
-                for (const auto& details : m_packageDetails)
+                //Any package still being processed belongs to a stale generation, so it is extracted again here
+                //to a directory of its own rather than one the background task may still be writing to.
+                ++m_downloadGeneration;
+                
+                //Move the unzipped files into place. Packages are normally unzipped as soon as they've downloaded, so
+                //only need unzipping here if that didn't happen.
+                for (u32 i = 0; i < m_packageDetails.size(); ++i)
                 {
-                    ExtractFilesFromPackage(details);
+                    const auto& details = m_packageDetails[i];
+                    
+                    std::string stagingDirectory;
+                    if(i < m_packageDownloads.size() && m_packageDownloads[i].m_state == PackageState::k_ready)
+                    {
+                        stagingDirectory = m_packageDownloads[i].m_stagingDirectory;
+                    }
+                    else
+                    {
+                        stagingDirectory = GetStagingDirectoryPath(details.m_id, m_downloadGeneration);
+                        ExtractFilesFromPackage(details, stagingDirectory);
+                    }
+                    
+                    InstallStagedFiles(stagingDirectory, details);
                 }
             }
             
@@ -354,6 +568,8 @@ namespace ChilliSource
             AppDataStore* ads = Application::Get()->GetSystem<AppDataStore>();
             ads->SetValue(k_adsKeyHasCached, true);
             
+            SaveChecksumIndex();
+            
             //Tell the delegate all is good
             inDelegate(Result::k_succeeded);
         }
@@ -378,57 +594,60 @@ namespace ChilliSource
                 break;
             case IContentDownloader::Result::k_failed:
                 m_serverManifestData.clear();
-                m_dlcCachePurged ? m_onUpdateCheckCompleteDelegate(CheckForUpdatesResult::k_checkFailedBlocking) : m_onUpdateCheckCompleteDelegate(CheckForUpdatesResult::k_checkFailed);
+                NotifyUpdateCheckComplete(m_dlcCachePurged ? CheckForUpdatesResult::k_checkFailedBlocking : CheckForUpdatesResult::k_checkFailed);
                 break;
             case IContentDownloader::Result::k_flushed:
                 m_serverManifestData += in_manifest;
                 break;
         };
-        
-        if(in_result != IContentDownloader::Result::k_flushed)
-        {
-            //Reset the listener
-            m_onUpdateCheckCompleteDelegate = nullptr;
-        }
     }
     //-----------------------------------------------------------
     //-----------------------------------------------------------
-    void ContentManagementSystem::OnContentDownloadComplete(IContentDownloader::Result in_result, const std::string& in_data)
+    void ContentManagementSystem::OnContentDownloadComplete(u32 in_packageIndex, IContentDownloader::Result in_result, const std::string& in_data)
     {
+        CS_ASSERT(in_packageIndex < m_packageDownloads.size(), "Package index out of range");
+        
+        auto& packageDownload = m_packageDownloads[in_packageIndex];
+        if(packageDownload.m_state != PackageState::k_downloading)
+        {
+            //The package has already failed; ignore the rest of its data
+            return;
+        }
+        
         switch(in_result)
         {
             case IContentDownloader::Result::k_succeeded:
             {
-                if(SavePackageToFile(m_packageDetails[m_currentPackageDownload], in_data, true))
+                if(WritePackageData(in_packageIndex, in_data))
                 {
-                    m_runningDownloadedTotal += m_packageDetails[m_currentPackageDownload].m_size;
-                    
-                    //Don't overwrite the old manifest until all the content has been downloaded 
-                    if(m_currentPackageDownload >= (m_packageDetails.size() - 1))
-                    {
-                        m_downloadInProgress = false;
-                        m_onDownloadCompleteDelegate(Result::k_succeeded);
-                    }
-                    else
-                    {
-                        DownloadNextPackage();
-                    }
+                    packageDownload.m_fileStream.reset();
+                    m_runningDownloadedTotal += m_packageDetails[in_packageIndex].m_size;
+                    OnContentDownloadProgress(in_packageIndex, 1.0f);
                     
+                    //Verify and unzip the package in the background while the remaining downloads continue
+                    ProcessPackage(in_packageIndex, true);
+                    DownloadNextPackages();
                     break;
                 }
             }
             case IContentDownloader::Result::k_failed:
             {
-                if(m_onDownloadCompleteDelegate)
-                {
-                    m_downloadInProgress = false;
-                    m_onDownloadCompleteDelegate(Result::k_failed);
-                }
+                //Any data already written is kept so the download can be resumed later
+                packageDownload.m_fileStream.reset();
+                packageDownload.m_state = PackageState::k_failed;
+                m_downloadFailed = true;
+                DownloadNextPackages();
                 break;
             }
             case IContentDownloader::Result::k_flushed:
             {
-                SavePackageToFile(m_packageDetails[m_currentPackageDownload], in_data, false);
+                if(!WritePackageData(in_packageIndex, in_data))
+                {
+                    packageDownload.m_fileStream.reset();
+                    packageDownload.m_state = PackageState::k_failed;
+                    m_downloadFailed = true;
+                    DownloadNextPackages();
+                }
                 break;
             }
         }
@@ -446,11 +665,11 @@ namespace ChilliSource
             CS_LOG_ERROR("CMS: Server content manifest is invalid");
             if(m_dlcCachePurged)
             {
-                m_onUpdateCheckCompleteDelegate(CheckForUpdatesResult::k_checkFailedBlocking);
+                NotifyUpdateCheckComplete(CheckForUpdatesResult::k_checkFailedBlocking);
             }
             else
             {
-                m_onUpdateCheckCompleteDelegate(CheckForUpdatesResult::k_checkFailed);
+                NotifyUpdateCheckComplete(CheckForUpdatesResult::k_checkFailed);
             }
 
             return;
@@ -459,15 +678,28 @@ namespace ChilliSource
         //Check if DLC is enabled
         if(!XMLUtils::GetAttributeValue<bool>(serverManifestRootNode, "DLCEnabled", false))
         {
-            m_onUpdateCheckCompleteDelegate(CheckForUpdatesResult::k_notAvailable);
+            NotifyUpdateCheckComplete(CheckForUpdatesResult::k_notAvailable);
             return;
         }
         
-        XMLUPtr currentManifest = LoadLocalManifest();
+        XMLSPtr currentManifest = LoadLocalManifest();
+        
+        //Hash everything the comparison will need up front and in parallel, then compare
+        //once it's done.
+        PrecalculateChecksums(GetChecksumRequests(serverManifestRootNode, currentManifest.get()), [=]()
+        {
+            CompareManifests(currentManifest.get());
+        });
+    }
+    //-----------------------------------------------------------
+    //-----------------------------------------------------------
+    void ContentManagementSystem::CompareManifests(const XML* in_currentManifest)
+    {
+        XML::Node* serverManifestRootNode = XMLUtils::GetFirstChildElement(m_serverManifest->GetDocument());
         
         //If we have not successfully loaded a manifest from file we need to check if any of the assets 
         //are in the bundle and pull down the others
-        if(currentManifest == nullptr || XMLUtils::GetFirstChildElement(currentManifest->GetDocument()) == nullptr)
+        if(in_currentManifest == nullptr || XMLUtils::GetFirstChildElement(in_currentManifest->GetDocument()) == nullptr)
         {
             //Grab all the URL's from the new manifest
             
@@ -488,7 +720,7 @@ namespace ChilliSource
             std::unordered_map<std::string, std::string> mapPackageIDToChecksum;
             
             //Store the data from the local manifest to make a comparison with the server manifest
-            XML::Node* currentRoot = XMLUtils::GetFirstChildElement(currentManifest->GetDocument());
+            XML::Node* currentRoot = XMLUtils::GetFirstChildElement(in_currentManifest->GetDocument());
             if(currentRoot != nullptr)
             {
                 //Loop round 
@@ -592,17 +824,179 @@ namespace ChilliSource
             RefreshIncompleteDownloadInfo();
         }
         
+        SaveChecksumIndex();
+        
         if(bRequiresUpdating && m_dlcCachePurged)
         {
-            m_onUpdateCheckCompleteDelegate(CheckForUpdatesResult::k_availableBlocking);
+            NotifyUpdateCheckComplete(CheckForUpdatesResult::k_availableBlocking);
         }
         else if(bRequiresUpdating && !m_dlcCachePurged)
         {
-            m_onUpdateCheckCompleteDelegate(CheckForUpdatesResult::k_available);
+            NotifyUpdateCheckComplete(CheckForUpdatesResult::k_available);
         }
         else
         {
-            m_onUpdateCheckCompleteDelegate(CheckForUpdatesResult::k_notAvailable);
+            NotifyUpdateCheckComplete(CheckForUpdatesResult::k_notAvailable);
+        }
+    }
+    //-----------------------------------------------------------
+    //-----------------------------------------------------------
+    std::vector<ContentManagementSystem::ChecksumRequest> ContentManagementSystem::GetChecksumRequests(XML::Node* in_serverManifestRoot, const XML* in_currentManifest) const
+    {
+        auto fileSystem = Application::Get()->GetFileSystem();
+        std::vector<ChecksumRequest> requests;
+        
+        auto addRequest = [&](StorageLocation in_location, const std::string& in_filePath)
+        {
+            ChecksumRequest request;
+            request.m_location = in_location;
+            request.m_filePath = in_filePath;
+            
+            //Files which can't be queried can't be indexed either so are left to be hashed on demand.
+            if(GetFileStats(GetAbsoluteFilePath(in_location, in_filePath), request.m_size, request.m_modificationTime))
+            {
+                requests.push_back(std::move(request));
+            }
+        };
+        
+        std::unordered_map<std::string, std::string> localPackageChecksums;
+        XML::Node* currentRoot = (in_currentManifest != nullptr) ? XMLUtils::GetFirstChildElement(in_currentManifest->GetDocument()) : nullptr;
+        if(currentRoot != nullptr)
+        {
+            XML::Node* localPackageEl = XMLUtils::GetFirstChildElement(currentRoot, "Package");
+            while(localPackageEl)
+            {
+                localPackageChecksums.insert(std::make_pair(XMLUtils::GetAttributeValue<std::string>(localPackageEl, "ID", ""), XMLUtils::GetAttributeValue<std::string>(localPackageEl, "Checksum", "")));
+                localPackageEl = XMLUtils::GetNextSiblingElement(localPackageEl, "Package");
+            }
+        }
+        
+        XML::Node* serverPackageEl = XMLUtils::GetFirstChildElement(in_serverManifestRoot, "Package");
+        while(serverPackageEl)
+        {
+            const std::string packageId = XMLUtils::GetAttributeValue<std::string>(serverPackageEl, "ID", "");
+            const std::string packageChecksum = XMLUtils::GetAttributeValue<std::string>(serverPackageEl, "Checksum", "");
+            
+            auto it = localPackageChecksums.find(packageId);
+            bool upToDate = (it != localPackageChecksums.end() && it->second == packageChecksum);
+            
+            XML::Node* fileEl = XMLUtils::GetFirstChildElement(serverPackageEl, "File");
+            while(fileEl)
+            {
+                std::string filePath = XMLUtils::GetAttributeValue<std::string>(fileEl, "Location", "");
+                if(filePath.empty())
+                {
+                    filePath = packageId + "/" + XMLUtils::GetAttributeValue<std::string>(fileEl, "Name", "");
+                }
+                
+                if(upToDate)
+                {
+                    addRequest(StorageLocation::k_DLC, filePath);
+                }
+                else
+                {
+                    addRequest(StorageLocation::k_package, fileSystem->GetPackageDLCPath() + filePath);
+                }
+                
+                fileEl = XMLUtils::GetNextSiblingElement(fileEl, "File");
+            }
+            
+            serverPackageEl = XMLUtils::GetNextSiblingElement(serverPackageEl, "Package");
+        }
+        
+        //Partially downloaded packages from a previous session will need verified if the update is resumed.
+        if(fileSystem->DoesFileExist(StorageLocation::k_DLC, k_tempManifestFilePath))
+        {
+            auto tempPackageFiles = fileSystem->GetFilePathsWithExtension(StorageLocation::k_DLC, k_tempDirectory, false, k_packageExtension);
+            for(const auto& packageFile : tempPackageFiles)
+            {
+                addRequest(StorageLocation::k_DLC, k_tempDirectory + packageFile);
+            }
+        }
+        
+        return requests;
+    }
+    //-----------------------------------------------------------
+    //-----------------------------------------------------------
+    void ContentManagementSystem::PrecalculateChecksums(std::vector<ChecksumRequest> in_requests, const std::function<void()>& in_completionDelegate)
+    {
+        CS_ASSERT(Application::Get()->GetTaskScheduler()->IsMainThread() == true, "Checksums must be precalculated on the main thread.");
+        
+        //Custom checksums aren't cached, and the delegate might not be thread-safe.
+        if(m_checksumDelegate)
+        {
+            in_completionDelegate();
+            return;
+        }
+        
+        {
+            std::unique_lock<std::mutex> lock(m_checksumIndexMutex);
+            auto misses = std::remove_if(in_requests.begin(), in_requests.end(), [&](const ChecksumRequest& in_request)
+            {
+                auto it = m_checksumIndex.find(GetChecksumIndexKey(in_request.m_location, in_request.m_filePath));
+                return (it != m_checksumIndex.end() && it->second.m_size == in_request.m_size && it->second.m_modificationTime == in_request.m_modificationTime);
+            });
+            in_requests.erase(misses, in_requests.end());
+        }
+        
+        if(in_requests.empty())
+        {
+            in_completionDelegate();
+            return;
+        }
+        
+        auto requests = std::make_shared<const std::vector<ChecksumRequest>>(std::move(in_requests));
+        auto checksums = std::make_shared<std::vector<std::string>>(requests->size());
+        
+        std::vector<Task> tasks;
+        tasks.reserve(requests->size());
+        for(std::size_t i = 0; i < requests->size(); ++i)
+        {
+            tasks.push_back([=](const TaskContext&) noexcept
+            {
+                const auto& request = (*requests)[i];
+                (*checksums)[i] = CalculateFileChecksum(request.m_location, request.m_filePath);
+            });
+        }
+        
+        auto taskScheduler = Application::Get()->GetTaskScheduler();
+        taskScheduler->ScheduleTasks(TaskType::k_large, tasks, [=](const TaskContext&) noexcept
+        {
+            taskScheduler->ScheduleTask(TaskType::k_mainThread, [=](const TaskContext&) noexcept
+            {
+                const s64 maxModificationTime = s64(std::time(nullptr)) - k_checksumIndexMinFileAge;
+                
+                {
+                    std::unique_lock<std::mutex> lock(m_checksumIndexMutex);
+                    for(std::size_t i = 0; i < requests->size(); ++i)
+                    {
+                        const auto& request = (*requests)[i];
+                        if(request.m_modificationTime < maxModificationTime)
+                        {
+                            ChecksumIndexEntry& entry = m_checksumIndex[GetChecksumIndexKey(request.m_location, request.m_filePath)];
+                            entry.m_size = request.m_size;
+                            entry.m_modificationTime = request.m_modificationTime;
+                            entry.m_checksum = std::move((*checksums)[i]);
+                            m_checksumIndexDirty = true;
+                        }
+                    }
+                }
+                
+                in_completionDelegate();
+            });
+        });
+    }
+    //-----------------------------------------------------------
+    //-----------------------------------------------------------
+    void ContentManagementSystem::NotifyUpdateCheckComplete(CheckForUpdatesResult in_result)
+    {
+        //Reset the listener before calling it in case it starts another check
+        auto delegate = m_onUpdateCheckCompleteDelegate;
+        m_onUpdateCheckCompleteDelegate = nullptr;
+        
+        if(delegate)
+        {
+            delegate(in_result);
         }
     }
     //-----------------------------------------------------------
@@ -650,72 +1044,171 @@ namespace ChilliSource
     }
     //-----------------------------------------------------------
     //-----------------------------------------------------------
-    bool ContentManagementSystem::SavePackageToFile(const PackageDetails& in_packageDetails, const std::string& in_zippedPackage, bool in_fullyDownloaded)
+    bool ContentManagementSystem::WritePackageData(u32 in_packageIndex, const std::string& in_zippedPackageData)
     {
-        std::string strFile = k_tempDirectory + in_packageDetails.m_id + k_packageExtensionFull;
-
-        //Append to the file as it can take multiple writes
-        auto pFileStream = Application::Get()->GetFileSystem()->CreateBinaryOutputStream(StorageLocation::k_DLC, strFile, CS::FileWriteMode::k_append);
-        if (pFileStream == nullptr)
+        auto& fileStream = m_packageDownloads[in_packageIndex].m_fileStream;
+        if (fileStream == nullptr)
         {
-            CS_LOG_ERROR("CMS: " + in_packageDetails.m_id + " Couldn't write package.");
+            CS_LOG_ERROR("CMS: " + m_packageDetails[in_packageIndex].m_id + " Couldn't write package.");
             return false;
         }
 
-        pFileStream->Write(reinterpret_cast<const u8*>(in_zippedPackage.data()), (s32)in_zippedPackage.size());
-        pFileStream.reset();
+        if (!in_zippedPackageData.empty())
+        {
+            fileStream->Write(reinterpret_cast<const u8*>(in_zippedPackageData.data()), u64(in_zippedPackageData.size()));
+        }
         
-        //Check if the full file has been written and perform a checksum validation 
-        if(in_fullyDownloaded)
+        return true;
+    }
+    //-----------------------------------------------------------
+    //-----------------------------------------------------------
+    void ContentManagementSystem::ProcessPackage(u32 in_packageIndex, bool in_verifyChecksum)
+    {
+        m_packageDownloads[in_packageIndex].m_state = PackageState::k_processing;
+        
+        const PackageDetails packageDetails = m_packageDetails[in_packageIndex];
+        const std::string tempFilePath = GetTempPackageFilePath(packageDetails.m_id);
+        const u32 generation = m_downloadGeneration;
+        const std::string stagingDirectory = GetStagingDirectoryPath(packageDetails.m_id, generation);
+        m_packageDownloads[in_packageIndex].m_stagingDirectory = stagingDirectory;
+        
+        //Custom checksum delegates might not be thread-safe, so are called here on the main thread.
+        bool verifyInBackground = in_verifyChecksum;
+        if(in_verifyChecksum && m_checksumDelegate)
         {
-            std::string strChecksum = CalculateChecksum(StorageLocation::k_DLC, strFile);
-            if(strChecksum != in_packageDetails.m_checksum)
+            if(CalculateChecksum(StorageLocation::k_DLC, tempFilePath) != packageDetails.m_checksum)
             {
-                CS_LOG_ERROR("CMS: " + in_packageDetails.m_id + " Package download corrupted");
-                return false;
+                CS_LOG_ERROR("CMS: " + packageDetails.m_id + " Package download corrupted");
+                Application::Get()->GetFileSystem()->DeleteFile(StorageLocation::k_DLC, tempFilePath);
+                OnPackageProcessed(in_packageIndex, false);
+                return;
             }
+            
+            verifyInBackground = false;
         }
         
-        return true;
+        auto taskScheduler = Application::Get()->GetTaskScheduler();
+        taskScheduler->ScheduleTask(TaskType::k_file, [=](const TaskContext&) noexcept
+        {
+            bool success = true;
+            
+            if(verifyInBackground && CalculateChecksum(StorageLocation::k_DLC, tempFilePath) != packageDetails.m_checksum)
+            {
+                //The download can't be resumed from a corrupt file, so start again next time
+                CS_LOG_ERROR("CMS: " + packageDetails.m_id + " Package download corrupted");
+                Application::Get()->GetFileSystem()->DeleteFile(StorageLocation::k_DLC, tempFilePath);
+                success = false;
+            }
+            
+            if(success)
+            {
+                success = ExtractFilesFromPackage(packageDetails, stagingDirectory);
+            }
+            
+            taskScheduler->ScheduleTask(TaskType::k_mainThread, [=](const TaskContext&) noexcept
+            {
+                if(generation == m_downloadGeneration)
+                {
+                    OnPackageProcessed(in_packageIndex, success);
+                }
+            });
+        });
+    }
+    //-----------------------------------------------------------
+    //-----------------------------------------------------------
+    void ContentManagementSystem::OnPackageProcessed(u32 in_packageIndex, bool in_success)
+    {
+        CS_ASSERT(in_packageIndex < m_packageDownloads.size(), "Package index out of range");
+        
+        if(in_success)
+        {
+            m_packageDownloads[in_packageIndex].m_state = PackageState::k_ready;
+        }
+        else
+        {
+            m_packageDownloads[in_packageIndex].m_state = PackageState::k_failed;
+            m_downloadFailed = true;
+        }
+        
+        DownloadNextPackages();
+    }
+    //-----------------------------------------------------------
+    //-----------------------------------------------------------
+    void ContentManagementSystem::CheckDownloadUpdatesComplete()
+    {
+        if(!m_downloadInProgress)
+        {
+            return;
+        }
+        
+        for(const auto& packageDownload : m_packageDownloads)
+        {
+            switch(packageDownload.m_state)
+            {
+                case PackageState::k_downloading:
+                case PackageState::k_processing:
+                    return;
+                case PackageState::k_pending:
+                    if(!m_downloadFailed)
+                    {
+                        return;
+                    }
+                    break;
+                case PackageState::k_ready:
+                case PackageState::k_failed:
+                    break;
+            }
+        }
+        
+        //Don't overwrite the old manifest until all the content has been downloaded
+        m_downloadInProgress = false;
+        
+        if(m_onDownloadCompleteDelegate)
+        {
+            m_onDownloadCompleteDelegate(m_downloadFailed ? Result::k_failed : Result::k_succeeded);
+        }
     }
-
     //-----------------------------------------------------------
     //-----------------------------------------------------------
-    void ContentManagementSystem::ExtractFilesFromPackage(const ContentManagementSystem::PackageDetails& in_packageDetails) const
+    bool ContentManagementSystem::ExtractFilesFromPackage(const ContentManagementSystem::PackageDetails& in_packageDetails, const std::string& in_stagingDirectory) const
     {
         //Open zip
-        std::string strZipFilePath(m_contentDirectory + "/" + k_tempDirectory + in_packageDetails.m_id + k_packageExtensionFull);
+        std::string strZipFilePath(GetAbsoluteFilePath(StorageLocation::k_DLC, GetTempPackageFilePath(in_packageDetails.m_id)));
         
         unzFile ZippedFile = unzOpen(strZipFilePath.c_str());
         if(!ZippedFile)
         {
             CS_LOG_ERROR("CMS: Cannot unzip content package: " + in_packageDetails.m_id);
-            return;
+            return false;
         }
 
-        //Remove old content before installing the new stuff
-        DeleteDirectory(in_packageDetails.m_id);
+        //Remove anything staged by a previous attempt
+        auto fileSystem = Application::Get()->GetFileSystem();
+        DeleteDirectory(in_stagingDirectory);
+        fileSystem->CreateDirectoryPath(StorageLocation::k_DLC, in_stagingDirectory);
         
         //Go to the first file in the zip
         const u64 uddwFilenameLength = 256;
         s8 byaFileName[uddwFilenameLength];
         
+        //Files are streamed out through a fixed size buffer, rather than being loaded in full
+        std::unique_ptr<s8[]> dataBuffer(new s8[k_extractionChunkSize]);
+        bool success = true;
+        
         s32 dwStatus = unzGoToFirstFile(ZippedFile);
         
         while(dwStatus == UNZ_OK)
         {
             //Open the next file
             if (unzOpenCurrentFile(ZippedFile) != UNZ_OK)
+            {
+                success = false;
                 break;
+            }
             
             //Get file information
             unz_file_info FileInfo;
             unzGetCurrentFileInfo(ZippedFile, &FileInfo, byaFileName, uddwFilenameLength, nullptr, 0, nullptr, 0);
-            CS_ASSERT(FileInfo.uncompressed_size < static_cast<uLong>(std::numeric_limits<u32>::max()), "File is too large. It cannot exceed " + ToString(std::numeric_limits<u32>::max()) + " bytes.");
-            
-            //Load the file into memory and then save it out to the directory
-            s8* pbyDataBuffer =  new s8[FileInfo.uncompressed_size];
-            unzReadCurrentFile(ZippedFile, pbyDataBuffer, static_cast<unsigned>(FileInfo.uncompressed_size));
             
             //Create new stuff
             std::string strFilePath = std::string(byaFileName);
@@ -723,22 +1216,77 @@ namespace ChilliSource
             {
                 //There is a nested folder so we need to create the directory structure
                 std::string strPath = GetPathExcludingFileName(strFilePath);
-                Application::Get()->GetFileSystem()->CreateDirectoryPath(StorageLocation::k_DLC, "/" + strPath);
+                fileSystem->CreateDirectoryPath(StorageLocation::k_DLC, in_stagingDirectory + strPath);
             }
             
             if(IsFile(strFilePath))
             {
-                Application::Get()->GetFileSystem()->WriteFile(StorageLocation::k_DLC, "/" + strFilePath, pbyDataBuffer, static_cast<u32>(FileInfo.uncompressed_size));
+                auto fileStream = fileSystem->CreateBinaryOutputStream(StorageLocation::k_DLC, in_stagingDirectory + strFilePath);
+                if(fileStream == nullptr)
+                {
+                    CS_LOG_ERROR("CMS: Cannot write file from content package: " + strFilePath);
+                    success = false;
+                }
+                else
+                {
+                    s32 bytesRead = 0;
+                    while((bytesRead = unzReadCurrentFile(ZippedFile, dataBuffer.get(), k_extractionChunkSize)) > 0)
+                    {
+                        fileStream->Write(reinterpret_cast<const u8*>(dataBuffer.get()), u64(bytesRead));
+                    }
+                    
+                    if(bytesRead < 0)
+                    {
+                        CS_LOG_ERROR("CMS: Cannot unzip file from content package: " + strFilePath);
+                        success = false;
+                    }
+                }
             }
             
             //Close current file and jump to the next
-            CS_SAFEDELETE_ARRAY(pbyDataBuffer);
             unzCloseCurrentFile(ZippedFile);
+            
+            if(!success)
+            {
+                break;
+            }
+            
             dwStatus = unzGoToNextFile(ZippedFile);
         }
         
         //Close the zip
         unzClose(ZippedFile);
+        
+        return success;
+    }
+    //-----------------------------------------------------------
+    //-----------------------------------------------------------
+    void ContentManagementSystem::InstallStagedFiles(const std::string& in_stagingDirectory, const PackageDetails& in_packageDetails) const
+    {
+        auto fileSystem = Application::Get()->GetFileSystem();
+        
+        //Remove old content before installing the new stuff
+        DeleteDirectory(in_packageDetails.m_id);
+        
+        for(const auto& filePath : fileSystem->GetFilePaths(StorageLocation::k_DLC, in_stagingDirectory, true))
+        {
+            if(ContainsDirectoryPath(filePath))
+            {
+                fileSystem->CreateDirectoryPath(StorageLocation::k_DLC, "/" + GetPathExcludingFileName(filePath));
+            }
+            
+            //Some platforms can't rename over an existing file
+            if(fileSystem->DoesFileExist(StorageLocation::k_DLC, filePath))
+            {
+                fileSystem->DeleteFile(StorageLocation::k_DLC, filePath);
+            }
+            
+            //Moving the file is much cheaper than copying it, but copy if the move isn't possible
+            if(std::rename(GetAbsoluteFilePath(StorageLocation::k_DLC, in_stagingDirectory + filePath).c_str(), GetAbsoluteFilePath(StorageLocation::k_DLC, filePath).c_str()) != 0)
+            {
+                fileSystem->CopyFile(StorageLocation::k_DLC, in_stagingDirectory + filePath, StorageLocation::k_DLC, filePath);
+            }
+        }
     }
     //-----------------------------------------------------------
     //-----------------------------------------------------------
@@ -766,6 +1314,14 @@ namespace ChilliSource
     }
     //-----------------------------------------------------------
     //-----------------------------------------------------------
+    void ContentManagementSystem::SetMaxConcurrentDownloads(u32 in_maxConcurrentDownloads)
+    {
+        CS_ASSERT(in_maxConcurrentDownloads > 0, "Must allow at least one download at a time.");
+        
+        m_maxConcurrentDownloads = in_maxConcurrentDownloads;
+    }
+    //-----------------------------------------------------------
+    //-----------------------------------------------------------
     bool ContentManagementSystem::DoesFileExist(const std::string& in_filename, const std::string in_checksum, bool in_checkOnlyBundle) const
     {
         if(in_checkOnlyBundle)
@@ -791,17 +1347,32 @@ namespace ChilliSource
     }
     //-----------------------------------------------------------
     //-----------------------------------------------------------
-    void ContentManagementSystem::OnContentDownloadProgress(const std::string& in_url, f32 in_progress)
+    void ContentManagementSystem::OnContentDownloadProgress(u32 in_packageIndex, f32 in_progress)
     {
+        CS_ASSERT(in_packageIndex < m_packageDownloads.size(), "Package index out of range - " + ToString(in_packageIndex) + ", " + ToString((u32)m_packageDownloads.size()));
+        
+        const auto& package = m_packageDetails[in_packageIndex];
+        auto& packageDownload = m_packageDownloads[in_packageIndex];
+        
+        //Resumed downloads only report progress through the remaining data
+        f32 progress = in_progress;
+        if(packageDownload.m_resumeOffset > 0 && package.m_size > 0)
+        {
+            f32 resumedProgress = std::min(f32(packageDownload.m_resumeOffset) / f32(package.m_size), 1.0f);
+            progress = resumedProgress + in_progress * (1.0f - resumedProgress);
+        }
+        
+        packageDownload.m_progress = progress;
+        
         if(m_onDownloadProgressDelegate)
         {
-            CS_ASSERT(m_packageDetails.size() > m_currentPackageDownload,
-                      "Current package index out of range - " + ToString(m_currentPackageDownload) + ", " + ToString((u32)m_packageDetails.size()));
-            
-            f32 increment = 1.0f / m_packageDetails.size();
-            f32 totalProgress = m_currentPackageDownload * increment + (in_progress * increment);
+            f32 totalProgress = 0.0f;
+            for(const auto& download : m_packageDownloads)
+            {
+                totalProgress += download.m_progress;
+            }
             
-            m_onDownloadProgressDelegate(m_packageDetails[m_currentPackageDownload].m_id, totalProgress);
+            m_onDownloadProgressDelegate(package.m_id, totalProgress / m_packageDownloads.size());
         }
     }
     //-----------------------------------------------------------
@@ -890,9 +1461,9 @@ namespace ChilliSource
                         
                         alreadyCachedPackages.push_back(details);
                     }
-                    else
+                    else if(Application::Get()->GetFileSystem()->GetFileSize(StorageLocation::k_DLC, cachedFilePath) >= XMLUtils::GetAttributeValue<u32>(serverPackageEl, "Size", 0))
                     {
-                        //Cached package is corrupt/incomplete, remove it
+                        //Cached package is corrupt, remove it. Incomplete packages are kept so their download can be resumed.
                         Application::Get()->GetFileSystem()->DeleteFile(StorageLocation::k_DLC, cachedFilePath);
                     }
                 }
@@ -904,4 +1475,87 @@ namespace ChilliSource
         
         m_cachedPackageDetails = alreadyCachedPackages;
     }
+    //-----------------------------------------------------------
+    //-----------------------------------------------------------
+    void ContentManagementSystem::LoadChecksumIndex()
+    {
+        std::string contents;
+        if(!Application::Get()->GetFileSystem()->ReadFile(StorageLocation::k_DLC, k_checksumIndexFile, contents))
+        {
+            return;
+        }
+        
+        std::istringstream stream(contents);
+        
+        std::string header, version, algorithm;
+        stream >> header >> version >> algorithm;
+        if(header != "CSChecksumIndex" || version != k_checksumIndexVersion || algorithm != k_checksumIndexAlgorithm)
+        {
+            CS_LOG_WARNING("CMS: Discarding checksum index with unrecognised format.");
+            return;
+        }
+        
+        std::unique_lock<std::mutex> lock(m_checksumIndexMutex);
+        
+        u32 location = 0;
+        ChecksumIndexEntry entry;
+        std::string filePath;
+        while(stream >> location >> entry.m_size >> entry.m_modificationTime >> entry.m_checksum)
+        {
+            //The path is the remainder of the line as it may contain spaces.
+            stream.get();
+            std::getline(stream, filePath);
+            
+            if(location == u32(StorageLocation::k_none) || location > u32(StorageLocation::k_chilliSource) || filePath.empty())
+            {
+                continue;
+            }
+            
+            m_checksumIndex[GetChecksumIndexKey(StorageLocation(location), filePath)] = entry;
+        }
+    }
+    //-----------------------------------------------------------
+    //-----------------------------------------------------------
+    void ContentManagementSystem::SaveChecksumIndex()
+    {
+        std::unique_lock<std::mutex> lock(m_checksumIndexMutex);
+        
+        if(!m_checksumIndexDirty)
+        {
+            return;
+        }
+        
+        std::ostringstream stream;
+        stream << "CSChecksumIndex " << k_checksumIndexVersion << " " << k_checksumIndexAlgorithm << "\n";
+        
+        for(auto it = m_checksumIndex.begin(); it != m_checksumIndex.end();)
+        {
+            auto separator = it->first.find(':');
+            CS_ASSERT(separator != std::string::npos, "Invalid checksum index key.");
+            
+            u32 location = ParseU32(it->first.substr(0, separator));
+            std::string filePath = it->first.substr(separator + 1);
+            
+            //Drop anything which has since been removed or changed.
+            u64 size = 0;
+            s64 modificationTime = 0;
+            if(!GetFileStats(GetAbsoluteFilePath(StorageLocation(location), filePath), size, modificationTime) || size != it->second.m_size || modificationTime != it->second.m_modificationTime)
+            {
+                it = m_checksumIndex.erase(it);
+                continue;
+            }
+            
+            stream << location << " " << it->second.m_size << " " << it->second.m_modificationTime << " " << it->second.m_checksum << " " << filePath << "\n";
+            ++it;
+        }
+        
+        if(Application::Get()->GetFileSystem()->WriteFile(StorageLocation::k_DLC, k_checksumIndexFile, stream.str()))
+        {
+            m_checksumIndexDirty = false;
+        }
+        else
+        {
+            CS_LOG_WARNING("CMS: Failed to write checksum index.");
+        }
+    }
 }
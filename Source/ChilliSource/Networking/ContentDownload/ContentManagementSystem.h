@@ -31,10 +31,14 @@
 
 #include <ChilliSource/ChilliSource.h>
 #include <ChilliSource/Core/Event/Event.h>
+#include <ChilliSource/Core/File/FileStream/BinaryOutputStream.h>
 #include <ChilliSource/Core/System/AppSystem.h>
 #include <ChilliSource/Core/XML/XMLUtils.h>
 #include <ChilliSource/Networking/ContentDownload/IContentDownloader.h>
 
+#include <mutex>
+#include <unordered_map>
+
 namespace ChilliSource
 {
     //---------------------------------------------------------------
@@ -47,6 +51,8 @@ namespace ChilliSource
     {
     public:
         CS_DECLARE_NAMEDTYPE(ContentManagementSystem);
+        
+        static const u32 k_defaultMaxConcurrentDownloads = 3;
         //--------------------------------------------------------
         /// An enum describing the possible results from a Check
         /// For Updates request.
@@ -101,7 +107,9 @@ namespace ChilliSource
         //--------------------------------------------------------
         using DownloadProgressDelegate = std::function<void(const std::string& in_packageName, f32 in_progress)>;
         //-----------------------------------------------------------
-        /// Called when a checksum needs to be calculated.
+        /// Called when a checksum needs to be calculated. Checksums
+        /// calculated by a custom delegate are neither cached nor
+        /// calculated in parallel.
         ///
         /// @author N Tanda
         ///
@@ -151,6 +159,14 @@ namespace ChilliSource
         /// there are updates pending this function should be
         /// called to begin downloading any out of date content
         ///
+        /// Packages are streamed to temporary files, so only the
+        /// data which is in flight is held in memory. If the content
+        /// downloader supports it, several packages are downloaded
+        /// at once and interrupted downloads are resumed. Each
+        /// package is verified and unzipped to a staging area in the
+        /// background as soon as it has downloaded, while the
+        /// remaining downloads continue.
+        ///
         /// Call GetDownloadProgress to get the progress value
         /// to update any progress UI
         ///
@@ -162,7 +178,8 @@ namespace ChilliSource
         void DownloadUpdates(const CompleteDelegate& in_delegate, const DownloadProgressDelegate& in_progressDelegate);
         //-----------------------------------------------------------
         /// Having downloaded the update packages this method
-        /// unzips the packages and overwrites any old assets
+        /// moves the unzipped package contents into place,
+        /// overwriting any old assets
         ///
         /// @author S Downie
         ///
@@ -170,8 +187,8 @@ namespace ChilliSource
         //-----------------------------------------------------------
         void InstallUpdates(const CompleteDelegate& in_delegate);
         //-----------------------------------------------------------
-        /// Data is cached in memory and only written to disc
-        /// when the download is successful; at which point
+        /// Packages are downloaded to temp files and only installed
+        /// when all downloads are successful; at which point
         /// we can clear the data and delete any temp files
         ///
         /// @author S Downie
@@ -215,6 +232,15 @@ namespace ChilliSource
         /// @param The checksum calculation delegate
         //-----------------------------------------------------------
         void SetChecksumDelegate(const ChecksumDelegate& in_delegate);
+        //-----------------------------------------------------------
+        /// Sets the maximum number of packages which will be
+        /// downloaded at once. This is ignored if the content
+        /// downloader doesn't support concurrent downloads.
+        ///
+        /// @param The maximum number of concurrent downloads. Must
+        /// be at least 1.
+        //-----------------------------------------------------------
+        void SetMaxConcurrentDownloads(u32 in_maxConcurrentDownloads);
         
     private:
         //-----------------------------------------------------------
@@ -250,6 +276,51 @@ namespace ChilliSource
                 return false;
             }
         };
+        //-----------------------------------------------------------
+        /// The state of a package while updates are downloading.
+        //-----------------------------------------------------------
+        enum class PackageState
+        {
+            k_pending,
+            k_downloading,
+            k_processing,
+            k_ready,
+            k_failed
+        };
+        //-----------------------------------------------------------
+        /// The progress of a single package while updates are
+        /// downloading.
+        //-----------------------------------------------------------
+        struct PackageDownload final
+        {
+            PackageState m_state = PackageState::k_pending;
+            u64 m_resumeOffset = 0;
+            f32 m_progress = 0.0f;
+            BinaryOutputStreamUPtr m_fileStream;
+            std::string m_stagingDirectory;
+        };
+        //-----------------------------------------------------------
+        /// A previously calculated checksum along with the size and
+        /// modification time of the file at the time it was
+        /// calculated. If either has changed the checksum is stale.
+        //-----------------------------------------------------------
+        struct ChecksumIndexEntry final
+        {
+            u64 m_size = 0;
+            s64 m_modificationTime = 0;
+            std::string m_checksum;
+        };
+        //-----------------------------------------------------------
+        /// A file which will need its checksum calculated while
+        /// building the download list.
+        //-----------------------------------------------------------
+        struct ChecksumRequest final
+        {
+            StorageLocation m_location;
+            std::string m_filePath;
+            u64 m_size = 0;
+            s64 m_modificationTime = 0;
+        };
         //------------------------------------------------------------
         /// Initialisation method called at a time when all App Systems
         /// have been created. System initialisation occurs in the order
@@ -287,14 +358,17 @@ namespace ChilliSource
         //-----------------------------------------------------------
         void OnContentManifestDownloadComplete(IContentDownloader::Result in_result, const std::string& in_manifest);
         //-----------------------------------------------------------
-        /// The file has downloaded we can now save it to the cache
+        /// Data for a package has been received; write it to the
+        /// package's temp file, and once the download has completed
+        /// start verifying and extracting it.
         ///
         /// @author S Downie
         ///
+        /// @param Index in m_packageDetails
         /// @param Request result
         /// @param Request response
         //-----------------------------------------------------------
-        void OnContentDownloadComplete(IContentDownloader::Result in_result, const std::string& in_data);
+        void OnContentDownloadComplete(u32 in_packageIndex, IContentDownloader::Result in_result, const std::string& in_data);
         //-----------------------------------------------------------
         /// Check if an existing content manifest exists and
         /// construct a list of the files that require updating
@@ -306,6 +380,45 @@ namespace ChilliSource
         //-----------------------------------------------------------
         void BuildDownloadList(const std::string& in_serverManifest);
         //-----------------------------------------------------------
+        /// Compares the server manifest against the local manifest
+        /// to build the list of packages to download or remove, then
+        /// notifies the update check delegate. Any checksums required
+        /// should already have been calculated.
+        ///
+        /// @param The local manifest. May be null.
+        //-----------------------------------------------------------
+        void CompareManifests(const XML* in_currentManifest);
+        //-----------------------------------------------------------
+        /// Finds every file which CompareManifests() and
+        /// VerifyTemporaryDownloads() will need to checksum. This
+        /// mirrors the comparison: packages which are up to date
+        /// in the local manifest need their cached DLC files
+        /// verifying, all others are checked against the bundle.
+        ///
+        /// @param The root node of the server manifest.
+        /// @param The local manifest. May be null.
+        ///
+        /// @return The files which need checksums.
+        //-----------------------------------------------------------
+        std::vector<ChecksumRequest> GetChecksumRequests(XML::Node* in_serverManifestRoot, const XML* in_currentManifest) const;
+        //-----------------------------------------------------------
+        /// Calculates the checksums of any of the given files which
+        /// are not already in the checksum index. These are spread
+        /// across background threads and the results are added to
+        /// the index. Must be called on the main thread.
+        ///
+        /// @param The files which need checksums.
+        /// @param Called on the main thread once all checksums have
+        /// been calculated.
+        //-----------------------------------------------------------
+        void PrecalculateChecksums(std::vector<ChecksumRequest> in_requests, const std::function<void()>& in_completionDelegate);
+        //-----------------------------------------------------------
+        /// Notifies and then clears the update check delegate.
+        ///
+        /// @param The result of the update check.
+        //-----------------------------------------------------------
+        void NotifyUpdateCheckComplete(CheckForUpdatesResult in_result);
+        //-----------------------------------------------------------
         /// The package may be outdated in documents but are
         /// all the files in bundle up to date
         ///
@@ -315,25 +428,61 @@ namespace ChilliSource
         //-----------------------------------------------------------
         void AddToDownloadListIfNotInBundle(XML::Node* in_packageEl);
         //-----------------------------------------------------------
-        /// Save the zip file to documents directory
+        /// Appends downloaded data to the package's temp file.
         ///
         /// @author S Downie
         ///
-        /// @param Package details
-        /// @param Binary zip
-        /// @param Whether the file has finished downloading
+        /// @param Index in m_packageDetails
+        /// @param Binary zip data
         /// @return Success
         //-----------------------------------------------------------
-        bool SavePackageToFile(const PackageDetails& in_packageDetails, const std::string& in_zippedPackage, bool in_fullyDownloaded);
+        bool WritePackageData(u32 in_packageIndex, const std::string& in_zippedPackageData);
+        //-----------------------------------------------------------
+        /// Verifies the checksum of a fully downloaded package and
+        /// extracts it to the staging area. This is performed in
+        /// the background, and calls OnPackageProcessed() on the
+        /// main thread once finished.
+        ///
+        /// @param Index in m_packageDetails
+        /// @param Whether the checksum still needs verifying.
+        //-----------------------------------------------------------
+        void ProcessPackage(u32 in_packageIndex, bool in_verifyChecksum);
+        //-----------------------------------------------------------
+        /// Called on the main thread once a package has been
+        /// verified and extracted.
+        ///
+        /// @param Index in m_packageDetails
+        /// @param Whether the package was valid and extracted.
+        //-----------------------------------------------------------
+        void OnPackageProcessed(u32 in_packageIndex, bool in_success);
         //-----------------------------------------------------------
-        /// Unzip the package and save all the files to the
-        /// documents directory
+        /// Notifies the download complete delegate if there is
+        /// nothing left to download or process.
+        //-----------------------------------------------------------
+        void CheckDownloadUpdatesComplete();
+        //-----------------------------------------------------------
+        /// Unzip the package to its staging directory. Entries are
+        /// streamed out in fixed size chunks, so the memory used
+        /// doesn't depend on the size of the package. This is
+        /// thread-safe.
         ///
         /// @author S Downie
         ///
-        /// @param Zipped package
+        /// @param Package details
+        /// @param The staging directory to unzip to
+        ///
+        /// @return Whether the package was extracted.
         //-----------------------------------------------------------
-        void ExtractFilesFromPackage(const PackageDetails& in_packageDetails) const;
+        bool ExtractFilesFromPackage(const PackageDetails& in_packageDetails, const std::string& in_stagingDirectory) const;
+        //-----------------------------------------------------------
+        /// Replaces the package's installed files with those in the
+        /// given staging directory. Files are moved rather than copied
+        /// where the platform allows it.
+        ///
+        /// @param The staging directory
+        /// @param Package details
+        //-----------------------------------------------------------
+        void InstallStagedFiles(const std::string& in_stagingDirectory, const PackageDetails& in_packageDetails) const;
         //-----------------------------------------------------------
         /// Checks whether the file is within the application and if the
         /// the checksums match
@@ -361,29 +510,51 @@ namespace ChilliSource
         //-----------------------------------------------------------
         std::string CalculateChecksum(StorageLocation in_location, const std::string& in_filePath) const;
         //-----------------------------------------------------------
-        /// Perform the HTTP request for the next DLC package.
+        /// Calculate a checksum for the file by reading it in full,
+        /// ignoring both the checksum index and the custom delegate.
+        /// This is thread-safe.
+        ///
+        /// @param File location
+        /// @param File path
+        /// @return Checksum string
+        //-----------------------------------------------------------
+        std::string CalculateFileChecksum(StorageLocation in_location, const std::string& in_filePath) const;
+        //-----------------------------------------------------------
+        /// Loads the persisted checksum index from the DLC storage
+        /// location, if there is one.
+        //-----------------------------------------------------------
+        void LoadChecksumIndex();
+        //-----------------------------------------------------------
+        /// Writes the checksum index to the DLC storage location if
+        /// it has changed, dropping entries for files which no
+        /// longer exist.
+        //-----------------------------------------------------------
+        void SaveChecksumIndex();
+        //-----------------------------------------------------------
+        /// Starts downloading pending DLC packages until the
+        /// concurrent download limit is reached.
         ///
         /// @author S Downie
         //-----------------------------------------------------------
-        void DownloadNextPackage();
+        void DownloadNextPackages();
         //-----------------------------------------------------------
-        /// Perform the HTTP request for a DLC package.
+        /// Perform the HTTP request for a DLC package, resuming
+        /// from any partially downloaded temp file.
         ///
         /// @author HMcLaughlin
         ///
         /// @param in_packageIndex - Index in m_packageDetails
-        /// @param in_checkCached - [Optional] Check if already cached
         //-----------------------------------------------------------
-        void DownloadPackage(u32 in_packageIndex, bool in_checkCached = true);
+        void DownloadPackage(u32 in_packageIndex);
         //-----------------------------------------------------------
         /// Callback for package download progress
         ///
         /// @author HMcLaughlin
         ///
-        /// @param in_url - Url of downloading package
+        /// @param in_packageIndex - Index in m_packageDetails
         /// @param in_progress - Progress through download (0.0f - 1.0f)
         //-----------------------------------------------------------
-        void OnContentDownloadProgress(const std::string& in_url, f32 in_progress);
+        void OnContentDownloadProgress(u32 in_packageIndex, f32 in_progress);
         //-----------------------------------------------------------
         /// Checks if there is any incomplete downloads and refresh
         /// the temporary data
@@ -407,6 +578,7 @@ namespace ChilliSource
         std::vector<std::string> m_removePackageIds;
         std::vector<PackageDetails> m_packageDetails;
         std::vector<PackageDetails> m_cachedPackageDetails;
+        std::vector<PackageDownload> m_packageDownloads;
         
         u32	m_runningToDownloadTotal = 0;
         u32 m_runningDownloadedTotal = 0;
@@ -420,13 +592,19 @@ namespace ChilliSource
         DownloadProgressDelegate m_onDownloadProgressDelegate;
         ChecksumDelegate m_checksumDelegate;
         
+        mutable std::mutex m_checksumIndexMutex;
+        mutable std::unordered_map<std::string, ChecksumIndexEntry> m_checksumIndex;
+        mutable bool m_checksumIndexDirty = false;
+        
         std::string m_serverManifestData;
         std::string m_contentDirectory;
         
-        u32 m_currentPackageDownload = 0;
+        u32 m_maxConcurrentDownloads = k_defaultMaxConcurrentDownloads;
+        u32 m_downloadGeneration = 0;
         
         bool m_dlcCachePurged = false;
         bool m_downloadInProgress = false;
+        bool m_downloadFailed = false;
     };
 }
 
@@ -97,6 +97,33 @@ namespace ChilliSource
         //---------------------------------------------------------
         virtual void DownloadPackage(const std::string& in_url, const Delegate& in_delegate, const DownloadProgressDelegate& in_progressDelegate) = 0;
         //---------------------------------------------------------
+        /// Download the remainder of the package file from the given
+        /// URL, starting at the given byte offset. This is used to
+        /// resume interrupted downloads, so only data from the offset
+        /// onwards should be passed to the delegate. Only called if
+        /// SupportsResume() returns true.
+        ///
+        /// @param URL string
+        /// @param The offset in bytes to resume from.
+        /// @param Delegate
+        /// @param Download Progress Delegate
+        //---------------------------------------------------------
+        virtual void ResumePackageDownload(const std::string& in_url, u64 in_offset, const Delegate& in_delegate, const DownloadProgressDelegate& in_progressDelegate)
+        {
+            CS_LOG_FATAL("This content downloader doesn't support resuming downloads.");
+        }
+        //---------------------------------------------------------
+        /// @return Whether or not the downloader can resume package
+        /// downloads from an offset.
+        //---------------------------------------------------------
+        virtual bool SupportsResume() const { return false; }
+        //---------------------------------------------------------
+        /// @return Whether or not the downloader can have more than
+        /// one package download in progress at once. If it can't,
+        /// packages are downloaded one after another.
+        //---------------------------------------------------------
+        virtual bool SupportsConcurrentDownloads() const { return false; }
+        //---------------------------------------------------------
         /// The destructor.
         ///
         /// @author S Downie
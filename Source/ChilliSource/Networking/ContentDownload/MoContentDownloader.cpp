@@ -35,6 +35,8 @@
 
 #include <json/json.h>
 
+#include <algorithm>
+
 namespace ChilliSource
 {
     const f32 k_downloadProgressUpdateIntervalDefault = 1.0f / 30.0f;
@@ -88,20 +90,45 @@ namespace ChilliSource
     //----------------------------------------------------------------
     void MoContentDownloader::DownloadPackage(const std::string& in_url, const Delegate& in_completiondelegate, const DownloadProgressDelegate& in_progressDelegate)
     {
-        mOnContentDownloadCompleteDelegate = in_completiondelegate;
-        mpCurrentRequest = mpHttpRequestSystem->MakeGetRequest(in_url, MakeDelegate(this, &MoContentDownloader::OnContentDownloadComplete));
+        ResumePackageDownload(in_url, 0, in_completiondelegate, in_progressDelegate);
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void MoContentDownloader::ResumePackageDownload(const std::string& in_url, u64 in_offset, const Delegate& in_completiondelegate, const DownloadProgressDelegate& in_progressDelegate)
+    {
+        PackageDownload packageDownload;
+        packageDownload.m_url = in_url;
+        packageDownload.m_completionDelegate = in_completiondelegate;
+        packageDownload.m_progressDelegate = in_progressDelegate;
+        packageDownload.m_resumeOffset = in_offset;
         
-        //Reset the timer
-        m_downloadProgressUpdateTimer->Reset();
-        m_downloadProgressEventConnection = m_downloadProgressUpdateTimer->OpenConnection(k_downloadProgressUpdateIntervalDefault, [=]()
+        ParamDictionary headers;
+        if(in_offset > 0)
         {
-            if(in_progressDelegate)
-            {
-                in_progressDelegate(in_url, GetDownloadProgress());
-            }
-        });
+            headers.SetValue("Range", "bytes=" + ToString(in_offset) + "-");
+        }
+        
+        //The package is streamed so that it is written out in chunks rather than buffered in memory in full
+        auto request = mpHttpRequestSystem->MakeStreamedGetRequest(in_url, headers, MakeDelegate(this, &MoContentDownloader::OnContentDownloadData), MakeDelegate(this, &MoContentDownloader::OnContentDownloadComplete));
+        m_packageDownloads.emplace(request, std::move(packageDownload));
         
-        m_downloadProgressUpdateTimer->Start();
+        //A single timer reports the progress of every download in flight
+        if(m_downloadProgressEventConnection == nullptr)
+        {
+            m_downloadProgressUpdateTimer->Reset();
+            m_downloadProgressEventConnection = m_downloadProgressUpdateTimer->OpenConnection(k_downloadProgressUpdateIntervalDefault, [=]()
+            {
+                for(const auto& pair : m_packageDownloads)
+                {
+                    if(pair.second.m_progressDelegate)
+                    {
+                        pair.second.m_progressDelegate(pair.second.m_url, GetDownloadProgress(pair.first));
+                    }
+                }
+            });
+            
+            m_downloadProgressUpdateTimer->Start();
+        }
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
@@ -161,45 +188,68 @@ namespace ChilliSource
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    void MoContentDownloader::OnContentDownloadComplete(const HttpRequest* in_request, const HttpResponse& in_response)
+    void MoContentDownloader::OnContentDownloadData(const HttpRequest* in_request, u32 in_responseCode, const u8* in_data, u32 in_dataSize)
     {
-        if(in_response.GetResult() != HttpResponse::Result::k_flushed)
+        auto it = m_packageDownloads.find(in_request);
+        CS_ASSERT(it != m_packageDownloads.end(), "Received data for an unknown package download.");
+        
+        //If the server ignored the range request and sent the whole file, the part which has
+        //already been downloaded needs to be skipped.
+        if(it->second.m_hasReceivedData == false)
         {
-            if(mpCurrentRequest == in_request)
+            it->second.m_hasReceivedData = true;
+            if(it->second.m_resumeOffset > 0 && in_responseCode != HttpResponseCode::k_partialContent)
             {
-                mpCurrentRequest = nullptr;
+                it->second.m_bytesToSkip = it->second.m_resumeOffset;
             }
+        }
         
-            if(m_downloadProgressUpdateTimer)
-            {
-                m_downloadProgressEventConnection.reset();
-                m_downloadProgressUpdateTimer->Stop();
-            }
+        if(it->second.m_bytesToSkip > 0)
+        {
+            auto numSkipped = u32(std::min(it->second.m_bytesToSkip, u64(in_dataSize)));
+            in_data += numSkipped;
+            in_dataSize -= numSkipped;
+            it->second.m_bytesToSkip -= numSkipped;
+        }
+        
+        if(in_dataSize > 0)
+        {
+            auto completionDelegate = it->second.m_completionDelegate;
+            completionDelegate(Result::k_flushed, std::string(reinterpret_cast<const char*>(in_data), in_dataSize));
+        }
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    void MoContentDownloader::OnContentDownloadComplete(const HttpRequest* in_request, HttpResponse& in_response)
+    {
+        auto it = m_packageDownloads.find(in_request);
+        CS_ASSERT(it != m_packageDownloads.end(), "Received a response for an unknown package download.");
+        
+        auto completionDelegate = it->second.m_completionDelegate;
+        m_packageDownloads.erase(it);
+        
+        if(m_packageDownloads.empty() && m_downloadProgressUpdateTimer)
+        {
+            m_downloadProgressEventConnection.reset();
+            m_downloadProgressUpdateTimer->Stop();
         }
         
         switch(in_response.GetResult())
         {
             case HttpResponse::Result::k_completed:
             {
-                // Check the response code for errors
-                switch(in_response.GetCode())
-                {
-                    default:   //OK
-                    case HttpResponseCode::k_ok:
-                        mOnContentDownloadCompleteDelegate(Result::k_succeeded, in_response.GetDataAsString());
-                        break;
-                }
+                completionDelegate(Result::k_succeeded, std::string());
                 break;
             }
             case HttpResponse::Result::k_timeout:
             case HttpResponse::Result::k_failed:
             {
-                mOnContentDownloadCompleteDelegate(Result::k_failed, in_response.GetDataAsString());
+                completionDelegate(Result::k_failed, std::string());
                 break;
             }
             case HttpResponse::Result::k_flushed:
             {
-                mOnContentDownloadCompleteDelegate(Result::k_flushed, in_response.GetDataAsString());
+                //Streamed requests pass all data to OnContentDownloadData()
                 break;
             }
         }
@@ -207,17 +257,32 @@ namespace ChilliSource
     //----------------------------------------------------------------
     //----------------------------------------------------------------
     f32 MoContentDownloader::GetDownloadProgress() const
+    {
+        u64 downloadedBytes = 0;
+        u64 expectedBytes = 0;
+        
+        for(const auto& pair : m_packageDownloads)
+        {
+            downloadedBytes += pair.first->GetDownloadedBytes();
+            expectedBytes += pair.first->GetExpectedSize();
+        }
+        
+        if(expectedBytes == 0)
+        {
+            return 0.0f;
+        }
+        
+        return (f32)downloadedBytes / (f32)expectedBytes;
+    }
+    //----------------------------------------------------------------
+    //----------------------------------------------------------------
+    f32 MoContentDownloader::GetDownloadProgress(const HttpRequest* in_request) const
     {
         f32 progress = 0.0f;
         
-        // Check if there is an active request
-        if(mpCurrentRequest)
+        if(in_request->GetExpectedSize() > 0)
         {
-            if(mpCurrentRequest->GetExpectedSize() > 0)
-            {
-                // Calculate current scene download progress
-                progress = (f32)mpCurrentRequest->GetDownloadedBytes() / (f32)mpCurrentRequest->GetExpectedSize();
-            }
+            progress = (f32)in_request->GetDownloadedBytes() / (f32)in_request->GetExpectedSize();
         }
         
         return progress;
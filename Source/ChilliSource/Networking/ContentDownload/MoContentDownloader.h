@@ -34,6 +34,8 @@
 #include <ChilliSource/Networking/ContentDownload/IContentDownloader.h>
 #include <ChilliSource/Networking/Http/HttpRequestSystem.h>
 
+#include <unordered_map>
+
 namespace ChilliSource
 {
     class MoContentDownloader final : public IContentDownloader
@@ -67,6 +69,27 @@ namespace ChilliSource
         //----------------------------------------------------------------
         void DownloadPackage(const std::string& in_url, const Delegate& in_completiondelegate, const DownloadProgressDelegate& in_progressDelegate);
         //----------------------------------------------------------------
+        /// Download the remainder of the package file from the given URL
+        /// using a http Range request. If the server ignores the range
+        /// and sends the whole file, the leading bytes are discarded.
+        ///
+        /// @param in_url - Url to download
+        /// @param in_offset - The offset in bytes to resume from
+        /// @param in_completiondelegate - Delegate to call on completion
+        /// @param in_progressDelegate - Download Progress Delegate
+        //----------------------------------------------------------------
+        void ResumePackageDownload(const std::string& in_url, u64 in_offset, const Delegate& in_completiondelegate, const DownloadProgressDelegate& in_progressDelegate);
+        //----------------------------------------------------------------
+        /// @return Whether or not the downloader can resume package
+        /// downloads from an offset.
+        //----------------------------------------------------------------
+        bool SupportsResume() const { return true; }
+        //----------------------------------------------------------------
+        /// @return Whether or not the downloader can have more than one
+        /// package download in progress at once.
+        //----------------------------------------------------------------
+        bool SupportsConcurrentDownloads() const { return true; }
+        //----------------------------------------------------------------
         /// Get Tags
         ///
         /// @return The current tags of this downloader
@@ -81,11 +104,30 @@ namespace ChilliSource
         //------------------------------------------------------------
         /// @author HMcLaughlin
         ///
-        /// @return The progress of the current package
+        /// @return The combined progress of all packages currently
+        /// being downloaded
         //------------------------------------------------------------
         f32 GetDownloadProgress() const;
         
     private:
+        //----------------------------------------------------------------
+        /// The state of a single package download which is in progress.
+        //----------------------------------------------------------------
+        struct PackageDownload final
+        {
+            std::string m_url;
+            Delegate m_completionDelegate;
+            DownloadProgressDelegate m_progressDelegate;
+            u64 m_resumeOffset = 0;
+            u64 m_bytesToSkip = 0;
+            bool m_hasReceivedData = false;
+        };
+        //----------------------------------------------------------------
+        /// @param in_request - A package download request
+        ///
+        /// @return The progress of the given request's download
+        //----------------------------------------------------------------
+        f32 GetDownloadProgress(const HttpRequest* in_request) const;
         //----------------------------------------------------------------
         /// Triggered when the manifest download has completed
         ///
@@ -96,14 +138,26 @@ namespace ChilliSource
         //----------------------------------------------------------------
         void OnContentManifestDownloadComplete(const HttpRequest* in_request, const HttpResponse& in_response);
         //----------------------------------------------------------------
-        /// Triggered when a package download has completed
+        /// Triggered with each chunk of package data as it is received.
+        /// The chunk is passed straight on to the completion delegate as
+        /// flushed data, so the package is never held in memory in full.
+        ///
+        /// @param Original request
+        /// @param The response code
+        /// @param The chunk of response data
+        /// @param The size of the chunk in bytes
+        //----------------------------------------------------------------
+        void OnContentDownloadData(const HttpRequest* in_request, u32 in_responseCode, const u8* in_data, u32 in_dataSize);
+        //----------------------------------------------------------------
+        /// Triggered when a package download has completed. All data
+        /// has already been passed on by OnContentDownloadData().
         ///
         /// @author S Downie
         ///
         /// @param Original request
         /// @param Request response
         //----------------------------------------------------------------
-        void OnContentDownloadComplete(const HttpRequest* in_request, const HttpResponse& in_response);
+        void OnContentDownloadComplete(const HttpRequest* in_request, HttpResponse& in_response);
         
     private:
         
@@ -111,11 +165,10 @@ namespace ChilliSource
         
         std::string mstrAssetServerURL;
         Delegate mOnContentManifestDownloadCompleteDelegate;
-        Delegate mOnContentDownloadCompleteDelegate;
         
         HttpRequestSystem* mpHttpRequestSystem;
         
-        HttpRequest* mpCurrentRequest;
+        std::unordered_map<const HttpRequest*, PackageDownload> m_packageDownloads;
         
         TimerSPtr m_downloadProgressUpdateTimer;
         EventConnectionUPtr m_downloadProgressEventConnection;
@@ -47,6 +47,9 @@ namespace ChilliSource
     CS_FORWARDDECLARE_CLASS(HttpRequestSystem);
     CS_FORWARDDECLARE_CLASS(HttpRequest);
     CS_FORWARDDECLARE_CLASS(HttpResponse);
+    CS_FORWARDDECLARE_CLASS(IHttpResponseSink);
+    CS_FORWARDDECLARE_CLASS(FileHttpResponseSink);
+    CS_FORWARDDECLARE_CLASS(ByteBufferHttpResponseSink);
     //--------------------------------------------------
     /// IAP
     //--------------------------------------------------
@@ -31,8 +31,11 @@
 #define _CHILLISOURCE_NETWORKING_HTTP_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Networking/Http/ByteBufferHttpResponseSink.h>
+#include <ChilliSource/Networking/Http/FileHttpResponseSink.h>
 #include <ChilliSource/Networking/Http/HttpRequest.h>
 #include <ChilliSource/Networking/Http/HttpRequestSystem.h>
 #include <ChilliSource/Networking/Http/HttpResponse.h>
+#include <ChilliSource/Networking/Http/IHttpResponseSink.h>
 
 #endif
@@ -0,0 +1,83 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Networking/Http/ByteBufferHttpResponseSink.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace ChilliSource
+{
+    //------------------------------------------------------------------------------
+    ByteBufferHttpResponseSink::ByteBufferHttpResponseSink(u32 expectedSize) noexcept
+        : m_capacity(expectedSize)
+    {
+        if (m_capacity > 0)
+        {
+            m_data.reset(new u8[m_capacity]);
+        }
+    }
+    
+    //------------------------------------------------------------------------------
+    void ByteBufferHttpResponseSink::Write(const u8* data, u32 dataSize) noexcept
+    {
+        if (dataSize == 0)
+        {
+            return;
+        }
+        
+        if (m_size + dataSize > m_capacity)
+        {
+            //The expected size was wrong, so fall back on growing geometrically.
+            m_capacity = std::max(m_size + dataSize, m_capacity * 2);
+            
+            std::unique_ptr<u8[]> newData(new u8[m_capacity]);
+            if (m_size > 0)
+            {
+                std::memcpy(newData.get(), m_data.get(), m_size);
+            }
+            m_data = std::move(newData);
+        }
+        
+        std::memcpy(m_data.get() + m_size, data, dataSize);
+        m_size += dataSize;
+    }
+    
+    //------------------------------------------------------------------------------
+    void ByteBufferHttpResponseSink::OnComplete(HttpResponse::Result result) noexcept
+    {
+        m_isComplete = (result == HttpResponse::Result::k_completed);
+    }
+    
+    //------------------------------------------------------------------------------
+    ByteBufferUPtr ByteBufferHttpResponseSink::ClaimByteBuffer() noexcept
+    {
+        ByteBufferUPtr byteBuffer(new ByteBuffer(std::unique_ptr<const u8[]>(m_data.release()), m_size));
+        
+        m_capacity = 0;
+        m_size = 0;
+        
+        return byteBuffer;
+    }
+}
@@ -0,0 +1,89 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_NETWORKING_HTTP_BYTEBUFFERHTTPRESPONSESINK_H_
+#define _CHILLISOURCE_NETWORKING_HTTP_BYTEBUFFERHTTPRESPONSESINK_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Base/ByteBuffer.h>
+#include <ChilliSource/Networking/Http/IHttpResponseSink.h>
+
+#include <memory>
+
+namespace ChilliSource
+{
+    /// An http response sink which writes the response body into a single pre-sized buffer.
+    /// If the expected size of the response is known up front this avoids both re-allocating
+    /// as the data arrives and copying it once the request has completed, as the buffer can
+    /// be claimed as a ByteBuffer.
+    ///
+    /// This is not thread-safe and should only be used on the main thread.
+    ///
+    class ByteBufferHttpResponseSink final : public IHttpResponseSink
+    {
+    public:
+        /// @param expectedSize
+        ///     The expected size of the response in bytes. The buffer will grow if the
+        ///     response is larger than this.
+        ///
+        ByteBufferHttpResponseSink(u32 expectedSize) noexcept;
+        
+        /// @return The number of bytes which have been written to the buffer.
+        ///
+        u32 GetSize() const noexcept { return m_size; }
+        
+        /// @return Whether or not the request completed successfully. If this is false the
+        ///     buffer contains a partial response.
+        ///
+        bool IsComplete() const noexcept { return m_isComplete; }
+        
+        /// Writes the given chunk of response data to the buffer, growing it if required.
+        ///
+        /// @param data
+        ///     The chunk of response data.
+        /// @param dataSize
+        ///     The size of the chunk in bytes.
+        ///
+        void Write(const u8* data, u32 dataSize) noexcept override;
+        
+        /// @param result
+        ///     The result of the request.
+        ///
+        void OnComplete(HttpResponse::Result result) noexcept override;
+        
+        /// Moves the response data out of the sink, leaving it empty.
+        ///
+        /// @return The response data.
+        ///
+        ByteBufferUPtr ClaimByteBuffer() noexcept;
+        
+    private:
+        std::unique_ptr<u8[]> m_data;
+        u32 m_capacity = 0;
+        u32 m_size = 0;
+        bool m_isComplete = false;
+    };
+}
+
+#endif
@@ -0,0 +1,59 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include <ChilliSource/Networking/Http/FileHttpResponseSink.h>
+
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/File/FileSystem.h>
+
+namespace ChilliSource
+{
+    //------------------------------------------------------------------------------
+    FileHttpResponseSink::FileHttpResponseSink(StorageLocation storageLocation, const std::string& filePath, FileWriteMode fileMode) noexcept
+    {
+        m_fileStream = Application::Get()->GetFileSystem()->CreateBinaryOutputStream(storageLocation, filePath, fileMode);
+        m_isValid = (m_fileStream != nullptr);
+        
+        if (!m_isValid)
+        {
+            CS_LOG_ERROR("FileHttpResponseSink: Could not open file '" + filePath + "'.");
+        }
+    }
+    
+    //------------------------------------------------------------------------------
+    void FileHttpResponseSink::Write(const u8* data, u32 dataSize) noexcept
+    {
+        if (m_fileStream)
+        {
+            m_fileStream->Write(data, u64(dataSize));
+            m_bytesWritten += dataSize;
+        }
+    }
+    
+    //------------------------------------------------------------------------------
+    void FileHttpResponseSink::OnComplete(HttpResponse::Result result) noexcept
+    {
+        m_fileStream.reset();
+    }
+}
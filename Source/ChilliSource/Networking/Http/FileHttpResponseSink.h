@@ -0,0 +1,86 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_NETWORKING_HTTP_FILEHTTPRESPONSESINK_H_
+#define _CHILLISOURCE_NETWORKING_HTTP_FILEHTTPRESPONSESINK_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/File/FileStream/BinaryOutputStream.h>
+#include <ChilliSource/Core/File/FileStream/FileWriteMode.h>
+#include <ChilliSource/Networking/Http/IHttpResponseSink.h>
+
+namespace ChilliSource
+{
+    /// An http response sink which writes the response body directly to file, so the body is
+    /// never held in memory in full. The file is closed once the request completes.
+    ///
+    /// This is not thread-safe and should only be used on the main thread.
+    ///
+    class FileHttpResponseSink final : public IHttpResponseSink
+    {
+    public:
+        /// Opens the file which the response will be written to.
+        ///
+        /// @param storageLocation
+        ///     The storage location of the file.
+        /// @param filePath
+        ///     The file path.
+        /// @param fileMode
+        ///     Whether the response should overwrite the file or be appended to it.
+        ///
+        FileHttpResponseSink(StorageLocation storageLocation, const std::string& filePath, FileWriteMode fileMode = FileWriteMode::k_overwrite) noexcept;
+        
+        /// @return Whether or not the file could be opened and all data has been written
+        ///     to it so far.
+        ///
+        bool IsValid() const noexcept { return m_isValid; }
+        
+        /// @return The number of bytes which have been written to the file.
+        ///
+        u64 GetBytesWritten() const noexcept { return m_bytesWritten; }
+        
+        /// Writes the given chunk of response data to file.
+        ///
+        /// @param data
+        ///     The chunk of response data.
+        /// @param dataSize
+        ///     The size of the chunk in bytes.
+        ///
+        void Write(const u8* data, u32 dataSize) noexcept override;
+        
+        /// Closes the file.
+        ///
+        /// @param result
+        ///     The result of the request.
+        ///
+        void OnComplete(HttpResponse::Result result) noexcept override;
+        
+    private:
+        BinaryOutputStreamUPtr m_fileStream;
+        bool m_isValid = false;
+        u64 m_bytesWritten = 0;
+    };
+}
+
+#endif
@@ -63,11 +63,22 @@ namespace ChilliSource
         /// Delegate called when the request completes (either with success of failure)
         ///
         /// @param Original request
-        /// @param Request response
+        /// @param Request response. This is mutable so that the data can be claimed by
+        /// the receiver rather than copied.
         ///
         /// @author S Downie
         //----------------------------------------------------------------------------------------
-        typedef std::function<void(const HttpRequest*, const HttpResponse&)> Delegate;
+        typedef std::function<void(const HttpRequest*, HttpResponse&)> Delegate;
+        //----------------------------------------------------------------------------------------
+        /// Delegate called with each chunk of the response body of a streamed request, in the
+        /// order it was received. The data is only valid for the duration of the call.
+        ///
+        /// @param Original request
+        /// @param The response code
+        /// @param The chunk of response data
+        /// @param The size of the chunk in bytes
+        //----------------------------------------------------------------------------------------
+        typedef std::function<void(const HttpRequest*, u32, const u8*, u32)> DataDelegate;
         //----------------------------------------------------------------------------------------
         /// Constructor
         ///
@@ -28,6 +28,9 @@
 
 #include <ChilliSource/Networking/Http/HttpRequestSystem.h>
 
+#include <ChilliSource/Networking/Http/HttpResponse.h>
+#include <ChilliSource/Networking/Http/IHttpResponseSink.h>
+
 #ifdef CS_TARGETPLATFORM_IOS
 #include <CSBackend/Platform/iOS/Networking/Http/HttpRequestSystem.h>
 #endif
@@ -67,6 +70,71 @@ namespace ChilliSource
         return nullptr;
     }
     //--------------------------------------------------------------------------------------------------
+    //--------------------------------------------------------------------------------------------------
+    HttpRequest* HttpRequestSystem::MakeStreamedGetRequest(const std::string& in_url, const ParamDictionary& in_headers, const HttpRequest::DataDelegate& in_dataDelegate, const HttpRequest::Delegate& in_delegate, u32 in_timeoutSecs)
+    {
+        CS_ASSERT(in_dataDelegate, "Streamed http request cannot have null data delegate");
+        CS_ASSERT(in_delegate, "Http request cannot have null delegate");
+        
+        HttpRequest::Delegate streamDelegate = [=](const HttpRequest* in_request, HttpResponse& in_response)
+        {
+            switch(in_response.GetResult())
+            {
+                case HttpResponse::Result::k_flushed:
+                {
+                    if(in_response.GetDataSize() > 0)
+                    {
+                        in_dataDelegate(in_request, in_response.GetCode(), in_response.GetData(), in_response.GetDataSize());
+                    }
+                    break;
+                }
+                case HttpResponse::Result::k_completed:
+                {
+                    if(in_response.GetDataSize() > 0)
+                    {
+                        in_dataDelegate(in_request, in_response.GetCode(), in_response.GetData(), in_response.GetDataSize());
+                    }
+                    
+                    HttpResponse response(in_response.GetResult(), in_response.GetCode(), std::string());
+                    in_delegate(in_request, response);
+                    break;
+                }
+                case HttpResponse::Result::k_failed:
+                case HttpResponse::Result::k_timeout:
+                {
+                    in_delegate(in_request, in_response);
+                    break;
+                }
+            }
+        };
+        
+        //Streamed responses are only passed on when the buffer is flushed, so make sure it will be.
+        m_isMakingStreamedRequest = true;
+        HttpRequest* request = MakeGetRequest(in_url, in_headers, streamDelegate, in_timeoutSecs);
+        m_isMakingStreamedRequest = false;
+        
+        return request;
+    }
+    //--------------------------------------------------------------------------------------------------
+    //--------------------------------------------------------------------------------------------------
+    HttpRequest* HttpRequestSystem::MakeStreamedGetRequest(const std::string& in_url, const ParamDictionary& in_headers, const IHttpResponseSinkSPtr& in_sink, const HttpRequest::Delegate& in_delegate, u32 in_timeoutSecs)
+    {
+        CS_ASSERT(in_sink, "Streamed http request cannot have null sink");
+        CS_ASSERT(in_delegate, "Http request cannot have null delegate");
+        
+        IHttpResponseSinkSPtr sink = in_sink;
+        
+        return MakeStreamedGetRequest(in_url, in_headers, [=](const HttpRequest* in_request, u32 in_responseCode, const u8* in_data, u32 in_dataSize)
+        {
+            sink->Write(in_data, in_dataSize);
+        },
+        [=](const HttpRequest* in_request, HttpResponse& in_response)
+        {
+            sink->OnComplete(in_response.GetResult());
+            in_delegate(in_request, in_response);
+        }, in_timeoutSecs);
+    }
+    //--------------------------------------------------------------------------------------------------
     /// @author S Downie
     ///
     /// @param The number of bytes read before the buffer is flushed (0 is infinite)
@@ -79,6 +147,23 @@ namespace ChilliSource
     //--------------------------------------------------------------------------------------------------
     u32 HttpRequestSystem::GetMaxBufferSize() const
     {
+        if(m_isMakingStreamedRequest && m_maxBufferSize == 0)
+        {
+            return k_defaultStreamBufferSize;
+        }
+        
         return m_maxBufferSize;
     }
+    //--------------------------------------------------------------------------------------------------
+    //--------------------------------------------------------------------------------------------------
+    void HttpRequestSystem::SetMaxConnectionsPerHost(u32 in_maxConnections)
+    {
+        m_maxConnectionsPerHost = in_maxConnections;
+    }
+    //--------------------------------------------------------------------------------------------------
+    //--------------------------------------------------------------------------------------------------
+    u32 HttpRequestSystem::GetMaxConnectionsPerHost() const
+    {
+        return m_maxConnectionsPerHost;
+    }
 }
@@ -44,6 +44,7 @@ namespace ChilliSource
     namespace HttpResponseCode
     {
         const u32 k_ok = 200;
+        const u32 k_partialContent = 206;
         const u32 k_redirect = 301;
         const u32 k_movedTemporarily = 302;
         const u32 k_redirectTemporarily = 307;
@@ -68,6 +69,7 @@ namespace ChilliSource
         CS_DECLARE_NAMEDTYPE(HttpRequestSystem);
         
         static const u32 k_defaultTimeoutSecs = 15;
+        static const u32 k_defaultStreamBufferSize = 64 * 1024;
         
         //----------------------------------------------------------------------------------------
         /// Delegate called when a reachability request completes (either with success of failure)
@@ -139,6 +141,38 @@ namespace ChilliSource
         //--------------------------------------------------------------------------------------------------
         virtual HttpRequest* MakePostRequest(const std::string& in_url, const std::string& in_body, const ParamDictionary& in_headers, const HttpRequest::Delegate& in_delegate, u32 in_timeoutSecs = k_defaultTimeoutSecs) = 0;
         //--------------------------------------------------------------------------------------------------
+        /// Causes the system to issue an Http GET request, the body of which is passed to the data
+        /// delegate in chunks as it is received rather than being buffered in the response. Chunks are
+        /// the size of the max buffer size, or k_defaultStreamBufferSize if that is unlimited.
+        ///
+        /// The completion delegate is called once all data has been received and will not contain any
+        /// response data. If the request fails part way through then some data may already have been
+        /// passed to the data delegate.
+        ///
+        /// @param URL
+        /// @param Key value headers to attach to the request
+        /// @param Delegate that is called with each chunk of response data.
+        /// @param Delegate that is called on request completed. Completion can be failure as well as success
+        /// @param Request timeout in seconds
+        ///
+        /// @return A pointer to the request. The system owns this pointer.
+        //--------------------------------------------------------------------------------------------------
+        HttpRequest* MakeStreamedGetRequest(const std::string& in_url, const ParamDictionary& in_headers, const HttpRequest::DataDelegate& in_dataDelegate, const HttpRequest::Delegate& in_delegate, u32 in_timeoutSecs = k_defaultTimeoutSecs);
+        //--------------------------------------------------------------------------------------------------
+        /// Causes the system to issue an Http GET request, the body of which is written to the given
+        /// sink as it is received. The sink is notified of the result before the completion delegate
+        /// is called. See the data delegate version for details.
+        ///
+        /// @param URL
+        /// @param Key value headers to attach to the request
+        /// @param The sink the response data will be written to.
+        /// @param Delegate that is called on request completed. Completion can be failure as well as success
+        /// @param Request timeout in seconds
+        ///
+        /// @return A pointer to the request. The system owns this pointer.
+        //--------------------------------------------------------------------------------------------------
+        HttpRequest* MakeStreamedGetRequest(const std::string& in_url, const ParamDictionary& in_headers, const IHttpResponseSinkSPtr& in_sink, const HttpRequest::Delegate& in_delegate, u32 in_timeoutSecs = k_defaultTimeoutSecs);
+        //--------------------------------------------------------------------------------------------------
         /// Equivalent to calling cancel on every incomplete request in progress.
         ///
         /// @author S Downie
@@ -158,19 +192,34 @@ namespace ChilliSource
         /// @param The number of bytes read before the buffer is flushed (0 is unlimited)
         //--------------------------------------------------------------------------------------------------
         void SetMaxBufferSize(u32 in_sizeInBytes);
+        //--------------------------------------------------------------------------------------------------
+        /// Sets the maximum number of connections which will be open to a single host at once. Any
+        /// further requests to that host are queued until a connection is free. This is currently only
+        /// respected on Raspberry Pi; other platforms use the limits of the native http stack.
+        ///
+        /// @param The maximum number of connections per host (0 is unlimited)
+        //--------------------------------------------------------------------------------------------------
+        void SetMaxConnectionsPerHost(u32 in_maxConnections);
         
     protected:
         
         //--------------------------------------------------------------------------------------------------
         /// @author S Downie
         ///
-        /// @return The number of bytes read before the buffer is flushed
+        /// @return The number of bytes read before the buffer is flushed for the request currently
+        /// being made.
         //--------------------------------------------------------------------------------------------------
         u32 GetMaxBufferSize() const;
+        //--------------------------------------------------------------------------------------------------
+        /// @return The maximum number of connections per host (0 is unlimited)
+        //--------------------------------------------------------------------------------------------------
+        u32 GetMaxConnectionsPerHost() const;
         
     private:
         
         u32 m_maxBufferSize = 0;
+        u32 m_maxConnectionsPerHost = 0;
+        bool m_isMakingStreamedRequest = false;
     };
 }
 
@@ -34,8 +34,8 @@ namespace ChilliSource
 {
     //----------------------------------------------------------------------------------------
     //----------------------------------------------------------------------------------------
-    HttpResponse::HttpResponse(Result in_result, u32 in_code, const std::string& in_data)
-    : m_data(in_data), m_result(in_result), m_code(in_code)
+    HttpResponse::HttpResponse(Result in_result, u32 in_code, std::string in_data)
+    : m_data(std::move(in_data)), m_result(in_result), m_code(in_code)
     {
         CS_ASSERT(m_data.size() < static_cast<std::string::size_type>(std::numeric_limits<u32>::max()), "Response data is too large. Cannot exceed "
                   + ToString(std::numeric_limits<u32>::max()) + " bytes.");
@@ -66,6 +66,12 @@ namespace ChilliSource
     }
     //----------------------------------------------------------------------------------------
     //----------------------------------------------------------------------------------------
+    std::string HttpResponse::ClaimData()
+    {
+        return std::move(m_data);
+    }
+    //----------------------------------------------------------------------------------------
+    //----------------------------------------------------------------------------------------
     u32 HttpResponse::GetCode() const
     {
         return m_code;
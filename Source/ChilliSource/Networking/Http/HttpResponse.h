@@ -36,7 +36,10 @@ namespace ChilliSource
     //----------------------------------------------------------------------------------------
     /// The response result of an http request. This contains the http response code and
     /// the response data. The response also contains the result which is whether the request
-    /// succeeded or failed. If the request fails then the response data will be empty
+    /// succeeded or failed. If the request fails then the response data will be empty.
+    ///
+    /// Large responses can be moved out of the response using ClaimData() to avoid copying
+    /// the payload after it has been received.
     ///
     /// @author S Downie
     //----------------------------------------------------------------------------------------
@@ -60,11 +63,11 @@ namespace ChilliSource
         ///
         /// @param Result
         /// @param Response code
-        /// @param Response data
+        /// @param Response data. This is moved into the response.
         ///
         /// @author S Downie
         //----------------------------------------------------------------------------------------
-        HttpResponse(Result in_result, u32 in_responseCode, const std::string& in_data);
+        HttpResponse(Result in_result, u32 in_responseCode, std::string in_data);
         //----------------------------------------------------------------------------------------
         /// @author S Downie
         ///
@@ -91,6 +94,14 @@ namespace ChilliSource
         //----------------------------------------------------------------------------------------
         const std::string& GetDataAsString() const;
         //----------------------------------------------------------------------------------------
+        /// Moves the contents of the response out of the response, leaving it empty. This
+        /// should be preferred over GetDataAsString() when the data needs to be kept, as it
+        /// avoids copying the payload.
+        ///
+        /// @return The contents of the response.
+        //----------------------------------------------------------------------------------------
+        std::string ClaimData();
+        //----------------------------------------------------------------------------------------
         /// @author S Downie
         ///
         /// @return HTTP response code (i.e. 200 = OK).
@@ -99,9 +110,9 @@ namespace ChilliSource
         
     private:
         
-        const std::string m_data;
-        const Result m_result;
-        const u32 m_code;
+        std::string m_data;
+        Result m_result;
+        u32 m_code;
     };
 }
 
@@ -0,0 +1,66 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef _CHILLISOURCE_NETWORKING_HTTP_IHTTPRESPONSESINK_H_
+#define _CHILLISOURCE_NETWORKING_HTTP_IHTTPRESPONSESINK_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Networking/Http/HttpResponse.h>
+
+namespace ChilliSource
+{
+    /// An interface for a destination which the body of a streamed http request is written
+    /// to as it is received. See HttpRequestSystem::MakeStreamedGetRequest().
+    ///
+    /// All methods are called on the main thread.
+    ///
+    class IHttpResponseSink
+    {
+    public:
+        CS_DECLARE_NOCOPY(IHttpResponseSink);
+        
+        IHttpResponseSink() = default;
+        
+        /// Called with each chunk of response data, in the order it was received.
+        ///
+        /// @param data
+        ///     The chunk of response data. This is only valid for the duration of the call.
+        /// @param dataSize
+        ///     The size of the chunk in bytes.
+        ///
+        virtual void Write(const u8* data, u32 dataSize) noexcept = 0;
+        
+        /// Called once the request has finished. No further data will be written.
+        ///
+        /// @param result
+        ///     The result of the request. If this isn't k_completed then the data written so
+        ///     far is incomplete.
+        ///
+        virtual void OnComplete(HttpResponse::Result result) noexcept = 0;
+        
+        virtual ~IHttpResponseSink() noexcept {}
+    };
+}
+
+#endif
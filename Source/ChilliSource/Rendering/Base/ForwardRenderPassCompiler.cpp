@@ -26,6 +26,7 @@
 
 #include <ChilliSource/Core/Math/Geometry/ShapeIntersection.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
+#include <ChilliSource/Core/Time/Profiler.h>
 #include <ChilliSource/Rendering/Base/RenderPasses.h>
 #include <ChilliSource/Rendering/Base/RenderFrame.h>
 #include <ChilliSource/Rendering/Base/RenderObject.h>
@@ -33,8 +34,15 @@
 #include <ChilliSource/Rendering/Base/RenderPassObject.h>
 #include <ChilliSource/Rendering/Base/RenderPassObjectSorter.h>
 #include <ChilliSource/Rendering/Base/RenderPassVisibilityChecker.h>
+#include <ChilliSource/Rendering/Lighting/PointLightClusterGrid.h>
+#include <ChilliSource/Rendering/Material/RenderMaterialGroup.h>
 #include <ChilliSource/Rendering/Model/RenderDynamicMesh.h>
+#include <ChilliSource/Rendering/Model/RenderMesh.h>
+#include <ChilliSource/Rendering/Target/RenderTargetGroup.h>
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
 
 namespace ChilliSource
 {
@@ -124,10 +132,12 @@ namespace ChilliSource
         ///
         /// @param renderFrame
         ///     The render frame from which to calculate the numer of passes.
+        /// @param numPointLightGroups
+        ///     The number of point light groups which need a point lights pass.
         ///
         /// @return The number of passes.
         ///
-        u32 CalcNumSceneOpaquePasses(const RenderFrame& renderFrame) noexcept
+        u32 CalcNumSceneOpaquePasses(const RenderFrame& renderFrame, u32 numPointLightGroups) noexcept
         {
             // Base
             constexpr u32 k_reservedRenderPasses = 1;
@@ -135,104 +145,151 @@ namespace ChilliSource
             u32 numDirectionalLightPasses = u32(renderFrame.GetDirectionalRenderLights().size());
             u32 numPointLightPasses = u32(renderFrame.GetPointRenderLights().size());
             
-            return k_reservedRenderPasses + numDirectionalLightPasses + numPointLightPasses;
+            return k_reservedRenderPasses + numDirectionalLightPasses + numPointLightPasses + numPointLightGroups;
         }
         
-        /// Filters the given list of objects to return only the objects which are a part of the requested
-        /// layer.
-        ///
-        /// @param renderLayer
-        ///     The render layer to filter on.
         /// @param renderObjects
-        ///     The list of render objects which should be filtered.
+        ///     The list of render objects to check.
         ///
-        /// @return The list of render objects for the requested layer.
+        /// @return Whether or not any of the render objects have a PointLights pass defined.
         ///
-        std::vector<RenderObject> GetLayerRenderObjects(RenderLayer renderLayer, const std::vector<RenderObject>& renderObjects) noexcept
+        bool ContainsPointLightsMaterial(const std::vector<RenderObject>& renderObjects) noexcept
         {
-            std::vector<RenderObject> layerRenderObjects;
-            
             for (const auto& renderObject : renderObjects)
             {
-                if (renderObject.GetRenderLayer() == renderLayer)
+                if (renderObject.GetRenderMaterialGroup()->GetRenderMaterial(GetVertexFormat(renderObject), static_cast<u32>(RenderPasses::k_pointLights)))
                 {
-                    layerRenderObjects.push_back(renderObject);
+                    return true;
                 }
             }
             
-            return layerRenderObjects;
+            return false;
         }
         
-        /// Parses a list of RenderObjects and generates a list of RenderPassObjects for
-        /// each RenderObject that has a ShadowMap pass defined, and has shadow casting
-        /// enabled.
+        /// Splits the lights in the given cluster grid into groups of up to RenderPass::k_maxPointLights
+        /// lights, each of which can be rendered in a single point lights pass. Lights are grouped in cluster
+        /// order so each group tends to affect a similar set of objects.
         ///
-        /// @param renderObjects
-        ///     A list of RenderObjects to parse
+        /// @param pointLightClusterGrid
+        ///     The cluster grid containing the lights.
         ///
-        /// @return The collection of RenderPassObjects.
+        /// @return The indices of the lights in each group.
         ///
-        std::vector<RenderPassObject> GetShadowMapRenderPassObjects(const std::vector<RenderObject>& renderObjects) noexcept
+        std::vector<std::vector<u32>> CalcPointLightGroups(const PointLightClusterGrid& pointLightClusterGrid) noexcept
         {
-            std::vector<RenderPassObject> baseRenderPassObjects;
+            const auto& orderedLights = pointLightClusterGrid.GetLightsInClusterOrder();
             
-            for (const auto& renderObject : renderObjects)
+            std::vector<std::vector<u32>> groups;
+            for (u32 i = 0; i < orderedLights.size(); i += RenderPass::k_maxPointLights)
             {
-                if (renderObject.ShouldCastShadows())
-                {
-                    auto renderMaterial = renderObject.GetRenderMaterialGroup()->GetRenderMaterial(GetVertexFormat(renderObject), static_cast<u32>(RenderPasses::k_shadowMap));
-                    
-                    if (renderMaterial)
-                    {
-                        baseRenderPassObjects.push_back(ConvertToRenderPassObject(renderObject, renderMaterial));
-                    }
-                }
+                u32 groupEnd = std::min(i + u32(RenderPass::k_maxPointLights), u32(orderedLights.size()));
+                groups.push_back(std::vector<u32>(orderedLights.begin() + i, orderedLights.begin() + groupEnd));
             }
             
-            return baseRenderPassObjects;
+            return groups;
         }
         
-        /// Parses a list of RenderObjects and generates a list of RenderPassObjects for
-        /// each RenderObject that has a Base pass defined.
+        /// The RenderObjects in a RenderFrame, classified by layer in a single sweep so that each
+        /// pass doesn't need to filter the full list of objects again. The standard layer objects
+        /// visible to the main camera are also calculated once and shared by all passes which
+        /// need them.
         ///
-        /// @param renderObjects
-        ///     A list of RenderObjects to parse
+        struct FrameRenderObjects final
+        {
+            std::vector<RenderObject> m_standard;
+            std::vector<RenderObject> m_visibleStandard;
+            std::vector<RenderObject> m_ui;
+            std::vector<RenderObject> m_skybox;
+        };
+        
+        /// Classifies the objects in the given frame by layer. The objects in each layer are counted
+        /// first, allowing each list to be allocated at its exact size before it is filled.
         ///
-        /// @return A collection of RenderPassObjects, one for each RenderObject Base pass
+        /// @param taskContext
+        ///     Context to manage any spawned tasks
+        /// @param renderFrame
+        ///     Current frame data
+        ///
+        /// @return The classified render objects.
         ///
-        std::vector<RenderPassObject> GetBaseRenderPassObjects(const std::vector<RenderObject>& renderObjects) noexcept
+        FrameRenderObjects ClassifyRenderObjects(const TaskContext& taskContext, const RenderFrame& renderFrame) noexcept
         {
-            std::vector<RenderPassObject> baseRenderPassObjects;
+            const auto& renderObjects = renderFrame.GetRenderObjects();
             
+            std::size_t numStandard = 0, numUI = 0, numSkybox = 0;
             for (const auto& renderObject : renderObjects)
             {
-                auto renderMaterial = renderObject.GetRenderMaterialGroup()->GetRenderMaterial(GetVertexFormat(renderObject), static_cast<u32>(RenderPasses::k_base));
-                
-                if (renderMaterial)
+                switch (renderObject.GetRenderLayer())
                 {
-                    baseRenderPassObjects.push_back(ConvertToRenderPassObject(renderObject, renderMaterial));
+                    case RenderLayer::k_standard:
+                        ++numStandard;
+                        break;
+                    case RenderLayer::k_ui:
+                        ++numUI;
+                        break;
+                    case RenderLayer::k_skybox:
+                        ++numSkybox;
+                        break;
                 }
             }
             
-            return baseRenderPassObjects;
+            FrameRenderObjects frameRenderObjects;
+            frameRenderObjects.m_standard.reserve(numStandard);
+            frameRenderObjects.m_ui.reserve(numUI);
+            frameRenderObjects.m_skybox.reserve(numSkybox);
+            
+            for (const auto& renderObject : renderObjects)
+            {
+                switch (renderObject.GetRenderLayer())
+                {
+                    case RenderLayer::k_standard:
+                        frameRenderObjects.m_standard.push_back(renderObject);
+                        break;
+                    case RenderLayer::k_ui:
+                        frameRenderObjects.m_ui.push_back(renderObject);
+                        break;
+                    case RenderLayer::k_skybox:
+                        frameRenderObjects.m_skybox.push_back(renderObject);
+                        break;
+                }
+            }
+            
+            frameRenderObjects.m_visibleStandard = RenderPassVisibilityChecker::CalculateVisibleObjects(taskContext, renderFrame.GetRenderCamera(), frameRenderObjects.m_standard);
+            
+            return frameRenderObjects;
         }
         
-        /// Parses a list of RenderObjects and generates a list of RenderPassObjects for
-        /// each RenderObject that has a Skybox pass defined.
+        /// Generates a RenderPassObject for each of the given RenderObjects which has a material for
+        /// the requested pass. The objects with a material are counted in a first sweep so that the
+        /// output can be allocated at its exact size before it is filled. Material lookup is cheap,
+        /// so it is repeated in the second sweep rather than stored in a temporary buffer.
         ///
         /// @param renderObjects
         ///     A list of RenderObjects to parse
+        /// @param renderPass
+        ///     The pass to generate RenderPassObjects for.
         ///
-        /// @return A collection of RenderPassObjects, one for each RenderObject Skybox pass
+        /// @return A collection of RenderPassObjects, one for each RenderObject with the requested pass.
         ///
-        std::vector<RenderPassObject> GetSkyboxRenderPassObjects(const std::vector<RenderObject>& renderObjects) noexcept
+        std::vector<RenderPassObject> GetRenderPassObjects(const std::vector<RenderObject>& renderObjects, RenderPasses renderPass) noexcept
         {
+            const auto passIndex = static_cast<u32>(renderPass);
+            
+            std::size_t numRenderPassObjects = 0;
+            for (const auto& renderObject : renderObjects)
+            {
+                if (renderObject.GetRenderMaterialGroup()->GetRenderMaterial(GetVertexFormat(renderObject), passIndex))
+                {
+                    ++numRenderPassObjects;
+                }
+            }
+            
             std::vector<RenderPassObject> renderPassObjects;
+            renderPassObjects.reserve(numRenderPassObjects);
             
             for (const auto& renderObject : renderObjects)
             {
-                auto renderMaterial = renderObject.GetRenderMaterialGroup()->GetRenderMaterial(GetVertexFormat(renderObject), static_cast<u32>(RenderPasses::k_skybox));
-                
+                auto renderMaterial = renderObject.GetRenderMaterialGroup()->GetRenderMaterial(GetVertexFormat(renderObject), passIndex);
                 if (renderMaterial)
                 {
                     renderPassObjects.push_back(ConvertToRenderPassObject(renderObject, renderMaterial));
@@ -261,74 +318,85 @@ namespace ChilliSource
                 passType = RenderPasses::k_directionalLightShadows;
             }
             
-            std::vector<RenderPassObject> renderPassObjects;
-            
-            for (const auto& renderObject : renderObjects)
-            {
-                auto renderMaterial = renderObject.GetRenderMaterialGroup()->GetRenderMaterial(GetVertexFormat(renderObject), static_cast<u32>(passType));
-                
-                if (renderMaterial)
-                {
-                    renderPassObjects.push_back(ConvertToRenderPassObject(renderObject, renderMaterial));
-                }
-            }
-            
-            return renderPassObjects;
+            return GetRenderPassObjects(renderObjects, passType);
         }
         
-        /// Parses a list of RenderObjects and generates a list of RenderPassObjects for
-        /// each RenderObject that has a PointLight pass defined, and is within the range
-        /// of influence of the given light.
+        /// Generates a list of RenderPassObjects for each of the given RenderObjects that has
+        /// a PointLight pass defined, but no PointLights pass. Objects with a PointLights pass
+        /// are instead rendered by the point lights pass for each group of lights.
         ///
         /// @param renderObjects
-        ///     A list of RenderObjects to parse
-        /// @param pointRenderLight
-        ///     The render light to get objects for.
+        ///     A list of RenderObjects
+        /// @param litObjectIndices
+        ///     The indices of the RenderObjects which are within the range of influence of the
+        ///     light, as calculated by the PointLightClusterGrid.
         ///
         /// @return A collection of RenderPassObjects for the render light pass.
         ///
-        std::vector<RenderPassObject> GetPointLightRenderPassObjects(const std::vector<RenderObject>& renderObjects, const PointRenderLight& pointRenderLight) noexcept
+        std::vector<RenderPassObject> GetPointLightRenderPassObjects(const std::vector<RenderObject>& renderObjects, const std::vector<u32>& litObjectIndices) noexcept
         {
-            Sphere pointLightBoundingSphere(pointRenderLight.GetPosition(), pointRenderLight.GetRangeOfInfluence());
-            
             std::vector<RenderPassObject> renderPassObjects;
+            renderPassObjects.reserve(litObjectIndices.size());
             
-            for (const auto& renderObject : renderObjects)
+            for (auto objectIndex : litObjectIndices)
             {
-                auto renderMaterial = renderObject.GetRenderMaterialGroup()->GetRenderMaterial(GetVertexFormat(renderObject), static_cast<u32>(RenderPasses::k_pointLight));
+                const auto& renderObject = renderObjects[objectIndex];
+                const auto& vertexFormat = GetVertexFormat(renderObject);
                 
-                if (renderMaterial && pointLightBoundingSphere.Contains(renderObject.GetBoundingSphere()))
+                if (renderObject.GetRenderMaterialGroup()->GetRenderMaterial(vertexFormat, static_cast<u32>(RenderPasses::k_pointLights)) == nullptr)
                 {
-                    renderPassObjects.push_back(ConvertToRenderPassObject(renderObject, renderMaterial));
+                    auto renderMaterial = renderObject.GetRenderMaterialGroup()->GetRenderMaterial(vertexFormat, static_cast<u32>(RenderPasses::k_pointLight));
+                    
+                    if (renderMaterial)
+                    {
+                        renderPassObjects.push_back(ConvertToRenderPassObject(renderObject, renderMaterial));
+                    }
                 }
             }
             
             return renderPassObjects;
         }
         
-        /// Parses a list of RenderObjects and generates a list of RenderPassObjects for
-        /// each RenderObject that has a Transparent pass defined.
+        /// Generates a list of RenderPassObjects for each of the given RenderObjects that has a
+        /// PointLights pass defined, and is within the range of influence of any of the lights
+        /// in the given group.
         ///
         /// @param renderObjects
-        ///     A list of RenderObjects to parse
+        ///     A list of RenderObjects
+        /// @param litObjectIndices
+        ///     The indices of the RenderObjects within range of each light, as calculated by the
+        ///     PointLightClusterGrid.
+        /// @param pointLightGroup
+        ///     The indices of the lights in the group.
         ///
-        /// @return A collection of RenderPassObjects, one for each RenderObject Transparent pass
+        /// @return A collection of RenderPassObjects for the point lights pass.
         ///
-        std::vector<RenderPassObject> GetTransparentRenderPassObjects(const std::vector<RenderObject>& renderObjects) noexcept
+        std::vector<RenderPassObject> GetPointLightsRenderPassObjects(const std::vector<RenderObject>& renderObjects, const std::vector<std::vector<u32>>& litObjectIndices, const std::vector<u32>& pointLightGroup) noexcept
         {
-            std::vector<RenderPassObject> transparentRenderPassObjects;
+            std::vector<u32> groupObjectIndices;
+            for (auto lightIndex : pointLightGroup)
+            {
+                groupObjectIndices.insert(groupObjectIndices.end(), litObjectIndices[lightIndex].begin(), litObjectIndices[lightIndex].end());
+            }
             
-            for (const auto& renderObject : renderObjects)
+            std::sort(groupObjectIndices.begin(), groupObjectIndices.end());
+            groupObjectIndices.erase(std::unique(groupObjectIndices.begin(), groupObjectIndices.end()), groupObjectIndices.end());
+            
+            std::vector<RenderPassObject> renderPassObjects;
+            renderPassObjects.reserve(groupObjectIndices.size());
+            
+            for (auto objectIndex : groupObjectIndices)
             {
-                auto renderMaterial = renderObject.GetRenderMaterialGroup()->GetRenderMaterial(GetVertexFormat(renderObject), static_cast<u32>(RenderPasses::k_transparent));
+                const auto& renderObject = renderObjects[objectIndex];
+                auto renderMaterial = renderObject.GetRenderMaterialGroup()->GetRenderMaterial(GetVertexFormat(renderObject), static_cast<u32>(RenderPasses::k_pointLights));
                 
                 if (renderMaterial)
                 {
-                    transparentRenderPassObjects.push_back(ConvertToRenderPassObject(renderObject, renderMaterial));
+                    renderPassObjects.push_back(ConvertToRenderPassObject(renderObject, renderMaterial));
                 }
             }
             
-            return transparentRenderPassObjects;
+            return renderPassObjects;
         }
         
         /// Gather all render objects in the frame that are to be renderered into the default RenderTarget
@@ -339,15 +407,27 @@ namespace ChilliSource
         ///     Context to manage any spawned tasks
         /// @param renderFrame
         ///     Current frame data
+        /// @param frameRenderObjects
+        ///     The render objects in the frame, classified by layer.
         ///
         /// @return The CameraRenderPassGroup
         ///
-        CameraRenderPassGroup CompileOpaqueSceneCameraRenderPassGroup(const TaskContext& taskContext, const RenderFrame& renderFrame) noexcept
+        CameraRenderPassGroup CompileOpaqueSceneCameraRenderPassGroup(const TaskContext& taskContext, const RenderFrame& renderFrame, const FrameRenderObjects& frameRenderObjects) noexcept
         {
-            auto standardRenderObjects = GetLayerRenderObjects(RenderLayer::k_standard, renderFrame.GetRenderObjects());
-            auto visibleStandardRenderObjects = RenderPassVisibilityChecker::CalculateVisibleObjects(taskContext, renderFrame.GetRenderCamera(), standardRenderObjects);
+            const auto& visibleStandardRenderObjects = frameRenderObjects.m_visibleStandard;
+            
+            // Bin the point lights into clusters to find the objects lit by each in roughly linear time, rather
+            // than testing every object against every light.
+            PointLightClusterGrid pointLightClusterGrid(renderFrame.GetRenderCamera(), renderFrame.GetPointRenderLights());
+            auto pointLightLitObjects = pointLightClusterGrid.CalculateLitObjects(visibleStandardRenderObjects);
             
-            u32 numPasses = CalcNumSceneOpaquePasses(renderFrame);
+            std::vector<std::vector<u32>> pointLightGroups;
+            if (ContainsPointLightsMaterial(visibleStandardRenderObjects))
+            {
+                pointLightGroups = CalcPointLightGroups(pointLightClusterGrid);
+            }
+            
+            u32 numPasses = CalcNumSceneOpaquePasses(renderFrame, u32(pointLightGroups.size()));
             std::vector<RenderPass> renderPasses(numPasses);
             std::vector<Task> tasks;
             u32 nextPassIndex = 0;
@@ -356,7 +436,7 @@ namespace ChilliSource
             u32 basePassIndex = nextPassIndex++;
             tasks.push_back([=, &renderPasses, &renderFrame, &visibleStandardRenderObjects](const TaskContext& innerTaskContext)
             {
-                auto renderPassObjects = GetBaseRenderPassObjects(visibleStandardRenderObjects);
+                auto renderPassObjects = GetRenderPassObjects(visibleStandardRenderObjects, RenderPasses::k_base);
                 RenderPassObjectSorter::OpaqueSort(renderFrame.GetRenderCamera(), renderPassObjects);
                 renderPasses[basePassIndex] = RenderPass(renderFrame.GetAmbientRenderLight(), std::move(renderPassObjects));
             });
@@ -374,14 +454,35 @@ namespace ChilliSource
             }
             
             // Point light pass
-            for (const auto& pointLight : renderFrame.GetPointRenderLights())
+            const auto& pointLights = renderFrame.GetPointRenderLights();
+            for (u32 pointLightIndex = 0; pointLightIndex < pointLights.size(); ++pointLightIndex)
             {
                 u32 pointLightPassIndex = nextPassIndex++;
-                tasks.push_back([=, &renderPasses, &renderFrame, &visibleStandardRenderObjects, &pointLight](const TaskContext& innerTaskContext)
+                tasks.push_back([=, &renderPasses, &renderFrame, &visibleStandardRenderObjects, &pointLights, &pointLightLitObjects](const TaskContext& innerTaskContext)
                 {
-                    auto renderPassObjects = GetPointLightRenderPassObjects(visibleStandardRenderObjects, pointLight);
+                    auto renderPassObjects = GetPointLightRenderPassObjects(visibleStandardRenderObjects, pointLightLitObjects[pointLightIndex]);
                     RenderPassObjectSorter::OpaqueSort(renderFrame.GetRenderCamera(), renderPassObjects);
-                    renderPasses[pointLightPassIndex] = RenderPass(pointLight, std::move(renderPassObjects));
+                    renderPasses[pointLightPassIndex] = RenderPass(pointLights[pointLightIndex], std::move(renderPassObjects));
+                });
+            }
+            
+            // Point lights pass
+            for (const auto& pointLightGroup : pointLightGroups)
+            {
+                u32 pointLightsPassIndex = nextPassIndex++;
+                tasks.push_back([=, &renderPasses, &renderFrame, &visibleStandardRenderObjects, &pointLights, &pointLightLitObjects, &pointLightGroup](const TaskContext& innerTaskContext)
+                {
+                    auto renderPassObjects = GetPointLightsRenderPassObjects(visibleStandardRenderObjects, pointLightLitObjects, pointLightGroup);
+                    RenderPassObjectSorter::OpaqueSort(renderFrame.GetRenderCamera(), renderPassObjects);
+                    
+                    std::vector<PointRenderLight> groupPointLights;
+                    groupPointLights.reserve(pointLightGroup.size());
+                    for (auto lightIndex : pointLightGroup)
+                    {
+                        groupPointLights.push_back(pointLights[lightIndex]);
+                    }
+                    
+                    renderPasses[pointLightsPassIndex] = RenderPass(std::move(groupPointLights), std::move(renderPassObjects));
                 });
             }
             
@@ -397,20 +498,19 @@ namespace ChilliSource
         ///     Context to manage any spawned tasks
         /// @param renderFrame
         ///     Current frame data
+        /// @param frameRenderObjects
+        ///     The render objects in the frame, classified by layer.
         ///
         /// @return The CameraRenderPassGroup
         ///
-        CameraRenderPassGroup CompileTransparentSceneCameraRenderPassGroup(const TaskContext& taskContext, const RenderFrame& renderFrame) noexcept
+        CameraRenderPassGroup CompileTransparentSceneCameraRenderPassGroup(const TaskContext& taskContext, const RenderFrame& renderFrame, const FrameRenderObjects& frameRenderObjects) noexcept
         {
             std::vector<RenderPass> renderPasses(1);
             std::vector<Task> tasks;
 
-            tasks.push_back([=, &renderPasses, &renderFrame](const TaskContext& innerTaskContext)
+            tasks.push_back([=, &renderPasses, &renderFrame, &frameRenderObjects](const TaskContext& innerTaskContext)
             {
-                auto standardRenderObjects = GetLayerRenderObjects(RenderLayer::k_standard, renderFrame.GetRenderObjects());
-                auto visibleStandardRenderObjects = RenderPassVisibilityChecker::CalculateVisibleObjects(taskContext, renderFrame.GetRenderCamera(), standardRenderObjects);
-                
-                auto renderPassObjects = GetTransparentRenderPassObjects(visibleStandardRenderObjects);
+                auto renderPassObjects = GetRenderPassObjects(frameRenderObjects.m_visibleStandard, RenderPasses::k_transparent);
                 RenderPassObjectSorter::TransparentSort(renderFrame.GetRenderCamera(), renderPassObjects);
                 renderPasses[0] = RenderPass(renderFrame.GetAmbientRenderLight(), std::move(renderPassObjects));
             });
@@ -431,16 +531,18 @@ namespace ChilliSource
         ///     Context to manage any spawned tasks
         /// @param renderFrame
         ///     Current frame data
+        /// @param frameRenderObjects
+        ///     The render objects in the frame, classified by layer.
         ///
         /// @return The generated CameraRenderPassGroup
         ///
-        CameraRenderPassGroup CompileSkyboxCameraRenderPassGroup(const TaskContext& taskContext, const RenderFrame& renderFrame) noexcept
+        CameraRenderPassGroup CompileSkyboxCameraRenderPassGroup(const TaskContext& taskContext, const RenderFrame& renderFrame, const FrameRenderObjects& frameRenderObjects) noexcept
         {
             //Use the main camera but ignore any scale or translation, as if the camera was at the origin
             RenderCamera camera(Matrix4::CreateRotation(renderFrame.GetRenderCamera().GetOrientation()), renderFrame.GetRenderCamera().GetProjectionMatrix(), renderFrame.GetRenderCamera().GetOrientation());
             
-            auto renderObjects = GetLayerRenderObjects(RenderLayer::k_skybox, renderFrame.GetRenderObjects());
-            auto renderPassObjects = GetSkyboxRenderPassObjects(renderObjects);
+            const auto& renderObjects = frameRenderObjects.m_skybox;
+            auto renderPassObjects = GetRenderPassObjects(renderObjects, RenderPasses::k_skybox);
             CS_ASSERT(renderObjects.size() == renderPassObjects.size(), "Invalid number of render pass objects in skybox pass. All render objects in the Skybox layer should have a skybox material.");
             
             std::vector<RenderPass> renderPasses;
@@ -460,20 +562,21 @@ namespace ChilliSource
         ///     Context to manage any spawned tasks
         /// @param renderFrame
         ///     Current frame data
+        /// @param frameRenderObjects
+        ///     The render objects in the frame, classified by layer.
         ///
         /// @return The generated CameraRenderPassGroup
         ///
-        CameraRenderPassGroup CompileUICameraRenderPassGroup(const TaskContext& taskContext, const RenderFrame& renderFrame) noexcept
+        CameraRenderPassGroup CompileUICameraRenderPassGroup(const TaskContext& taskContext, const RenderFrame& renderFrame, const FrameRenderObjects& frameRenderObjects) noexcept
         {
             constexpr f32 k_near = 0.0f;
             constexpr f32 k_far = 1.0f;
             auto projMatrix = Matrix4::CreateOrthographicProjectionLH(0, f32(renderFrame.GetResolution().x), 0, f32(renderFrame.GetResolution().y), k_near, k_far);
             RenderCamera uiCamera(Matrix4::k_identity, projMatrix, Quaternion::k_identity);
             
-            auto uiRenderObjects = GetLayerRenderObjects(RenderLayer::k_ui, renderFrame.GetRenderObjects());
-            auto visibleUIRenderObjects = RenderPassVisibilityChecker::CalculateVisibleObjects(taskContext, uiCamera, uiRenderObjects);
+            auto visibleUIRenderObjects = RenderPassVisibilityChecker::CalculateVisibleObjects(taskContext, uiCamera, frameRenderObjects.m_ui);
             
-            auto uiRenderPassObjects = GetTransparentRenderPassObjects(visibleUIRenderObjects);
+            auto uiRenderPassObjects = GetRenderPassObjects(visibleUIRenderObjects, RenderPasses::k_transparent);
             CS_ASSERT(visibleUIRenderObjects.size() == uiRenderPassObjects.size(), "Invalid number of render pass objects in transparent pass. All render objects in the UI layer should have a transparent material.");
             
             RenderPassObjectSorter::PrioritySort(uiRenderPassObjects);
@@ -494,10 +597,12 @@ namespace ChilliSource
         ///     Context to manage any spawned tasks
         /// @param renderFrame
         ///     Current frame data
+        /// @param frameRenderObjects
+        ///     The render objects in the frame, classified by layer.
         ///
         /// @return The TargetRenderPassGroup
         ///
-        TargetRenderPassGroup CompileMainTargetRenderPassGroup(const TaskContext& taskContext, const RenderFrame& renderFrame) noexcept
+        TargetRenderPassGroup CompileMainTargetRenderPassGroup(const TaskContext& taskContext, const RenderFrame& renderFrame, const FrameRenderObjects& frameRenderObjects) noexcept
         {
             constexpr u32 k_numGroups = 4;
             
@@ -507,31 +612,31 @@ namespace ChilliSource
             
             // Scene camera group - Opaque
             u32 sceneIndexO = nextIndex++;
-            tasks.push_back([=, &cameraRenderPassGroups, &renderFrame](const TaskContext& innerTaskContext)
+            tasks.push_back([=, &cameraRenderPassGroups, &renderFrame, &frameRenderObjects](const TaskContext& innerTaskContext)
             {
-                cameraRenderPassGroups[sceneIndexO] = CompileOpaqueSceneCameraRenderPassGroup(innerTaskContext, renderFrame);
+                cameraRenderPassGroups[sceneIndexO] = CompileOpaqueSceneCameraRenderPassGroup(innerTaskContext, renderFrame, frameRenderObjects);
             });
             
             // Skybox camera group - Rendered after the other scene objects to reduce overdraw. The shader and material settings ensure
             // that depth testing isn't an issue.
             u32 skyboxIndex = nextIndex++;
-            tasks.push_back([=, &cameraRenderPassGroups, &renderFrame](const TaskContext& innerTaskContext)
+            tasks.push_back([=, &cameraRenderPassGroups, &renderFrame, &frameRenderObjects](const TaskContext& innerTaskContext)
             {
-                cameraRenderPassGroups[skyboxIndex] = CompileSkyboxCameraRenderPassGroup(innerTaskContext, renderFrame);
+                cameraRenderPassGroups[skyboxIndex] = CompileSkyboxCameraRenderPassGroup(innerTaskContext, renderFrame, frameRenderObjects);
             });
             
             // Scene camera group - Transparent
             u32 sceneIndexT = nextIndex++;
-            tasks.push_back([=, &cameraRenderPassGroups, &renderFrame](const TaskContext& innerTaskContext)
+            tasks.push_back([=, &cameraRenderPassGroups, &renderFrame, &frameRenderObjects](const TaskContext& innerTaskContext)
             {
-                cameraRenderPassGroups[sceneIndexT] = CompileTransparentSceneCameraRenderPassGroup(innerTaskContext, renderFrame);
+                cameraRenderPassGroups[sceneIndexT] = CompileTransparentSceneCameraRenderPassGroup(innerTaskContext, renderFrame, frameRenderObjects);
             });
             
             // UI camera group
             u32 uiIndex = nextIndex++;
-            tasks.push_back([=, &cameraRenderPassGroups, &renderFrame](const TaskContext& innerTaskContext)
+            tasks.push_back([=, &cameraRenderPassGroups, &renderFrame, &frameRenderObjects](const TaskContext& innerTaskContext)
             {
-                cameraRenderPassGroups[uiIndex] = CompileUICameraRenderPassGroup(innerTaskContext, renderFrame);
+                cameraRenderPassGroups[uiIndex] = CompileUICameraRenderPassGroup(innerTaskContext, renderFrame, frameRenderObjects);
             });
             
             taskContext.ProcessChildTasks(tasks);
@@ -546,33 +651,128 @@ namespace ChilliSource
             }
         }
         
-        /// Gather all render objects in the frame that are to be renderered into a shadow RenderTarget
-        /// into a TargetRenderPassGroup.
+        /// Filters the given list of RenderObjects down to those which cast shadows.
         ///
-        /// @param taskContext
-        ///     Context to manage any spawned tasks
-        /// @param renderFrame
-        ///     Current frame data
+        /// @param renderObjects
+        ///     A list of RenderObjects to filter.
+        ///
+        /// @return The shadow casting RenderObjects.
+        ///
+        std::vector<RenderObject> GetShadowCasters(const std::vector<RenderObject>& renderObjects) noexcept
+        {
+            auto numShadowCasters = std::count_if(renderObjects.begin(), renderObjects.end(), [](const RenderObject& renderObject) { return renderObject.ShouldCastShadows(); });
+            
+            std::vector<RenderObject> shadowCasters;
+            shadowCasters.reserve(numShadowCasters);
+            
+            for (const auto& renderObject : renderObjects)
+            {
+                if (renderObject.ShouldCastShadows())
+                {
+                    shadowCasters.push_back(renderObject);
+                }
+            }
+            
+            return shadowCasters;
+        }
+        
+        /// Removes any shadow casters which cannot cast a shadow onto the given receivers. Both are
+        /// compared in light space: a caster is kept if it overlaps the extent of the receivers
+        /// perpendicular to the light direction, and isn't entirely beyond the furthest receiver.
+        ///
+        /// @param lightCamera
+        ///     The camera describing the light's shadow volume.
+        /// @param shadowCasters
+        ///     The shadow casters, already culled to the light's shadow volume.
+        /// @param receivers
+        ///     The objects visible to the main camera which can receive shadows.
+        ///
+        /// @return The shadow casters which can affect the receivers.
+        ///
+        std::vector<RenderObject> CullShadowCastersToReceivers(const RenderCamera& lightCamera, const std::vector<RenderObject>& shadowCasters, const std::vector<RenderObject>& receivers) noexcept
+        {
+            std::vector<RenderObject> culledShadowCasters;
+            
+            if (receivers.empty())
+            {
+                return culledShadowCasters;
+            }
+            
+            const auto& lightViewMatrix = lightCamera.GetViewMatrix();
+            
+            Vector3 receiversMin(std::numeric_limits<f32>::infinity(), std::numeric_limits<f32>::infinity(), std::numeric_limits<f32>::infinity());
+            Vector3 receiversMax(-std::numeric_limits<f32>::infinity(), -std::numeric_limits<f32>::infinity(), -std::numeric_limits<f32>::infinity());
+            for (const auto& receiver : receivers)
+            {
+                auto centre = receiver.GetBoundingSphere().vOrigin * lightViewMatrix;
+                auto radius = receiver.GetBoundingSphere().fRadius;
+                
+                receiversMin = Vector3::Min(receiversMin, centre - Vector3(radius, radius, radius));
+                receiversMax = Vector3::Max(receiversMax, centre + Vector3(radius, radius, radius));
+            }
+            
+            for (const auto& shadowCaster : shadowCasters)
+            {
+                auto centre = shadowCaster.GetBoundingSphere().vOrigin * lightViewMatrix;
+                auto radius = shadowCaster.GetBoundingSphere().fRadius;
+                
+                if (centre.x + radius >= receiversMin.x && centre.x - radius <= receiversMax.x && centre.y + radius >= receiversMin.y && centre.y - radius <= receiversMax.y &&
+                    centre.z - radius <= receiversMax.z)
+                {
+                    culledShadowCasters.push_back(shadowCaster);
+                }
+            }
+            
+            return culledShadowCasters;
+        }
+        
+        /// Checks whether or not any directional light in the given frames renders to the shadow map
+        /// target with the given id.
+        ///
+        /// @param renderFrames
+        ///     The frames being compiled.
+        /// @param shadowMapTargetId
+        ///     The unique id of the shadow map target.
+        ///
+        /// @return Whether or not the target is in use.
+        ///
+        bool IsShadowMapTargetInUse(const std::vector<RenderFrame>& renderFrames, u64 shadowMapTargetId) noexcept
+        {
+            for (const auto& renderFrame : renderFrames)
+            {
+                for (const auto& directionalRenderLight : renderFrame.GetDirectionalRenderLights())
+                {
+                    if (directionalRenderLight.GetShadowMapTarget() && directionalRenderLight.GetShadowMapTarget()->GetUniqueId() == shadowMapTargetId)
+                    {
+                        return true;
+                    }
+                }
+            }
+            
+            return false;
+        }
+        
+        /// Gather the given shadow casters into a TargetRenderPassGroup which renders them into the
+        /// light's shadow map.
+        ///
+        /// @param lightCamera
+        ///     The camera describing the light's shadow volume.
         /// @param directionalRenderLight
         ///     The directional light that should have a shadow map built for it.
+        /// @param shadowCasters
+        ///     The shadow casters which should be rendered into the shadow map.
         ///
         /// @return The TargetRenderPassGroup
         ///
-        TargetRenderPassGroup CompileShadowMapTargetRenderPassGroup(const TaskContext& taskContext, const RenderFrame& renderFrame, const DirectionalRenderLight& directionalRenderLight) noexcept
+        TargetRenderPassGroup CompileShadowMapTargetRenderPassGroup(const RenderCamera& lightCamera, const DirectionalRenderLight& directionalRenderLight, const std::vector<RenderObject>& shadowCasters) noexcept
         {
-            CS_ASSERT(directionalRenderLight.GetShadowMapTarget(), "Cannot compile shadow map target with light that has no shadow map target.");
-            
-            RenderCamera camera(directionalRenderLight.GetLightWorldMatrix(), directionalRenderLight.GetLightProjectionMatrix(), directionalRenderLight.GetLightOrientation());
-            
-            auto standardRenderObjects = GetLayerRenderObjects(RenderLayer::k_standard, renderFrame.GetRenderObjects());
-            auto visibleStandardRenderObjects = RenderPassVisibilityChecker::CalculateVisibleObjects(taskContext, renderFrame.GetRenderCamera(), standardRenderObjects);
-            auto renderPassObjects = GetShadowMapRenderPassObjects(visibleStandardRenderObjects);
-            RenderPassObjectSorter::OpaqueSort(renderFrame.GetRenderCamera(), renderPassObjects);
+            auto renderPassObjects = GetRenderPassObjects(shadowCasters, RenderPasses::k_shadowMap);
+            RenderPassObjectSorter::OpaqueSort(lightCamera, renderPassObjects);
             RenderPass renderPass(std::move(renderPassObjects));
             
             std::vector<RenderPass> renderPasses;
             renderPasses.push_back(std::move(renderPass));
-            CameraRenderPassGroup cameraRenderPassGroup(camera, std::move(renderPasses));
+            CameraRenderPassGroup cameraRenderPassGroup(lightCamera, std::move(renderPasses));
             
             std::vector<CameraRenderPassGroup> cameraRenderPassGroups;
             cameraRenderPassGroups.push_back(std::move(cameraRenderPassGroup));
@@ -583,41 +783,171 @@ namespace ChilliSource
     //------------------------------------------------------------------------------
     std::vector<TargetRenderPassGroup> ForwardRenderPassCompiler::CompileTargetRenderPassGroups(const TaskContext& taskContext, std::vector<RenderFrame>&& renderFrames) noexcept
     {
+        CS_PROFILE_SCOPE("ForwardRenderPassCompiler::CompileTargetRenderPassGroups");
+        
         u32 numTargets = 0;
         for(const auto& renderFrame : renderFrames)
         {
             numTargets += CalcNumTargets(renderFrame);
         }
         
+        // Classify the objects in each frame up front, so the passes compiled for it can share the results.
+        std::vector<FrameRenderObjects> framesRenderObjects;
+        framesRenderObjects.reserve(renderFrames.size());
+        for(const auto& renderFrame : renderFrames)
+        {
+            framesRenderObjects.push_back(ClassifyRenderObjects(taskContext, renderFrame));
+        }
+        
         std::vector<TargetRenderPassGroup> targetRenderPassGroups(numTargets);
         std::vector<Task> tasks;
         u32 nextPassIndex = 0;
         
-        for(const auto& renderFrame : renderFrames)
+        for(std::size_t frameIndex = 0; frameIndex < renderFrames.size(); ++frameIndex)
         {
+            const auto& renderFrame = renderFrames[frameIndex];
+            const auto& frameRenderObjects = framesRenderObjects[frameIndex];
+            
             // Shadow targets
             for (const auto& directionalRenderLight : renderFrame.GetDirectionalRenderLights())
             {
                 if (directionalRenderLight.GetShadowMapTarget())
                 {
                     u32 shadowPassIndex = nextPassIndex++;
-                    tasks.push_back([=, &targetRenderPassGroups, &renderFrame, &directionalRenderLight](const TaskContext& innerTaskContext)
+                    tasks.push_back([=, &targetRenderPassGroups, &frameRenderObjects, &directionalRenderLight](const TaskContext& innerTaskContext)
                     {
-                        targetRenderPassGroups[shadowPassIndex] = CompileShadowMapTargetRenderPassGroup(innerTaskContext, renderFrame, directionalRenderLight);
+                        targetRenderPassGroups[shadowPassIndex] = CompileShadowMapTarget(innerTaskContext, frameRenderObjects.m_standard, frameRenderObjects.m_visibleStandard, directionalRenderLight);
                     });
                 }
             }
             
             // Main target (screen or offscreen target)
             u32 mainPassIndex = nextPassIndex++;
-            tasks.push_back([=, &targetRenderPassGroups, &renderFrame](const TaskContext& innerTaskContext)
+            tasks.push_back([=, &targetRenderPassGroups, &renderFrame, &frameRenderObjects](const TaskContext& innerTaskContext)
             {
-                targetRenderPassGroups[mainPassIndex] = CompileMainTargetRenderPassGroup(innerTaskContext, renderFrame);
+                targetRenderPassGroups[mainPassIndex] = CompileMainTargetRenderPassGroup(innerTaskContext, renderFrame, frameRenderObjects);
             });
         }
         
         taskContext.ProcessChildTasks(tasks);
         
+        // Discard the keys of shadow maps which weren't used this frame, so that the keys of destroyed
+        // targets don't accumulate.
+        {
+            std::unique_lock<std::mutex> lock(m_shadowMapKeysMutex);
+            for (auto it = m_shadowMapKeys.begin(); it != m_shadowMapKeys.end();)
+            {
+                if (!IsShadowMapTargetInUse(renderFrames, it->first))
+                {
+                    it = m_shadowMapKeys.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+        }
+        
         return targetRenderPassGroups;
     }
+    
+    //------------------------------------------------------------------------------
+    void ForwardRenderPassCompiler::Invalidate() noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_shadowMapKeysMutex);
+        m_shadowMapKeys.clear();
+    }
+    
+    //------------------------------------------------------------------------------
+    bool ForwardRenderPassCompiler::ShadowMapKey::operator==(const ShadowMapKey& other) const noexcept
+    {
+        static_assert(sizeof(ShadowCasterKey) == sizeof(u64) * 2 + sizeof(f32) * 16, "Caster keys are compared bytewise so must not contain padding.");
+        
+        if (m_lightWorldMatrix != other.m_lightWorldMatrix || m_lightProjectionMatrix != other.m_lightProjectionMatrix || m_casters.size() != other.m_casters.size())
+        {
+            return false;
+        }
+        
+        for (std::size_t i = 0; i < m_casters.size(); ++i)
+        {
+            if (memcmp(&m_casters[i], &other.m_casters[i], sizeof(ShadowCasterKey)) != 0)
+            {
+                return false;
+            }
+        }
+        
+        return true;
+    }
+    
+    //------------------------------------------------------------------------------
+    bool ForwardRenderPassCompiler::TryBuildShadowMapKey(const DirectionalRenderLight& directionalRenderLight, const std::vector<RenderObject>& shadowCasters, ShadowMapKey& key) noexcept
+    {
+        key.m_lightWorldMatrix = directionalRenderLight.GetLightWorldMatrix();
+        key.m_lightProjectionMatrix = directionalRenderLight.GetLightProjectionMatrix();
+        key.m_casters.clear();
+        key.m_casters.reserve(shadowCasters.size());
+        
+        for (const auto& shadowCaster : shadowCasters)
+        {
+            if (shadowCaster.GetRenderDynamicMesh() || shadowCaster.GetRenderSkinnedAnimation())
+            {
+                return false;
+            }
+            
+            ShadowCasterKey casterKey;
+            casterKey.m_renderMaterialGroupId = shadowCaster.GetRenderMaterialGroup()->GetUniqueId();
+            casterKey.m_renderMeshId = shadowCaster.GetRenderMesh()->GetUniqueId();
+            casterKey.m_worldMatrix = shadowCaster.GetWorldMatrix();
+            key.m_casters.push_back(casterKey);
+        }
+        
+        // The raw bytes are compared, rather than the values, so that the ordering is strict even if a matrix contains NaN.
+        std::sort(key.m_casters.begin(), key.m_casters.end(), [](const ShadowCasterKey& a, const ShadowCasterKey& b)
+        {
+            return memcmp(&a, &b, sizeof(ShadowCasterKey)) < 0;
+        });
+        
+        return true;
+    }
+    
+    //------------------------------------------------------------------------------
+    TargetRenderPassGroup ForwardRenderPassCompiler::CompileShadowMapTarget(const TaskContext& taskContext, const std::vector<RenderObject>& standardRenderObjects, const std::vector<RenderObject>& visibleStandardRenderObjects,
+                                                                            const DirectionalRenderLight& directionalRenderLight) noexcept
+    {
+        CS_ASSERT(directionalRenderLight.GetShadowMapTarget(), "Cannot compile shadow map target with light that has no shadow map target.");
+        
+        RenderCamera lightCamera(directionalRenderLight.GetLightWorldMatrix(), directionalRenderLight.GetLightProjectionMatrix(), directionalRenderLight.GetLightOrientation());
+        
+        auto shadowCasters = RenderPassVisibilityChecker::CalculateVisibleObjects(taskContext, lightCamera, GetShadowCasters(standardRenderObjects));
+        shadowCasters = CullShadowCastersToReceivers(lightCamera, shadowCasters, visibleStandardRenderObjects);
+        
+        auto shadowMapTarget = directionalRenderLight.GetShadowMapTarget();
+        if (directionalRenderLight.ShouldReuseShadowMap())
+        {
+            ShadowMapKey key;
+            if (TryBuildShadowMapKey(directionalRenderLight, shadowCasters, key))
+            {
+                std::unique_lock<std::mutex> lock(m_shadowMapKeysMutex);
+                auto it = m_shadowMapKeys.find(shadowMapTarget->GetUniqueId());
+                if (it != m_shadowMapKeys.end() && it->second == key)
+                {
+                    return TargetRenderPassGroup(shadowMapTarget);
+                }
+                
+                m_shadowMapKeys[shadowMapTarget->GetUniqueId()] = std::move(key);
+            }
+            else
+            {
+                std::unique_lock<std::mutex> lock(m_shadowMapKeysMutex);
+                m_shadowMapKeys.erase(shadowMapTarget->GetUniqueId());
+            }
+        }
+        else
+        {
+            std::unique_lock<std::mutex> lock(m_shadowMapKeysMutex);
+            m_shadowMapKeys.erase(shadowMapTarget->GetUniqueId());
+        }
+        
+        return CompileShadowMapTargetRenderPassGroup(lightCamera, directionalRenderLight, shadowCasters);
+    }
 }
@@ -28,8 +28,14 @@
 #include <ChilliSource/ChilliSource.h>
 
 #include <ChilliSource/Rendering/Base/IRenderPassCompiler.h>
+
+#include <ChilliSource/Core/Math/Matrix4.h>
 #include <ChilliSource/Rendering/Base/CameraRenderPassGroup.h>
 
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
 namespace ChilliSource
 {
     /// Compiles the RenderPasses required when forward rendering. See ForwardRenderPasses.h for more
@@ -55,6 +61,81 @@ namespace ChilliSource
         /// @return The list of target render pass groups
         ///
         std::vector<TargetRenderPassGroup> CompileTargetRenderPassGroups(const TaskContext& taskContext, std::vector<RenderFrame>&& renderFrames) noexcept override;
+        
+        /// Discards the keys of previously rendered shadow maps, ensuring they are all rendered
+        /// again next frame.
+        ///
+        /// This is thread-safe.
+        ///
+        void Invalidate() noexcept override;
+        
+    private:
+        /// Identifies a single shadow caster within a ShadowMapKey. Ids are used rather than addresses
+        /// since they are never reused.
+        ///
+        struct ShadowCasterKey final
+        {
+            u64 m_renderMaterialGroupId;
+            u64 m_renderMeshId;
+            Matrix4 m_worldMatrix;
+        };
+        
+        /// Describes everything which affects the contents of a shadow map. The casters are sorted, so
+        /// two keys for the same light and casters compare equal regardless of the order the casters
+        /// were gathered in.
+        ///
+        struct ShadowMapKey final
+        {
+            Matrix4 m_lightWorldMatrix;
+            Matrix4 m_lightProjectionMatrix;
+            std::vector<ShadowCasterKey> m_casters;
+            
+            /// @param other
+            ///     The key to compare with.
+            ///
+            /// @return Whether or not the two keys describe exactly the same shadow map contents.
+            ///
+            bool operator==(const ShadowMapKey& other) const noexcept;
+        };
+        
+        /// Builds the key describing the contents of a shadow map. Skinned and dynamic meshes are
+        /// allocated from the frame allocator, so have no identity which can be compared across
+        /// frames. If any caster uses one, no key is built.
+        ///
+        /// @param directionalRenderLight
+        ///     The light which the shadow map is rendered for.
+        /// @param shadowCasters
+        ///     The shadow casters which will be rendered into the shadow map.
+        /// @param key
+        ///     [Out] The key.
+        ///
+        /// @return Whether or not a key could be built.
+        ///
+        static bool TryBuildShadowMapKey(const DirectionalRenderLight& directionalRenderLight, const std::vector<RenderObject>& shadowCasters, ShadowMapKey& key) noexcept;
+        
+        /// Compiles the shadow map target for the given light. Shadow casters are culled to the light's
+        /// volume, and to the extent of the visible shadow receivers. If the light allows it, and
+        /// neither the light nor the casters have changed since the shadow map was last rendered,
+        /// the previous contents of the shadow map are retained instead.
+        ///
+        /// This is thread-safe.
+        ///
+        /// @param taskContext
+        ///     Context to manage any spawned tasks
+        /// @param standardRenderObjects
+        ///     All objects in the frame's standard layer.
+        /// @param visibleStandardRenderObjects
+        ///     The objects in the frame's standard layer which are visible to the main camera.
+        /// @param directionalRenderLight
+        ///     The directional light that should have a shadow map built for it.
+        ///
+        /// @return The TargetRenderPassGroup
+        ///
+        TargetRenderPassGroup CompileShadowMapTarget(const TaskContext& taskContext, const std::vector<RenderObject>& standardRenderObjects, const std::vector<RenderObject>& visibleStandardRenderObjects,
+                                                     const DirectionalRenderLight& directionalRenderLight) noexcept;
+        
+        std::mutex m_shadowMapKeysMutex;
+        std::unordered_map<u64, ShadowMapKey> m_shadowMapKeys;
     };
 }
 
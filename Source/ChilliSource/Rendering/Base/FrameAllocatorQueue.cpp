@@ -100,4 +100,19 @@ namespace ChilliSource
         
         CS_LOG_FATAL("Cannot push an allocator that is not owned by this queue");
     }
+    
+    //------------------------------------------------------------------------------
+    void FrameAllocatorQueue::Reserve(u32 numAllocators) noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        
+        while (m_allocators.size() < numAllocators)
+        {
+            PagedLinearAllocatorUPtr allocator(new PagedLinearAllocator(k_allocatorPageSize));
+            m_queue.push_back(allocator.get());
+            m_allocators.push_back(std::move(allocator));
+            
+            m_condition.notify_one();
+        }
+    }
 }
@@ -39,8 +39,9 @@ namespace ChilliSource
     /// pipeline. These allocators are queued, allowing users to pop one when required
     /// and pushed again once finished with. As there are three main stages to the
     /// render pipeline (snapshot, preparation and command processing) there are three
-    /// allocators in the queue. If all are in use, then this will block until one is
-    /// returned to the manager.
+    /// allocators in the queue by default. More can be added when the renderer's pipeline
+    /// depth is increased. If all are in use, then this will block until one is returned
+    /// to the manager.
     ///
     /// This is thread safe.
     ///
@@ -75,6 +76,15 @@ namespace ChilliSource
         ///
         void Push(IAllocator* allocator) noexcept;
         
+        /// Creates additional allocators, if required, so that the queue owns at least the
+        /// given number. Allocators are never removed, so this has no effect if the queue
+        /// already owns enough.
+        ///
+        /// @param numAllocators
+        ///     The minimum number of allocators the queue should own.
+        ///
+        void Reserve(u32 numAllocators) noexcept;
+        
     private:
         std::mutex m_mutex;
         std::condition_variable m_condition;
@@ -24,6 +24,8 @@
 
 #include <ChilliSource/Rendering/Base/IRenderCommandProcessor.h>
 
+#include <ChilliSource/Rendering/Base/RecordingRenderCommandProcessor.h>
+
 #if defined(CS_TARGETPLATFORM_IOS) || defined(CS_TARGETPLATFORM_ANDROID) || defined(CS_TARGETPLATFORM_WINDOWS) || defined(CS_TARGETPLATFORM_RPI)
 #   include <CSBackend/Rendering/OpenGL/Base/RenderCommandProcessor.h>
 #endif
@@ -33,7 +35,9 @@ namespace ChilliSource
     //------------------------------------------------------------------------------
     IRenderCommandProcessorUPtr IRenderCommandProcessor::Create() noexcept
     {
-#if defined(CS_TARGETPLATFORM_IOS) || defined(CS_TARGETPLATFORM_ANDROID) || defined(CS_TARGETPLATFORM_WINDOWS) || defined(CS_TARGETPLATFORM_RPI)
+#if defined(CS_ENABLE_HEADLESSRENDERING)
+        return IRenderCommandProcessorUPtr(new RecordingRenderCommandProcessor());
+#elif defined(CS_TARGETPLATFORM_IOS) || defined(CS_TARGETPLATFORM_ANDROID) || defined(CS_TARGETPLATFORM_WINDOWS) || defined(CS_TARGETPLATFORM_RPI)
         return IRenderCommandProcessorUPtr(new CSBackend::OpenGL::RenderCommandProcessor());
 #else
         return nullptr;
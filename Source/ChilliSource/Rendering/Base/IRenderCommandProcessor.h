@@ -46,7 +46,8 @@ namespace ChilliSource
         IRenderCommandProcessor() = default;
         
         /// Creates a new instance of the render command processor. The specific processor
-        /// type depends on the current platform.
+        /// type depends on the current platform. If CS_ENABLE_HEADLESSRENDERING is defined
+        /// a headless RecordingRenderCommandProcessor is created instead.
         ///
         /// @return The newly created instance.
         ///
@@ -53,6 +53,12 @@ namespace ChilliSource
         ///
         virtual std::vector<TargetRenderPassGroup> CompileTargetRenderPassGroups(const TaskContext& taskContext, std::vector<RenderFrame>&& renderFrame) noexcept = 0;
         
+        /// Discards any state cached from previous frames, such as which render targets can have their
+        /// contents reused. This should be called whenever the contents of render targets may have
+        /// been lost, for example when the graphics context is invalidated.
+        ///
+        virtual void Invalidate() noexcept = 0;
+        
         virtual ~IRenderPassCompiler() noexcept {};
         
     };
@@ -0,0 +1,93 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Rendering/Base/RecordingRenderCommandProcessor.h>
+
+namespace ChilliSource
+{
+    //------------------------------------------------------------------------------
+    RecordingRenderCommandProcessor::RecordingRenderCommandProcessor(IRenderCommandProcessorUPtr renderCommandProcessor) noexcept
+        : m_renderCommandProcessor(std::move(renderCommandProcessor))
+    {
+    }
+    
+    //------------------------------------------------------------------------------
+    void RecordingRenderCommandProcessor::CaptureNextFrame(StorageLocation storageLocation, const std::string& filePath) noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_captureMutex);
+        m_isCapturePending = true;
+        m_captureStorageLocation = storageLocation;
+        m_captureFilePath = filePath;
+    }
+    
+    //------------------------------------------------------------------------------
+    void RecordingRenderCommandProcessor::Process(const RenderCommandBuffer* renderCommandBuffer) noexcept
+    {
+        StorageLocation captureStorageLocation = StorageLocation::k_none;
+        std::string captureFilePath;
+        {
+            std::unique_lock<std::mutex> lock(m_captureMutex);
+            if (m_isCapturePending)
+            {
+                m_isCapturePending = false;
+                captureStorageLocation = m_captureStorageLocation;
+                captureFilePath = std::move(m_captureFilePath);
+            }
+        }
+        
+        //the payload of each command is only needed if the frame is going to be saved.
+        m_lastFrame = RenderCommandCaptureCUPtr(new RenderCommandCapture(renderCommandBuffer, !captureFilePath.empty()));
+        m_totalStats.Add(m_lastFrame->GetStats());
+        ++m_numFrames;
+        
+        if (!captureFilePath.empty())
+        {
+            m_lastFrame->Save(captureStorageLocation, captureFilePath);
+        }
+        
+        if (m_renderCommandProcessor)
+        {
+            m_renderCommandProcessor->Process(renderCommandBuffer);
+        }
+    }
+    
+    //------------------------------------------------------------------------------
+    void RecordingRenderCommandProcessor::Invalidate() noexcept
+    {
+        if (m_renderCommandProcessor)
+        {
+            m_renderCommandProcessor->Invalidate();
+        }
+    }
+    
+    //------------------------------------------------------------------------------
+    void RecordingRenderCommandProcessor::Restore() noexcept
+    {
+        if (m_renderCommandProcessor)
+        {
+            m_renderCommandProcessor->Restore();
+        }
+    }
+}
@@ -0,0 +1,118 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_RENDERING_BASE_RECORDINGRENDERCOMMANDPROCESSOR_H_
+#define _CHILLISOURCE_RENDERING_BASE_RECORDINGRENDERCOMMANDPROCESSOR_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/File/StorageLocation.h>
+#include <ChilliSource/Rendering/Base/IRenderCommandProcessor.h>
+#include <ChilliSource/Rendering/RenderCommand/RenderCommandCapture.h>
+
+#include <mutex>
+#include <string>
+
+namespace ChilliSource
+{
+    /// A render command processor which records each RenderCommandBuffer it is given rather
+    /// than performing any render API calls, optionally forwarding the buffer on to another
+    /// processor afterwards. With no other processor this can be used to run the full render
+    /// prep pipeline headless, for example for benchmarking or regression testing on machines
+    /// without a GL context. With another processor it can be used to capture frames from a
+    /// running application.
+    ///
+    /// Statistics are kept for the most recent frame and accumulated across all frames, and
+    /// the next processed frame can be saved to disk by calling CaptureNextFrame(). The payload
+    /// of each command is only recorded for the frame which is saved, so only saved captures
+    /// can be replayed; see RenderCommandCapture::CreateRenderCommandBuffer().
+    ///
+    /// CaptureNextFrame() is thread-safe. Everything else is not thread-safe and must be
+    /// executed on the render thread.
+    ///
+    class RecordingRenderCommandProcessor final : public IRenderCommandProcessor
+    {
+    public:
+        /// Creates a new instance, optionally wrapping the given processor.
+        ///
+        /// @param renderCommandProcessor
+        ///     (Optional) The processor which each buffer should be passed on to after it
+        ///     has been recorded. If null then the processor is headless.
+        ///
+        RecordingRenderCommandProcessor(IRenderCommandProcessorUPtr renderCommandProcessor = nullptr) noexcept;
+        
+        /// @return The number of frames which have been processed.
+        ///
+        u32 GetNumFrames() const noexcept { return m_numFrames; }
+        
+        /// @return The capture of the most recently processed frame, or null if no frames have
+        ///     been processed yet.
+        ///
+        const RenderCommandCapture* GetLastFrame() const noexcept { return m_lastFrame.get(); }
+        
+        /// @return The statistics accumulated across all processed frames.
+        ///
+        const RenderCommandCapture::Stats& GetTotalStats() const noexcept { return m_totalStats; }
+        
+        /// Requests that the next processed frame is saved to the given file. Any previous
+        /// request which hasn't yet been fulfilled is replaced. This is thread-safe.
+        ///
+        /// @param storageLocation
+        ///     The storage location of the file.
+        /// @param filePath
+        ///     The file path.
+        ///
+        void CaptureNextFrame(StorageLocation storageLocation, const std::string& filePath) noexcept;
+        
+        /// Records the given render command buffer, then passes it on to the wrapped processor
+        /// if there is one.
+        ///
+        /// @param renderCommandBuffer
+        ///     The buffer of render commands that should be processed.
+        ///
+        void Process(const RenderCommandBuffer* renderCommandBuffer) noexcept override;
+        
+        /// Passes the call on to the wrapped processor if there is one.
+        ///
+        void Invalidate() noexcept override;
+        
+        /// Passes the call on to the wrapped processor if there is one.
+        ///
+        void Restore() noexcept override;
+        
+    private:
+        IRenderCommandProcessorUPtr m_renderCommandProcessor;
+        
+        u32 m_numFrames = 0;
+        RenderCommandCaptureCUPtr m_lastFrame;
+        RenderCommandCapture::Stats m_totalStats;
+        
+        std::mutex m_captureMutex;
+        bool m_isCapturePending = false;
+        StorageLocation m_captureStorageLocation = StorageLocation::k_none;
+        std::string m_captureFilePath;
+    };
+}
+
+#endif
@@ -82,6 +82,10 @@ namespace ChilliSource
         ///
         bool IsVAOSupported() const noexcept;
         
+        /// @return Whether or not instanced draw calls are supported.
+        ///
+        bool IsInstancingSupported() const noexcept;
+        
         /// @return Whether or not the fragment shader supports highp floats.
         ///
         bool IsHighPrecisionFloatsSupported() const noexcept;
@@ -108,6 +112,8 @@ namespace ChilliSource
         ///         Whether or not map buffer is supported.
         /// @param isVAOSupported
         ///     Whether vertex array objects are supported
+        /// @param isInstancingSupported
+        ///         Whether or not instanced draw calls are supported.
         /// @param isHighPrecisionFloatsSupported
         ///         Whether or not the fragment shader supports highp floats.
         /// @param maxTextureSize
@@ -117,7 +123,7 @@ namespace ChilliSource
         /// @param maxVertexAttribs
         ///         The max. number of vertex attributes supported by this device.
         ///
-        RenderCapabilities(bool isShadowMapsSupported, bool isDepthTexturesSupported, bool isMapBuffersSupported, bool isVAOSupported, bool isHighPrecisionFloatsSupported, u32 maxTextureSize, u32 numTextureUnits, u32 maxVertexAttribs);
+        RenderCapabilities(bool isShadowMapsSupported, bool isDepthTexturesSupported, bool isMapBuffersSupported, bool isVAOSupported, bool isInstancingSupported, bool isHighPrecisionFloatsSupported, u32 maxTextureSize, u32 numTextureUnits, u32 maxVertexAttribs);
         
     private:
         
@@ -125,6 +131,7 @@ namespace ChilliSource
         bool m_isDepthTexturesSupported;
         bool m_isMapBuffersSupported;
         bool m_isVAOSupported;
+        bool m_isInstancingSupported;
         bool m_isHighPrecisionFloatsSupported;
         
         u32 m_maxTextureSize;
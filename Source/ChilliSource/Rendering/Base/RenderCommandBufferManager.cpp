@@ -32,11 +32,6 @@
 
 namespace ChilliSource
 {
-    namespace
-    {
-        constexpr u32 k_maxQueueSize = 1;
-    }
-    
     CS_DEFINE_NAMEDTYPE(RenderCommandBufferManager);
     
     //------------------------------------------------------------------------------
@@ -50,6 +45,23 @@ namespace ChilliSource
     {
     }
     //------------------------------------------------------------------------------
+    void RenderCommandBufferManager::SetMaxQueueSize(u32 maxQueueSize) noexcept
+    {
+        CS_ASSERT(maxQueueSize > 0, "The command buffer queue must be able to hold at least one buffer.");
+        
+        std::unique_lock<std::mutex> lock(m_renderCommandBuffersMutex);
+        m_maxQueueSize = maxQueueSize;
+        lock.unlock();
+        
+        m_renderCommandBuffersCondition.notify_all();
+    }
+    //------------------------------------------------------------------------------
+    u32 RenderCommandBufferManager::GetMaxQueueSize() noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_renderCommandBuffersMutex);
+        return m_maxQueueSize;
+    }
+    //------------------------------------------------------------------------------
     bool RenderCommandBufferManager::IsA(InterfaceIDType interfaceId) const noexcept
     {
         return (RenderCommandBufferManager::InterfaceID == interfaceId);
@@ -256,7 +268,7 @@ namespace ChilliSource
     {
         std::unique_lock<std::mutex> lock(m_renderCommandBuffersMutex);
         
-        while (m_renderCommandBuffers.size() >= k_maxQueueSize)
+        while (m_renderCommandBuffers.size() >= m_maxQueueSize)
         {
             m_renderCommandBuffersCondition.wait(lock);
         }
@@ -87,6 +87,19 @@ namespace ChilliSource
         ///
         RenderCommandBufferCUPtr WaitThenPopCommandBuffer() noexcept;
         
+        /// Sets the maximum number of command buffers which can be queued waiting to be processed
+        /// before pushing blocks. Defaults to 1. This is typically set through the Renderer's
+        /// pipeline depth rather than directly.
+        ///
+        /// @param maxQueueSize
+        ///     The maximum queue size. Must be at least 1.
+        ///
+        void SetMaxQueueSize(u32 maxQueueSize) noexcept;
+        
+        /// @return The maximum number of command buffers which can be queued.
+        ///
+        u32 GetMaxQueueSize() noexcept;
+        
     private:
         friend class Application;
         friend class LifecycleManager;
@@ -180,6 +193,7 @@ namespace ChilliSource
         std::mutex m_renderCommandBuffersMutex;
         std::condition_variable m_renderCommandBuffersCondition;
         std::deque<RenderCommandBufferUPtr> m_renderCommandBuffers;
+        u32 m_maxQueueSize = 1;
         
         Renderer* m_renderer = nullptr;
     };
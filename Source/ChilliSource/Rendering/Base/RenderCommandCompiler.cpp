@@ -24,7 +24,9 @@
 
 #include <ChilliSource/Rendering/Base/RenderCommandCompiler.h>
 
+#include <ChilliSource/Core/Base/EngineCounters.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
+#include <ChilliSource/Core/Time/Profiler.h>
 #include <ChilliSource/Rendering/Base/CameraRenderPassGroup.h>
 #include <ChilliSource/Rendering/Base/RenderPass.h>
 #include <ChilliSource/Rendering/Base/TargetRenderPassGroup.h>
@@ -35,6 +37,8 @@ namespace ChilliSource
 {
     namespace
     {
+        constexpr std::size_t k_minInstanceRunLength = 2;
+        
         /// An container for the current cached state of a render command list.
         ///
         struct RenderCommandListStateCache final
@@ -43,6 +47,9 @@ namespace ChilliSource
             const RenderMesh* m_mesh = nullptr;
             const RenderDynamicMesh* m_dynamicMesh = nullptr;
             const RenderSkinnedAnimation* m_skinnedAnimation = nullptr;
+            
+            u32 m_numMaterialSwitches = 0;
+            u32 m_numDrawCalls = 0;
         };
         
         /// Calculates whether a Camera Render Pass Group contains at least one render pass
@@ -91,6 +98,11 @@ namespace ChilliSource
             
             for (const auto& targetRenderPassGroup : targetRenderPassGroups)
             {
+                if (targetRenderPassGroup.ShouldRetainContents())
+                {
+                    continue;
+                }
+                
                 ++count; // target setup
                 
                 for (const auto& cameraRenderPassGroup : targetRenderPassGroup.GetRenderCameraGroups())
@@ -179,6 +191,27 @@ namespace ChilliSource
                     renderCommandList->AddApplyPointLightCommand(pointLight.GetColour(), pointLight.GetPosition(), pointLight.GetAttenuation());
                     break;
                 }
+                case RenderPass::LightType::k_points:
+                {
+                    const auto& pointLights = renderPass.GetPointLights();
+                    
+                    std::vector<Colour> colours;
+                    std::vector<Vector3> positions;
+                    std::vector<Vector3> attenuations;
+                    colours.reserve(pointLights.size());
+                    positions.reserve(pointLights.size());
+                    attenuations.reserve(pointLights.size());
+                    
+                    for (const auto& pointLight : pointLights)
+                    {
+                        colours.push_back(pointLight.GetColour());
+                        positions.push_back(pointLight.GetPosition());
+                        attenuations.push_back(pointLight.GetAttenuation());
+                    }
+                    
+                    renderCommandList->AddApplyPointLightsCommand(std::move(colours), std::move(positions), std::move(attenuations));
+                    break;
+                }
                 default:
                 {
                     CS_LOG_FATAL("Invalid light type.");
@@ -210,6 +243,7 @@ namespace ChilliSource
                 cache.m_mesh = nullptr;
                 cache.m_dynamicMesh = nullptr;
                 cache.m_skinnedAnimation = nullptr;
+                ++cache.m_numMaterialSwitches;
                 
                 renderCommandList->AddApplyMaterialCommand(cache.m_material);
             }
@@ -286,6 +320,67 @@ namespace ChilliSource
             }
         }
         
+        /// Calculates the number of consecutive render pass objects, starting at the given index,
+        /// which can be rendered with a single render instances command. This requires each
+        /// object to share the same material and static mesh, and have no skinned animation. Small
+        /// meshes are excluded as they are handled by the SmallMeshBatcher.
+        ///
+        /// @param renderPassObjects
+        ///     The list of render pass objects.
+        /// @param startIndex
+        ///     The index of the first object in the run.
+        ///
+        /// @return The length of the run. This will always be at least 1.
+        ///
+        std::size_t CalcInstanceRunLength(const std::vector<RenderPassObject>& renderPassObjects, std::size_t startIndex) noexcept
+        {
+            const auto& first = renderPassObjects[startIndex];
+            if (first.GetType() != RenderPassObject::Type::k_static)
+            {
+                return 1;
+            }
+            
+            auto endIndex = startIndex + 1;
+            while (endIndex < renderPassObjects.size())
+            {
+                const auto& renderPassObject = renderPassObjects[endIndex];
+                if (renderPassObject.GetType() != RenderPassObject::Type::k_static || renderPassObject.GetRenderMaterial() != first.GetRenderMaterial() ||
+                    renderPassObject.GetRenderMesh() != first.GetRenderMesh())
+                {
+                    break;
+                }
+                
+                ++endIndex;
+            }
+            
+            return endIndex - startIndex;
+        }
+        
+        /// Adds a new render instances command for the given run of render pass objects. The
+        /// world matrices are packed into a single contiguous list.
+        ///
+        /// @param renderPassObjects
+        ///     The list of render pass objects.
+        /// @param startIndex
+        ///     The index of the first object in the run.
+        /// @param runLength
+        ///     The number of objects in the run.
+        /// @param renderCommandList
+        ///     The render command list to add the command to.
+        ///
+        void AddRenderInstancesCommand(const std::vector<RenderPassObject>& renderPassObjects, std::size_t startIndex, std::size_t runLength, RenderCommandList* renderCommandList) noexcept
+        {
+            std::vector<Matrix4> worldMatrices;
+            worldMatrices.reserve(runLength);
+            
+            for (std::size_t i = startIndex; i < startIndex + runLength; ++i)
+            {
+                worldMatrices.push_back(renderPassObjects[i].GetWorldMatrix());
+            }
+            
+            renderCommandList->AddRenderInstancesCommand(std::move(worldMatrices));
+        }
+        
         /// Compiles the render commands for the given render pass. The render pass must contain
         /// render pass objects otherwise this will assert.
         ///
@@ -293,10 +388,10 @@ namespace ChilliSource
         ///     The render pass.
         /// @param renderCommandList
         ///     The render command list to add the commands to.
-        /// @param renderFrameData
-        ///     Container for all allocations which must live until the end of the frame.
+        /// @param counterValues
+        ///     [Out] The counter values which the pass's statistics should be added to.
         ///
-        void CompileRenderCommandsForPass(const RenderPass& renderPass, RenderCommandList* renderCommandList) noexcept
+        void CompileRenderCommandsForPass(const RenderPass& renderPass, RenderCommandList* renderCommandList, EngineCounterValues& counterValues) noexcept
         {
             AddApplyLightCommand(renderPass, renderCommandList);
             
@@ -306,8 +401,10 @@ namespace ChilliSource
             RenderCommandListStateCache cache;
             SmallMeshBatcher batcher(renderCommandList);
             
-            for (const auto& renderPassObject : renderPassObjects)
+            for (std::size_t i = 0; i < renderPassObjects.size();)
             {
+                const auto& renderPassObject = renderPassObjects[i];
+                
                 AddApplyMaterialCommand(renderPassObject, renderCommandList, cache, batcher);
                 
                 if (SmallMeshBatcher::CanBatch(renderPassObject))
@@ -316,6 +413,7 @@ namespace ChilliSource
                     cache.m_dynamicMesh = nullptr;
                 
                     batcher.Batch(renderPassObject);
+                    ++i;
                 }
                 else
                 {
@@ -323,12 +421,30 @@ namespace ChilliSource
                     
                     AddApplyMeshCommand(renderPassObject, renderCommandList, cache);
                     AddApplySkinnedAnimationCommand(renderPassObject, renderCommandList, cache);
-                    renderCommandList->AddRenderInstanceCommand(renderPassObject.GetWorldMatrix());
+                    
+                    auto runLength = CalcInstanceRunLength(renderPassObjects, i);
+                    if (runLength >= k_minInstanceRunLength)
+                    {
+                        AddRenderInstancesCommand(renderPassObjects, i, runLength, renderCommandList);
+                    }
+                    else
+                    {
+                        renderCommandList->AddRenderInstanceCommand(renderPassObject.GetWorldMatrix());
+                    }
+                    
+                    ++cache.m_numDrawCalls;
+                    i += runLength;
                 }
-                
             }
             
             batcher.Flush();
+            
+            //Each mesh batch results in a single draw call.
+            counterValues.Increment(EngineCounter::k_renderPasses);
+            counterValues.Increment(EngineCounter::k_materialSwitches, cache.m_numMaterialSwitches);
+            counterValues.Increment(EngineCounter::k_drawCalls, cache.m_numDrawCalls + batcher.GetNumBatches());
+            counterValues.Increment(EngineCounter::k_meshBatches, batcher.GetNumBatches());
+            counterValues.Increment(EngineCounter::k_batchedObjects, batcher.GetNumBatchedObjects());
         }
     }
     
@@ -336,11 +452,16 @@ namespace ChilliSource
     RenderCommandBufferUPtr RenderCommandCompiler::CompileRenderCommands(const TaskContext& taskContext, IAllocator* frameAllocator, const std::vector<TargetRenderPassGroup>& targetRenderPassGroups, RenderCommandListUPtr preRenderCommandList,
                                                                          RenderCommandListUPtr postRenderCommandList, std::vector<RenderFrameData> renderFramesData) noexcept
     {
+        CS_PROFILE_SCOPE("RenderCommandCompiler::CompileRenderCommands");
+        
         u32 numLists = CalcNumRenderCommandLists(targetRenderPassGroups, preRenderCommandList.get(), postRenderCommandList.get());
         RenderCommandBufferUPtr renderCommandBuffer(new RenderCommandBuffer(numLists, frameAllocator, std::move(renderFramesData)));
         std::vector<Task> tasks;
         u32 currentList = 0;
         
+        //Each pass is compiled in its own task, so gathers its counter values separately. They are combined once all tasks are complete.
+        std::vector<EngineCounterValues> passCounterValues(numLists);
+        
         if (preRenderCommandList->GetOrderedList().size() > 0)
         {
             *renderCommandBuffer->GetRenderCommandList(currentList++) = std::move(*preRenderCommandList);
@@ -348,6 +469,11 @@ namespace ChilliSource
         
         for (const auto& targetRenderPassGroup : targetRenderPassGroups)
         {
+            if (targetRenderPassGroup.ShouldRetainContents())
+            {
+                continue;
+            }
+            
             AddBeginCommand(targetRenderPassGroup, renderCommandBuffer->GetRenderCommandList(currentList++));
                 
             for (const auto& cameraRenderPassGroup : targetRenderPassGroup.GetRenderCameraGroups())
@@ -361,10 +487,11 @@ namespace ChilliSource
                     {
                         if (renderPass.GetRenderPassObjects().size() > 0)
                         {
-                            auto renderCommandList = renderCommandBuffer->GetRenderCommandList(currentList++);
-                            tasks.push_back([=, &renderPass, &renderCommandBuffer](const TaskContext& innerTaskContext)
+                            auto renderCommandList = renderCommandBuffer->GetRenderCommandList(currentList);
+                            auto& counterValues = passCounterValues[currentList++];
+                            tasks.push_back([=, &renderPass, &renderCommandBuffer, &counterValues](const TaskContext& innerTaskContext)
                             {
-                                CompileRenderCommandsForPass(renderPass, renderCommandList);
+                                CompileRenderCommandsForPass(renderPass, renderCommandList, counterValues);
                             });
                         }
                     }
@@ -384,6 +511,11 @@ namespace ChilliSource
             taskContext.ProcessChildTasks(tasks);
         }
         
+        for (const auto& counterValues : passCounterValues)
+        {
+            renderCommandBuffer->GetCounterValues().Add(counterValues);
+        }
+        
         return renderCommandBuffer;
     }
 }
@@ -50,6 +50,13 @@ namespace ChilliSource
     {
     }
     
+    //------------------------------------------------------------------------------
+    RenderPass::RenderPass(std::vector<PointRenderLight> lights, std::vector<RenderPassObject> renderPassObjects) noexcept
+        : m_renderPassObjects(std::move(renderPassObjects)), m_pointLights(std::move(lights)), m_lightType(LightType::k_points), m_ambientLight(AmbientRenderLight(Colour::k_black))
+    {
+        CS_ASSERT(m_pointLights.size() > 0 && m_pointLights.size() <= k_maxPointLights, "Invalid number of point lights for pass.");
+    }
+    
     //------------------------------------------------------------------------------
     RenderPass::RenderPass(const DirectionalRenderLight& light, std::vector<RenderPassObject> renderPassObjects) noexcept
         : m_renderPassObjects(std::move(renderPassObjects)), m_lightType(LightType::k_directional), m_directionalLight(light)
@@ -72,6 +79,14 @@ namespace ChilliSource
         return m_pointLight;
     }
     
+    //------------------------------------------------------------------------------
+    const std::vector<PointRenderLight>& RenderPass::GetPointLights() const noexcept
+    {
+        CS_ASSERT(m_lightType == LightType::k_points, "Point lights not set for pass");
+        
+        return m_pointLights;
+    }
+    
     //------------------------------------------------------------------------------
     const DirectionalRenderLight& RenderPass::GetDirectionalLight() const noexcept
     {
@@ -47,6 +47,10 @@ namespace ChilliSource
     public:
         CS_DECLARE_NOCOPY(RenderPass);
         
+        /// The maximum number of point lights which can be applied in a single point lights pass.
+        ///
+        static constexpr u32 k_maxPointLights = 4;
+        
         /// Enum describing the light types a pass can hold
         ///
         enum class LightType
@@ -54,7 +58,8 @@ namespace ChilliSource
             k_none,
             k_ambient,
             k_directional,
-            k_point
+            k_point,
+            k_points
         };
         
         RenderPass() noexcept;
@@ -80,6 +85,14 @@ namespace ChilliSource
         ///
         RenderPass(const PointRenderLight& light, std::vector<RenderPassObject> renderPassObjects) noexcept;
         
+        /// @param lights
+        ///     The point lights to use for this pass. There must be at least one and no more than
+        ///     k_maxPointLights. Should be moved.
+        /// @param renderPassObjects
+        ///     The list of render pass objects for this pass. Should be moved.
+        ///
+        RenderPass(std::vector<PointRenderLight> lights, std::vector<RenderPassObject> renderPassObjects) noexcept;
+        
         /// @param light
         ///     The directional light to use for this pass
         /// @param renderPassObjects
@@ -105,6 +118,13 @@ namespace ChilliSource
         ///
         const PointRenderLight& GetPointLight() const noexcept;
         
+        /// Return the point lights for this pass, if set. GetLightType() should be used
+        /// to determine if these are set, if not this function will assert
+        ///
+        /// @return The point lights to use for this pass
+        ///
+        const std::vector<PointRenderLight>& GetPointLights() const noexcept;
+        
         /// Return the directional light for this pass, if set. GetLightType() should be used
         /// to determine if this is set, if not this function will assert
         ///
@@ -118,6 +138,7 @@ namespace ChilliSource
         
     private:
         std::vector<RenderPassObject> m_renderPassObjects;
+        std::vector<PointRenderLight> m_pointLights;
         LightType m_lightType;
         
         union
@@ -43,6 +43,11 @@ namespace ChilliSource
     /// * The point light pass. For each point light in the scene, a pass over all lit opaque objects
     ///   within the range of influence of the light is performed. This renders the applied lighting
     ///   additively to the previous passes and does not write to the depth buffer.
+    /// * The point lights pass. This is an optional alternative to the point light pass for materials
+    ///   which can apply several point lights at once. Nearby point lights are grouped, up to
+    ///   RenderPass::k_maxPointLights at a time, and a single pass is performed for each group over
+    ///   the lit opaque objects within range of any light in the group. Objects with a point lights
+    ///   material are not rendered in the per light point light passes.
     /// * The transparent pass. This render all transparent objects in the scene with only ambient
     ///   lighting. The depth buffer is not written to; the objects are first sorted to ensure no
     ///   artefacts occur.
@@ -58,7 +63,8 @@ namespace ChilliSource
         k_directionalLightShadows,
         k_pointLight,
         k_transparent,
-        k_skybox
+        k_skybox,
+        k_pointLights
     };
 }
 
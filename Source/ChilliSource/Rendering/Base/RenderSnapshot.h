@@ -82,7 +82,7 @@ namespace ChilliSource
         
         /// @return  The main camera that will be used to render the scene.
         ///
-        RenderCamera GetRenderCamera() noexcept { return m_renderCamera; }
+        const RenderCamera& GetRenderCamera() const noexcept { return m_renderCamera; }
         
         /// Adds an ambient light to the render snapshot.
         ///
@@ -25,7 +25,9 @@
 #include <ChilliSource/Rendering/Base/Renderer.h>
 
 #include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Base/EngineCounters.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
+#include <ChilliSource/Core/Time/Profiler.h>
 #include <ChilliSource/Rendering/Base/ForwardRenderPassCompiler.h>
 #include <ChilliSource/Rendering/Base/RenderCommandCompiler.h>
 #include <ChilliSource/Rendering/Base/RenderCommandBufferManager.h>
@@ -66,10 +68,7 @@ namespace ChilliSource
     
     //------------------------------------------------------------------------------
     Renderer::Renderer() noexcept
-        : m_currentMainSnapshot(nullptr, Integer2::k_zero, Colour::k_black, RenderCamera())
-
     {
-
     }
     
     //------------------------------------------------------------------------------
@@ -87,53 +86,36 @@ namespace ChilliSource
     //------------------------------------------------------------------------------
     void Renderer::ProcessRenderSnapshots(IAllocator* frameAllocator, RenderSnapshot mainRenderSnapshot, std::vector<RenderSnapshot> offscreenRenderSnapshots) noexcept
     {
-        WaitThenStartRenderPrep();
-        
-        m_currentMainSnapshot = std::move(mainRenderSnapshot);
-        m_currentOffscreenSnapshots = std::move(offscreenRenderSnapshots);
+        CS_PROFILE_SCOPE("Renderer::ProcessRenderSnapshots");
         
-        auto taskScheduler = Application::Get()->GetTaskScheduler();
-        
-        taskScheduler->ScheduleTask(TaskType::k_small, [=](const TaskContext& taskContext)
+        if (WaitThenQueueRenderPrep(PendingRenderPrep{ frameAllocator, std::move(mainRenderSnapshot), std::move(offscreenRenderSnapshots) }))
         {
-            std::vector<RenderFrame> renderFrames(m_currentOffscreenSnapshots.size());
-            std::vector<RenderFrameData> renderFramesData(m_currentOffscreenSnapshots.size());
-            
-            for(auto i=0; i<m_currentOffscreenSnapshots.size(); ++i)
+            auto taskScheduler = Application::Get()->GetTaskScheduler();
+            taskScheduler->ScheduleTask(TaskType::k_small, [=](const TaskContext& taskContext)
             {
-                CS_ASSERT(m_currentOffscreenSnapshots[i].GetPreRenderCommandList()->GetOrderedList().size() == 0 && m_currentOffscreenSnapshots[i].GetPostRenderCommandList()->GetOrderedList().size() == 0, "Offscreen render snapshots cannot have pre or post render commands");
-                
-                auto renderFrameData = m_currentOffscreenSnapshots[i].ClaimRenderFrameData();
-                renderFramesData.push_back(std::move(renderFrameData));
-                
-                auto renderFrame = CompileRenderFrame(m_currentOffscreenSnapshots[i]);
-                renderFrames.push_back(std::move(renderFrame));
-            }
-            
-            auto preRenderCommandList = m_currentMainSnapshot.ClaimPreRenderCommandList();
-            auto postRenderCommandList = m_currentMainSnapshot.ClaimPostRenderCommandList();
-            
-            auto renderFrameData = m_currentMainSnapshot.ClaimRenderFrameData();
-            renderFramesData.push_back(std::move(renderFrameData));
-            
-            auto renderFrame = CompileRenderFrame(m_currentMainSnapshot);
-            renderFrames.push_back(std::move(renderFrame));
-            
-            auto targetRenderPassGroups = m_renderPassCompiler->CompileTargetRenderPassGroups(taskContext, std::move(renderFrames));
-            auto renderCommandBuffer = RenderCommandCompiler::CompileRenderCommands(taskContext, std::move(frameAllocator), targetRenderPassGroups, std::move(preRenderCommandList), std::move(postRenderCommandList), std::move(renderFramesData));
-            
-            m_commandRecycleSystem->WaitThenPushCommandBuffer(std::move(renderCommandBuffer));
-            
-            EndRenderPrep();
-        });
+                ProcessQueuedRenderPreps(taskContext);
+            });
+        }
     }
     
     //------------------------------------------------------------------------------
     void Renderer::ProcessRenderCommandBuffer() noexcept
     {
-        auto renderCommandBuffer = m_commandRecycleSystem->WaitThenPopCommandBuffer();
+        CS_PROFILE_SCOPE("Renderer::ProcessRenderCommandBuffer");
+        
+        RenderCommandBufferCUPtr renderCommandBuffer;
+        {
+            CS_PROFILE_SCOPE("Renderer::WaitThenPopCommandBuffer");
+            renderCommandBuffer = m_commandRecycleSystem->WaitThenPopCommandBuffer();
+        }
+        
+        auto startTime = Profiler::GetTimestamp();
+        
         m_renderCommandProcessor->Process(renderCommandBuffer.get());
         
+        EngineCounters::Set(EngineCounter::k_renderSubmitTime, s64(Profiler::GetTimestamp() - startTime));
+        EngineCounters::EndRenderedFrame(renderCommandBuffer->GetCounterValues());
+        
         auto allocator = renderCommandBuffer->GetFrameAllocator();
         renderCommandBuffer.reset();
         
@@ -141,25 +123,120 @@ namespace ChilliSource
     }
     
     //------------------------------------------------------------------------------
-    void Renderer::WaitThenStartRenderPrep() noexcept
+    void Renderer::SetPipelineDepth(u32 pipelineDepth) noexcept
     {
+        CS_ASSERT(pipelineDepth > 0, "Pipeline depth must be at least 1.");
+        
+        //One allocator is required for the frame being snapshotted, plus one for each frame that
+        //can be in flight in render preparation and in the command buffer queue. The frame being
+        //processed on the render thread shares the allocator budget with the command buffer queue
+        //so that the default depth matches the original three allocators.
+        m_frameAllocatorQueue.Reserve(2 * pipelineDepth + 1);
+        m_commandRecycleSystem->SetMaxQueueSize(pipelineDepth);
+        
+        std::unique_lock<std::mutex> lock(m_renderPrepMutex);
+        m_pipelineDepth = pipelineDepth;
+        m_renderPrepCondition.notify_all();
+    }
+    
+    //------------------------------------------------------------------------------
+    bool Renderer::WaitThenQueueRenderPrep(PendingRenderPrep pendingRenderPrep) noexcept
+    {
+        CS_PROFILE_SCOPE("Renderer::WaitThenQueueRenderPrep");
+        
         std::unique_lock<std::mutex> lock(m_renderPrepMutex);
         
-        while (m_renderPrepActive)
+        while (m_pendingRenderPreps.size() >= m_pipelineDepth)
         {
             m_renderPrepCondition.wait(lock);
         }
         
+        m_pendingRenderPreps.push_back(std::move(pendingRenderPrep));
+        
+        if (m_renderPrepActive)
+        {
+            return false;
+        }
+        
         m_renderPrepActive = true;
+        return true;
     }
     
     //------------------------------------------------------------------------------
-    void Renderer::EndRenderPrep() noexcept
+    void Renderer::ProcessQueuedRenderPreps(const TaskContext& taskContext) noexcept
+    {
+        do
+        {
+            std::unique_lock<std::mutex> lock(m_renderPrepMutex);
+            auto& pendingRenderPrep = m_pendingRenderPreps.front();
+            lock.unlock();
+            
+            //The front of the queue is only removed by EndRenderPrep() so remains valid while other
+            //frames are pushed to the back.
+            RenderPrep(taskContext, pendingRenderPrep);
+        }
+        while (EndRenderPrep());
+    }
+    
+    //------------------------------------------------------------------------------
+    void Renderer::RenderPrep(const TaskContext& taskContext, PendingRenderPrep& pendingRenderPrep) noexcept
+    {
+        CS_PROFILE_SCOPE("Renderer::RenderPrep");
+        
+        auto startTime = Profiler::GetTimestamp();
+        auto& offscreenSnapshots = pendingRenderPrep.m_offscreenSnapshots;
+        auto& mainSnapshot = pendingRenderPrep.m_mainSnapshot;
+        
+        std::vector<RenderFrame> renderFrames(offscreenSnapshots.size());
+        std::vector<RenderFrameData> renderFramesData(offscreenSnapshots.size());
+        
+        for(auto i=0; i<offscreenSnapshots.size(); ++i)
+        {
+            CS_ASSERT(offscreenSnapshots[i].GetPreRenderCommandList()->GetOrderedList().size() == 0 && offscreenSnapshots[i].GetPostRenderCommandList()->GetOrderedList().size() == 0, "Offscreen render snapshots cannot have pre or post render commands");
+            
+            auto renderFrameData = offscreenSnapshots[i].ClaimRenderFrameData();
+            renderFramesData.push_back(std::move(renderFrameData));
+            
+            auto renderFrame = CompileRenderFrame(offscreenSnapshots[i]);
+            renderFrames.push_back(std::move(renderFrame));
+        }
+        
+        auto preRenderCommandList = mainSnapshot.ClaimPreRenderCommandList();
+        auto postRenderCommandList = mainSnapshot.ClaimPostRenderCommandList();
+        
+        auto renderFrameData = mainSnapshot.ClaimRenderFrameData();
+        renderFramesData.push_back(std::move(renderFrameData));
+        
+        auto renderFrame = CompileRenderFrame(mainSnapshot);
+        renderFrames.push_back(std::move(renderFrame));
+        
+        s64 numRenderObjects = 0;
+        for (const auto& compiledRenderFrame : renderFrames)
+        {
+            numRenderObjects += s64(compiledRenderFrame.GetRenderObjects().size());
+        }
+        
+        auto targetRenderPassGroups = m_renderPassCompiler->CompileTargetRenderPassGroups(taskContext, std::move(renderFrames));
+        auto renderCommandBuffer = RenderCommandCompiler::CompileRenderCommands(taskContext, pendingRenderPrep.m_frameAllocator, targetRenderPassGroups, std::move(preRenderCommandList), std::move(postRenderCommandList), std::move(renderFramesData));
+        renderCommandBuffer->GetCounterValues().Increment(EngineCounter::k_renderObjects, numRenderObjects);
+        
+        EngineCounters::Set(EngineCounter::k_renderPrepTime, s64(Profiler::GetTimestamp() - startTime));
+        
+        {
+            CS_PROFILE_SCOPE("Renderer::WaitThenPushCommandBuffer");
+            m_commandRecycleSystem->WaitThenPushCommandBuffer(std::move(renderCommandBuffer));
+        }
+    }
+    
+    //------------------------------------------------------------------------------
+    bool Renderer::EndRenderPrep() noexcept
     {
         std::unique_lock<std::mutex> lock(m_renderPrepMutex);
-        m_currentOffscreenSnapshots.clear();
-        m_renderPrepActive = false;
+        m_pendingRenderPreps.pop_front();
+        m_renderPrepActive = !m_pendingRenderPreps.empty();
         m_renderPrepCondition.notify_all();
+        
+        return m_renderPrepActive;
     }
     
     //------------------------------------------------------------------------------
@@ -196,6 +273,8 @@ namespace ChilliSource
     //------------------------------------------------------------------------------
     void Renderer::OnSystemSuspend() noexcept
     {
+        m_renderPassCompiler->Invalidate();
+        
 #ifdef CS_TARGETPLATFORM_ANDROID
         m_renderCommandProcessor->Invalidate();
 #endif
@@ -67,6 +67,16 @@ namespace ChilliSource
     ///   each depending on render API (i.e OpenGL) that is being used. This is processed on
     ///   the render thread.
     ///
+    /// The Frame, Pass and Render Command Queue Compilation stages are referred to collectively
+    /// as render preparation. Frames are always prepared and processed in the order they were
+    /// snapshotted, but the pipeline depth controls how many frames can be in flight at each
+    /// stage. A depth of 1, the default, minimises latency; increasing it allows the main thread
+    /// to run further ahead of render preparation and processing, improving throughput when the
+    /// duration of each stage varies from frame to frame at the cost of added latency. The time
+    /// taken by the preparation and processing stages is published to EngineCounters. The counts
+    /// gathered while preparing a frame travel with its command buffer, and are published
+    /// together once that frame has been processed.
+    ///
     /// This is thread safe, though certain methods need to be called on certain threads.
     ///
     class Renderer final : public AppSystem
@@ -107,8 +117,8 @@ namespace ChilliSource
         /// then stores the output render command buffer render to later be processed by the
         /// ProcessRenderCommandBuffer() method.
         ///
-        /// If the render pipeline is busy this will block until is it ready for the next snapshot
-        /// to be processed.
+        /// If the pipeline depth is already reached this will block until a previously snapshotted
+        /// frame has finished render preparation.
         ///
         /// This must be called from the main thread.
         ///
@@ -130,10 +140,38 @@ namespace ChilliSource
         ///
         void ProcessRenderCommandBuffer() noexcept;
         
+        /// Sets the number of frames which can be in flight at each of the render preparation and
+        /// render command processing stages. Higher values allow the main thread to queue more
+        /// frames ahead of the render thread, trading latency for throughput. Defaults to 1.
+        ///
+        /// Additional frame allocators are created as required; they are not released if the
+        /// depth is subsequently lowered.
+        ///
+        /// This must be called from the main thread.
+        ///
+        /// @param pipelineDepth
+        ///     The pipeline depth. Must be at least 1.
+        ///
+        void SetPipelineDepth(u32 pipelineDepth) noexcept;
+        
+        /// This is not thread-safe and should only be called on the main thread.
+        ///
+        /// @return The number of frames which can be in flight at each stage of the render pipeline.
+        ///
+        u32 GetPipelineDepth() const noexcept { return m_pipelineDepth; }
+        
         /// @return The renderers frame allocator queue
         ///
         FrameAllocatorQueue& GetFrameAllocatorQueue() noexcept { return m_frameAllocatorQueue; }
         
+        /// This should only be accessed from the render thread. If the engine is built with
+        /// CS_ENABLE_HEADLESSRENDERING this will be a RecordingRenderCommandProcessor, which can
+        /// be used to query frame statistics and capture frames.
+        ///
+        /// @return The render command processor.
+        ///
+        IRenderCommandProcessor* GetRenderCommandProcessor() noexcept { return m_renderCommandProcessor.get(); }
+        
     private:
         friend class Application;
         friend class LifecycleManager;
@@ -145,18 +183,53 @@ namespace ChilliSource
         ///
         static RendererUPtr Create() noexcept;
         
+        /// The data required to perform render preparation for a single frame.
+        ///
+        struct PendingRenderPrep final
+        {
+            IAllocator* m_frameAllocator;
+            RenderSnapshot m_mainSnapshot;
+            std::vector<RenderSnapshot> m_offscreenSnapshots;
+        };
+        
         Renderer() noexcept;
         
-        /// If the render preparation stages (Compile Render Frame, Compile Render Passes and Compile
-        /// Render Commands stages) are currently being processed this waits until they have finished
-        /// before continuing. It then again flags the render preparation stages as in-progress.
+        /// If the number of frames awaiting or undergoing render preparation (Compile Render Frame,
+        /// Compile Render Passes and Compile Render Commands stages) has reached the pipeline depth
+        /// this waits until one has finished before continuing. It then queues the given frame.
+        ///
+        /// @param pendingRenderPrep
+        ///     The frame to queue. Must be moved.
+        ///
+        /// @return Whether or not render preparation needs to be started. If false, the frame will
+        ///     be prepared by the task which is already processing the queue.
+        ///
+        bool WaitThenQueueRenderPrep(PendingRenderPrep pendingRenderPrep) noexcept;
+        
+        /// Performs render preparation for each queued frame in order, until the queue is empty.
+        /// This should be called from a background task.
         ///
-        void WaitThenStartRenderPrep() noexcept;
+        /// @param taskContext
+        ///     The context of the task performing render preparation.
+        ///
+        void ProcessQueuedRenderPreps(const TaskContext& taskContext) noexcept;
+        
+        /// Performs render preparation for the given frame, pushing the resulting command buffer
+        /// to be processed on the render thread.
+        ///
+        /// @param taskContext
+        ///     The context of the task performing render preparation.
+        /// @param pendingRenderPrep
+        ///     The frame to prepare.
+        ///
+        void RenderPrep(const TaskContext& taskContext, PendingRenderPrep& pendingRenderPrep) noexcept;
         
-        /// Flags the render preparation stage as finished and notifies any threads that are currently
-        /// waiting.
+        /// Flags render preparation of the front queued frame as finished and notifies any threads
+        /// that are currently waiting.
+        ///
+        /// @return Whether or not there is another queued frame to prepare.
         ///
-        void EndRenderPrep() noexcept;
+        bool EndRenderPrep() noexcept;
         
         /// Initialisation called when all App Systems have been created.
         ///
@@ -182,11 +255,10 @@ namespace ChilliSource
         
         std::mutex m_renderPrepMutex;
         std::condition_variable m_renderPrepCondition;
+        std::deque<PendingRenderPrep> m_pendingRenderPreps;
         bool m_renderPrepActive = false;
         bool m_initialised = false;
-        
-        RenderSnapshot m_currentMainSnapshot;
-        std::vector<RenderSnapshot> m_currentOffscreenSnapshots;
+        u32 m_pipelineDepth = 1;
         
         RenderCommandBufferManager* m_commandRecycleSystem = nullptr;
     };
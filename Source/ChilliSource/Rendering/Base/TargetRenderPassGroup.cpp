@@ -41,4 +41,13 @@ namespace ChilliSource
         
         m_resolution = m_renderTargetGroup->GetResolution();
     }
-}
\ No newline at end of file
+    
+    //------------------------------------------------------------------------------
+    TargetRenderPassGroup::TargetRenderPassGroup(const RenderTargetGroup* renderTargetGroup) noexcept
+        : m_renderTargetGroup(renderTargetGroup), m_shouldRetainContents(true)
+    {
+        CS_ASSERT(m_renderTargetGroup, "Must supply a valid render target group.");
+        
+        m_resolution = m_renderTargetGroup->GetResolution();
+    }
+}
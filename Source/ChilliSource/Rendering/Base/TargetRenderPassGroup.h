@@ -67,6 +67,14 @@ namespace ChilliSource
         ///
         TargetRenderPassGroup(const RenderTargetGroup* renderTargetGroup, const Colour& clearColour, std::vector<CameraRenderPassGroup> cameraRenderPassGroups) noexcept;
         
+        /// Creates a new instance which retains the previous contents of the given render target
+        /// group. Nothing will be rendered to the target, and it will not be cleared.
+        ///
+        /// @param renderTargetGroup
+        ///     The RenderTargetGroup whose contents should be retained.
+        ///
+        explicit TargetRenderPassGroup(const RenderTargetGroup* renderTargetGroup) noexcept;
+        
         /// @return The render target group that the contained passes should be applied to. Null
         ///     indicates that the default render target should be used.
         ///
@@ -83,12 +91,18 @@ namespace ChilliSource
         /// @return The list of render camera groups
         ///
         const std::vector<CameraRenderPassGroup>& GetRenderCameraGroups() const noexcept { return m_renderCameraGroups; }
+        
+        /// @return Whether or not the previous contents of the target should be retained, in which
+        ///     case nothing should be rendered to it.
+        ///
+        bool ShouldRetainContents() const noexcept { return m_shouldRetainContents; }
 
     private:
         const RenderTargetGroup* m_renderTargetGroup = nullptr;
         Integer2 m_resolution;
         Colour m_clearColour;
         std::vector<CameraRenderPassGroup> m_renderCameraGroups;
+        bool m_shouldRetainContents = false;
     };
 }
 
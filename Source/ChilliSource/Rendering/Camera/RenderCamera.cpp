@@ -24,6 +24,8 @@
 
 #include <ChilliSource/Rendering/Camera/RenderCamera.h>
 
+#include <algorithm>
+
 namespace ChilliSource
 {
     //------------------------------------------------------------------------------
@@ -34,4 +36,18 @@ namespace ChilliSource
         m_viewProjectionMatrix = m_viewMatrix * m_projectionMatrix;
         m_frustrum.CalculateClippingPlanes(m_viewProjectionMatrix);
     }
+    
+    //------------------------------------------------------------------------------
+    f32 RenderCamera::CalcScreenSize(const Sphere& boundingSphere) const noexcept
+    {
+        constexpr f32 k_minW = 0.0001f;
+        
+        const auto& centre = boundingSphere.vOrigin;
+        const auto& viewProj = m_viewProjectionMatrix.m;
+        
+        // The clip space w is the view space depth for perspective projections and one for orthographic projections.
+        f32 w = centre.x * viewProj[3] + centre.y * viewProj[7] + centre.z * viewProj[11] + viewProj[15];
+        
+        return boundingSphere.fRadius * m_projectionMatrix.m[5] / std::max(w, k_minW);
+    }
 }
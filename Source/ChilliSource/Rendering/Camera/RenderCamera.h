@@ -77,6 +77,16 @@ namespace ChilliSource
         ///
         const Frustum& GetFrustrum() const noexcept { return m_frustrum; }
         
+        /// Calculates the approximate size of the given world space sphere when projected by the
+        /// camera. This is typically used to select a level of detail.
+        ///
+        /// @param boundingSphere
+        ///     The world space bounding sphere.
+        ///
+        /// @return The projected diameter of the sphere as a fraction of the viewport height.
+        ///
+        f32 CalcScreenSize(const Sphere& boundingSphere) const noexcept;
+        
     private:
         Matrix4 m_worldMatrix;
         Matrix4 m_projectionMatrix;
@@ -164,6 +164,12 @@ namespace ChilliSource
     }
     //-------------------------------------------
     //-------------------------------------------
+    u64 Font::GetCpuMemoryUsage() const
+    {
+        return u64(m_characterInfos.size() * (sizeof(UTF8Char) + sizeof(CharacterInfo)) + m_characters.size());
+    }
+    //-------------------------------------------
+    //-------------------------------------------
     bool Font::TryGetCharacterInfo(UTF8Char in_char, CharacterInfo& out_info) const
     {
         auto itCharEntry = m_characterInfos.find(in_char);
@@ -176,6 +176,13 @@ namespace ChilliSource
         /// @return Whether the character exists in the font
         //---------------------------------------------------------------------
         bool TryGetCharacterInfo(UTF8Char in_char, CharacterInfo& out_info) const;
+        //---------------------------------------------------------------------
+        /// The font texture is a separate resource and is not included.
+        ///
+        /// @return The approximate number of bytes of main memory held by
+        /// the glyph lookup tables.
+        //---------------------------------------------------------------------
+        u64 GetCpuMemoryUsage() const override;
     
     private:
         
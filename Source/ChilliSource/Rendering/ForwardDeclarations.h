@@ -42,6 +42,7 @@ namespace ChilliSource
     CS_FORWARDDECLARE_CLASS(CanvasRenderer);
     CS_FORWARDDECLARE_CLASS(IRenderCommandProcessor);
     CS_FORWARDDECLARE_CLASS(IRenderPassCompiler);
+    CS_FORWARDDECLARE_CLASS(RecordingRenderCommandProcessor);
     CS_FORWARDDECLARE_CLASS(ForwardRenderPassCompiler);
     CS_FORWARDDECLARE_CLASS(FrameAllocatorQueue);
     CS_FORWARDDECLARE_CLASS(RenderCapabilities);
@@ -91,6 +92,7 @@ namespace ChilliSource
     CS_FORWARDDECLARE_CLASS(AmbientRenderLight);
     CS_FORWARDDECLARE_CLASS(DirectionalRenderLight);
     CS_FORWARDDECLARE_CLASS(PointRenderLight);
+    CS_FORWARDDECLARE_CLASS(PointLightClusterGrid);
     //------------------------------------------------------------
     /// Material
     //------------------------------------------------------------
@@ -111,6 +113,7 @@ namespace ChilliSource
     CS_FORWARDDECLARE_CLASS(MeshDesc);
     CS_FORWARDDECLARE_CLASS(Model);
     CS_FORWARDDECLARE_CLASS(ModelDesc);
+    CS_FORWARDDECLARE_CLASS(ModelResourceOptions);
     CS_FORWARDDECLARE_CLASS(PrimitiveModelFactory);
     CS_FORWARDDECLARE_CLASS(RenderDynamicMesh);
     CS_FORWARDDECLARE_CLASS(RenderMesh);
@@ -123,6 +126,7 @@ namespace ChilliSource
     CS_FORWARDDECLARE_CLASS(SkinnedAnimation);
     CS_FORWARDDECLARE_CLASS(SkinnedAnimationGroup);
     CS_FORWARDDECLARE_CLASS(SmallMeshBatcher);
+    CS_FORWARDDECLARE_CLASS(StaticBatchComponent);
     CS_FORWARDDECLARE_CLASS(StaticModelComponent);
     CS_FORWARDDECLARE_CLASS(VertexFormat);
     enum class IndexFormat;
@@ -184,6 +188,7 @@ namespace ChilliSource
     CS_FORWARDDECLARE_CLASS(ApplyMeshRenderCommand);
     CS_FORWARDDECLARE_CLASS(ApplyMeshBatchRenderCommand);
     CS_FORWARDDECLARE_CLASS(ApplyPointLightRenderCommand);
+    CS_FORWARDDECLARE_CLASS(ApplyPointLightsRenderCommand);
     CS_FORWARDDECLARE_CLASS(ApplySkinnedAnimationRenderCommand);
     CS_FORWARDDECLARE_CLASS(BeginRenderCommand);
     CS_FORWARDDECLARE_CLASS(BeginWithTargetGroupRenderCommand);
@@ -201,8 +206,10 @@ namespace ChilliSource
     CS_FORWARDDECLARE_CLASS(RenderCommand);
     CS_FORWARDDECLARE_CLASS(RenderCommandBuffer);
     CS_FORWARDDECLARE_CLASS(RenderCommandBufferManager);
+    CS_FORWARDDECLARE_CLASS(RenderCommandCapture);
     CS_FORWARDDECLARE_CLASS(RenderCommandList);
     CS_FORWARDDECLARE_CLASS(RenderInstanceRenderCommand);
+    CS_FORWARDDECLARE_CLASS(RenderInstancesRenderCommand);
     CS_FORWARDDECLARE_CLASS(UnloadMaterialGroupRenderCommand);
     CS_FORWARDDECLARE_CLASS(UnloadMeshRenderCommand);
     CS_FORWARDDECLARE_CLASS(UnloadShaderRenderCommand);
@@ -174,7 +174,8 @@ namespace ChilliSource
             const auto& transform = GetEntity()->GetTransform();
             auto worldMatrix = transform.GetWorldTransform();
             auto orientation = transform.GetWorldOrientation();
-            renderSnapshot.AddDirectionalRenderLight(DirectionalRenderLight(GetFinalColour(), m_direction, worldMatrix, m_lightProjection, orientation, m_shadowTolerance, m_shadowMapTarget->GetRenderTargetGroup()));
+            renderSnapshot.AddDirectionalRenderLight(DirectionalRenderLight(GetFinalColour(), m_direction, worldMatrix, m_lightProjection, orientation, m_shadowTolerance, m_shadowMapTarget->GetRenderTargetGroup(),
+                                                                          m_shadowMapReuseEnabled));
         }
         else
         {
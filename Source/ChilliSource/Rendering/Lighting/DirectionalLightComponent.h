@@ -123,6 +123,17 @@ namespace ChilliSource
         ///
         void SetShadowVolume(f32 width, f32 height, f32 near, f32 far) noexcept;
         
+        /// Sets whether or not the previous frame's shadow map can be reused when neither the light
+        /// nor any of the shadow casters within its volume have changed. This is useful for scenes
+        /// which are largely static, but should be disabled if shadow casting materials are animated
+        /// in ways other than their transform. A shadow map which any skinned or dynamic mesh casts
+        /// into is always rendered again.
+        ///
+        /// @param enabled
+        ///     Whether or not shadow map reuse is enabled.
+        ///
+        void SetShadowMapReuseEnabled(bool enabled) noexcept { m_shadowMapReuseEnabled = enabled; }
+        
         /// @return The colour of the directional light.
         ///
         const Colour& GetColour() const noexcept { return m_colour; }
@@ -142,6 +153,11 @@ namespace ChilliSource
         ///
         f32 GetShadowTolerance() const noexcept { return m_shadowTolerance; }
         
+        /// @return Whether or not the previous frame's shadow map can be reused when neither the light
+        ///     nor any of the shadow casters within its volume have changed.
+        ///
+        bool IsShadowMapReuseEnabled() const noexcept { return m_shadowMapReuseEnabled; }
+        
         /// Cleans up shadow textures if required.
         ///
         ~DirectionalLightComponent() noexcept;
@@ -184,6 +200,7 @@ namespace ChilliSource
         Colour m_colour;
         f32 m_intensity;
         f32 m_shadowTolerance = 0.0f;
+        bool m_shadowMapReuseEnabled = false;
         
         Vector3 m_direction;
         Matrix4 m_lightProjection;
@@ -40,9 +40,9 @@ namespace ChilliSource
     
     //------------------------------------------------------------------------------
     DirectionalRenderLight::DirectionalRenderLight(const Colour& colour, const Vector3& direction, const Matrix4& lightWorldMatrix, const Matrix4& lightProjectionMatrix, const Quaternion& lightOrientation,
-                                                   f32 shadowTolerance, const RenderTargetGroup* shadowMapTarget) noexcept
+                                                   f32 shadowTolerance, const RenderTargetGroup* shadowMapTarget, bool shouldReuseShadowMap) noexcept
         : m_colour(colour), m_direction(direction), m_lightWorldMatrix(lightWorldMatrix), m_lightProjectionMatrix(lightProjectionMatrix), m_lightOrientation(lightOrientation),
-          m_shadowTolerance(shadowTolerance), m_shadowMapTarget(shadowMapTarget)
+          m_shadowTolerance(shadowTolerance), m_shadowMapTarget(shadowMapTarget), m_shouldReuseShadowMap(shouldReuseShadowMap)
     {
         CS_ASSERT(m_shadowMapTarget, "Shadow map target cannot be null.");
     }
@@ -72,9 +72,12 @@ namespace ChilliSource
         ///     The tolerence used to judge if an object is in shadow.
         /// @param shadowMapTarget
         ///     The render target group which should be used for the shadow map.
+        /// @param shouldReuseShadowMap
+        ///     (Optional) Whether or not the previous frame's shadow map can be reused if neither the light
+        ///     nor any of the shadow casters have changed. Defaults to false.
         ///
         DirectionalRenderLight(const Colour& colour, const Vector3& direction, const Matrix4& lightWorldMatrix, const Matrix4& lightProjectionMatrix, const Quaternion& lightOrientation,
-                               f32 shadowTolerance, const RenderTargetGroup* shadowMapTarget) noexcept;
+                               f32 shadowTolerance, const RenderTargetGroup* shadowMapTarget, bool shouldReuseShadowMap = false) noexcept;
         
         /// @return The colour of the light.
         ///
@@ -105,6 +108,11 @@ namespace ChilliSource
         ///
         const RenderTargetGroup* GetShadowMapTarget() const noexcept { return m_shadowMapTarget; }
         
+        /// @return Whether or not the previous frame's shadow map can be reused if neither the light nor
+        ///     any of the shadow casters have changed.
+        ///
+        bool ShouldReuseShadowMap() const noexcept { return m_shouldReuseShadowMap; }
+        
     private:
         Colour m_colour;
         Vector3 m_direction;
@@ -113,6 +121,7 @@ namespace ChilliSource
         Quaternion m_lightOrientation;
         f32 m_shadowTolerance = 0.0f;
         const RenderTargetGroup* m_shadowMapTarget = nullptr;
+        bool m_shouldReuseShadowMap = false;
     };
 }
 
@@ -0,0 +1,327 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Rendering/Lighting/PointLightClusterGrid.h>
+
+#include <ChilliSource/Core/Math/Vector4.h>
+#include <ChilliSource/Rendering/Base/RenderObject.h>
+#include <ChilliSource/Rendering/Camera/RenderCamera.h>
+#include <ChilliSource/Rendering/Lighting/PointRenderLight.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace ChilliSource
+{
+    namespace
+    {
+        /// Clip space w values below this are treated as being behind the camera, in which
+        /// case a volume is considered to cover the whole screen.
+        ///
+        constexpr f32 k_minClipW = 0.0001f;
+        
+        /// Depth ranges smaller than this are clamped to avoid a divide by zero when all lights
+        /// lie on the same depth plane.
+        ///
+        constexpr f32 k_minDepthRange = 0.0001f;
+        
+        /// Bounding volumes are grown by this fraction of their radius, plus k_boundsPadding,
+        /// before binning so that rounding can never cause a cluster to be missed.
+        ///
+        constexpr f32 k_boundsPaddingScale = 0.001f;
+        constexpr f32 k_boundsPadding = 0.0001f;
+        
+        /// @param value
+        ///     The value in grid units.
+        /// @param count
+        ///     The number of cells along the axis.
+        ///
+        /// @return The cell containing the value, clamped to the grid.
+        ///
+        u32 ClampToCell(f32 value, u32 count) noexcept
+        {
+            if (!(value > 0.0f))
+            {
+                return 0;
+            }
+            
+            return std::min(u32(value), count - 1);
+        }
+        
+        /// Spreads the lower 10 bits of the given value so that there are two zero bits between
+        /// each, for building a morton code.
+        ///
+        /// @param value
+        ///     The value to spread.
+        ///
+        /// @return The spread value.
+        ///
+        u32 SpreadBits(u32 value) noexcept
+        {
+            value &= 0x000003ff;
+            value = (value | (value << 16)) & 0xff0000ff;
+            value = (value | (value << 8)) & 0x0300f00f;
+            value = (value | (value << 4)) & 0x030c30c3;
+            value = (value | (value << 2)) & 0x09249249;
+            return value;
+        }
+    }
+    
+    //------------------------------------------------------------------------------
+    PointLightClusterGrid::PointLightClusterGrid(const RenderCamera& camera, const std::vector<PointRenderLight>& pointLights) noexcept
+        : m_viewMatrix(camera.GetViewMatrix()), m_viewProjectionMatrix(camera.GetViewProjectionMatrix())
+    {
+        if (pointLights.empty())
+        {
+            return;
+        }
+        
+        m_lightBounds.reserve(pointLights.size());
+        for (const auto& pointLight : pointLights)
+        {
+            m_lightBounds.push_back(Sphere(pointLight.GetPosition(), pointLight.GetRangeOfInfluence()));
+        }
+        
+        // The depth slices span only the depth range occupied by lights.
+        const auto& view = m_viewMatrix.m;
+        const f32 depthAxisLength = std::abs(view[2]) + std::abs(view[6]) + std::abs(view[10]);
+        
+        m_minDepth = std::numeric_limits<f32>::max();
+        m_maxDepth = -std::numeric_limits<f32>::max();
+        for (const auto& lightBounds : m_lightBounds)
+        {
+            const auto& centre = lightBounds.vOrigin;
+            f32 centreDepth = centre.x * view[2] + centre.y * view[6] + centre.z * view[10] + view[14];
+            f32 depthExtent = (lightBounds.fRadius * (1.0f + k_boundsPaddingScale) + k_boundsPadding) * depthAxisLength;
+            
+            m_minDepth = std::min(m_minDepth, centreDepth - depthExtent);
+            m_maxDepth = std::max(m_maxDepth, centreDepth + depthExtent);
+        }
+        m_depthSliceScale = f32(k_numDepthSlices) / std::max(m_maxDepth - m_minDepth, k_minDepthRange);
+        
+        // Build the per cluster light lists as a single array with an offset per cluster.
+        constexpr u32 k_numClusters = k_numTilesX * k_numTilesY * k_numDepthSlices;
+        
+        std::vector<ClusterRange> lightRanges(m_lightBounds.size());
+        m_clusterLightOffsets.assign(k_numClusters + 1, 0);
+        
+        for (u32 lightIndex = 0; lightIndex < m_lightBounds.size(); ++lightIndex)
+        {
+            auto& range = lightRanges[lightIndex];
+            CalcClusterRange(m_lightBounds[lightIndex], range);
+            
+            for (u32 z = range.m_minZ; z <= range.m_maxZ; ++z)
+            {
+                for (u32 y = range.m_minY; y <= range.m_maxY; ++y)
+                {
+                    for (u32 x = range.m_minX; x <= range.m_maxX; ++x)
+                    {
+                        ++m_clusterLightOffsets[GetClusterIndex(x, y, z) + 1];
+                    }
+                }
+            }
+        }
+        
+        for (u32 i = 0; i < k_numClusters; ++i)
+        {
+            m_clusterLightOffsets[i + 1] += m_clusterLightOffsets[i];
+        }
+        
+        m_clusterLights.resize(m_clusterLightOffsets.back());
+        std::vector<u32> clusterCursors(m_clusterLightOffsets.begin(), m_clusterLightOffsets.end() - 1);
+        
+        for (u32 lightIndex = 0; lightIndex < m_lightBounds.size(); ++lightIndex)
+        {
+            const auto& range = lightRanges[lightIndex];
+            
+            for (u32 z = range.m_minZ; z <= range.m_maxZ; ++z)
+            {
+                for (u32 y = range.m_minY; y <= range.m_maxY; ++y)
+                {
+                    for (u32 x = range.m_minX; x <= range.m_maxX; ++x)
+                    {
+                        m_clusterLights[clusterCursors[GetClusterIndex(x, y, z)]++] = lightIndex;
+                    }
+                }
+            }
+        }
+        
+        // Order the lights along a morton curve through the clusters containing their centres.
+        std::vector<u32> lightKeys(m_lightBounds.size());
+        m_lightsInClusterOrder.resize(m_lightBounds.size());
+        
+        for (u32 lightIndex = 0; lightIndex < m_lightBounds.size(); ++lightIndex)
+        {
+            ClusterRange centreRange;
+            CalcClusterRange(Sphere(m_lightBounds[lightIndex].vOrigin, 0.0f), centreRange);
+            
+            u32 centreX = (centreRange.m_minX + centreRange.m_maxX) / 2;
+            u32 centreY = (centreRange.m_minY + centreRange.m_maxY) / 2;
+            lightKeys[lightIndex] = SpreadBits(centreX) | (SpreadBits(centreY) << 1) | (SpreadBits(centreRange.m_minZ) << 2);
+            m_lightsInClusterOrder[lightIndex] = lightIndex;
+        }
+        
+        std::stable_sort(m_lightsInClusterOrder.begin(), m_lightsInClusterOrder.end(), [&lightKeys](u32 a, u32 b)
+        {
+            return lightKeys[a] < lightKeys[b];
+        });
+    }
+    
+    //------------------------------------------------------------------------------
+    std::vector<std::vector<u32>> PointLightClusterGrid::CalculateLitObjects(const std::vector<RenderObject>& renderObjects) const noexcept
+    {
+        const u32 numLights = GetNumLights();
+        std::vector<std::vector<u32>> litObjects(numLights);
+        
+        if (numLights == 0)
+        {
+            return litObjects;
+        }
+        
+        // Lights can span several of the clusters an object overlaps, so track the last object
+        // each light was tested against to avoid testing or adding it twice.
+        std::vector<u32> lastTestedObject(numLights, std::numeric_limits<u32>::max());
+        
+        const f32 averageLightsPerCluster = f32(m_clusterLights.size()) / f32(m_clusterLightOffsets.size() - 1);
+        
+        for (u32 objectIndex = 0; objectIndex < renderObjects.size(); ++objectIndex)
+        {
+            const auto& objectBounds = renderObjects[objectIndex].GetBoundingSphere();
+            
+            ClusterRange range;
+            if (!CalcClusterRange(objectBounds, range))
+            {
+                continue;
+            }
+            
+            u32 numClusters = (range.m_maxX - range.m_minX + 1) * (range.m_maxY - range.m_minY + 1) * (range.m_maxZ - range.m_minZ + 1);
+            if (numClusters * averageLightsPerCluster >= f32(numLights))
+            {
+                // Large objects overlap enough clusters that testing every light is cheaper.
+                for (u32 lightIndex = 0; lightIndex < numLights; ++lightIndex)
+                {
+                    if (m_lightBounds[lightIndex].Contains(objectBounds))
+                    {
+                        litObjects[lightIndex].push_back(objectIndex);
+                    }
+                }
+                continue;
+            }
+            
+            for (u32 z = range.m_minZ; z <= range.m_maxZ; ++z)
+            {
+                for (u32 y = range.m_minY; y <= range.m_maxY; ++y)
+                {
+                    for (u32 x = range.m_minX; x <= range.m_maxX; ++x)
+                    {
+                        u32 clusterIndex = GetClusterIndex(x, y, z);
+                        
+                        for (u32 i = m_clusterLightOffsets[clusterIndex]; i < m_clusterLightOffsets[clusterIndex + 1]; ++i)
+                        {
+                            u32 lightIndex = m_clusterLights[i];
+                            if (lastTestedObject[lightIndex] != objectIndex)
+                            {
+                                lastTestedObject[lightIndex] = objectIndex;
+                                
+                                if (m_lightBounds[lightIndex].Contains(objectBounds))
+                                {
+                                    litObjects[lightIndex].push_back(objectIndex);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        
+        return litObjects;
+    }
+    
+    //------------------------------------------------------------------------------
+    bool PointLightClusterGrid::CalcClusterRange(const Sphere& sphere, ClusterRange& out_range) const noexcept
+    {
+        const auto& centre = sphere.vOrigin;
+        const f32 radius = sphere.fRadius * (1.0f + k_boundsPaddingScale) + k_boundsPadding;
+        
+        // Depth slices, from the view space depth range of the box enclosing the sphere.
+        const auto& view = m_viewMatrix.m;
+        f32 centreDepth = centre.x * view[2] + centre.y * view[6] + centre.z * view[10] + view[14];
+        f32 depthExtent = radius * (std::abs(view[2]) + std::abs(view[6]) + std::abs(view[10]));
+        
+        if (centreDepth + depthExtent < m_minDepth || centreDepth - depthExtent > m_maxDepth)
+        {
+            return false;
+        }
+        
+        out_range.m_minZ = ClampToCell((centreDepth - depthExtent - m_minDepth) * m_depthSliceScale, k_numDepthSlices);
+        out_range.m_maxZ = ClampToCell((centreDepth + depthExtent - m_minDepth) * m_depthSliceScale, k_numDepthSlices);
+        
+        // Screen tiles, from the projected corners of the box enclosing the sphere. If any corner
+        // is behind the camera the projection is unbounded, so the whole screen is covered.
+        out_range.m_minX = 0;
+        out_range.m_maxX = k_numTilesX - 1;
+        out_range.m_minY = 0;
+        out_range.m_maxY = k_numTilesY - 1;
+        
+        const auto& viewProj = m_viewProjectionMatrix.m;
+        Vector4 centreClip = Vector4(centre, 1.0f) * m_viewProjectionMatrix;
+        Vector4 axisX(radius * viewProj[0], radius * viewProj[1], radius * viewProj[2], radius * viewProj[3]);
+        Vector4 axisY(radius * viewProj[4], radius * viewProj[5], radius * viewProj[6], radius * viewProj[7]);
+        Vector4 axisZ(radius * viewProj[8], radius * viewProj[9], radius * viewProj[10], radius * viewProj[11]);
+        
+        f32 minX = std::numeric_limits<f32>::max();
+        f32 maxX = -std::numeric_limits<f32>::max();
+        f32 minY = std::numeric_limits<f32>::max();
+        f32 maxY = -std::numeric_limits<f32>::max();
+        
+        for (u32 corner = 0; corner < 8; ++corner)
+        {
+            Vector4 cornerClip = centreClip;
+            cornerClip += (corner & 1) ? axisX : -axisX;
+            cornerClip += (corner & 2) ? axisY : -axisY;
+            cornerClip += (corner & 4) ? axisZ : -axisZ;
+            
+            if (cornerClip.w < k_minClipW)
+            {
+                return true;
+            }
+            
+            f32 x = cornerClip.x / cornerClip.w;
+            f32 y = cornerClip.y / cornerClip.w;
+            minX = std::min(minX, x);
+            maxX = std::max(maxX, x);
+            minY = std::min(minY, y);
+            maxY = std::max(maxY, y);
+        }
+        
+        out_range.m_minX = ClampToCell((minX * 0.5f + 0.5f) * f32(k_numTilesX), k_numTilesX);
+        out_range.m_maxX = ClampToCell((maxX * 0.5f + 0.5f) * f32(k_numTilesX), k_numTilesX);
+        out_range.m_minY = ClampToCell((minY * 0.5f + 0.5f) * f32(k_numTilesY), k_numTilesY);
+        out_range.m_maxY = ClampToCell((maxY * 0.5f + 0.5f) * f32(k_numTilesY), k_numTilesY);
+        
+        return true;
+    }
+}
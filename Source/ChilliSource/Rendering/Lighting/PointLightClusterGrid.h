@@ -0,0 +1,135 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_RENDERING_LIGHTING_POINTLIGHTCLUSTERGRID_H_
+#define _CHILLISOURCE_RENDERING_LIGHTING_POINTLIGHTCLUSTERGRID_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Math/Matrix4.h>
+#include <ChilliSource/Core/Math/Geometry/Shapes.h>
+
+#include <vector>
+
+namespace ChilliSource
+{
+    /// Bins point lights into a grid of clusters in view space, so that the lights affecting
+    /// a render object can be found by only testing the lights which share a cluster with the
+    /// object, rather than every light in the scene. The grid is split into screen space tiles
+    /// and view space depth slices which span the depth range of the lights.
+    ///
+    /// The binning is conservative: every object returned by the exact bounding sphere test
+    /// against each light is found, and the results are identical to testing every object
+    /// against every light.
+    ///
+    /// This is immutable and therefore thread-safe.
+    ///
+    class PointLightClusterGrid final
+    {
+    public:
+        static constexpr u32 k_numTilesX = 16;
+        static constexpr u32 k_numTilesY = 8;
+        static constexpr u32 k_numDepthSlices = 16;
+        
+        /// Bins the given point lights into the cluster grid for the given camera.
+        ///
+        /// @param camera
+        ///     The camera the cluster grid is built for.
+        /// @param pointLights
+        ///     The point lights to bin.
+        ///
+        PointLightClusterGrid(const RenderCamera& camera, const std::vector<PointRenderLight>& pointLights) noexcept;
+        
+        /// @return The number of point lights in the grid.
+        ///
+        u32 GetNumLights() const noexcept { return u32(m_lightBounds.size()); }
+        
+        /// Finds the render objects within the range of influence of each light. This is linear
+        /// in the number of objects, plus the number of lights sharing a cluster with each object.
+        ///
+        /// @param renderObjects
+        ///     The render objects to test against the lights. These should already have been
+        ///     culled against the camera.
+        ///
+        /// @return For each light, the indices of the render objects within range of it in
+        ///     ascending order.
+        ///
+        std::vector<std::vector<u32>> CalculateLitObjects(const std::vector<RenderObject>& renderObjects) const noexcept;
+        
+        /// @return The indices of the lights ordered by the cluster containing the centre of each
+        ///     light, so that neighbouring lights in the list are likely to be near each other.
+        ///     This is useful for grouping lights which affect similar sets of objects.
+        ///
+        const std::vector<u32>& GetLightsInClusterOrder() const noexcept { return m_lightsInClusterOrder; }
+        
+    private:
+        /// The inclusive range of clusters overlapped by a bounding volume.
+        ///
+        struct ClusterRange final
+        {
+            u32 m_minX = 0;
+            u32 m_maxX = 0;
+            u32 m_minY = 0;
+            u32 m_maxY = 0;
+            u32 m_minZ = 0;
+            u32 m_maxZ = 0;
+        };
+        
+        /// Calculates the clusters overlapped by the axis aligned box enclosing the given sphere.
+        /// This is the same box used by the sphere intersection test.
+        ///
+        /// @param sphere
+        ///     The sphere.
+        /// @param out_range
+        ///     (Out) The range of clusters overlapped by the sphere.
+        ///
+        /// @return Whether or not the sphere overlaps the depth range of the grid at all.
+        ///
+        bool CalcClusterRange(const Sphere& sphere, ClusterRange& out_range) const noexcept;
+        
+        /// @param x
+        ///     The tile index along x.
+        /// @param y
+        ///     The tile index along y.
+        /// @param z
+        ///     The depth slice index.
+        ///
+        /// @return The index of the cluster.
+        ///
+        u32 GetClusterIndex(u32 x, u32 y, u32 z) const noexcept { return (z * k_numTilesY + y) * k_numTilesX + x; }
+        
+        Matrix4 m_viewMatrix;
+        Matrix4 m_viewProjectionMatrix;
+        f32 m_minDepth = 0.0f;
+        f32 m_maxDepth = 0.0f;
+        f32 m_depthSliceScale = 0.0f;
+        
+        std::vector<Sphere> m_lightBounds;
+        std::vector<u32> m_clusterLightOffsets;
+        std::vector<u32> m_clusterLights;
+        std::vector<u32> m_lightsInClusterOrder;
+    };
+}
+
+#endif
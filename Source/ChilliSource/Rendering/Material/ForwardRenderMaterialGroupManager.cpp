@@ -543,12 +543,19 @@ namespace ChilliSource
         
         for(const auto& shaderPass : renderShaders)
         {
+            // Each pass owns its own copy of the shader variables, as ownership is passed to the render material.
+            RenderShaderVariablesUPtr passRenderShaderVariables;
+            if (renderShaderVariables)
+            {
+                passRenderShaderVariables = RenderShaderVariablesUPtr(new RenderShaderVariables(*renderShaderVariables));
+            }
+            
             auto renderMaterial = MakeUnique<RenderMaterial>(m_renderMaterialPool, shaderPass.first, renderTextures2D, renderTexturesCubemap,
                                                                         isTransparencyEnabled, isColourWriteEnabled, isDepthWriteEnabled, isDepthTestEnabled, isFaceCullingEnabled, isStencilTestEnabled,
                                                                         depthTestFunc,
                                                                         sourceBlendMode, destinationBlendMode,
                                                                         stencilFailOp, stencilDepthFailOp, stencilPassOp, stencilTestFunc, stencilRef, stencilMask,
-                                                                        cullFace, emissiveColour, ambientColour, diffuseColour, specularColour, std::move(renderShaderVariables));
+                                                                        cullFace, emissiveColour, ambientColour, diffuseColour, specularColour, std::move(passRenderShaderVariables));
 
             renderMaterialsSlots[static_cast<u32>(shaderPass.second)] = renderMaterial.get();
             renderMaterials.push_back(std::move(renderMaterial));
@@ -343,6 +343,10 @@ namespace ChilliSource
             {
                 return RenderPasses::k_pointLight;
             }
+            else if (passLower == "pointlights")
+            {
+                return RenderPasses::k_pointLights;
+            }
             else if (passLower == "transparent")
             {
                 return RenderPasses::k_transparent;
@@ -26,13 +26,19 @@
 
 #include <ChilliSource/Rendering/Model/VertexFormat.h>
 
+#include <atomic>
 #include <vector>
 
 namespace ChilliSource
 {
+    namespace
+    {
+        std::atomic<u64> g_nextUniqueId(1);
+    }
+    
     //------------------------------------------------------------------------------
     RenderMaterialGroup::RenderMaterialGroup(std::vector<UniquePtr<RenderMaterial>> renderMaterials, std::vector<Collection> collections) noexcept
-        : m_renderMaterials(std::move(renderMaterials)), m_collections(collections)
+        : m_renderMaterials(std::move(renderMaterials)), m_collections(collections), m_uniqueId(g_nextUniqueId++)
     {
         m_renderMaterialsRaw.reserve(m_renderMaterials.size());
         for (const auto& renderMaterial : m_renderMaterials)
@@ -53,7 +53,7 @@ namespace ChilliSource
     public:
         CS_DECLARE_NOCOPY(RenderMaterialGroup);
         
-        static constexpr u32 k_numMaterialSlots = 7;
+        static constexpr u32 k_numMaterialSlots = 8;
         
         /// A collection of RenderMaterials for a single vertex format.
         ///
@@ -126,12 +126,22 @@ namespace ChilliSource
         /// @return An unsorted list of all RenderMaterials in the group.
         ///
         const std::vector<RenderMaterial*>& GetRenderMaterials() noexcept { return m_renderMaterialsRaw; }
+
+        /// @return The list of material collections.
+        ///
+        const std::vector<Collection>& GetCollections() const noexcept { return m_collections; }
+
+        /// @return An id which identifies this group. Unlike the address of the group, this is never
+        ///     reused after the group is destroyed, so it is safe to use as a cache key.
+        ///
+        u64 GetUniqueId() const noexcept { return m_uniqueId; }
         
     private:
         
         std::vector<UniquePtr<RenderMaterial>> m_renderMaterials;
         std::vector<RenderMaterial*> m_renderMaterialsRaw;
         std::vector<Collection> m_collections;
+        u64 m_uniqueId;
     };
 }
 
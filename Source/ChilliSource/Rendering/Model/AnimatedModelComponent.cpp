@@ -539,6 +539,7 @@ namespace ChilliSource
         UpdateAttachedEntities();
         
         m_animationDataDirty = false;
+        m_numSkippedPoseUpdates = 0;
     }
     
     //------------------------------------------------------------------------------
@@ -621,6 +622,15 @@ namespace ChilliSource
     //------------------------------------------------------------------------------
     void AnimatedModelComponent::OnUpdate(f32 deltaTime) noexcept
     {
+        // Less detailed levels rebuild their pose less often; level n only rebuilds every n + 1 updates.
+        // The playback position is still advanced every update so that events fire on time.
+        if (m_numSkippedPoseUpdates < m_lod)
+        {
+            UpdateAnimationTimer(deltaTime);
+            ++m_numSkippedPoseUpdates;
+            return;
+        }
+        
         UpdateAnimation(deltaTime);
     }
     
@@ -636,15 +646,44 @@ namespace ChilliSource
             UpdateAnimation(0.0f);
         }
         
+        const auto& transform = GetEntity()->GetTransform();
+        auto interpolationFactor = Application::Get()->GetInterpolationFactor();
+        
+        Matrix4 worldTransform;
+        Vector3 worldPosition, worldScale;
+        Quaternion worldOrientation;
+        if (interpolationFactor < 1.0f)
+        {
+            //The bounds are derived from the interpolated transform so they match what is presented.
+            worldTransform = transform.GetInterpolatedWorldTransform(interpolationFactor);
+            worldTransform.Decompose(worldPosition, worldScale, worldOrientation);
+        }
+        else
+        {
+            worldTransform = transform.GetWorldTransform();
+            worldPosition = transform.GetWorldPosition();
+            worldScale = transform.GetWorldScale();
+            worldOrientation = transform.GetWorldOrientation();
+        }
+        
+        if (m_model->GetNumLods() > 1)
+        {
+            auto modelBoundingSphere = Sphere::Transform(m_model->GetBoundingSphere(), worldPosition, worldOrientation, worldScale);
+            m_lod = m_model->CalcLod(renderSnapshot.GetRenderCamera().CalcScreenSize(modelBoundingSphere), m_lod);
+        }
+        else
+        {
+            m_lod = 0;
+        }
+        
         for (u32 index = 0; index < m_model->GetNumMeshes(); ++index)
         {
             CS_ASSERT(m_materials[index]->GetLoadState() == Resource::LoadState::k_loaded, "Cannot use a material that hasn't been loaded yet.");
             
             auto renderMaterialGroup = m_materials[index]->GetRenderMaterialGroup();
-            auto renderMesh = m_model->GetRenderMesh(index);
+            auto renderMesh = m_model->GetRenderMesh(index, m_lod);
             
-            const auto& transform = GetEntity()->GetTransform();
-            auto boundingSphere = Sphere::Transform(renderMesh->GetBoundingSphere(), transform.GetWorldPosition(), transform.GetWorldOrientation(), transform.GetWorldScale());
+            auto boundingSphere = Sphere::Transform(renderMesh->GetBoundingSphere(), worldPosition, worldOrientation, worldScale);
             
             RenderSkinnedAnimationAUPtr renderSkinnedAnimation;
             if (m_activeAnimationGroup->IsPrepared() == true)
@@ -657,7 +696,7 @@ namespace ChilliSource
             }
             
             CS_ASSERT(renderSkinnedAnimation, "No render skinned animation.");
-            renderSnapshot.AddRenderObject(RenderObject(renderMaterialGroup, renderMesh, renderSkinnedAnimation.get(), GetEntity()->GetTransform().GetWorldTransform(), boundingSphere,
+            renderSnapshot.AddRenderObject(RenderObject(renderMaterialGroup, renderMesh, renderSkinnedAnimation.get(), worldTransform, boundingSphere,
                                                            m_shadowCastingEnabled, RenderLayer::k_standard));
             renderSnapshot.AddRenderSkinnedAnimation(std::move(renderSkinnedAnimation));
         }
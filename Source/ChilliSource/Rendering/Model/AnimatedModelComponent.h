@@ -297,6 +297,14 @@ namespace ChilliSource
         ///
         void SetMaterialForMesh(const MaterialCSPtr& material, const std::string& meshName) noexcept;
         
+        /// Less detailed levels rebuild the skeleton pose less frequently: level n rebuilds the pose
+        /// every n + 1 updates.
+        ///
+        /// @return The level of detail selected during the last render snapshot. This is chosen from
+        ///     the projected size of the model on screen.
+        ///
+        u32 GetLod() const noexcept { return m_lod; }
+        
         /// @return Whether the render component casts shadows
         ///
         bool IsShadowCastingEnabled() const noexcept { return m_shadowCastingEnabled; };
@@ -567,6 +575,8 @@ namespace ChilliSource
         OOBB m_oobb;
         Sphere m_boundingSphere;
         bool m_shadowCastingEnabled = true;
+        u32 m_lod = 0;
+        u32 m_numSkippedPoseUpdates = 0;
         bool m_isVisible = true;
     };
 }
@@ -30,8 +30,10 @@
 
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
+#include <ChilliSource/Core/Time/Profiler.h>
 #include <ChilliSource/Rendering/Model/Model.h>
 #include <ChilliSource/Rendering/Model/ModelDesc.h>
+#include <ChilliSource/Rendering/Model/ModelResourceOptions.h>
 #include <ChilliSource/Rendering/Model/IndexFormat.h>
 #include <ChilliSource/Rendering/Model/PolygonType.h>
 
@@ -44,7 +46,8 @@ namespace ChilliSource
         const std::string k_modelFileExtension("csmodel");
         
         constexpr u32 k_minVersion = 13;
-        constexpr u32 k_maxVersion = 13;
+        constexpr u32 k_maxVersion = 14;
+        constexpr u32 k_minLodVersion = 14;
         constexpr u32 k_fileCheckValue = 6666;
         
         //---------------------------------------------
@@ -57,6 +60,7 @@ namespace ChilliSource
         {
             k_none,
             k_hasAnimation,
+            k_hasLods
         };
         //---------------------------------------------
         /// Model resources can have flexible attribute
@@ -119,9 +123,11 @@ namespace ChilliSource
         struct ModelHeader final
         {
             bool m_hasAnimationData = false;
+            bool m_hasLods = false;
             VertexFormat m_vertexFormat;
             IndexFormat m_indexFormat = IndexFormat::k_short;
             AABB m_aabb;
+            std::vector<f32> m_lodScreenSizes;
         };
         //----------------------------------------------------------------------------
         /// Read block of data in for given type
@@ -369,6 +375,10 @@ namespace ChilliSource
                     case Feature::k_hasAnimation:
                         out_modelHeader.m_hasAnimationData = true;
                         break;
+                    case Feature::k_hasLods:
+                        CS_RELEASE_ASSERT(versionNum >= k_minLodVersion, "csmodel levels of detail require a newer version: " + in_filePath);
+                        out_modelHeader.m_hasLods = true;
+                        break;
                     default:
                         CS_LOG_ERROR("Unknown feature type in csmodel (" + in_filePath + ") feature declaration!");
                         break;
@@ -396,6 +406,22 @@ namespace ChilliSource
                 out_meshQuantities.m_numSkeletonNodes = (s32)in_meshStream->Read<s16>();
                 out_meshQuantities.m_numJoints = (u32)in_meshStream->Read<u8>();
             }
+            
+            //Read the minimum screen size of each level of detail. The meshes for each level follow in order.
+            if (out_modelHeader.m_hasLods)
+            {
+                u32 numLods = (u32)in_meshStream->Read<u8>();
+                CS_RELEASE_ASSERT(numLods > 0, "csmodel must have at least one level of detail: " + in_filePath);
+                
+                for (u32 i = 0; i < numLods; ++i)
+                {
+                    out_modelHeader.m_lodScreenSizes.push_back(in_meshStream->Read<f32>());
+                }
+            }
+            else
+            {
+                out_modelHeader.m_lodScreenSizes.push_back(0.0f);
+            }
         }
         //----------------------------------------------------------------------------
         /// Read the mesh data from file and creates a mesh descriptor.
@@ -410,6 +436,8 @@ namespace ChilliSource
         //----------------------------------------------------------------------------
         bool ReadFile(StorageLocation in_location, const std::string& in_filePath, ModelDesc& out_modelDesc)
         {
+            CS_PROFILE_SCOPE("CSModelProvider::ReadFile");
+            
             auto meshStream = Application::Get()->GetFileSystem()->CreateBinaryInputStream(in_location, in_filePath);
             
             //Check file for corruption
@@ -430,7 +458,8 @@ namespace ChilliSource
             }
             
             std::vector<MeshDesc> meshDescs;
-            for(u32 i = 0; i < quantities.m_numMeshes; ++i)
+            const u32 numMeshDescs = quantities.m_numMeshes * u32(modelHeader.m_lodScreenSizes.size());
+            for(u32 i = 0; i < numMeshDescs; ++i)
             {
                 auto meshHeader = ReadMeshHeader(meshStream.get(), modelHeader.m_indexFormat);
                 
@@ -445,10 +474,24 @@ namespace ChilliSource
             }
             
             auto modelBoundingSphere = CalcBoundingSphere(modelHeader.m_aabb);
-            out_modelDesc = ModelDesc(std::move(meshDescs), modelHeader.m_aabb, modelBoundingSphere, skeletonDesc, false);
+            out_modelDesc = ModelDesc(std::move(meshDescs), modelHeader.m_lodScreenSizes, modelHeader.m_aabb, modelBoundingSphere, skeletonDesc, false);
 
             return true;
         }
+        //----------------------------------------------------------------------------
+        /// @param The model load options. May be null.
+        ///
+        /// @return Whether or not the model should retain a copy of its mesh data.
+        //----------------------------------------------------------------------------
+        bool ShouldRetainMeshData(const IResourceOptionsBaseCSPtr& in_options)
+        {
+            if (in_options != nullptr)
+            {
+                return static_cast<const ModelResourceOptions*>(in_options.get())->ShouldRetainMeshData();
+            }
+            
+            return false;
+        }
     }
     
     CS_DEFINE_NAMEDTYPE(CSModelProvider);
@@ -491,7 +534,7 @@ namespace ChilliSource
             return;
         }
         
-        modelResource->Build(std::move(modelDesc));
+        modelResource->Build(std::move(modelDesc), ShouldRetainMeshData(in_options));
         modelResource->SetLoadState(Resource::LoadState::k_loaded);
     }
     //----------------------------------------------------------------------------
@@ -505,12 +548,12 @@ namespace ChilliSource
         //Load model as task
         Application::Get()->GetTaskScheduler()->ScheduleTask(TaskType::k_file, [=](const TaskContext&) noexcept
         {
-            LoadMeshDataTask(in_location, in_filePath, in_delegate, meshResource);
+            LoadMeshDataTask(in_location, in_filePath, in_options, in_delegate, meshResource);
         });
     }
     //----------------------------------------------------------------------------
     //----------------------------------------------------------------------------
-    void CSModelProvider::LoadMeshDataTask(StorageLocation in_location, const std::string& in_filePath, const AsyncLoadDelegate& in_delegate, const ModelSPtr& out_resource)
+    void CSModelProvider::LoadMeshDataTask(StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsBaseCSPtr& in_options, const AsyncLoadDelegate& in_delegate, const ModelSPtr& out_resource)
     {
         //read the mesh data into a MoStaticDeclaration
         ModelDescSPtr modelDesc(new ModelDesc());
@@ -526,7 +569,7 @@ namespace ChilliSource
         //start a main thread task for loading the data into a mesh
         Application::Get()->GetTaskScheduler()->ScheduleTask(TaskType::k_large, [=](const TaskContext&) noexcept
         {
-            out_resource->Build(std::move(*modelDesc));
+            out_resource->Build(std::move(*modelDesc), ShouldRetainMeshData(in_options));
             out_resource->SetLoadState(Resource::LoadState::k_loaded);
             
            in_delegate(out_resource);
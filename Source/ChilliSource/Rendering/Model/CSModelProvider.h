@@ -108,10 +108,11 @@ namespace ChilliSource
         ///
         /// @param The storage location to load from
         /// @param File path
+        /// @param Options to customise the creation
         /// @param Delegate to callback on completion either success or failure
         /// @param the output resource pointer
         //----------------------------------------------------------------------------
-        void LoadMeshDataTask(StorageLocation in_location, const std::string& in_filePath, const AsyncLoadDelegate& in_delegate, const ModelSPtr& out_resource);
+        void LoadMeshDataTask(StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsBaseCSPtr& in_options, const AsyncLoadDelegate& in_delegate, const ModelSPtr& out_resource);
     };
 }
 
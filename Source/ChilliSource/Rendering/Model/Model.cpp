@@ -27,12 +27,29 @@
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Rendering/Material/Material.h>
 #include <ChilliSource/Rendering/Model/ModelDesc.h>
+#include <ChilliSource/Rendering/Model/RenderMesh.h>
 #include <ChilliSource/Rendering/Model/RenderMeshManager.h>
 
 #include <algorithm>
+#include <cstring>
 
 namespace ChilliSource
 {
+    namespace
+    {
+        /// Calculates the size of the vertex and index data of the given mesh.
+        ///
+        /// @param renderMesh
+        ///     The render mesh.
+        ///
+        /// @return The size of the mesh data in bytes.
+        ///
+        u64 CalcMeshDataSize(const RenderMesh* renderMesh) noexcept
+        {
+            return u64(renderMesh->GetNumVertices()) * u64(renderMesh->GetVertexFormat().GetSize()) + u64(renderMesh->GetNumIndices()) * u64(GetIndexSize(renderMesh->GetIndexFormat()));
+        }
+    }
+    
     CS_DEFINE_NAMEDTYPE(Model);
 
     //------------------------------------------------------------------------------
@@ -48,7 +65,7 @@ namespace ChilliSource
     }
     
     //------------------------------------------------------------------------------
-    void Model::Build(ModelDesc modelDesc) noexcept
+    void Model::Build(ModelDesc modelDesc, bool shouldRetainMeshData) noexcept
     {
         DestroyRenderMeshes();
         
@@ -56,12 +73,23 @@ namespace ChilliSource
         m_boundingSphere = modelDesc.GetBoundingSphere();
         m_skeleton = Skeleton(modelDesc.GetSkeletonDesc());
         
+        m_lodScreenSizes.clear();
+        for (u32 lod = 0; lod < modelDesc.GetNumLods(); ++lod)
+        {
+            m_lodScreenSizes.push_back(modelDesc.GetLodScreenSize(lod));
+        }
+        
+        const u32 numMeshes = modelDesc.GetNumMeshDescs() / modelDesc.GetNumLods();
+        
         auto renderMeshManager = Application::Get()->GetSystem<RenderMeshManager>();
         for (u32 meshIndex = 0; meshIndex < modelDesc.GetNumMeshDescs(); ++meshIndex)
         {
             auto& meshDesc = modelDesc.GetMeshDesc(meshIndex);
             
-            m_meshNames.push_back(meshDesc.GetName());
+            if (meshIndex < numMeshes)
+            {
+                m_meshNames.push_back(meshDesc.GetName());
+            }
             
             auto poylgonType = meshDesc.GetPolygonType();
             auto vertexFormat = meshDesc.GetVertexFormat();
@@ -75,6 +103,17 @@ namespace ChilliSource
             auto indexDataSize = meshDesc.GetNumIndices() * GetIndexSize(meshDesc.GetIndexFormat());
             auto inverseBindPoseMatrices = meshDesc.ClaimInverseBindPoseMatrices();
             
+            if (shouldRetainMeshData && meshIndex < numMeshes)
+            {
+                std::unique_ptr<u8[]> vertexDataCopy(new u8[vertexDataSize]);
+                memcpy(vertexDataCopy.get(), vertexData.get(), vertexDataSize);
+                m_vertexData.push_back(std::move(vertexDataCopy));
+                
+                std::unique_ptr<u8[]> indexDataCopy(new u8[indexDataSize]);
+                memcpy(indexDataCopy.get(), indexData.get(), indexDataSize);
+                m_indexData.push_back(std::move(indexDataCopy));
+            }
+            
             auto renderMesh = renderMeshManager->CreateRenderMesh(poylgonType, vertexFormat, indexFormat, numVertices, numIndices, boundingSphere, std::move(vertexData), vertexDataSize, std::move(indexData), indexDataSize,
                                                                   modelDesc.ShouldBackupData(), std::move(inverseBindPoseMatrices));
             m_renderMeshes.push_back(std::move(renderMesh));
@@ -114,7 +153,7 @@ namespace ChilliSource
         CS_ASSERT(GetLoadState() == LoadState::k_loaded, "Cannot access a model before it is loaded.");
         CS_ASSERT(m_renderMeshes.size() > 0, "Cannot access a model which has not been built.");
         
-        return u32(m_renderMeshes.size());
+        return u32(m_meshNames.size());
     }
     
     //------------------------------------------------------------------------------
@@ -146,13 +185,121 @@ namespace ChilliSource
     }
     
     //------------------------------------------------------------------------------
-    const RenderMesh* Model::GetRenderMesh(u32 index) const noexcept
+    const RenderMesh* Model::GetRenderMesh(u32 index, u32 lod) const noexcept
     {
         CS_ASSERT(GetLoadState() == LoadState::k_loaded, "Cannot access a model before it is loaded.");
         CS_ASSERT(m_renderMeshes.size() > 0, "Cannot access a model which has not been built.");
         CS_ASSERT(index < m_meshNames.size(), "Index is out of bounds.");
+        CS_ASSERT(lod < m_lodScreenSizes.size(), "LOD is out of bounds.");
+        
+        return m_renderMeshes[lod * m_meshNames.size() + index].get();
+    }
+    
+    //------------------------------------------------------------------------------
+    u32 Model::GetNumLods() const noexcept
+    {
+        CS_ASSERT(GetLoadState() == LoadState::k_loaded, "Cannot access a model before it is loaded.");
+        CS_ASSERT(m_renderMeshes.size() > 0, "Cannot access a model which has not been built.");
+        
+        return u32(m_lodScreenSizes.size());
+    }
+    
+    //------------------------------------------------------------------------------
+    f32 Model::GetLodScreenSize(u32 lod) const noexcept
+    {
+        CS_ASSERT(GetLoadState() == LoadState::k_loaded, "Cannot access a model before it is loaded.");
+        CS_ASSERT(m_renderMeshes.size() > 0, "Cannot access a model which has not been built.");
+        CS_ASSERT(lod < m_lodScreenSizes.size(), "LOD is out of bounds.");
+        
+        return m_lodScreenSizes[lod];
+    }
+    
+    //------------------------------------------------------------------------------
+    u32 Model::CalcLod(f32 screenSize, u32 currentLod) const noexcept
+    {
+        CS_ASSERT(GetLoadState() == LoadState::k_loaded, "Cannot access a model before it is loaded.");
+        CS_ASSERT(m_renderMeshes.size() > 0, "Cannot access a model which has not been built.");
+        
+        u32 lod = std::min(currentLod, u32(m_lodScreenSizes.size()) - 1);
+        
+        // Only switch to a more detailed level once comfortably above its threshold, and to a less
+        // detailed level once comfortably below the current threshold.
+        while (lod > 0 && screenSize >= m_lodScreenSizes[lod - 1] * (1.0f + k_lodHysteresis))
+        {
+            --lod;
+        }
+        
+        while (lod + 1 < m_lodScreenSizes.size() && screenSize < m_lodScreenSizes[lod] * (1.0f - k_lodHysteresis))
+        {
+            ++lod;
+        }
+        
+        return lod;
+    }
+    
+    //------------------------------------------------------------------------------
+    bool Model::HasMeshData() const noexcept
+    {
+        CS_ASSERT(GetLoadState() == LoadState::k_loaded, "Cannot access a model before it is loaded.");
+        CS_ASSERT(m_renderMeshes.size() > 0, "Cannot access a model which has not been built.");
+        
+        return m_vertexData.size() > 0;
+    }
+    
+    //------------------------------------------------------------------------------
+    const u8* Model::GetVertexData(u32 index) const noexcept
+    {
+        CS_ASSERT(GetLoadState() == LoadState::k_loaded, "Cannot access a model before it is loaded.");
+        CS_ASSERT(m_vertexData.size() > 0, "Cannot access mesh data which has not been retained.");
+        CS_ASSERT(index < m_vertexData.size(), "Index is out of bounds.");
+        
+        return m_vertexData[index].get();
+    }
+    
+    //------------------------------------------------------------------------------
+    const u8* Model::GetIndexData(u32 index) const noexcept
+    {
+        CS_ASSERT(GetLoadState() == LoadState::k_loaded, "Cannot access a model before it is loaded.");
+        CS_ASSERT(m_indexData.size() > 0, "Cannot access mesh data which has not been retained.");
+        CS_ASSERT(index < m_indexData.size(), "Index is out of bounds.");
+        
+        return m_indexData[index].get();
+    }
+    
+    //------------------------------------------------------------------------------
+    u64 Model::GetCpuMemoryUsage() const noexcept
+    {
+        u64 size = 0;
+        for (std::size_t index = 0; index < m_renderMeshes.size(); ++index)
+        {
+            const auto& renderMesh = m_renderMeshes[index];
+            
+            if (renderMesh->ShouldBackupData())
+            {
+                size += CalcMeshDataSize(renderMesh.get());
+            }
+            
+            if (index < m_vertexData.size())
+            {
+                size += CalcMeshDataSize(renderMesh.get());
+            }
+            
+            size += u64(renderMesh->GetInverseBindPoseMatrices().size() * sizeof(Matrix4));
+        }
+        
+        return size;
+    }
+    
+    //------------------------------------------------------------------------------
+    u64 Model::GetGpuMemoryUsage() const noexcept
+    {
+        u64 size = 0;
+        for (const auto& renderMesh : m_renderMeshes)
+        {
+            size += CalcMeshDataSize(renderMesh.get());
+        }
         
-        return m_renderMeshes[index].get();
+        return size;
     }
     
     //------------------------------------------------------------------------------
@@ -165,6 +312,9 @@ namespace ChilliSource
         }
         m_renderMeshes.clear();
         m_meshNames.clear();
+        m_lodScreenSizes.clear();
+        m_vertexData.clear();
+        m_indexData.clear();
     }
     
     //------------------------------------------------------------------------------
@@ -42,6 +42,8 @@ namespace ChilliSource
     public:
         CS_DECLARE_NAMEDTYPE(Model);
         
+        static constexpr f32 k_lodHysteresis = 0.1f;
+        
         /// Allows querying of whether or not this resource implements the interface described by the
         /// given interface Id. Typically this is not called directly as the templated equivalent
         /// IsA<Interface>() is preferred.
@@ -58,10 +60,16 @@ namespace ChilliSource
         ///
         /// The description must be passed by move, rather than copy to avoid duplicating mesh data.
         ///
+        /// A copy of the vertex and index data can optionally be retained in main memory. This is
+        /// required for the model to be merged into static geometry batches.
+        ///
         /// @param modelDesc
         ///     The model description. Can only be used once to build a model.
+        /// @param shouldRetainMeshData
+        ///     (Optional) Whether or not a copy of the mesh data should be kept in main memory.
+        ///     Defaults to false.
         ///
-        void Build(ModelDesc modelDesc) noexcept;
+        void Build(ModelDesc modelDesc, bool shouldRetainMeshData = false) noexcept;
         
         /// This must not be called until the model is built and loaded.
         ///
@@ -110,17 +118,94 @@ namespace ChilliSource
         ///
         const u32 GetMeshIndex(const std::string& name) const noexcept;
         
-        /// Looks up the RenderMesh of the mesh with the given index. If the index is out of bounds, this will
-        /// assert.
+        /// Looks up the RenderMesh of the mesh with the given index at the given level of detail. If either
+        /// index is out of bounds, this will assert.
         ///
         /// This must not be called until the model is built and loaded.
         ///
         /// @param index
         ///     The index of the mesh.
+        /// @param lod
+        ///     (Optional) The level of detail. Defaults to the most detailed.
         ///
         /// @return The render mesh.
         ///
-        const RenderMesh* GetRenderMesh(u32 index) const noexcept;
+        const RenderMesh* GetRenderMesh(u32 index, u32 lod = 0) const noexcept;
+        
+        /// This must not be called until the model is built and loaded.
+        ///
+        /// @return The number of levels of detail. This is always at least one.
+        ///
+        u32 GetNumLods() const noexcept;
+        
+        /// This must not be called until the model is built and loaded.
+        ///
+        /// @param lod
+        ///     The level of detail.
+        ///
+        /// @return The minimum screen size, as a fraction of the viewport height, at which the level of
+        ///     detail is used.
+        ///
+        f32 GetLodScreenSize(u32 lod) const noexcept;
+        
+        /// Selects the level of detail which should be used for the given screen size. Hysteresis is
+        /// applied relative to the currently selected level of detail, so that objects close to a
+        /// threshold do not continually switch between levels.
+        ///
+        /// This must not be called until the model is built and loaded.
+        ///
+        /// @param screenSize
+        ///     The projected size of the model's bounding sphere as a fraction of the viewport height.
+        /// @param currentLod
+        ///     The level of detail which is currently in use.
+        ///
+        /// @return The level of detail which should be used.
+        ///
+        u32 CalcLod(f32 screenSize, u32 currentLod) const noexcept;
+        
+        /// This must not be called until the model is built and loaded.
+        ///
+        /// @return Whether or not a copy of the mesh data was retained in main memory when the
+        ///     model was built.
+        ///
+        bool HasMeshData() const noexcept;
+        
+        /// Looks up the retained vertex data of the mesh with the given index at the most detailed
+        /// level of detail; other levels are not retained. The data is laid out
+        /// as described by the vertex format of the mesh's RenderMesh. If the mesh data was not
+        /// retained, or the index is out of bounds, this will assert.
+        ///
+        /// This must not be called until the model is built and loaded.
+        ///
+        /// @param index
+        ///     The index of the mesh.
+        ///
+        /// @return The vertex data.
+        ///
+        const u8* GetVertexData(u32 index) const noexcept;
+        
+        /// Looks up the retained index data of the mesh with the given index at the most detailed
+        /// level of detail. If the mesh data was not retained, or the index is out of bounds, this
+        /// will assert.
+        ///
+        /// This must not be called until the model is built and loaded.
+        ///
+        /// @param index
+        ///     The index of the mesh.
+        ///
+        /// @return The index data.
+        ///
+        const u8* GetIndexData(u32 index) const noexcept;
+        
+        /// @return The approximate number of bytes of main memory held by the model. This includes
+        ///     any mesh data backed up for restoring on context loss or retained for batching.
+        ///
+        u64 GetCpuMemoryUsage() const noexcept override;
+        
+        /// @return The approximate number of bytes of graphics memory used by the model's vertex
+        ///     and index buffers.
+        ///
+        u64 GetGpuMemoryUsage() const noexcept override;
         
         ~Model() noexcept;
         
@@ -143,6 +228,9 @@ namespace ChilliSource
 
         std::vector<std::string> m_meshNames;
         std::vector<UniquePtr<RenderMesh>> m_renderMeshes;
+        std::vector<f32> m_lodScreenSizes;
+        std::vector<std::unique_ptr<const u8[]>> m_vertexData;
+        std::vector<std::unique_ptr<const u8[]>> m_indexData;
         Skeleton m_skeleton;
         AABB m_aabb;
         Sphere m_boundingSphere;
@@ -38,6 +38,14 @@ namespace ChilliSource
     {
     }
     
+    //------------------------------------------------------------------------------
+    ModelDesc::ModelDesc(std::vector<MeshDesc> meshDescs, std::vector<f32> lodScreenSizes, const AABB& aabb, const Sphere& boundingSphere, const SkeletonDesc& skeletonDesc, bool shouldBackupData) noexcept
+    : m_meshDescs(std::move(meshDescs)), m_lodScreenSizes(std::move(lodScreenSizes)), m_aabb(aabb), m_boundingSphere(boundingSphere), m_skeletonDesc(skeletonDesc), m_shouldBackupData(shouldBackupData)
+    {
+        CS_ASSERT(m_lodScreenSizes.size() > 0, "A model must have at least one level of detail.");
+        CS_ASSERT(m_meshDescs.size() % m_lodScreenSizes.size() == 0, "Each level of detail must have the same number of meshes.");
+    }
+    
     //------------------------------------------------------------------------------
     MeshDesc& ModelDesc::GetMeshDesc(u32 index) noexcept
     {
@@ -53,4 +61,12 @@ namespace ChilliSource
         
         return m_meshDescs[index];
     }
+    
+    //------------------------------------------------------------------------------
+    f32 ModelDesc::GetLodScreenSize(u32 lod) const noexcept
+    {
+        CS_ASSERT(lod < GetNumLods(), "Index out of bounds.");
+        
+        return m_lodScreenSizes[lod];
+    }
 }
@@ -77,6 +77,29 @@ namespace ChilliSource
         ///
         ModelDesc(std::vector<MeshDesc> meshDescs, const AABB& aabb, const Sphere& boundingSphere, const SkeletonDesc& skeletonDesc, bool shouldBackupData = true) noexcept;
         
+        /// Creates a new model description with multiple levels of detail.
+        ///
+        /// The mesh descriptions are ordered by level of detail, with each level containing the same
+        /// number of meshes in the same order, starting with the most detailed.
+        ///
+        /// @param meshDescs
+        ///     The list of mesh descriptions for every level of detail. This must be passed by move
+        ///     to avoid duplicating mesh data.
+        /// @param lodScreenSizes
+        ///     The minimum screen size at which each level of detail is used, as a fraction of the
+        ///     viewport height covered by the model's bounding sphere. This should be in descending
+        ///     order.
+        /// @param aabb
+        ///     The local AABB of the model.
+        /// @param boundingSphere
+        ///     The local bounding sphere of the model.
+        /// @param skeletonDesc
+        ///     The skeleton description.
+        /// @param shouldBackupData
+        ///     If the model mesh data should be backed up in main memory for restoring it later.
+        ///
+        ModelDesc(std::vector<MeshDesc> meshDescs, std::vector<f32> lodScreenSizes, const AABB& aabb, const Sphere& boundingSphere, const SkeletonDesc& skeletonDesc, bool shouldBackupData = true) noexcept;
+        
         /// @return The list of mesh descriptions.
         ///
         u32 GetNumMeshDescs() const noexcept { return u32(m_meshDescs.size()); }
@@ -97,6 +120,18 @@ namespace ChilliSource
         ///
         const MeshDesc& GetMeshDesc(u32 index) const noexcept;
         
+        /// @return The number of levels of detail. This is always at least one.
+        ///
+        u32 GetNumLods() const noexcept { return u32(m_lodScreenSizes.size()); }
+        
+        /// @param lod
+        ///     The level of detail. Must be lower than the value returned from GetNumLods() else
+        ///     this will assert.
+        ///
+        /// @return The minimum screen size at which the level of detail is used.
+        ///
+        f32 GetLodScreenSize(u32 lod) const noexcept;
+        
         /// @return The local AABB of the mode.
         ///
         const AABB& GetAABB() const noexcept { return m_aabb;  }
@@ -115,6 +150,7 @@ namespace ChilliSource
         
     private:
         std::vector<MeshDesc> m_meshDescs;
+        std::vector<f32> m_lodScreenSizes { 0.0f };
         AABB m_aabb;
         Sphere m_boundingSphere;
         SkeletonDesc m_skeletonDesc;
@@ -0,0 +1,63 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_RENDERING_MODEL_MODELRESOURCEOPTIONS_H_
+#define _CHILLISOURCE_RENDERING_MODEL_MODELRESOURCEOPTIONS_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Resource/IResourceOptions.h>
+#include <ChilliSource/Rendering/Model/Model.h>
+
+namespace ChilliSource
+{
+    /// Custom options for loading a model.
+    ///
+    /// Models loaded with mesh data retained keep a copy of their vertex and index data in
+    /// main memory, allowing them to be merged into static geometry batches.
+    ///
+    /// This is immutable and therefore thread-safe.
+    ///
+    class ModelResourceOptions final : public IResourceOptions<Model>
+    {
+    public:
+        /// @param shouldRetainMeshData
+        ///     Whether or not a copy of the mesh data should be kept in main memory.
+        ///
+        ModelResourceOptions(bool shouldRetainMeshData = false) noexcept;
+        
+        /// @return Hash of the options contents
+        ///
+        u32 GenerateHash() const override;
+        
+        /// @return Whether or not a copy of the mesh data should be kept in main memory.
+        ///
+        bool ShouldRetainMeshData() const noexcept { return m_shouldRetainMeshData; }
+        
+    private:
+        bool m_shouldRetainMeshData;
+    };
+}
+
+#endif
@@ -100,6 +100,11 @@ namespace ChilliSource
         ///
         const std::vector<Matrix4>& GetInverseBindPoseMatrices() const noexcept { return m_inverseBindPoseMatrices; }
 
+        /// @return An id which identifies this mesh. Unlike the address of the mesh, this is never
+        ///     reused after the mesh is destroyed, so it is safe to use as a cache key.
+        ///
+        u64 GetUniqueId() const noexcept { return m_uniqueId; }
+        
         /// This is not thread safe and should only be called from the render thread.
         ///
         /// @return A pointer to render system specific additional information.
@@ -123,6 +128,7 @@ namespace ChilliSource
         Sphere m_boundingSphere;
         bool m_shouldBackupData;
         std::vector<Matrix4> m_inverseBindPoseMatrices;
+        u64 m_uniqueId;
         
         void* m_extraData = nullptr;
     };
@@ -24,6 +24,11 @@
 
 #include <ChilliSource/Rendering/Model/RenderMeshBatch.h>
 
+#include <ChilliSource/Core/Math/SIMDMath.h>
+
+#include <cstddef>
+#include <cstring>
+
 namespace ChilliSource
 {
     //------------------------------------------------------------------------------
@@ -39,18 +44,52 @@ namespace ChilliSource
 
     //------------------------------------------------------------------------------
     RenderMeshBatch::RenderMeshBatch(PolygonType polygonType, const VertexFormat& vertexFormat, IndexFormat indexFormat, std::vector<Mesh> meshes) noexcept
-        : m_polygonType(polygonType), m_vertexFormat(vertexFormat), m_indexFormat(indexFormat), m_meshes(std::move(meshes))
+        : m_polygonType(polygonType), m_vertexFormat(vertexFormat), m_indexFormat(indexFormat)
     {
-        CS_ASSERT(m_meshes.size() > 0, "Cannot create a batch with zero size.");
+        //TODO: Add support for static mesh vertex formats
+        CS_ASSERT(meshes.size() > 0, "Cannot create a batch with zero size.");
+        CS_ASSERT(m_vertexFormat == VertexFormat::k_sprite, "Unsupported vertex format.");
+        CS_ASSERT(m_indexFormat == IndexFormat::k_short, "Only short indices are supported at the moment.");
         
-        for (const auto& mesh : m_meshes)
+        for (const auto& mesh : meshes)
         {
-            CS_ASSERT((mesh.GetIndexDataSize() > 0) == (m_meshes[0].GetIndexDataSize() > 0), "Either all meshes must have indices, or all meshes must have no indices.");
+            CS_ASSERT((mesh.GetIndexDataSize() > 0) == (meshes[0].GetIndexDataSize() > 0), "Either all meshes must have indices, or all meshes must have no indices.");
             
             m_numVertices += mesh.GetNumVertices();
             m_numIndices += mesh.GetNumIndices();
             m_vertexDataSize += mesh.GetVertexDataSize();
             m_indexDataSize += mesh.GetIndexDataSize();
         }
+        
+        CS_ASSERT(m_numVertices * m_vertexFormat.GetSize() == m_vertexDataSize, "Vertex data size and number of vertices is out of sync.");
+        CS_ASSERT(m_numIndices * GetIndexSize(m_indexFormat) == m_indexDataSize, "Index data size and number of indices is out of sync.");
+        
+        m_vertexData = std::unique_ptr<u8[]>(new u8[m_vertexDataSize]);
+        if (m_indexDataSize > 0)
+        {
+            m_indexData = std::unique_ptr<u8[]>(new u8[m_indexDataSize]);
+        }
+        
+        auto combinedIndices = reinterpret_cast<u16*>(m_indexData.get());
+        u32 vertexOffset = 0;
+        u32 vertexDataOffset = 0;
+        u32 indexOffset = 0;
+        for (const auto& mesh : meshes)
+        {
+            auto combinedVertices = m_vertexData.get() + vertexDataOffset;
+            memcpy(combinedVertices, mesh.GetVertexData(), mesh.GetVertexDataSize());
+            SIMDMath::TransformVector4Strided(combinedVertices + offsetof(SpriteVertex, m_position), mesh.GetWorldMatrix().m, combinedVertices + offsetof(SpriteVertex, m_position),
+                                              mesh.GetNumVertices(), sizeof(SpriteVertex));
+            
+            auto meshIndices = reinterpret_cast<const u16*>(mesh.GetIndexData());
+            for (u32 i = 0; i < mesh.GetNumIndices(); ++i)
+            {
+                combinedIndices[indexOffset + i] = u16(vertexOffset + meshIndices[i]);
+            }
+            
+            vertexOffset += mesh.GetNumVertices();
+            vertexDataOffset += mesh.GetVertexDataSize();
+            indexOffset += mesh.GetNumIndices();
+        }
     }
 }
@@ -31,16 +31,19 @@
 #include <ChilliSource/Rendering/Model/PolygonType.h>
 #include <ChilliSource/Rendering/Model/VertexFormat.h>
 
+#include <memory>
 #include <vector>
 
 namespace ChilliSource
 {
-    /// Contains the description of a series of meshes which can be combined in a single draw
-    /// call. All meshes must have the same polygon type, vertex and index format, and if one
-    /// mesh contains indices, then they all must.
+    /// Contains the combined vertex and index data for a series of meshes which can be rendered
+    /// in a single draw call. All meshes must have the same polygon type, vertex and index format,
+    /// and if one mesh contains indices, then they all must.
     ///
-    /// A render mesh batch doesn't directly contain any mesh data, merely holding handles to
-    /// the data. This means that the described data must outlive the mesh batch.
+    /// The combined data is built when the batch is created: vertex positions are converted into
+    /// world space and indices are offset to the new position of their vertices in the combined
+    /// buffer. As batches are created during render command compilation this work is performed
+    /// in parallel, leaving only a single upload for the render thread.
     ///
     /// This is immutable and therefore thread-safe.
     ///
@@ -111,7 +114,8 @@ namespace ChilliSource
             u32 m_indexDataSize;
         };
         
-        /// Creates a new batch with the given mesh type info and meshes to batch.
+        /// Creates a new batch with the given mesh type info and meshes to batch. The mesh data is
+        /// combined into a single buffer, so the described data only needs to outlive construction.
         ///
         /// @param polygonType
         ///     The polygonType of the batch.
@@ -152,9 +156,13 @@ namespace ChilliSource
         ///
         u32 GetIndexDataSize() const noexcept { return m_indexDataSize; }
         
-        /// @return The meshes included in the batch.
+        /// @return The combined vertex data of the batch, in world space.
         ///
-        const std::vector<Mesh>& GetMeshes() const noexcept { return m_meshes; }
+        const u8* GetVertexData() const noexcept { return m_vertexData.get(); }
+        
+        /// @return The combined index data of the batch. Will be null if the batch has no indices.
+        ///
+        const u8* GetIndexData() const noexcept { return m_indexData.get(); }
         
     private:
         PolygonType m_polygonType;
@@ -164,7 +172,8 @@ namespace ChilliSource
         u32 m_numIndices = 0;
         u32 m_vertexDataSize = 0;
         u32 m_indexDataSize = 0;
-        std::vector<Mesh> m_meshes;
+        std::unique_ptr<u8[]> m_vertexData;
+        std::unique_ptr<u8[]> m_indexData;
     };
 }
 
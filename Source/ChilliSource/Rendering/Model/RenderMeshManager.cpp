@@ -76,6 +76,11 @@ namespace ChilliSource
         std::unique_lock<std::mutex> lock(m_mutex);
         m_pendingLoadCommands.push_back(std::move(loadCommand));
         
+        if (shouldBackupData)
+        {
+            m_backedUpRenderMeshes.push_back(rawRenderMesh);
+        }
+        
         return renderMesh;
     }
 
@@ -83,8 +88,29 @@ namespace ChilliSource
     void RenderMeshManager::DestroyRenderMesh(UniquePtr<RenderMesh> renderMesh) noexcept
     {
         std::unique_lock<std::mutex> lock(m_mutex);
+        
+        if (renderMesh->ShouldBackupData())
+        {
+            for (auto it = m_backedUpRenderMeshes.begin(); it != m_backedUpRenderMeshes.end(); ++it)
+            {
+                if (*it == renderMesh.get())
+                {
+                    std::swap(m_backedUpRenderMeshes.back(), *it);
+                    m_backedUpRenderMeshes.pop_back();
+                    break;
+                }
+            }
+        }
+        
         m_pendingUnloadCommands.push_back(std::move(renderMesh));
     }
+    
+    //------------------------------------------------------------------------------
+    std::vector<const RenderMesh*> RenderMeshManager::GetBackedUpRenderMeshes() noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_backedUpRenderMeshes;
+    }
 
     //------------------------------------------------------------------------------
     void RenderMeshManager::OnRenderSnapshot(TargetType targetType, RenderSnapshot& renderSnapshot, IAllocator* frameAllocator) noexcept
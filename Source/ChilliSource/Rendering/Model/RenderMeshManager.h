@@ -107,7 +107,14 @@ namespace ChilliSource
         ///     The RenderMesh which should be destroyed.
         ///
         void DestroyRenderMesh(UniquePtr<RenderMesh> renderMesh) noexcept;
-
+        
+        /// This is thread-safe.
+        ///
+        /// @return A copy of the list of render meshes which back up their data, and so can be
+        ///     restored after the graphics context is lost. This includes meshes which are not
+        ///     owned by a Model, such as merged static batches.
+        ///
+        std::vector<const RenderMesh*> GetBackedUpRenderMeshes() noexcept;
         
     private:
         friend class Application;
@@ -147,6 +154,7 @@ namespace ChilliSource
         
         std::mutex m_mutex;
         ObjectPoolAllocator<RenderMesh> m_renderMeshPool;
+        std::vector<const RenderMesh*> m_backedUpRenderMeshes;
         std::vector<PendingLoadCommand> m_pendingLoadCommands;
         std::vector<UniquePtr<RenderMesh>> m_pendingUnloadCommands;
     };
@@ -85,6 +85,9 @@ namespace ChilliSource
     {
         if (!m_currentMeshes.empty())
         {
+            ++m_numBatches;
+            m_numBatchedObjects += u32(m_currentMeshes.size());
+            
             auto renderMeshBatch = RenderMeshBatchUPtr(new RenderMeshBatch(m_currentPolygonType, m_currentVertexFormat, m_currentIndexFormat, std::move(m_currentMeshes)));
             
             m_renderCommandList->AddApplyMeshBatchCommand(std::move(renderMeshBatch));
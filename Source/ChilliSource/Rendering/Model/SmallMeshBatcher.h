@@ -86,6 +86,14 @@ namespace ChilliSource
         ///
         void Flush() noexcept;
         
+        /// @return The number of batches which have been flushed.
+        ///
+        u32 GetNumBatches() const noexcept { return m_numBatches; }
+        
+        /// @return The number of objects in the batches which have been flushed.
+        ///
+        u32 GetNumBatchedObjects() const noexcept { return m_numBatchedObjects; }
+        
         ~SmallMeshBatcher() noexcept;
         
     private:
@@ -115,6 +123,8 @@ namespace ChilliSource
         std::vector<RenderMeshBatch::Mesh> m_currentMeshes;
         u32 m_currentVertexDataSize = 0;
         u32 m_currentIndexDataSize = 0;
+        u32 m_numBatches = 0;
+        u32 m_numBatchedObjects = 0;
     };
 }
 
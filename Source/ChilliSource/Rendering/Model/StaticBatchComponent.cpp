@@ -0,0 +1,466 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Rendering/Model/StaticBatchComponent.h>
+
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/Entity/Entity.h>
+#include <ChilliSource/Core/Math/Matrix4.h>
+#include <ChilliSource/Core/Math/SIMDMath.h>
+#include <ChilliSource/Core/Threading/TaskScheduler.h>
+#include <ChilliSource/Rendering/Base/RenderSnapshot.h>
+#include <ChilliSource/Rendering/Material/Material.h>
+#include <ChilliSource/Rendering/Model/IndexFormat.h>
+#include <ChilliSource/Rendering/Model/Model.h>
+#include <ChilliSource/Rendering/Model/PolygonType.h>
+#include <ChilliSource/Rendering/Model/RenderMesh.h>
+#include <ChilliSource/Rendering/Model/RenderMeshManager.h>
+#include <ChilliSource/Rendering/Model/StaticModelComponent.h>
+
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace ChilliSource
+{
+    namespace
+    {
+        constexpr u32 k_maxVertices = u32(std::numeric_limits<u16>::max()) + 1;
+        
+        /// A single mesh which should be merged into a batch.
+        ///
+        struct SourceMesh final
+        {
+            ModelCSPtr m_model;
+            u32 m_meshIndex;
+            Matrix4 m_worldMatrix;
+        };
+        
+        /// A description of a batch prior to its meshes being merged.
+        ///
+        struct BatchDesc final
+        {
+            MaterialCSPtr m_material;
+            bool m_shouldCastShadows;
+            VertexFormat m_vertexFormat;
+            PolygonType m_polygonType;
+            std::array<s32, 3> m_cell;
+            u32 m_numVertices = 0;
+            u32 m_numIndices = 0;
+            std::vector<SourceMesh> m_meshes;
+        };
+        
+        /// Calculates the spatial cell which the given world space position lies in.
+        ///
+        /// @param position
+        ///     The world space position.
+        /// @param cellSize
+        ///     The world space size of each cell.
+        ///
+        /// @return The cell coordinates.
+        ///
+        std::array<s32, 3> CalcCell(const Vector3& position, f32 cellSize) noexcept
+        {
+            return {{ s32(std::floor(position.x / cellSize)), s32(std::floor(position.y / cellSize)), s32(std::floor(position.z / cellSize)) }};
+        }
+        
+        /// Transforms a direction by the upper 3x3 of the given matrix and normalises the result.
+        ///
+        /// @param data
+        ///     The three floats describing the direction. The result is written back into this.
+        /// @param matrix
+        ///     The matrix.
+        ///
+        void TransformDirection(u8* data, const Matrix4& matrix) noexcept
+        {
+            f32 direction[3];
+            memcpy(direction, data, sizeof(direction));
+            
+            auto transformed = Vector3::Normalise(Vector3(direction[0] * matrix.m[0] + direction[1] * matrix.m[4] + direction[2] * matrix.m[8],
+                                                          direction[0] * matrix.m[1] + direction[1] * matrix.m[5] + direction[2] * matrix.m[9],
+                                                          direction[0] * matrix.m[2] + direction[1] * matrix.m[6] + direction[2] * matrix.m[10]));
+            
+            direction[0] = transformed.x;
+            direction[1] = transformed.y;
+            direction[2] = transformed.z;
+            memcpy(data, direction, sizeof(direction));
+        }
+        
+        /// Checks whether or not all meshes in the given static model component can be merged
+        /// into a batch.
+        ///
+        /// @param component
+        ///     The static model component.
+        ///
+        /// @return Whether or not the component can be batched.
+        ///
+        bool CanBatch(const StaticModelComponent* component) noexcept
+        {
+            if (!component->IsStatic() || !component->IsVisible())
+            {
+                return false;
+            }
+            
+            const auto& model = component->GetModel();
+            if (!model || model->GetLoadState() != Resource::LoadState::k_loaded)
+            {
+                return false;
+            }
+            
+            if (!model->HasMeshData())
+            {
+                CS_LOG_WARNING("Static model cannot be batched as its mesh data was not retained. Load it with ModelResourceOptions to allow batching.");
+                return false;
+            }
+            
+            for (u32 meshIndex = 0; meshIndex < model->GetNumMeshes(); ++meshIndex)
+            {
+                auto renderMesh = model->GetRenderMesh(meshIndex);
+                if (renderMesh->GetPolygonType() == PolygonType::k_triangleStrip || renderMesh->GetIndexFormat() != IndexFormat::k_short)
+                {
+                    return false;
+                }
+            }
+            
+            return true;
+        }
+        
+        /// Adds a mesh to the batch description which shares its material, shadow casting, format and
+        /// cell, and has room for its vertices. If there isn't one, a new batch description is created.
+        ///
+        /// @param material
+        ///     The material of the mesh.
+        /// @param shouldCastShadows
+        ///     Whether or not the mesh casts shadows.
+        /// @param cell
+        ///     The cell the mesh lies in.
+        /// @param sourceMesh
+        ///     The mesh.
+        /// @param batchDescs
+        ///     (Out) The list of batch descriptions.
+        ///
+        void AddToBatchDesc(const MaterialCSPtr& material, bool shouldCastShadows, const std::array<s32, 3>& cell, SourceMesh sourceMesh, std::vector<BatchDesc>& batchDescs) noexcept
+        {
+            auto renderMesh = sourceMesh.m_model->GetRenderMesh(sourceMesh.m_meshIndex);
+            
+            for (auto& batchDesc : batchDescs)
+            {
+                if (batchDesc.m_material == material && batchDesc.m_shouldCastShadows == shouldCastShadows && batchDesc.m_cell == cell && batchDesc.m_polygonType == renderMesh->GetPolygonType() &&
+                    batchDesc.m_vertexFormat == renderMesh->GetVertexFormat() && batchDesc.m_numVertices + renderMesh->GetNumVertices() <= k_maxVertices)
+                {
+                    batchDesc.m_numVertices += renderMesh->GetNumVertices();
+                    batchDesc.m_numIndices += renderMesh->GetNumIndices();
+                    batchDesc.m_meshes.push_back(std::move(sourceMesh));
+                    return;
+                }
+            }
+            
+            BatchDesc batchDesc;
+            batchDesc.m_material = material;
+            batchDesc.m_shouldCastShadows = shouldCastShadows;
+            batchDesc.m_vertexFormat = renderMesh->GetVertexFormat();
+            batchDesc.m_polygonType = renderMesh->GetPolygonType();
+            batchDesc.m_cell = cell;
+            batchDesc.m_numVertices = renderMesh->GetNumVertices();
+            batchDesc.m_numIndices = renderMesh->GetNumIndices();
+            batchDesc.m_meshes.push_back(std::move(sourceMesh));
+            batchDescs.push_back(std::move(batchDesc));
+        }
+        
+        /// Merges the meshes in the given batch description into a single world space RenderMesh.
+        /// The merged data is backed up so that the mesh can be restored after the graphics
+        /// context is lost. This is thread-safe and is typically called from a background thread.
+        ///
+        /// @param batchDesc
+        ///     The batch description.
+        /// @param boundingSphere
+        ///     (Out) The world space bounding sphere of the merged mesh.
+        ///
+        /// @return The merged RenderMesh.
+        ///
+        UniquePtr<RenderMesh> MergeMeshes(const BatchDesc& batchDesc, Sphere& boundingSphere) noexcept
+        {
+            const auto& vertexFormat = batchDesc.m_vertexFormat;
+            const u32 vertexSize = vertexFormat.GetSize();
+            const u32 vertexDataSize = batchDesc.m_numVertices * vertexSize;
+            const u32 indexDataSize = batchDesc.m_numIndices * sizeof(u16);
+            
+            std::unique_ptr<u8[]> vertexData(new u8[vertexDataSize]);
+            std::unique_ptr<u8[]> indexData(new u8[indexDataSize]);
+            
+            Vector3 min(std::numeric_limits<f32>::infinity(), std::numeric_limits<f32>::infinity(), std::numeric_limits<f32>::infinity());
+            Vector3 max(-std::numeric_limits<f32>::infinity(), -std::numeric_limits<f32>::infinity(), -std::numeric_limits<f32>::infinity());
+            
+            u32 vertexOffset = 0;
+            u32 indexOffset = 0;
+            for (const auto& sourceMesh : batchDesc.m_meshes)
+            {
+                auto renderMesh = sourceMesh.m_model->GetRenderMesh(sourceMesh.m_meshIndex);
+                auto numVertices = renderMesh->GetNumVertices();
+                auto numIndices = renderMesh->GetNumIndices();
+                
+                u8* vertices = vertexData.get() + vertexOffset * vertexSize;
+                memcpy(vertices, sourceMesh.m_model->GetVertexData(sourceMesh.m_meshIndex), numVertices * vertexSize);
+                
+                auto normalMatrix = Matrix4::Transpose(Matrix4::Inverse(sourceMesh.m_worldMatrix));
+                
+                for (u32 elementIndex = 0; elementIndex < vertexFormat.GetNumElements(); ++elementIndex)
+                {
+                    auto elementOffset = vertexFormat.GetElementOffset(elementIndex);
+                    
+                    switch (vertexFormat.GetElement(elementIndex))
+                    {
+                        case VertexFormat::ElementType::k_position4:
+                        {
+                            SIMDMath::TransformVector4Strided(vertices + elementOffset, sourceMesh.m_worldMatrix.m, vertices + elementOffset, numVertices, vertexSize);
+                            
+                            for (u32 vertexIndex = 0; vertexIndex < numVertices; ++vertexIndex)
+                            {
+                                f32 position[3];
+                                memcpy(position, vertices + vertexIndex * vertexSize + elementOffset, sizeof(position));
+                                
+                                min = Vector3::Min(min, Vector3(position[0], position[1], position[2]));
+                                max = Vector3::Max(max, Vector3(position[0], position[1], position[2]));
+                            }
+                            break;
+                        }
+                        case VertexFormat::ElementType::k_normal3:
+                        {
+                            for (u32 vertexIndex = 0; vertexIndex < numVertices; ++vertexIndex)
+                            {
+                                TransformDirection(vertices + vertexIndex * vertexSize + elementOffset, normalMatrix);
+                            }
+                            break;
+                        }
+                        case VertexFormat::ElementType::k_tangent3:
+                        case VertexFormat::ElementType::k_bitangent3:
+                        {
+                            for (u32 vertexIndex = 0; vertexIndex < numVertices; ++vertexIndex)
+                            {
+                                TransformDirection(vertices + vertexIndex * vertexSize + elementOffset, sourceMesh.m_worldMatrix);
+                            }
+                            break;
+                        }
+                        default:
+                            break;
+                    }
+                }
+                
+                const u16* sourceIndices = reinterpret_cast<const u16*>(sourceMesh.m_model->GetIndexData(sourceMesh.m_meshIndex));
+                u16* indices = reinterpret_cast<u16*>(indexData.get()) + indexOffset;
+                for (u32 index = 0; index < numIndices; ++index)
+                {
+                    indices[index] = u16(sourceIndices[index] + vertexOffset);
+                }
+                
+                vertexOffset += numVertices;
+                indexOffset += numIndices;
+            }
+            
+            boundingSphere.vOrigin = 0.5f * (min + max);
+            boundingSphere.fRadius = 0.5f * (max - min).Length();
+            
+            auto renderMeshManager = Application::Get()->GetSystem<RenderMeshManager>();
+            return renderMeshManager->CreateRenderMesh(batchDesc.m_polygonType, vertexFormat, IndexFormat::k_short, batchDesc.m_numVertices, batchDesc.m_numIndices, boundingSphere,
+                                                       std::move(vertexData), vertexDataSize, std::move(indexData), indexDataSize, true);
+        }
+    }
+    
+    CS_DEFINE_NAMEDTYPE(StaticBatchComponent);
+    
+    //------------------------------------------------------------------------------
+    StaticBatchComponent::StaticBatchComponent(f32 cellSize) noexcept
+        : m_cellSize(cellSize)
+    {
+        CS_ASSERT(m_cellSize > 0.0f, "Cell size must be greater than zero.");
+    }
+    
+    //------------------------------------------------------------------------------
+    bool StaticBatchComponent::IsA(InterfaceIDType interfaceId) const noexcept
+    {
+        return (interfaceId == StaticBatchComponent::InterfaceID);
+    }
+    
+    //------------------------------------------------------------------------------
+    const Sphere& StaticBatchComponent::GetBatchBoundingSphere(u32 index) const noexcept
+    {
+        CS_ASSERT(index < m_batches.size(), "Index is out of bounds.");
+        
+        return m_batches[index].m_boundingSphere;
+    }
+    
+    //------------------------------------------------------------------------------
+    void StaticBatchComponent::Build(const BuildDelegate& delegate) noexcept
+    {
+        CS_ASSERT(GetEntity() != nullptr && GetEntity()->GetScene() != nullptr, "Static batch component must be attached to an entity in the scene.");
+        
+        Clear();
+        
+        std::vector<StaticModelComponentSPtr> components;
+        GetEntity()->GetComponentsRecursive(components);
+        
+        auto buildJob = std::make_shared<BuildJob>();
+        buildJob->m_delegate = delegate;
+        
+        std::vector<BatchDesc> batchDescs;
+        for (const auto& component : components)
+        {
+            if (!CanBatch(component.get()))
+            {
+                continue;
+            }
+            
+            const auto& model = component->GetModel();
+            const auto& transform = component->GetEntity()->GetTransform();
+            for (u32 meshIndex = 0; meshIndex < model->GetNumMeshes(); ++meshIndex)
+            {
+                auto boundingSphere = Sphere::Transform(model->GetRenderMesh(meshIndex)->GetBoundingSphere(), transform.GetWorldPosition(), transform.GetWorldOrientation(), transform.GetWorldScale());
+                auto cell = CalcCell(boundingSphere.vOrigin, m_cellSize);
+                
+                SourceMesh sourceMesh;
+                sourceMesh.m_model = model;
+                sourceMesh.m_meshIndex = meshIndex;
+                sourceMesh.m_worldMatrix = transform.GetWorldTransform();
+                AddToBatchDesc(component->GetMaterialForMesh(meshIndex), component->IsShadowCastingEnabled(), cell, std::move(sourceMesh), batchDescs);
+            }
+            
+            buildJob->m_components.push_back(component);
+        }
+        
+        buildJob->m_batches.resize(batchDescs.size());
+        m_buildJob = buildJob;
+        
+        auto sharedBatchDescs = std::make_shared<std::vector<BatchDesc>>(std::move(batchDescs));
+        
+        std::vector<Task> tasks;
+        for (std::size_t batchIndex = 0; batchIndex < sharedBatchDescs->size(); ++batchIndex)
+        {
+            tasks.push_back([=](const TaskContext&) noexcept
+            {
+                const auto& batchDesc = sharedBatchDescs->at(batchIndex);
+                auto& batch = buildJob->m_batches[batchIndex];
+                
+                batch.m_material = batchDesc.m_material;
+                batch.m_shouldCastShadows = batchDesc.m_shouldCastShadows;
+                batch.m_renderMesh = MergeMeshes(batchDesc, batch.m_boundingSphere);
+            });
+        }
+        
+        auto taskScheduler = Application::Get()->GetTaskScheduler();
+        taskScheduler->ScheduleTasks(TaskType::k_large, tasks, [=](const TaskContext&) noexcept
+        {
+            Application::Get()->GetTaskScheduler()->ScheduleTask(TaskType::k_mainThread, [=](const TaskContext&) noexcept
+            {
+                if (buildJob->m_isCancelled)
+                {
+                    DestroyBatches(buildJob->m_batches);
+                    return;
+                }
+                
+                OnBuildComplete(buildJob);
+            });
+        });
+    }
+    
+    //------------------------------------------------------------------------------
+    void StaticBatchComponent::DestroyBatches(std::vector<Batch>& batches) noexcept
+    {
+        if (batches.size() > 0)
+        {
+            auto renderMeshManager = Application::Get()->GetSystem<RenderMeshManager>();
+            for (auto& batch : batches)
+            {
+                renderMeshManager->DestroyRenderMesh(std::move(batch.m_renderMesh));
+            }
+            batches.clear();
+        }
+    }
+    
+    //------------------------------------------------------------------------------
+    void StaticBatchComponent::OnBuildComplete(const std::shared_ptr<BuildJob>& buildJob) noexcept
+    {
+        CS_ASSERT(m_buildJob == buildJob, "Unexpected build job.");
+        m_buildJob.reset();
+        
+        m_batches = std::move(buildJob->m_batches);
+        m_batchedComponents = std::move(buildJob->m_components);
+        
+        for (const auto& weakComponent : m_batchedComponents)
+        {
+            if (auto component = weakComponent.lock())
+            {
+                component->SetBatched(true);
+            }
+        }
+        
+        if (buildJob->m_delegate)
+        {
+            buildJob->m_delegate();
+        }
+    }
+    
+    //------------------------------------------------------------------------------
+    void StaticBatchComponent::Clear() noexcept
+    {
+        if (m_buildJob)
+        {
+            m_buildJob->m_isCancelled = true;
+            m_buildJob.reset();
+        }
+        
+        for (const auto& weakComponent : m_batchedComponents)
+        {
+            if (auto component = weakComponent.lock())
+            {
+                component->SetBatched(false);
+            }
+        }
+        m_batchedComponents.clear();
+        
+        DestroyBatches(m_batches);
+    }
+    
+    //------------------------------------------------------------------------------
+    void StaticBatchComponent::OnRenderSnapshot(RenderSnapshot& renderSnapshot, IAllocator* frameAllocator) noexcept
+    {
+        for (const auto& batch : m_batches)
+        {
+            renderSnapshot.AddRenderObject(RenderObject(batch.m_material->GetRenderMaterialGroup(), batch.m_renderMesh.get(), Matrix4::k_identity, batch.m_boundingSphere, batch.m_shouldCastShadows, RenderLayer::k_standard));
+        }
+    }
+    
+    //------------------------------------------------------------------------------
+    void StaticBatchComponent::OnRemovedFromScene() noexcept
+    {
+        Clear();
+    }
+    
+    //------------------------------------------------------------------------------
+    StaticBatchComponent::~StaticBatchComponent() noexcept
+    {
+        Clear();
+    }
+}
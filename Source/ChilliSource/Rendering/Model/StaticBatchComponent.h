@@ -0,0 +1,187 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_RENDERING_MODEL_STATICBATCHCOMPONENT_H_
+#define _CHILLISOURCE_RENDERING_MODEL_STATICBATCHCOMPONENT_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Entity/Component.h>
+#include <ChilliSource/Core/Math/Geometry/Shapes.h>
+#include <ChilliSource/Core/Memory/UniquePtr.h>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace ChilliSource
+{
+    /// A component which merges the static geometry beneath its entity into a small number of
+    /// combined RenderMeshes, reducing the number of draw calls required to render level geometry.
+    ///
+    /// When built, all StaticModelComponents in the owning entity's hierarchy which have been
+    /// marked as static, are visible, and were loaded with their mesh data retained are grouped
+    /// by material and by the spatial cell their bounds lie in. The meshes in each group are
+    /// transformed into world space and merged on background threads. Each cell keeps its own
+    /// bounds so that it can still be culled. Once complete, the merged models are no longer
+    /// rendered individually, but their entities remain in the scene for gameplay queries.
+    ///
+    /// Merged meshes use 16-bit indices, so groups which exceed the maximum number of vertices
+    /// are split into multiple batches.
+    ///
+    /// This is not thread safe and should not be used on multiple threads at once.
+    ///
+    class StaticBatchComponent final : public Component
+    {
+    public:
+        CS_DECLARE_NAMEDTYPE(StaticBatchComponent);
+        
+        static constexpr f32 k_defaultCellSize = 50.0f;
+        
+        /// A delegate which is called on the main thread when a build has completed.
+        ///
+        using BuildDelegate = std::function<void() noexcept>;
+        
+        /// Creates a new static batch component with the given cell size.
+        ///
+        /// @param cellSize
+        ///     (Optional) The world space size of each spatial cell. Larger cells result in fewer
+        ///     draw calls but less effective culling.
+        ///
+        StaticBatchComponent(f32 cellSize = k_defaultCellSize) noexcept;
+        
+        /// Allows querying of whether or not this component implements the interface described
+        /// by the given interface Id. Typically this is not called directly as the templated
+        /// equivalent IsA<Interface>() is preferred.
+        ///
+        /// @param interfaceId
+        ///     The Id of the interface.
+        ///
+        /// @return Whether or not the interface is implemented.
+        ///
+        bool IsA(InterfaceIDType interfaceId) const noexcept override;
+        
+        /// @return The world space size of each spatial cell.
+        ///
+        f32 GetCellSize() const noexcept { return m_cellSize; }
+        
+        /// @return Whether or not a build is currently in progress.
+        ///
+        bool IsBuilding() const noexcept { return m_buildJob != nullptr; }
+        
+        /// @return The number of merged batches. Each batch is rendered with a single draw call.
+        ///
+        u32 GetNumBatches() const noexcept { return u32(m_batches.size()); }
+        
+        /// @return The number of static model components which have been merged into the batches.
+        ///
+        u32 GetNumBatchedComponents() const noexcept { return u32(m_batchedComponents.size()); }
+        
+        /// Looks up the world space bounding sphere of the batch with the given index. If the index
+        /// is out of bounds, this will assert.
+        ///
+        /// @param index
+        ///     The index of the batch.
+        ///
+        /// @return The world space bounding sphere of the batch.
+        ///
+        const Sphere& GetBatchBoundingSphere(u32 index) const noexcept;
+        
+        /// Merges the static geometry in the owning entity's hierarchy. This should typically be called
+        /// once the level has finished loading. Any previously built batches are cleared and any build
+        /// in progress is cancelled. The component must be attached to an entity in the scene.
+        ///
+        /// The models continue to be rendered individually until the build completes.
+        ///
+        /// @param delegate
+        ///     (Optional) Called on the main thread when the build has completed.
+        ///
+        void Build(const BuildDelegate& delegate = nullptr) noexcept;
+        
+        /// Destroys all merged batches, returning the static models to being rendered individually.
+        /// Any build in progress is cancelled.
+        ///
+        void Clear() noexcept;
+        
+        ~StaticBatchComponent() noexcept;
+        
+    private:
+        /// A merged batch of static geometry.
+        ///
+        struct Batch final
+        {
+            MaterialCSPtr m_material;
+            UniquePtr<RenderMesh> m_renderMesh;
+            Sphere m_boundingSphere;
+            bool m_shouldCastShadows = true;
+        };
+        
+        /// The state of a build in progress. This is shared with the build tasks so that the
+        /// component can be safely destroyed while a build is in progress.
+        ///
+        struct BuildJob final
+        {
+            std::vector<Batch> m_batches;
+            std::vector<std::weak_ptr<StaticModelComponent>> m_components;
+            BuildDelegate m_delegate;
+            bool m_isCancelled = false;
+        };
+        
+        /// Destroys the RenderMeshes of the given batches and clears the list.
+        ///
+        /// @param batches
+        ///     (Out) The batches to destroy.
+        ///
+        static void DestroyBatches(std::vector<Batch>& batches) noexcept;
+        
+        /// Called on the main thread once all batches in the given build job have been merged,
+        /// unless the build was cancelled.
+        ///
+        /// @param buildJob
+        ///     The completed build job.
+        ///
+        void OnBuildComplete(const std::shared_ptr<BuildJob>& buildJob) noexcept;
+        
+        /// Called during the render snapshot phase. Adds a render object to the scene for each
+        /// merged batch.
+        ///
+        /// @param renderSnapshot
+        ///     The render snapshot.
+        /// @param frameAllocator
+        ///     Allocate any memory required for rendering stuff from here
+        ///
+        void OnRenderSnapshot(RenderSnapshot& renderSnapshot, IAllocator* frameAllocator) noexcept override;
+        
+        /// Triggered when the component is removed from an entity on the scene.
+        ///
+        void OnRemovedFromScene() noexcept override;
+        
+        f32 m_cellSize;
+        std::vector<Batch> m_batches;
+        std::vector<std::weak_ptr<StaticModelComponent>> m_batchedComponents;
+        std::shared_ptr<BuildJob> m_buildJob;
+    };
+}
+
+#endif
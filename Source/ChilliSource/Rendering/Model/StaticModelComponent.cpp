@@ -342,17 +342,51 @@ namespace ChilliSource
         CS_ASSERT(m_model->GetLoadState() == Resource::LoadState::k_loaded, "Cannot use a model that hasn't been loaded yet.");
         CS_ASSERT(m_model->GetNumMeshes() == m_materials.size(), "Invalid number of materials.");
         
+        if (m_isBatched)
+        {
+            return;
+        }
+        
+        const auto& transform = GetEntity()->GetTransform();
+        auto interpolationFactor = Application::Get()->GetInterpolationFactor();
+        
+        Matrix4 worldTransform;
+        Vector3 worldPosition, worldScale;
+        Quaternion worldOrientation;
+        if (interpolationFactor < 1.0f)
+        {
+            //The bounds are derived from the interpolated transform so they match what is presented.
+            worldTransform = transform.GetInterpolatedWorldTransform(interpolationFactor);
+            worldTransform.Decompose(worldPosition, worldScale, worldOrientation);
+        }
+        else
+        {
+            worldTransform = transform.GetWorldTransform();
+            worldPosition = transform.GetWorldPosition();
+            worldScale = transform.GetWorldScale();
+            worldOrientation = transform.GetWorldOrientation();
+        }
+        
+        if (m_model->GetNumLods() > 1)
+        {
+            auto modelBoundingSphere = Sphere::Transform(m_model->GetBoundingSphere(), worldPosition, worldOrientation, worldScale);
+            m_lod = m_model->CalcLod(renderSnapshot.GetRenderCamera().CalcScreenSize(modelBoundingSphere), m_lod);
+        }
+        else
+        {
+            m_lod = 0;
+        }
+        
         for (u32 index = 0; index < m_model->GetNumMeshes(); ++index)
         {
             CS_ASSERT(m_materials[index]->GetLoadState() == Resource::LoadState::k_loaded, "Cannot use a material that hasn't been loaded yet.");
             
             auto renderMaterialGroup = m_materials[index]->GetRenderMaterialGroup();
-            auto renderMesh = m_model->GetRenderMesh(index);
+            auto renderMesh = m_model->GetRenderMesh(index, m_lod);
             
-            const auto& transform = GetEntity()->GetTransform();
-            auto boundingSphere = Sphere::Transform(renderMesh->GetBoundingSphere(), transform.GetWorldPosition(), transform.GetWorldOrientation(), transform.GetWorldScale());
+            auto boundingSphere = Sphere::Transform(renderMesh->GetBoundingSphere(), worldPosition, worldOrientation, worldScale);
             
-            renderSnapshot.AddRenderObject(RenderObject(renderMaterialGroup, renderMesh, GetEntity()->GetTransform().GetWorldTransform(), boundingSphere, m_shadowCastingEnabled, RenderLayer::k_standard));
+            renderSnapshot.AddRenderObject(RenderObject(renderMaterialGroup, renderMesh, worldTransform, boundingSphere, m_shadowCastingEnabled, RenderLayer::k_standard));
         }
     }
     
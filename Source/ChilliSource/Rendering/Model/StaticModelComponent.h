@@ -179,6 +179,11 @@ namespace ChilliSource
         ///
         void SetMaterialForMesh(const MaterialCSPtr& material, const std::string& meshName) noexcept;
         
+        /// @return The level of detail selected during the last render snapshot. This is chosen from
+        ///     the projected size of the model on screen.
+        ///
+        u32 GetLod() const noexcept { return m_lod; }
+        
         /// @return Whether the render component casts shadows
         ///
         bool IsShadowCastingEnabled() const noexcept;
@@ -188,7 +193,39 @@ namespace ChilliSource
         ///
         void SetShadowCastingEnabled(bool enabled) noexcept;
         
+        /// @return Whether or not the model has been marked as static geometry.
+        ///
+        bool IsStatic() const noexcept { return m_isStatic; }
+        
+        /// Marks the model as static geometry, allowing it to be merged into a StaticBatchComponent
+        /// with other static models which share a material. Models must have been loaded with their
+        /// mesh data retained to be merged. This takes effect the next time the batch is built.
+        ///
+        /// @param isStatic
+        ///     Whether or not the model is static geometry.
+        ///
+        void SetStatic(bool isStatic) noexcept { m_isStatic = isStatic; }
+        
+        /// Batched models are rendered by the StaticBatchComponent they have been merged into, rather
+        /// than individually, but remain in the scene for gameplay queries. Changes to the transform,
+        /// model, materials or visibility of a batched model will not be reflected until the batch is
+        /// rebuilt.
+        ///
+        /// @return Whether or not the model has been merged into a static batch.
+        ///
+        bool IsBatched() const noexcept { return m_isBatched; }
+        
     private:
+        friend class StaticBatchComponent;
+        
+        /// Sets whether or not the model has been merged into a static batch. This should only be
+        /// called by StaticBatchComponent.
+        ///
+        /// @param isBatched
+        ///     Whether or not the model has been merged into a static batch.
+        ///
+        void SetBatched(bool isBatched) noexcept { m_isBatched = isBatched; }
+        
         /// Triggered when the component is attached to an entity on the scene
         ///
         void OnAddedToScene() noexcept override;
@@ -218,7 +255,10 @@ namespace ChilliSource
         OOBB m_oobb;
         Sphere m_boundingSphere;
         bool m_shadowCastingEnabled = true;
+        u32 m_lod = 0;
         bool m_isVisible = true;
+        bool m_isStatic = false;
+        bool m_isBatched = false;
         
         bool m_isAABBValid = false;
         bool m_isOOBBValid = false;
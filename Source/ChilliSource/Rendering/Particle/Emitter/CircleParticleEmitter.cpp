@@ -28,7 +28,7 @@
 
 #include <ChilliSource/Rendering/Particle/Emitter/CircleParticleEmitter.h>
 
-#include <ChilliSource/Core/Math/Random.h>
+#include <ChilliSource/Core/Math/RandomStream.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
 #include <ChilliSource/Rendering/Particle/Emitter/CircleParticleEmitterDef.h>
 
@@ -41,12 +41,14 @@ namespace ChilliSource
         ///
         /// @author Ian Copland
         ///
+        /// @param The random stream to generate from.
+        ///
         /// @return A random point in a unit circle.
         //----------------------------------------------------------------
-        Vector2 GeneratePointInUnitCircle()
+        Vector2 GeneratePointInUnitCircle(RandomStream& inout_randomStream)
         {
-            f32 dist = std::sqrt(Random::GenerateNormalised<f32>());
-            return Random::GenerateDirection2D<f32>() * dist;
+            f32 dist = std::sqrt(inout_randomStream.GenerateNormalised<f32>());
+            return inout_randomStream.GenerateDirection2D<f32>() * dist;
         }
     }
 
@@ -62,16 +64,18 @@ namespace ChilliSource
     //----------------------------------------------------------------
     void CircleParticleEmitter::GenerateEmission(f32 in_normalisedEmissionTime, Vector3& out_position, Vector3& out_direction)
     {
-        f32 radius = m_circleParticleEmitterDef->GetRadiusProperty()->GenerateValue(in_normalisedEmissionTime);
+        RandomStream& randomStream = GetRandomStream();
+        f32 radius = 0.0f;
+        m_circleParticleEmitterDef->GetRadiusProperty()->GenerateValues(in_normalisedEmissionTime, randomStream, &radius, 1);
 
         //calculate the position.
         switch (m_circleParticleEmitterDef->GetEmitFromType())
         {
         case CircleParticleEmitterDef::EmitFromType::k_inside:
-            out_position = Vector3(GeneratePointInUnitCircle() * radius, 0.0f);
+            out_position = Vector3(GeneratePointInUnitCircle(randomStream) * radius, 0.0f);
             break;
         case CircleParticleEmitterDef::EmitFromType::k_surface:
-            out_position = Vector3(Random::GenerateDirection2D<f32>() * radius, 0.0f);
+            out_position = Vector3(randomStream.GenerateDirection2D<f32>() * radius, 0.0f);
             break;
         default:
             CS_LOG_FATAL("Invalid 'Emit From' type.");
@@ -82,7 +86,7 @@ namespace ChilliSource
         switch (m_circleParticleEmitterDef->GetEmitDirectionType())
         {
         case CircleParticleEmitterDef::EmitDirectionType::k_random:
-            out_direction = Vector3(Random::GenerateDirection2D<f32>(), 0.0f);
+            out_direction = Vector3(randomStream.GenerateDirection2D<f32>(), 0.0f);
             break;
         case CircleParticleEmitterDef::EmitDirectionType::k_awayFromCentre:
             out_direction = Vector3::Normalise(out_position);
@@ -28,7 +28,7 @@
 
 #include <ChilliSource/Rendering/Particle/Emitter/Cone2DParticleEmitter.h>
 
-#include <ChilliSource/Core/Math/Random.h>
+#include <ChilliSource/Core/Math/RandomStream.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
 #include <ChilliSource/Rendering/Particle/Emitter/Cone2DParticleEmitterDef.h>
 
@@ -44,13 +44,14 @@ namespace ChilliSource
         ///
         /// @author Ian Copland
         ///
+        /// @param The random stream to generate from.
         /// @param The angle.
         ///
         /// @return The direction.
         //----------------------------------------------------------------
-        Vector2 GenerateDirectionWithinAngle(f32 in_angle)
+        Vector2 GenerateDirectionWithinAngle(RandomStream& inout_randomStream, f32 in_angle)
         {
-            f32 angle = MathUtils::k_pi * 0.5f + Random::GenerateNormalised<f32>() * in_angle - 0.5f * in_angle;
+            f32 angle = MathUtils::k_pi * 0.5f + inout_randomStream.GenerateNormalised<f32>() * in_angle - 0.5f * in_angle;
             Vector2 direction(std::cos(angle), std::sin(angle));
             return direction;
         }
@@ -60,14 +61,15 @@ namespace ChilliSource
         ///
         /// @author Ian Copland
         ///
+        /// @param The random stream to generate from.
         /// @param The angle.
         ///
         /// @return The direction.
         //----------------------------------------------------------------
-        Vector2 GenerateDirectionWithAngle(f32 in_angle)
+        Vector2 GenerateDirectionWithAngle(RandomStream& inout_randomStream, f32 in_angle)
         {
             f32 angle = 0.0f;
-            if (Random::Generate<u32>(0, 1) == 0)
+            if (inout_randomStream.Generate<u32>(0, 1) == 0)
             {
                 angle = MathUtils::k_pi * 0.5f - 0.5f * in_angle;
             }
@@ -84,14 +86,15 @@ namespace ChilliSource
         ///
         /// @author Ian Copland
         ///
+        /// @param The random stream to generate from.
         /// @param The angle.
         ///
         /// @return The position.
         //----------------------------------------------------------------
-        Vector2 GeneratePositionInUnitCone2D(f32 in_angle)
+        Vector2 GeneratePositionInUnitCone2D(RandomStream& inout_randomStream, f32 in_angle)
         {
-            f32 dist = std::sqrt(Random::GenerateNormalised<f32>());
-            return GenerateDirectionWithinAngle(in_angle) * dist;
+            f32 dist = std::sqrt(inout_randomStream.GenerateNormalised<f32>());
+            return GenerateDirectionWithinAngle(inout_randomStream, in_angle) * dist;
         }
         //----------------------------------------------------------------
         /// Generates a position on a the surface of a unit 2D cone with the
@@ -99,14 +102,15 @@ namespace ChilliSource
         ///
         /// @author Ian Copland
         ///
+        /// @param The random stream to generate from.
         /// @param The angle.
         ///
         /// @return The direction.
         //----------------------------------------------------------------
-        Vector2 GeneratePositionOnUnitCone2D(f32 in_angle)
+        Vector2 GeneratePositionOnUnitCone2D(RandomStream& inout_randomStream, f32 in_angle)
         {
-            f32 dist = std::sqrt(Random::GenerateNormalised<f32>());
-            return GenerateDirectionWithAngle(in_angle) * dist;
+            f32 dist = std::sqrt(inout_randomStream.GenerateNormalised<f32>());
+            return GenerateDirectionWithAngle(inout_randomStream, in_angle) * dist;
         }
     }
 
@@ -122,17 +126,20 @@ namespace ChilliSource
     //----------------------------------------------------------------
     void Cone2DParticleEmitter::GenerateEmission(f32 in_normalisedEmissionTime, Vector3& out_position, Vector3& out_direction)
     {
-        f32 radius = m_coneParticleEmitterDef->GetRadiusProperty()->GenerateValue(in_normalisedEmissionTime);
-        f32 angle = m_coneParticleEmitterDef->GetAngleProperty()->GenerateValue(in_normalisedEmissionTime);
+        RandomStream& randomStream = GetRandomStream();
+        f32 radius = 0.0f;
+        m_coneParticleEmitterDef->GetRadiusProperty()->GenerateValues(in_normalisedEmissionTime, randomStream, &radius, 1);
+        f32 angle = 0.0f;
+        m_coneParticleEmitterDef->GetAngleProperty()->GenerateValues(in_normalisedEmissionTime, randomStream, &angle, 1);
 
         //calculate the position.
         switch (m_coneParticleEmitterDef->GetEmitFromType())
         {
         case Cone2DParticleEmitterDef::EmitFromType::k_inside:
-            out_position = Vector3(GeneratePositionInUnitCone2D(angle) * radius, 0.0f);
+            out_position = Vector3(GeneratePositionInUnitCone2D(randomStream, angle) * radius, 0.0f);
             break;
         case Cone2DParticleEmitterDef::EmitFromType::k_edge:
-            out_position = Vector3(GeneratePositionOnUnitCone2D(angle) * radius, 0.0f);
+            out_position = Vector3(GeneratePositionOnUnitCone2D(randomStream, angle) * radius, 0.0f);
             break;
         case Cone2DParticleEmitterDef::EmitFromType::k_base:
             out_position = Vector3::k_zero;
@@ -146,7 +153,7 @@ namespace ChilliSource
         switch (m_coneParticleEmitterDef->GetEmitDirectionType())
         {
         case Cone2DParticleEmitterDef::EmitDirectionType::k_random:
-            out_direction = Vector3(GenerateDirectionWithinAngle(angle), 0.0f);
+            out_direction = Vector3(GenerateDirectionWithinAngle(randomStream, angle), 0.0f);
             break;
         case Cone2DParticleEmitterDef::EmitDirectionType::k_awayFromBase:
             if (out_position != Vector3::k_zero)
@@ -155,7 +162,7 @@ namespace ChilliSource
             }
             else
             {
-                out_direction = Vector3(GenerateDirectionWithinAngle(angle), 0.0f);
+                out_direction = Vector3(GenerateDirectionWithinAngle(randomStream, angle), 0.0f);
             }
             break;
         default:
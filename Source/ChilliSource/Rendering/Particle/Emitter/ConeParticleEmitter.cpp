@@ -28,7 +28,7 @@
 
 #include <ChilliSource/Rendering/Particle/Emitter/ConeParticleEmitter.h>
 
-#include <ChilliSource/Core/Math/Random.h>
+#include <ChilliSource/Core/Math/RandomStream.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
 #include <ChilliSource/Rendering/Particle/Emitter/ConeParticleEmitterDef.h>
 
@@ -44,19 +44,20 @@ namespace ChilliSource
         ///
         /// @author Ian Copland
         ///
+        /// @param The random stream to generate from.
         /// @param The angle.
         ///
         /// @return The direction.
         //----------------------------------------------------------------
-        Vector3 GenerateDirectionWithinAngle(f32 in_angle)
+        Vector3 GenerateDirectionWithinAngle(RandomStream& inout_randomStream, f32 in_angle)
         {
             //get the y value that would ensure the top of the cone is a circle of unit radius.
             f32 y = 1.0f / tan(in_angle * 0.5f);
 
             //get a random point within the circle at the top of the cone. the square root of the
             //random distance is used to acheive even distribution.
-            Vector2 topDirection = Random::GenerateDirection2D<f32>();
-            f32 dist = std::sqrt(Random::GenerateNormalised<f32>());
+            Vector2 topDirection = inout_randomStream.GenerateDirection2D<f32>();
+            f32 dist = std::sqrt(inout_randomStream.GenerateNormalised<f32>());
 
             //normalise this to get a direction vector.
             Vector3 output(topDirection.x * dist, y, topDirection.y * dist);
@@ -69,17 +70,18 @@ namespace ChilliSource
         ///
         /// @author Ian Copland
         ///
+        /// @param The random stream to generate from.
         /// @param The angle.
         ///
         /// @return The direction.
         //----------------------------------------------------------------
-        Vector3 GenerateDirectionWithAngle(f32 in_angle)
+        Vector3 GenerateDirectionWithAngle(RandomStream& inout_randomStream, f32 in_angle)
         {
             //get the y value that would ensure the top of the cone is a circle of unit radius.
             f32 y = 1.0f / tan(in_angle * 0.5f);
 
             //get a random point on the surface the circle at the top of the cone.
-            Vector2 topDirection = Random::GenerateDirection2D<f32>();
+            Vector2 topDirection = inout_randomStream.GenerateDirection2D<f32>();
 
             //normalise this to get a direction vector.
             Vector3 output(topDirection.x, y, topDirection.y);
@@ -92,16 +94,17 @@ namespace ChilliSource
         ///
         /// @author Ian Copland
         ///
+        /// @param The random stream to generate from.
         /// @param The angle.
         ///
         /// @return The position.
         //----------------------------------------------------------------
-        Vector3 GeneratePositionInUnitCone(f32 in_angle)
+        Vector3 GeneratePositionInUnitCone(RandomStream& inout_randomStream, f32 in_angle)
         {
             const f32 oneOverThree = 1.0f / 3.0f;
 
-            f32 dist = std::pow(Random::GenerateNormalised<f32>(), oneOverThree);
-            return GenerateDirectionWithinAngle(in_angle) * dist;
+            f32 dist = std::pow(inout_randomStream.GenerateNormalised<f32>(), oneOverThree);
+            return GenerateDirectionWithinAngle(inout_randomStream, in_angle) * dist;
         }
         //----------------------------------------------------------------
         /// Generates a position on a the surface of a unit cone with the
@@ -109,16 +112,17 @@ namespace ChilliSource
         ///
         /// @author Ian Copland
         ///
+        /// @param The random stream to generate from.
         /// @param The angle.
         ///
         /// @return The direction.
         //----------------------------------------------------------------
-        Vector3 GeneratePositionOnUnitCone(f32 in_angle)
+        Vector3 GeneratePositionOnUnitCone(RandomStream& inout_randomStream, f32 in_angle)
         {
             const f32 oneOverThree = 1.0f / 3.0f;
 
-            f32 dist = std::pow(Random::GenerateNormalised<f32>(), oneOverThree);
-            return GenerateDirectionWithAngle(in_angle) * dist;
+            f32 dist = std::pow(inout_randomStream.GenerateNormalised<f32>(), oneOverThree);
+            return GenerateDirectionWithAngle(inout_randomStream, in_angle) * dist;
         }
     }
 
@@ -134,17 +138,20 @@ namespace ChilliSource
     //----------------------------------------------------------------
     void ConeParticleEmitter::GenerateEmission(f32 in_normalisedEmissionTime, Vector3& out_position, Vector3& out_direction)
     {
-        f32 radius = m_coneParticleEmitterDef->GetRadiusProperty()->GenerateValue(in_normalisedEmissionTime);
-        f32 angle = m_coneParticleEmitterDef->GetAngleProperty()->GenerateValue(in_normalisedEmissionTime);
+        RandomStream& randomStream = GetRandomStream();
+        f32 radius = 0.0f;
+        m_coneParticleEmitterDef->GetRadiusProperty()->GenerateValues(in_normalisedEmissionTime, randomStream, &radius, 1);
+        f32 angle = 0.0f;
+        m_coneParticleEmitterDef->GetAngleProperty()->GenerateValues(in_normalisedEmissionTime, randomStream, &angle, 1);
 
         //calculate the position.
         switch (m_coneParticleEmitterDef->GetEmitFromType())
         {
         case ConeParticleEmitterDef::EmitFromType::k_inside:
-            out_position = GeneratePositionInUnitCone(angle) * radius;
+            out_position = GeneratePositionInUnitCone(randomStream, angle) * radius;
             break;
         case ConeParticleEmitterDef::EmitFromType::k_surface:
-            out_position = GeneratePositionOnUnitCone(angle) * radius;
+            out_position = GeneratePositionOnUnitCone(randomStream, angle) * radius;
             break;
         case ConeParticleEmitterDef::EmitFromType::k_base:
             out_position = Vector3::k_zero;
@@ -158,7 +165,7 @@ namespace ChilliSource
         switch (m_coneParticleEmitterDef->GetEmitDirectionType())
         {
         case ConeParticleEmitterDef::EmitDirectionType::k_random:
-            out_direction = GenerateDirectionWithinAngle(angle);
+            out_direction = GenerateDirectionWithinAngle(randomStream, angle);
             break;
         case ConeParticleEmitterDef::EmitDirectionType::k_awayFromBase:
             if (out_position != Vector3::k_zero)
@@ -167,7 +174,7 @@ namespace ChilliSource
             }
             else
             {
-                out_direction = GenerateDirectionWithinAngle(angle);
+                out_direction = GenerateDirectionWithinAngle(randomStream, angle);
             }
             break;
         default:
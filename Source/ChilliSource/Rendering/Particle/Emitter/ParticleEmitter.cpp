@@ -31,7 +31,6 @@
 #include <ChilliSource/Core/Container/dynamic_array.h>
 #include <ChilliSource/Core/Entity/Entity.h>
 #include <ChilliSource/Core/Entity/Transform.h>
-#include <ChilliSource/Core/Math/Random.h>
 #include <ChilliSource/Rendering/Particle/Particle.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
 #include <ChilliSource/Rendering/Particle/Emitter/ParticleEmitterDef.h>
@@ -84,10 +83,22 @@ namespace ChilliSource
     }
     //----------------------------------------------
     //----------------------------------------------
+    void ParticleEmitter::SetRandomSeed(u64 in_seed)
+    {
+        m_randomStream.Seed(in_seed);
+    }
+    //----------------------------------------------
+    //----------------------------------------------
     const ParticleEmitterDef* ParticleEmitter::GetEmitterDef() const
     {
         return m_emitterDef;
     }
+    //----------------------------------------------
+    //----------------------------------------------
+    RandomStream& ParticleEmitter::GetRandomStream()
+    {
+        return m_randomStream;
+    }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
     std::vector<u32> ParticleEmitter::TryEmitStream(f32 in_playbackTime, const Vector3& in_emitterPosition, const Vector3& in_emitterScale, const Quaternion& in_emitterOrientation)
@@ -99,7 +110,9 @@ namespace ChilliSource
         //Get the time between emissions at this stage in the playback timer. Note that this doesn't take into account
         //the interpolation between the last frame and this, but should be close enough.
         const f32 normalisedPlaybackTime = in_playbackTime / particleEffect->GetDuration();
-        const f32 timeBetweenEmissions = 1.0f / m_emitterDef->GetEmissionRateProperty()->GenerateValue(normalisedPlaybackTime);
+        f32 emissionRate = 0.0f;
+        m_emitterDef->GetEmissionRateProperty()->GenerateValues(normalisedPlaybackTime, m_randomStream, &emissionRate, 1);
+        const f32 timeBetweenEmissions = 1.0f / emissionRate;
 
         f32 prevEmissionTime = m_emissionTime;
         Vector3 prevEntityPosition = m_emissionPosition;
@@ -123,16 +136,9 @@ namespace ChilliSource
             }
             CS_ASSERT(normalisedEmissionTime >= 0.0f && normalisedEmissionTime <= 1.0f, "Invalid emission time.");
             
-            u32 particlesPerEmission = m_emitterDef->GetParticlesPerEmissionProperty()->GenerateValue(normalisedEmissionTime);
-            for (u32 i = 0; i < particlesPerEmission; ++i)
-            {
-                f32 chanceOfEmission = m_emitterDef->GetEmissionChanceProperty()->GenerateValue(normalisedEmissionTime);
-                f32 random = Random::GenerateNormalised<f32>();
-                if (random <= chanceOfEmission)
-                {
-                    Emit(normalisedEmissionTime, m_emissionPosition, m_emissionScale, m_emissionOrientation, emittedParticles);
-                }
-            }
+            u32 particlesPerEmission = 0;
+            m_emitterDef->GetParticlesPerEmissionProperty()->GenerateValues(normalisedEmissionTime, m_randomStream, &particlesPerEmission, 1);
+            EmitBatch(normalisedEmissionTime, particlesPerEmission, m_emissionPosition, m_emissionScale, m_emissionOrientation, emittedParticles);
 
             nextEmissionTime += timeBetweenEmissions;
         }
@@ -154,16 +160,9 @@ namespace ChilliSource
             m_emissionOrientation = in_emitterOrientation;
 
             const f32 normalisedPlaybackTime = 0.0f;
-            u32 particlesPerEmission = m_emitterDef->GetParticlesPerEmissionProperty()->GenerateValue(normalisedPlaybackTime);
-            for (u32 i = 0; i < particlesPerEmission; ++i)
-            {
-                f32 chanceOfEmission = m_emitterDef->GetEmissionChanceProperty()->GenerateValue(normalisedPlaybackTime);
-                f32 random = Random::GenerateNormalised<f32>();
-                if (random <= chanceOfEmission)
-                {
-                    Emit(normalisedPlaybackTime, m_emissionPosition, m_emissionScale, m_emissionOrientation, emittedParticles);
-                }
-            }
+            u32 particlesPerEmission = 0;
+            m_emitterDef->GetParticlesPerEmissionProperty()->GenerateValues(normalisedPlaybackTime, m_randomStream, &particlesPerEmission, 1);
+            EmitBatch(normalisedPlaybackTime, particlesPerEmission, m_emissionPosition, m_emissionScale, m_emissionOrientation, emittedParticles);
 
             m_hasEmitted = true;
         }
@@ -172,55 +171,95 @@ namespace ChilliSource
     }
     //----------------------------------------------------------------
     //----------------------------------------------------------------
-    void ParticleEmitter::Emit(f32 in_normalisedEmissionTime, const Vector3& in_emissionPosition, const Vector3& in_emissionScale, const Quaternion& in_emissionOrientation, std::vector<u32>& inout_emittedParticles)
+    void ParticleEmitter::EmitBatch(f32 in_normalisedEmissionTime, u32 in_numParticles, const Vector3& in_emissionPosition, const Vector3& in_emissionScale, const Quaternion& in_emissionOrientation, std::vector<u32>& inout_emittedParticles)
     {
+        if (in_numParticles == 0)
+        {
+            return;
+        }
+
         const ParticleEffect* particleEffect = m_emitterDef->GetParticleEffect();
 
-        u32 particleIndex = m_nextParticleIndex++;
-        Particle& particle = m_particleArray->at(particleIndex);
-        if (m_nextParticleIndex >= particleEffect->GetMaxParticles())
+        //decide which particles will be emitted.
+        m_emissionChances.resize(in_numParticles);
+        m_emissionRandoms.resize(in_numParticles);
+        m_emitterDef->GetEmissionChanceProperty()->GenerateValues(in_normalisedEmissionTime, m_randomStream, m_emissionChances.data(), in_numParticles);
+        m_randomStream.FillNormalised(m_emissionRandoms.data(), in_numParticles);
+
+        const std::size_t firstEmitted = inout_emittedParticles.size();
+        for (u32 i = 0; i < in_numParticles; ++i)
+        {
+            if (m_emissionRandoms[i] <= m_emissionChances[i])
+            {
+                u32 particleIndex = m_nextParticleIndex++;
+                if (m_nextParticleIndex >= particleEffect->GetMaxParticles())
+                {
+                    m_nextParticleIndex = 0;
+                }
+
+                //the particle is activated immediately so it cannot be claimed twice if the batch wraps the particle list.
+                Particle& particle = m_particleArray->at(particleIndex);
+                if (particle.m_isActive == false)
+                {
+                    particle.m_isActive = true;
+                    inout_emittedParticles.push_back(particleIndex);
+                }
+            }
+        }
+
+        const u32 numEmitted = static_cast<u32>(inout_emittedParticles.size() - firstEmitted);
+        if (numEmitted == 0)
         {
-            m_nextParticleIndex = 0;
+            return;
         }
 
-        if (particle.m_isActive == false)
+        //generate the initial properties for the whole batch.
+        m_batchScales.resize(numEmitted);
+        m_batchRotations.resize(numEmitted);
+        m_batchSpeeds.resize(numEmitted);
+        m_batchLifetimes.resize(numEmitted);
+        m_batchColours.resize(numEmitted);
+        m_batchAngularVelocities.resize(numEmitted);
+        particleEffect->GetInitialScaleProperty()->GenerateValues(in_normalisedEmissionTime, m_randomStream, m_batchScales.data(), numEmitted);
+        particleEffect->GetInitialRotationProperty()->GenerateValues(in_normalisedEmissionTime, m_randomStream, m_batchRotations.data(), numEmitted);
+        particleEffect->GetInitialSpeedProperty()->GenerateValues(in_normalisedEmissionTime, m_randomStream, m_batchSpeeds.data(), numEmitted);
+        particleEffect->GetLifetimeProperty()->GenerateValues(in_normalisedEmissionTime, m_randomStream, m_batchLifetimes.data(), numEmitted);
+        particleEffect->GetInitialColourProperty()->GenerateValues(in_normalisedEmissionTime, m_randomStream, m_batchColours.data(), numEmitted);
+        particleEffect->GetInitialAngularVelocityProperty()->GenerateValues(in_normalisedEmissionTime, m_randomStream, m_batchAngularVelocities.data(), numEmitted);
+
+        //the emission transform is shared by the whole batch.
+        const ParticleEffect::SimulationSpace simulationSpace = particleEffect->GetSimulationSpace();
+        const Matrix4 worldTransform = Matrix4::CreateTransform(in_emissionPosition, in_emissionScale, in_emissionOrientation);
+
+        //we can't directly apply the emission scale to the particles as this would look strange as
+        //the camera moved around an emitting entity with a non-uniform scale, so this works out a uniform
+        //scale from the average of the components.
+        const f32 particleScaleFactor = (in_emissionScale.x + in_emissionScale.y + in_emissionScale.z) / 3.0f;
+
+        for (u32 i = 0; i < numEmitted; ++i)
         {
-            inout_emittedParticles.push_back(particleIndex);
+            Particle& particle = m_particleArray->at(inout_emittedParticles[firstEmitted + i]);
 
             //Get the emission position and direction.
             Vector3 localPosition;
             Vector3 localDirection;
             GenerateEmission(in_normalisedEmissionTime, localPosition, localDirection);
 
-            //calculate the local space properties.
-            Vector2 localScale = particleEffect->GetInitialScaleProperty()->GenerateValue(in_normalisedEmissionTime);
-            f32 localRotation = particleEffect->GetInitialRotationProperty()->GenerateValue(in_normalisedEmissionTime);
-            f32 localSpeed = particleEffect->GetInitialSpeedProperty()->GenerateValue(in_normalisedEmissionTime);
-
             //apply these in the correct simulation space.
-            switch (particleEffect->GetSimulationSpace())
+            switch (simulationSpace)
             {
                 case ParticleEffect::SimulationSpace::k_world:
                 {
-                    //transform the position into world space.
-                    const Matrix4 worldTransform = Matrix4::CreateTransform(in_emissionPosition, in_emissionScale, in_emissionOrientation);
                     particle.m_position = localPosition * worldTransform;
-
-                    //we can't directly apply the emission scale to the particles as this would look strange as
-                    //the camera moved around an emitting entity with a non-uniform scale, so this works out a uniform
-                    //scale from the average of the components.
-                    f32 particleScaleFactor = (in_emissionScale.x + in_emissionScale.y + in_emissionScale.z) / 3.0f;
-                    particle.m_scale = localScale * particleScaleFactor;
-
-                    //transform the velocity into world space.
-                    particle.m_velocity = Vector3::Rotate(((localDirection * localSpeed) * in_emissionScale), in_emissionOrientation);
+                    particle.m_scale = m_batchScales[i] * particleScaleFactor;
+                    particle.m_velocity = Vector3::Rotate(((localDirection * m_batchSpeeds[i]) * in_emissionScale), in_emissionOrientation);
                     break;
                 }
                 case ParticleEffect::SimulationSpace::k_local:
                 {
                     particle.m_position = localPosition;
-                    particle.m_scale = localScale;
-                    particle.m_velocity = localDirection * localSpeed;
+                    particle.m_scale = m_batchScales[i];
+                    particle.m_velocity = localDirection * m_batchSpeeds[i];
                     break;
                 }
                 default:
@@ -231,12 +270,11 @@ namespace ChilliSource
             }
 
             //apply the remaining properties.
-            particle.m_lifetime = particleEffect->GetLifetimeProperty()->GenerateValue(in_normalisedEmissionTime);
+            particle.m_lifetime = m_batchLifetimes[i];
             particle.m_energy = particle.m_lifetime;
-            particle.m_colour = particleEffect->GetInitialColourProperty()->GenerateValue(in_normalisedEmissionTime);
-            particle.m_rotation = localRotation;
-            particle.m_angularVelocity = particleEffect->GetInitialAngularVelocityProperty()->GenerateValue(in_normalisedEmissionTime);
-            particle.m_isActive = true;
+            particle.m_colour = m_batchColours[i];
+            particle.m_rotation = m_batchRotations[i];
+            particle.m_angularVelocity = m_batchAngularVelocities[i];
         }
     }
 }
@@ -30,10 +30,12 @@
 #define _CHILLISOURCE_RENDERING_PARTICLE_EMITTER_PARTICLEEMITTER_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Base/Colour.h>
+#include <ChilliSource/Core/Math/Vector2.h>
 #include <ChilliSource/Core/Math/Vector3.h>
 #include <ChilliSource/Core/Math/Quaternion.h>
+#include <ChilliSource/Core/Math/RandomStream.h>
 
-#include <random>
 #include <vector>
 
 namespace ChilliSource
@@ -44,7 +46,9 @@ namespace ChilliSource
     /// particle should be spawned. 
     ///
     /// Particle emitters will be updated as part of a background task and 
-    /// should not be accessed from other threads.
+    /// should not be accessed from other threads. Each emitter owns its own
+    /// random stream, so emission never contends with other tasks and can
+    /// be made reproducible by seeding it.
     ///
     /// @author Ian Copland
     //-----------------------------------------------------------------------
@@ -78,6 +82,18 @@ namespace ChilliSource
         //----------------------------------------------------------------
         std::vector<u32> TryEmit(f32 in_playbackTime, const Vector3& in_emitterPosition, const Vector3& in_emitterScale, const Quaternion& in_emitterOrientation, bool in_interpolateEmission);
         //----------------------------------------------------------------
+        /// Re-seeds the random stream used for emission. Emitters which
+        /// are given the same seed and the same sequence of TryEmit()
+        /// calls will emit the same number of particles with identical
+        /// initial properties. Values generated by affectors over a
+        /// particle's lifetime are not drawn from this stream, so are
+        /// not reproduced. By default each emitter is given a unique
+        /// seed.
+        ///
+        /// @param The seed.
+        //----------------------------------------------------------------
+        void SetRandomSeed(u64 in_seed);
+        //----------------------------------------------------------------
         /// Destructor.
         ///
         /// @author Ian Copland
@@ -91,6 +107,11 @@ namespace ChilliSource
         //----------------------------------------------------------------
         const ParticleEmitterDef* GetEmitterDef() const;
         //----------------------------------------------------------------
+        /// @return The random stream that should be used for all random
+        /// values generated during emission.
+        //----------------------------------------------------------------
+        RandomStream& GetRandomStream();
+        //----------------------------------------------------------------
         /// Generates the position and direction of a new emission. These 
         /// values are in local space. This will be called as part of a 
         /// background task.
@@ -126,12 +147,13 @@ namespace ChilliSource
         //----------------------------------------------------------------
         std::vector<u32> TryEmitBurst(f32 in_playbackTime, const Vector3& in_emitterPosition, const Vector3& in_emitterScale, const Quaternion& in_emitterOrientation);
         //----------------------------------------------------------------
-        /// Emits a new particle if the next particle in the list is free
-        /// to be emitted. 
+        /// Emits a batch of new particles. Each particle in the batch is
+        /// subject to the emission chance, and will only be emitted if the
+        /// next particle in the list is free to be emitted. The initial
+        /// properties for all emitted particles are generated in bulk.
         ///
-        /// @author Ian Copland
-        /// 
         /// @param The normalised playback time of emission.
+        /// @param The number of particles to try and emit.
         /// @param The world space position of the emitter at the time
         /// of emission.
         /// @param The world space scale of the emitter at the time
@@ -139,11 +161,9 @@ namespace ChilliSource
         /// @param The world orientation of the emitter at the time of
         /// emission.
         /// @param [In/Out] The list of emitted particles, will add to the
-        /// list if a particle is successfully emitted.
-        ///
-        /// @param The index of the emitted particle. 
+        /// list for each particle that is successfully emitted.
         //----------------------------------------------------------------
-        void Emit(f32 in_normalisedEmissionTime, const Vector3& in_emissionPosition, const Vector3& in_emissionScale, const Quaternion& in_emissionOrientation, std::vector<u32>& inout_emittedParticles);
+        void EmitBatch(f32 in_normalisedEmissionTime, u32 in_numParticles, const Vector3& in_emissionPosition, const Vector3& in_emissionScale, const Quaternion& in_emissionOrientation, std::vector<u32>& inout_emittedParticles);
 
         const ParticleEmitterDef* m_emitterDef = nullptr;
         dynamic_array<Particle>* m_particleArray = nullptr;
@@ -154,6 +174,16 @@ namespace ChilliSource
         f32 m_emissionTime = 0.0f;
         bool m_hasEmitted = false;
         u32 m_nextParticleIndex = 0;
+        RandomStream m_randomStream;
+
+        std::vector<f32> m_emissionChances;
+        std::vector<f32> m_emissionRandoms;
+        std::vector<Vector2> m_batchScales;
+        std::vector<f32> m_batchRotations;
+        std::vector<f32> m_batchSpeeds;
+        std::vector<f32> m_batchLifetimes;
+        std::vector<Colour> m_batchColours;
+        std::vector<f32> m_batchAngularVelocities;
     };
 }
 
@@ -28,7 +28,7 @@
 
 #include <ChilliSource/Rendering/Particle/Emitter/PointParticleEmitter.h>
 
-#include <ChilliSource/Core/Math/Random.h>
+#include <ChilliSource/Core/Math/RandomStream.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
 #include <ChilliSource/Rendering/Particle/Emitter/PointParticleEmitterDef.h>
 
@@ -44,7 +44,8 @@ namespace ChilliSource
     //----------------------------------------------------------------
     void PointParticleEmitter::GenerateEmission(f32 in_normalisedEmissionTime, Vector3& out_position, Vector3& out_direction)
     {
+        RandomStream& randomStream = GetRandomStream();
         out_position = Vector3::k_zero;
-        out_direction = Random::GenerateDirection3D<f32>();
+        out_direction = randomStream.GenerateDirection3D<f32>();
     }
 }
@@ -28,7 +28,7 @@
 
 #include <ChilliSource/Rendering/Particle/Emitter/SphereParticleEmitter.h>
 
-#include <ChilliSource/Core/Math/Random.h>
+#include <ChilliSource/Core/Math/RandomStream.h>
 #include <ChilliSource/Rendering/Particle/ParticleEffect.h>
 #include <ChilliSource/Rendering/Particle/Emitter/SphereParticleEmitterDef.h>
 
@@ -41,12 +41,14 @@ namespace ChilliSource
         ///
         /// @author Ian Copland
         ///
+        /// @param The random stream to generate from.
+        ///
         /// @return A random point in a unit sphere.
         //----------------------------------------------------------------
-        Vector3 GeneratePointInUnitSphere()
+        Vector3 GeneratePointInUnitSphere(RandomStream& inout_randomStream)
         {
-            f32 dist = std::pow(Random::GenerateNormalised<f32>(), (1.0f / 3.0f));
-            return Random::GenerateDirection3D<f32>() * dist;
+            f32 dist = std::pow(inout_randomStream.GenerateNormalised<f32>(), (1.0f / 3.0f));
+            return inout_randomStream.GenerateDirection3D<f32>() * dist;
         }
     }
 
@@ -62,16 +64,18 @@ namespace ChilliSource
     //----------------------------------------------------------------
     void SphereParticleEmitter::GenerateEmission(f32 in_normalisedEmissionTime, Vector3& out_position, Vector3& out_direction)
     {
-        f32 radius = m_sphereParticleEmitterDef->GetRadiusProperty()->GenerateValue(in_normalisedEmissionTime);
+        RandomStream& randomStream = GetRandomStream();
+        f32 radius = 0.0f;
+        m_sphereParticleEmitterDef->GetRadiusProperty()->GenerateValues(in_normalisedEmissionTime, randomStream, &radius, 1);
 
         //calculate the position.
         switch (m_sphereParticleEmitterDef->GetEmitFromType())
         {
         case SphereParticleEmitterDef::EmitFromType::k_inside:
-            out_position = GeneratePointInUnitSphere() * radius;
+            out_position = GeneratePointInUnitSphere(randomStream) * radius;
             break;
         case SphereParticleEmitterDef::EmitFromType::k_surface:
-            out_position = Random::GenerateDirection3D<f32>() * radius;
+            out_position = randomStream.GenerateDirection3D<f32>() * radius;
             break;
         default:
             CS_LOG_FATAL("Invalid 'Emit From' type.");
@@ -82,7 +86,7 @@ namespace ChilliSource
         switch (m_sphereParticleEmitterDef->GetEmitDirectionType())
         {
         case SphereParticleEmitterDef::EmitDirectionType::k_random:
-            out_direction = Random::GenerateDirection3D<f32>();
+            out_direction = randomStream.GenerateDirection3D<f32>();
             break;
         case SphereParticleEmitterDef::EmitDirectionType::k_awayFromCentre:
             out_direction = Vector3::Normalise(out_position);
@@ -64,6 +64,17 @@ namespace ChilliSource
         /// created with.
         //------------------------------------------------------------------------------
         TPropertyType GenerateValue(f32 in_playbackProgress) const override;
+        //------------------------------------------------------------------------------
+        /// Generates a batch of random values between the lower and upper values the
+        /// property was created with, drawn from the given stream.
+        ///
+        /// @param The normalised (0.0 - 1.0) particle effect playback progress. This is
+        /// ignored for a random property.
+        /// @param [In/Out] The random stream to generate values from.
+        /// @param [Out] The array the generated values are written to.
+        /// @param The number of values to generate.
+        //------------------------------------------------------------------------------
+        void GenerateValues(f32 in_playbackProgress, RandomStream& inout_randomStream, TPropertyType* out_values, u32 in_numValues) const override;
         
     private:
         TPropertyType m_lowerValue;
@@ -82,6 +93,12 @@ namespace ChilliSource
     {
         return Random::GenerateComponentwise(m_lowerValue, m_upperValue);
     }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <typename TPropertyType> void ComponentwiseRandomConstantParticleProperty<TPropertyType>::GenerateValues(f32 in_playbackProgress, RandomStream& inout_randomStream, TPropertyType* out_values, u32 in_numValues) const
+    {
+        inout_randomStream.FillComponentwise(m_lowerValue, m_upperValue, out_values, in_numValues);
+    }
 }
 
 #endif
@@ -58,12 +58,35 @@ namespace ChilliSource
         //------------------------------------------------------------------------------
         virtual TPropertyType GenerateValue(f32 in_playbackProgress) const = 0;
         //------------------------------------------------------------------------------
+        /// Generates a batch of new values within the confines of the property's
+        /// settings. Properties which generate random values will draw them from the
+        /// given stream, allowing results to be reproduced and avoiding the cost of
+        /// looking up the thread's stream for every value. By default this calls
+        /// GenerateValue() for each value.
+        ///
+        /// @param The normalised (0.0 - 1.0) particle effect playback progress.
+        /// @param [In/Out] The random stream to generate values from.
+        /// @param [Out] The array the generated values are written to.
+        /// @param The number of values to generate.
+        //------------------------------------------------------------------------------
+        virtual void GenerateValues(f32 in_playbackProgress, RandomStream& inout_randomStream, TPropertyType* out_values, u32 in_numValues) const;
+        //------------------------------------------------------------------------------
         /// Destructor.
         ///
         /// @author Ian Copland
         //------------------------------------------------------------------------------
         virtual ~ParticleProperty() {};
     };
+    
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <typename TPropertyType> void ParticleProperty<TPropertyType>::GenerateValues(f32 in_playbackProgress, RandomStream& inout_randomStream, TPropertyType* out_values, u32 in_numValues) const
+    {
+        for (u32 i = 0; i < in_numValues; ++i)
+        {
+            out_values[i] = GenerateValue(in_playbackProgress);
+        }
+    }
 }
 
 #endif
@@ -76,6 +76,16 @@ namespace ChilliSource
         /// @return The generated value.
         //------------------------------------------------------------------------------
         TPropertyType GenerateValue(f32 in_playbackProgress) const override;
+        //------------------------------------------------------------------------------
+        /// Generates a batch of random values between the lower and upper values the
+        /// property was created with, drawn from the given stream.
+        ///
+        /// @param The normalised (0.0 - 1.0) particle effect playback progress.
+        /// @param [In/Out] The random stream to generate values from.
+        /// @param [Out] The array the generated values are written to.
+        /// @param The number of values to generate.
+        //------------------------------------------------------------------------------
+        void GenerateValues(f32 in_playbackProgress, RandomStream& inout_randomStream, TPropertyType* out_values, u32 in_numValues) const override;
         
     private:
         TPropertyType m_startLowerValue;
@@ -106,6 +116,19 @@ namespace ChilliSource
         
         return Random::Generate(lowerBound, upperBound);
     }
+    //------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------
+    template <typename TPropertyType> void RandomCurveParticleProperty<TPropertyType>::GenerateValues(f32 in_playbackProgress, RandomStream& inout_randomStream, TPropertyType* out_values, u32 in_numValues) const
+    {
+        CS_ASSERT(in_playbackProgress >= 0.0f && in_playbackProgress <= 1.0f, "Playback progress must be in the range 0.0 to 1.0.");
+        
+        f32 interpolationFactor = m_curveFunction(in_playbackProgress);
+        
+        TPropertyType lowerBound = TPropertyType(m_startLowerValue + (m_endLowerValue - m_startLowerValue) * interpolationFactor);
+        TPropertyType upperBound = TPropertyType(m_startUpperValue + (m_endUpperValue - m_startUpperValue) * interpolationFactor);
+        
+        inout_randomStream.Fill(lowerBound, upperBound, out_values, in_numValues);
+    }
 }
 
 #endif
@@ -0,0 +1,36 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Rendering/RenderCommand/Commands/ApplyPointLightsRenderCommand.h>
+
+namespace ChilliSource
+{
+    //------------------------------------------------------------------------------
+    ApplyPointLightsRenderCommand::ApplyPointLightsRenderCommand(std::vector<Colour> colours, std::vector<Vector3> positions, std::vector<Vector3> attenuations) noexcept
+        : RenderCommand(Type::k_applyPointLights), m_colours(std::move(colours)), m_positions(std::move(positions)), m_attenuations(std::move(attenuations))
+    {
+        CS_ASSERT(m_colours.size() == m_positions.size() && m_colours.size() == m_attenuations.size(), "Point light data is mismatched.");
+    }
+}
@@ -0,0 +1,87 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_RENDERING_RENDERCOMMAND_COMMANDS_APPLYPOINTLIGHTSRENDERCOMMAND_H_
+#define _CHILLISOURCE_RENDERING_RENDERCOMMAND_COMMANDS_APPLYPOINTLIGHTSRENDERCOMMAND_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Base/Colour.h>
+#include <ChilliSource/Core/Math/Vector3.h>
+#include <ChilliSource/Rendering/RenderCommand/RenderCommand.h>
+
+#include <vector>
+
+namespace ChilliSource
+{
+    /// A render command for applying a group of point lights to the current context state, so
+    /// that they can all be applied by a single pass.
+    ///
+    /// This must be instantiated via a RenderCommandList.
+    ///
+    /// This is immutable and therefore thread-safe.
+    ///
+    class ApplyPointLightsRenderCommand final : public RenderCommand
+    {
+    public:
+        /// @return The number of lights.
+        ///
+        u32 GetNumLights() const noexcept { return u32(m_colours.size()); }
+        
+        /// @return The colour of each light.
+        ///
+        const std::vector<Colour>& GetColours() const noexcept { return m_colours; }
+        
+        /// @return The world space position of each light.
+        ///
+        const std::vector<Vector3>& GetPositions() const noexcept { return m_positions; }
+        
+        /// @return The vector containing the constant, linear and quadratic attenuation values of
+        ///     each light.
+        ///
+        const std::vector<Vector3>& GetAttenuations() const noexcept { return m_attenuations; }
+        
+    private:
+        friend class RenderCommandList;
+        
+        /// Creates a new instance with the given light colours, positions and attenuations. Each
+        /// list must be the same length.
+        ///
+        /// @param colours
+        ///     The colour of each light. Should be moved.
+        /// @param positions
+        ///     The world space position of each light. Should be moved.
+        /// @param attenuations
+        ///     The vector containing the constant, linear and quadratic attenuation values of each
+        ///     light. Should be moved.
+        ///
+        ApplyPointLightsRenderCommand(std::vector<Colour> colours, std::vector<Vector3> positions, std::vector<Vector3> attenuations) noexcept;
+        
+        std::vector<Colour> m_colours;
+        std::vector<Vector3> m_positions;
+        std::vector<Vector3> m_attenuations;
+    };
+}
+
+#endif
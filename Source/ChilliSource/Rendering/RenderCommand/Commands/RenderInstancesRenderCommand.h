@@ -0,0 +1,70 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_RENDERING_RENDERCOMMAND_COMMANDS_RENDERINSTANCESRENDERCOMMAND_H_
+#define _CHILLISOURCE_RENDERING_RENDERCOMMAND_COMMANDS_RENDERINSTANCESRENDERCOMMAND_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Math/Matrix4.h>
+#include <ChilliSource/Rendering/RenderCommand/RenderCommand.h>
+
+#include <vector>
+
+namespace ChilliSource
+{
+    /// A render command for rendering multiple instances of the mesh currently described by the
+    /// context state, each with its own world transform. The world matrices are stored packed
+    /// so that they can be uploaded to an instance buffer in a single copy.
+    ///
+    /// This must be instantiated via a RenderCommandList.
+    ///
+    /// This is immutable and therefore thread-safe.
+    ///
+    class RenderInstancesRenderCommand final : public RenderCommand
+    {
+    public:
+        /// @return The number of instances.
+        ///
+        u32 GetNumInstances() const noexcept { return u32(m_worldMatrices.size()); }
+        
+        /// @return The world matrix of each instance.
+        ///
+        const std::vector<Matrix4>& GetWorldMatrices() const noexcept { return m_worldMatrices; };
+        
+    private:
+        friend class RenderCommandList;
+        
+        /// Creates a new command with the given world matrices.
+        ///
+        /// @param worldMatrices
+        ///     The world matrix of each instance. Should be moved.
+        ///
+        RenderInstancesRenderCommand(std::vector<Matrix4> worldMatrices) noexcept;
+        
+        std::vector<Matrix4> m_worldMatrices;
+    };
+}
+
+#endif
@@ -62,12 +62,14 @@ namespace ChilliSource
             k_applyAmbientLight,
             k_applyDirectionalLight,
             k_applyPointLight,
+            k_applyPointLights,
             k_applyMaterial,
             k_applyMesh,
             k_applyDynamicMesh,
             k_applyMeshBatch,
             k_applySkinnedAnimation,
             k_renderInstance,
+            k_renderInstances,
             k_end,
             k_unloadTargetGroup,
             k_unloadMesh,
@@ -77,6 +79,10 @@ namespace ChilliSource
             k_unloadCubemap
         };
         
+        /// The number of render command types. This must be kept in sync with the last type.
+        ///
+        static constexpr u32 k_numTypes = u32(Type::k_unloadCubemap) + 1;
+        
         /// @return The type of render command that this is.
         ///
         Type GetType() const noexcept { return m_type; }
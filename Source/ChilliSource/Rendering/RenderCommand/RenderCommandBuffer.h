@@ -26,6 +26,7 @@
 #define _CHILLISOURCE_RENDERING_RENDERCOMMAND_RENDERCOMMANDQUEUE_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Base/EngineCounters.h>
 #include <ChilliSource/Rendering/Base/RenderFrameData.h>
 #include <ChilliSource/Rendering/Model/RenderDynamicMesh.h>
 #include <ChilliSource/Rendering/Model/RenderSkinnedAnimation.h>
@@ -83,6 +84,15 @@ namespace ChilliSource
         ///
         const std::vector<const RenderCommandList*>& GetQueue() const noexcept { return m_queue; }
         
+        /// @return The per rendered frame counter values gathered while the buffer was compiled.
+        ///     These are published once the buffer has been processed.
+        ///
+        EngineCounterValues& GetCounterValues() noexcept { return m_counterValues; }
+        
+        /// @return The per rendered frame counter values gathered while the buffer was compiled.
+        ///
+        const EngineCounterValues& GetCounterValues() const noexcept { return m_counterValues; }
+        
     private:
         std::vector<RenderDynamicMeshAUPtr> m_renderDynamicMeshes;
         std::vector<RenderSkinnedAnimationAUPtr> m_renderSkinnedAnimations;
@@ -90,6 +100,7 @@ namespace ChilliSource
         std::vector<RenderCommandListUPtr> m_renderCommandLists; //TODO: This should be changed to a pool.
         const std::vector<RenderFrameData> m_renderFramesData;
         IAllocator* m_frameAllocator;
+        EngineCounterValues m_counterValues;
     };
 }
 
@@ -0,0 +1,2166 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include <ChilliSource/Rendering/RenderCommand/RenderCommandCapture.h>
+
+#include <ChilliSource/Core/Base/Application.h>
+#include <ChilliSource/Core/File/FileSystem.h>
+#include <ChilliSource/Core/File/FileStream/BinaryOutputStream.h>
+#include <ChilliSource/Core/File/FileStream/IBinaryInputStream.h>
+#include <ChilliSource/Core/Memory/UniquePtr.h>
+#include <ChilliSource/Rendering/Base/RenderFrameData.h>
+#include <ChilliSource/Rendering/Material/RenderMaterial.h>
+#include <ChilliSource/Rendering/Material/RenderMaterialGroup.h>
+#include <ChilliSource/Rendering/Model/IndexFormat.h>
+#include <ChilliSource/Rendering/Model/RenderDynamicMesh.h>
+#include <ChilliSource/Rendering/Model/RenderMesh.h>
+#include <ChilliSource/Rendering/Model/RenderMeshBatch.h>
+#include <ChilliSource/Rendering/Model/RenderSkinnedAnimation.h>
+#include <ChilliSource/Rendering/RenderCommand/RenderCommandBuffer.h>
+#include <ChilliSource/Rendering/RenderCommand/RenderCommandList.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/ApplyAmbientLightRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/ApplyCameraRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/ApplyDirectionalLightRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/ApplyDynamicMeshRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/ApplyMaterialRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/ApplyMeshBatchRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/ApplyMeshRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/ApplyPointLightRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/ApplyPointLightsRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/ApplySkinnedAnimationRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/BeginRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/BeginWithTargetGroupRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/LoadCubemapRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/LoadMaterialGroupRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/LoadMeshRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/LoadShaderRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/LoadTargetGroupRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/LoadTextureRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/RenderInstanceRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/RenderInstancesRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/RestoreCubemapRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/RestoreMeshRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/RestoreRenderTargetGroupCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/RestoreTextureRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/UnloadCubemapRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/UnloadMaterialGroupRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/UnloadMeshRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/UnloadShaderRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/UnloadTargetGroupRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/UnloadTextureRenderCommand.h>
+#include <ChilliSource/Rendering/Shader/RenderShader.h>
+#include <ChilliSource/Rendering/Target/RenderTargetGroup.h>
+#include <ChilliSource/Rendering/Texture/RenderTexture.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+
+namespace ChilliSource
+{
+    namespace
+    {
+        constexpr u32 k_fileIdentifier = 0x43525343; // "CSRC"
+        constexpr u32 k_fileVersion = 2;
+        constexpr u64 k_headerSize = 3 * sizeof(u32);
+        constexpr u64 k_commandListSize = sizeof(u32);
+        constexpr u64 k_commandSize = 4 * sizeof(u32);
+        
+        constexpr u32 k_noResource = std::numeric_limits<u32>::max();
+        constexpr u32 k_numCubemapFaces = 6;
+        
+        /// The type of each entry in the resource table of a capture. Dynamic meshes and skinned
+        /// animations are per-frame data, so are recreated each time a frame is rebuilt.
+        ///
+        enum class ResourceType
+        {
+            k_texture,
+            k_shader,
+            k_mesh,
+            k_material,
+            k_materialGroup,
+            k_targetGroup,
+            k_dynamicMesh,
+            k_skinnedAnimation
+        };
+        
+        /// Reads a single u32 from the given stream.
+        ///
+        /// @param stream
+        ///     The stream to read from.
+        /// @param out
+        ///     (Out) The value read.
+        ///
+        /// @return Whether or not the value could be read.
+        ///
+        bool ReadU32(IBinaryInputStream* stream, u32& out) noexcept
+        {
+            return stream->Read(reinterpret_cast<u8*>(&out), sizeof(u32));
+        }
+        
+        /// Reads a block of data which was written with its size from the given stream. The size
+        /// is checked against the remaining length of the stream before anything is allocated.
+        ///
+        /// @param stream
+        ///     The stream to read from.
+        /// @param out
+        ///     (Out) The data read.
+        ///
+        /// @return Whether or not the data could be read.
+        ///
+        bool ReadData(IBinaryInputStream* stream, std::vector<u8>& out) noexcept
+        {
+            u32 size = 0;
+            if (!ReadU32(stream, size) || u64(size) > stream->GetLength() - stream->GetReadPosition())
+            {
+                return false;
+            }
+            
+            out.resize(size);
+            return size == 0 || stream->Read(out.data(), size);
+        }
+        
+        /// Appends the given value to the data. This should only be used with types which can
+        /// safely be copied byte-wise, such as the math types.
+        ///
+        /// @param data
+        ///     The data to append to.
+        /// @param value
+        ///     The value to write.
+        ///
+        template <typename TValueType> void WriteValue(std::vector<u8>& data, const TValueType& value) noexcept
+        {
+            auto offset = data.size();
+            data.resize(offset + sizeof(TValueType));
+            memcpy(data.data() + offset, &value, sizeof(TValueType));
+        }
+        
+        /// @param data
+        ///     The data to append to.
+        /// @param value
+        ///     The enum value to write.
+        ///
+        template <typename TEnumType> void WriteEnum(std::vector<u8>& data, TEnumType value) noexcept
+        {
+            WriteValue(data, u32(value));
+        }
+        
+        /// @param data
+        ///     The data to append to.
+        /// @param value
+        ///     The bool to write.
+        ///
+        void WriteBool(std::vector<u8>& data, bool value) noexcept
+        {
+            WriteValue(data, u8(value ? 1 : 0));
+        }
+        
+        /// Appends the size of the given bytes, followed by the bytes themselves.
+        ///
+        /// @param data
+        ///     The data to append to.
+        /// @param bytes
+        ///     The bytes to write. May be null if the size is zero.
+        /// @param size
+        ///     The number of bytes.
+        ///
+        void WriteBytes(std::vector<u8>& data, const void* bytes, u32 size) noexcept
+        {
+            WriteValue(data, size);
+            
+            if (size > 0)
+            {
+                auto offset = data.size();
+                data.resize(offset + size);
+                memcpy(data.data() + offset, bytes, size);
+            }
+        }
+        
+        /// @param data
+        ///     The data to append to.
+        /// @param value
+        ///     The string to write.
+        ///
+        void WriteString(std::vector<u8>& data, const std::string& value) noexcept
+        {
+            WriteBytes(data, value.data(), u32(value.size()));
+        }
+        
+        /// Appends the number of values, followed by the values themselves. This should only be
+        /// used with types which can safely be copied byte-wise.
+        ///
+        /// @param data
+        ///     The data to append to.
+        /// @param values
+        ///     The values to write.
+        ///
+        template <typename TValueType> void WriteVector(std::vector<u8>& data, const std::vector<TValueType>& values) noexcept
+        {
+            WriteValue(data, u32(values.size()));
+            
+            if (values.size() > 0)
+            {
+                auto offset = data.size();
+                data.resize(offset + values.size() * sizeof(TValueType));
+                memcpy(data.data() + offset, values.data(), values.size() * sizeof(TValueType));
+            }
+        }
+        
+        /// @param data
+        ///     The data to append to.
+        /// @param vertexFormat
+        ///     The vertex format to write.
+        ///
+        void WriteVertexFormat(std::vector<u8>& data, const VertexFormat& vertexFormat) noexcept
+        {
+            WriteValue(data, vertexFormat.GetNumElements());
+            for (u32 i = 0; i < vertexFormat.GetNumElements(); ++i)
+            {
+                WriteEnum(data, vertexFormat.GetElement(i));
+            }
+        }
+        
+        /// @param data
+        ///     The data to append to.
+        /// @param sphere
+        ///     The sphere to write.
+        ///
+        void WriteSphere(std::vector<u8>& data, const Sphere& sphere) noexcept
+        {
+            WriteValue(data, sphere.vOrigin);
+            WriteValue(data, sphere.fRadius);
+        }
+        
+        /// Reads back data written with the functions above. Every read is bounds checked, and
+        /// once a read has failed all further reads fail and return default values, so the
+        /// reader only needs to be checked for validity once a set of reads is complete.
+        ///
+        class DataReader final
+        {
+        public:
+            /// @param data
+            ///     The data to read from. Must outlive the reader.
+            /// @param offset
+            ///     (Optional) The offset to start reading from.
+            ///
+            DataReader(const std::vector<u8>& data, std::size_t offset = 0) noexcept
+                : m_data(data), m_offset(offset), m_isValid(offset <= data.size())
+            {
+            }
+            
+            /// @return Whether or not all reads so far have succeeded.
+            ///
+            bool IsValid() const noexcept { return m_isValid; }
+            
+            /// @return Whether or not all of the data has been read.
+            ///
+            bool IsAtEnd() const noexcept { return m_offset == m_data.size(); }
+            
+            /// @return The current read offset.
+            ///
+            std::size_t GetOffset() const noexcept { return m_offset; }
+            
+            /// Marks the data as invalid, causing all further reads to fail.
+            ///
+            void Fail() noexcept { m_isValid = false; }
+            
+            /// @return The next value, or a default constructed value if it couldn't be read.
+            ///
+            template <typename TValueType> TValueType ReadValue() noexcept
+            {
+                TValueType value = TValueType();
+                if (auto bytes = ReadBytes(sizeof(TValueType)))
+                {
+                    memcpy(&value, bytes, sizeof(TValueType));
+                }
+                return value;
+            }
+            
+            /// @return The next enum value.
+            ///
+            template <typename TEnumType> TEnumType ReadEnum() noexcept
+            {
+                return TEnumType(ReadValue<u32>());
+            }
+            
+            /// @return The next bool.
+            ///
+            bool ReadBool() noexcept
+            {
+                return ReadValue<u8>() != 0;
+            }
+            
+            /// @param size
+            ///     (Out) The number of bytes.
+            ///
+            /// @return The next block of bytes. This points into the data being read, so is only
+            ///     valid for as long as the data is. Null if there are no bytes.
+            ///
+            const u8* ReadBytes(u32& size) noexcept
+            {
+                size = ReadValue<u32>();
+                auto bytes = ReadBytes(std::size_t(size));
+                if (!bytes)
+                {
+                    size = 0;
+                }
+                return size > 0 ? bytes : nullptr;
+            }
+            
+            /// @return The next string.
+            ///
+            std::string ReadString() noexcept
+            {
+                u32 size = 0;
+                auto bytes = ReadBytes(size);
+                return size > 0 ? std::string(reinterpret_cast<const char*>(bytes), size) : std::string();
+            }
+            
+            /// @return The next vector of values.
+            ///
+            template <typename TValueType> std::vector<TValueType> ReadVector() noexcept
+            {
+                auto numValues = ReadValue<u32>();
+                if (!m_isValid || numValues > (m_data.size() - m_offset) / sizeof(TValueType))
+                {
+                    m_isValid = false;
+                    return std::vector<TValueType>();
+                }
+                
+                std::vector<TValueType> values(numValues);
+                if (numValues > 0)
+                {
+                    memcpy(values.data(), ReadBytes(numValues * sizeof(TValueType)), numValues * sizeof(TValueType));
+                }
+                return values;
+            }
+            
+            /// @return The next vertex format.
+            ///
+            VertexFormat ReadVertexFormat() noexcept
+            {
+                auto numElements = ReadValue<u32>();
+                if (numElements > VertexFormat::k_maxElements)
+                {
+                    m_isValid = false;
+                }
+                
+                std::vector<VertexFormat::ElementType> elements;
+                for (u32 i = 0; i < numElements && m_isValid; ++i)
+                {
+                    auto element = ReadValue<u32>();
+                    if (element > u32(VertexFormat::ElementType::k_jointIndex4))
+                    {
+                        m_isValid = false;
+                    }
+                    
+                    elements.push_back(VertexFormat::ElementType(element));
+                }
+                
+                return m_isValid ? VertexFormat(elements) : VertexFormat();
+            }
+            
+            /// @return The next sphere.
+            ///
+            Sphere ReadSphere() noexcept
+            {
+                auto origin = ReadValue<Vector3>();
+                auto radius = ReadValue<f32>();
+                return Sphere(origin, radius);
+            }
+            
+        private:
+            /// @param size
+            ///     The number of bytes to read.
+            ///
+            /// @return A pointer to the bytes, or null if they couldn't be read.
+            ///
+            const u8* ReadBytes(std::size_t size) noexcept
+            {
+                if (!m_isValid || size > m_data.size() - m_offset)
+                {
+                    m_isValid = false;
+                    return nullptr;
+                }
+                
+                auto bytes = m_data.data() + m_offset;
+                m_offset += size;
+                return bytes;
+            }
+            
+            const std::vector<u8>& m_data;
+            std::size_t m_offset;
+            bool m_isValid;
+        };
+        
+        /// Builds the resource table of a capture. Each resource is described the first time
+        /// it is referenced, after any resources it depends on, so the table can be read back
+        /// in a single pass.
+        ///
+        class ResourceRecorder final
+        {
+        public:
+            /// @param resourceData
+            ///     The resource table to write to. Must outlive the recorder.
+            ///
+            ResourceRecorder(std::vector<u8>& resourceData) noexcept
+                : m_resourceData(resourceData)
+            {
+            }
+            
+            /// @param renderTexture
+            ///     The texture. May be null.
+            ///
+            /// @return The index of the texture in the table.
+            ///
+            u32 AddTexture(const RenderTexture* renderTexture) noexcept
+            {
+                u32 index = 0;
+                if (!renderTexture || TryGetIndex(renderTexture, index))
+                {
+                    return renderTexture ? index : k_noResource;
+                }
+                
+                WriteEnum(m_resourceData, ResourceType::k_texture);
+                WriteValue(m_resourceData, renderTexture->GetDimensions());
+                WriteEnum(m_resourceData, renderTexture->GetImageFormat());
+                WriteEnum(m_resourceData, renderTexture->GetImageCompression());
+                WriteEnum(m_resourceData, renderTexture->GetFilterMode());
+                WriteEnum(m_resourceData, renderTexture->GetWrapModeS());
+                WriteEnum(m_resourceData, renderTexture->GetWrapModeT());
+                WriteBool(m_resourceData, renderTexture->IsMipmapped());
+                WriteBool(m_resourceData, renderTexture->ShouldBackupData());
+                
+                return AddIndex(renderTexture);
+            }
+            
+            /// @param renderShader
+            ///     The shader.
+            ///
+            /// @return The index of the shader in the table.
+            ///
+            u32 AddShader(const RenderShader* renderShader) noexcept
+            {
+                u32 index = 0;
+                if (TryGetIndex(renderShader, index))
+                {
+                    return index;
+                }
+                
+                WriteEnum(m_resourceData, ResourceType::k_shader);
+                
+                return AddIndex(renderShader);
+            }
+            
+            /// @param renderMesh
+            ///     The mesh.
+            ///
+            /// @return The index of the mesh in the table.
+            ///
+            u32 AddMesh(const RenderMesh* renderMesh) noexcept
+            {
+                u32 index = 0;
+                if (TryGetIndex(renderMesh, index))
+                {
+                    return index;
+                }
+                
+                WriteEnum(m_resourceData, ResourceType::k_mesh);
+                WriteEnum(m_resourceData, renderMesh->GetPolygonType());
+                WriteVertexFormat(m_resourceData, renderMesh->GetVertexFormat());
+                WriteEnum(m_resourceData, renderMesh->GetIndexFormat());
+                WriteValue(m_resourceData, renderMesh->GetNumVertices());
+                WriteValue(m_resourceData, renderMesh->GetNumIndices());
+                WriteSphere(m_resourceData, renderMesh->GetBoundingSphere());
+                WriteBool(m_resourceData, renderMesh->ShouldBackupData());
+                WriteVector(m_resourceData, renderMesh->GetInverseBindPoseMatrices());
+                
+                return AddIndex(renderMesh);
+            }
+            
+            /// @param renderMaterial
+            ///     The material.
+            ///
+            /// @return The index of the material in the table.
+            ///
+            u32 AddMaterial(const RenderMaterial* renderMaterial) noexcept
+            {
+                u32 index = 0;
+                if (TryGetIndex(renderMaterial, index))
+                {
+                    return index;
+                }
+                
+                auto shaderIndex = AddShader(renderMaterial->GetRenderShader());
+                
+                std::vector<u32> textureIndices;
+                for (auto renderTexture : renderMaterial->GetRenderTextures2D())
+                {
+                    textureIndices.push_back(AddTexture(renderTexture));
+                }
+                
+                std::vector<u32> cubemapIndices;
+                for (auto renderTexture : renderMaterial->GetRenderTexturesCubemap())
+                {
+                    cubemapIndices.push_back(AddTexture(renderTexture));
+                }
+                
+                WriteEnum(m_resourceData, ResourceType::k_material);
+                WriteValue(m_resourceData, shaderIndex);
+                WriteVector(m_resourceData, textureIndices);
+                WriteVector(m_resourceData, cubemapIndices);
+                WriteBool(m_resourceData, renderMaterial->IsTransparencyEnabled());
+                WriteBool(m_resourceData, renderMaterial->IsColourWriteEnabled());
+                WriteBool(m_resourceData, renderMaterial->IsDepthWriteEnabled());
+                WriteBool(m_resourceData, renderMaterial->IsDepthTestEnabled());
+                WriteBool(m_resourceData, renderMaterial->IsFaceCullingEnabled());
+                WriteBool(m_resourceData, renderMaterial->IsStencilTestEnabled());
+                WriteEnum(m_resourceData, renderMaterial->GetDepthTestFunc());
+                WriteEnum(m_resourceData, renderMaterial->GetSourceBlendMode());
+                WriteEnum(m_resourceData, renderMaterial->GetDestinationBlendMode());
+                WriteEnum(m_resourceData, renderMaterial->GetStencilFailOp());
+                WriteEnum(m_resourceData, renderMaterial->GetStencilDepthFailOp());
+                WriteEnum(m_resourceData, renderMaterial->GetStencilPassOp());
+                WriteEnum(m_resourceData, renderMaterial->GetStencilTestFunc());
+                WriteValue(m_resourceData, renderMaterial->GetStencilTestFuncRef());
+                WriteValue(m_resourceData, renderMaterial->GetStencilTestFuncMask());
+                WriteEnum(m_resourceData, renderMaterial->GetCullFace());
+                WriteValue(m_resourceData, renderMaterial->GetEmissiveColour());
+                WriteValue(m_resourceData, renderMaterial->GetAmbientColour());
+                WriteValue(m_resourceData, renderMaterial->GetDiffuseColour());
+                WriteValue(m_resourceData, renderMaterial->GetSpecularColour());
+                
+                auto renderShaderVariables = renderMaterial->GetRenderShaderVariables();
+                WriteBool(m_resourceData, renderShaderVariables != nullptr);
+                if (renderShaderVariables)
+                {
+                    WriteValue(m_resourceData, renderShaderVariables->GetNumVariables());
+                    for (const auto& variable : renderShaderVariables->GetVariables())
+                    {
+                        WriteString(m_resourceData, variable.m_name);
+                        WriteEnum(m_resourceData, variable.m_type);
+                        WriteValue(m_resourceData, variable.m_dataOffset);
+                    }
+                    WriteVector(m_resourceData, renderShaderVariables->GetData());
+                }
+                
+                return AddIndex(renderMaterial);
+            }
+            
+            /// @param renderMaterialGroup
+            ///     The material group.
+            ///
+            /// @return The index of the material group in the table.
+            ///
+            u32 AddMaterialGroup(RenderMaterialGroup* renderMaterialGroup) noexcept
+            {
+                u32 index = 0;
+                if (TryGetIndex(renderMaterialGroup, index))
+                {
+                    return index;
+                }
+                
+                const auto& renderMaterials = renderMaterialGroup->GetRenderMaterials();
+                
+                std::vector<u32> materialIndices;
+                for (auto renderMaterial : renderMaterials)
+                {
+                    materialIndices.push_back(AddMaterial(renderMaterial));
+                }
+                
+                WriteEnum(m_resourceData, ResourceType::k_materialGroup);
+                WriteVector(m_resourceData, materialIndices);
+                
+                //the materials in each collection are stored as indices into the group's material list.
+                const auto& collections = renderMaterialGroup->GetCollections();
+                WriteValue(m_resourceData, u32(collections.size()));
+                for (const auto& collection : collections)
+                {
+                    WriteVertexFormat(m_resourceData, collection.GetVertexFormat());
+                    
+                    for (u32 i = 0; i < RenderMaterialGroup::k_numMaterialSlots; ++i)
+                    {
+                        auto it = std::find(renderMaterials.begin(), renderMaterials.end(), collection.GetRenderMaterial(i));
+                        WriteValue(m_resourceData, it != renderMaterials.end() ? u32(it - renderMaterials.begin()) : k_noResource);
+                    }
+                }
+                
+                return AddIndex(renderMaterialGroup);
+            }
+            
+            /// @param renderTargetGroup
+            ///     The target group.
+            ///
+            /// @return The index of the target group in the table.
+            ///
+            u32 AddTargetGroup(const RenderTargetGroup* renderTargetGroup) noexcept
+            {
+                u32 index = 0;
+                if (TryGetIndex(renderTargetGroup, index))
+                {
+                    return index;
+                }
+                
+                auto colourTargetIndex = AddTexture(renderTargetGroup->GetColourTarget());
+                auto depthTargetIndex = AddTexture(renderTargetGroup->GetDepthTarget());
+                
+                auto type = RenderTargetGroupType::k_colour;
+                if (renderTargetGroup->ShouldUseStencilBuffer())
+                {
+                    type = RenderTargetGroupType::k_colourDepthStencil;
+                }
+                else if (renderTargetGroup->ShouldUseDepthBuffer())
+                {
+                    type = RenderTargetGroupType::k_colourDepth;
+                }
+                
+                WriteEnum(m_resourceData, ResourceType::k_targetGroup);
+                WriteValue(m_resourceData, colourTargetIndex);
+                WriteValue(m_resourceData, depthTargetIndex);
+                WriteEnum(m_resourceData, type);
+                
+                return AddIndex(renderTargetGroup);
+            }
+            
+            /// @param renderDynamicMesh
+            ///     The dynamic mesh.
+            ///
+            /// @return The index of the dynamic mesh in the table.
+            ///
+            u32 AddDynamicMesh(const RenderDynamicMesh* renderDynamicMesh) noexcept
+            {
+                u32 index = 0;
+                if (TryGetIndex(renderDynamicMesh, index))
+                {
+                    return index;
+                }
+                
+                WriteEnum(m_resourceData, ResourceType::k_dynamicMesh);
+                WriteEnum(m_resourceData, renderDynamicMesh->GetPolygonType());
+                WriteVertexFormat(m_resourceData, renderDynamicMesh->GetVertexFormat());
+                WriteEnum(m_resourceData, renderDynamicMesh->GetIndexFormat());
+                WriteValue(m_resourceData, renderDynamicMesh->GetNumVertices());
+                WriteValue(m_resourceData, renderDynamicMesh->GetNumIndices());
+                WriteSphere(m_resourceData, renderDynamicMesh->GetBoundingSphere());
+                WriteBytes(m_resourceData, renderDynamicMesh->GetVertexData(), renderDynamicMesh->GetVertexDataSize());
+                WriteBytes(m_resourceData, renderDynamicMesh->GetIndexData(), renderDynamicMesh->GetIndexDataSize());
+                
+                return AddIndex(renderDynamicMesh);
+            }
+            
+            /// @param renderSkinnedAnimation
+            ///     The skinned animation.
+            ///
+            /// @return The index of the skinned animation in the table.
+            ///
+            u32 AddSkinnedAnimation(const RenderSkinnedAnimation* renderSkinnedAnimation) noexcept
+            {
+                u32 index = 0;
+                if (TryGetIndex(renderSkinnedAnimation, index))
+                {
+                    return index;
+                }
+                
+                WriteEnum(m_resourceData, ResourceType::k_skinnedAnimation);
+                WriteBytes(m_resourceData, renderSkinnedAnimation->GetJointData(), renderSkinnedAnimation->GetJointDataSize() * sizeof(Vector4));
+                
+                return AddIndex(renderSkinnedAnimation);
+            }
+            
+        private:
+            /// @param resource
+            ///     The resource.
+            /// @param index
+            ///     (Out) The index of the resource, if it has already been added.
+            ///
+            /// @return Whether or not the resource has already been added.
+            ///
+            bool TryGetIndex(const void* resource, u32& index) const noexcept
+            {
+                auto it = m_indices.find(resource);
+                if (it == m_indices.end())
+                {
+                    return false;
+                }
+                
+                index = it->second;
+                return true;
+            }
+            
+            /// Assigns the next index to the given resource, which has just been described.
+            ///
+            /// @param resource
+            ///     The resource.
+            ///
+            /// @return The index of the resource.
+            ///
+            u32 AddIndex(const void* resource) noexcept
+            {
+                auto index = u32(m_indices.size());
+                m_indices.emplace(resource, index);
+                return index;
+            }
+            
+            std::vector<u8>& m_resourceData;
+            std::unordered_map<const void*, u32> m_indices;
+        };
+        
+        /// Writes the payload of the given command, describing any resources it references.
+        ///
+        /// @param renderCommand
+        ///     The command.
+        /// @param resourceRecorder
+        ///     The recorder for the resource table.
+        /// @param payloadData
+        ///     The payload data to append to.
+        ///
+        void WritePayload(const RenderCommand* renderCommand, ResourceRecorder& resourceRecorder, std::vector<u8>& payloadData) noexcept
+        {
+            switch (renderCommand->GetType())
+            {
+                case RenderCommand::Type::k_loadTexture:
+                {
+                    auto command = static_cast<const LoadTextureRenderCommand*>(renderCommand);
+                    WriteValue(payloadData, resourceRecorder.AddTexture(command->GetRenderTexture()));
+                    WriteBytes(payloadData, command->GetTextureData(), command->GetTextureData() ? command->GetTextureDataSize() : 0);
+                    break;
+                }
+                case RenderCommand::Type::k_loadCubemap:
+                {
+                    auto command = static_cast<const LoadCubemapRenderCommand*>(renderCommand);
+                    WriteValue(payloadData, resourceRecorder.AddTexture(command->GetRenderTexture()));
+                    for (const auto& textureData : command->GetTextureData())
+                    {
+                        WriteBytes(payloadData, textureData.get(), textureData ? command->GetTextureDataSize() : 0);
+                    }
+                    break;
+                }
+                case RenderCommand::Type::k_loadShader:
+                {
+                    auto command = static_cast<const LoadShaderRenderCommand*>(renderCommand);
+                    WriteValue(payloadData, resourceRecorder.AddShader(command->GetRenderShader()));
+                    WriteString(payloadData, command->GetVertexShader());
+                    WriteString(payloadData, command->GetFragmentShader());
+                    break;
+                }
+                case RenderCommand::Type::k_loadMaterialGroup:
+                    WriteValue(payloadData, resourceRecorder.AddMaterialGroup(static_cast<const LoadMaterialGroupRenderCommand*>(renderCommand)->GetRenderMaterialGroup()));
+                    break;
+                case RenderCommand::Type::k_loadMesh:
+                {
+                    auto command = static_cast<const LoadMeshRenderCommand*>(renderCommand);
+                    WriteValue(payloadData, resourceRecorder.AddMesh(command->GetRenderMesh()));
+                    WriteBytes(payloadData, command->GetVertexData(), command->GetVertexData() ? command->GetVertexDataSize() : 0);
+                    WriteBytes(payloadData, command->GetIndexData(), command->GetIndexData() ? command->GetIndexDataSize() : 0);
+                    break;
+                }
+                case RenderCommand::Type::k_restoreTexture:
+                    WriteValue(payloadData, resourceRecorder.AddTexture(static_cast<const RestoreTextureRenderCommand*>(renderCommand)->GetRenderTexture()));
+                    break;
+                case RenderCommand::Type::k_restoreCubemap:
+                    WriteValue(payloadData, resourceRecorder.AddTexture(static_cast<const RestoreCubemapRenderCommand*>(renderCommand)->GetRenderTexture()));
+                    break;
+                case RenderCommand::Type::k_restoreMesh:
+                    WriteValue(payloadData, resourceRecorder.AddMesh(static_cast<const RestoreMeshRenderCommand*>(renderCommand)->GetRenderMesh()));
+                    break;
+                case RenderCommand::Type::k_restoreRenderTargetGroup:
+                    WriteValue(payloadData, resourceRecorder.AddTargetGroup(static_cast<const RestoreRenderTargetGroupCommand*>(renderCommand)->GetTargetRenderGroup()));
+                    break;
+                case RenderCommand::Type::k_loadTargetGroup:
+                    WriteValue(payloadData, resourceRecorder.AddTargetGroup(static_cast<const LoadTargetGroupRenderCommand*>(renderCommand)->GetRenderTargetGroup()));
+                    break;
+                case RenderCommand::Type::k_begin:
+                {
+                    auto command = static_cast<const BeginRenderCommand*>(renderCommand);
+                    WriteValue(payloadData, command->GetResolution());
+                    WriteValue(payloadData, command->GetClearColour());
+                    break;
+                }
+                case RenderCommand::Type::k_beginWithTargetGroup:
+                {
+                    auto command = static_cast<const BeginWithTargetGroupRenderCommand*>(renderCommand);
+                    WriteValue(payloadData, resourceRecorder.AddTargetGroup(command->GetRenderTargetGroup()));
+                    WriteValue(payloadData, command->GetClearColour());
+                    break;
+                }
+                case RenderCommand::Type::k_applyCamera:
+                {
+                    auto command = static_cast<const ApplyCameraRenderCommand*>(renderCommand);
+                    WriteValue(payloadData, command->GetPosition());
+                    WriteValue(payloadData, command->GetViewMatrix());
+                    WriteValue(payloadData, command->GetViewProjectionMatrix());
+                    break;
+                }
+                case RenderCommand::Type::k_applyAmbientLight:
+                    WriteValue(payloadData, static_cast<const ApplyAmbientLightRenderCommand*>(renderCommand)->GetColour());
+                    break;
+                case RenderCommand::Type::k_applyDirectionalLight:
+                {
+                    auto command = static_cast<const ApplyDirectionalLightRenderCommand*>(renderCommand);
+                    WriteValue(payloadData, command->GetColour());
+                    WriteValue(payloadData, command->GetDirection());
+                    WriteValue(payloadData, command->GetLightViewProjection());
+                    WriteValue(payloadData, command->GetShadowTolerance());
+                    WriteValue(payloadData, resourceRecorder.AddTexture(command->GetShadowMapRenderTexture()));
+                    break;
+                }
+                case RenderCommand::Type::k_applyPointLight:
+                {
+                    auto command = static_cast<const ApplyPointLightRenderCommand*>(renderCommand);
+                    WriteValue(payloadData, command->GetColour());
+                    WriteValue(payloadData, command->GetPosition());
+                    WriteValue(payloadData, command->GetAttenuation());
+                    break;
+                }
+                case RenderCommand::Type::k_applyPointLights:
+                {
+                    auto command = static_cast<const ApplyPointLightsRenderCommand*>(renderCommand);
+                    WriteVector(payloadData, command->GetColours());
+                    WriteVector(payloadData, command->GetPositions());
+                    WriteVector(payloadData, command->GetAttenuations());
+                    break;
+                }
+                case RenderCommand::Type::k_applyMaterial:
+                    WriteValue(payloadData, resourceRecorder.AddMaterial(static_cast<const ApplyMaterialRenderCommand*>(renderCommand)->GetRenderMaterial()));
+                    break;
+                case RenderCommand::Type::k_applyMesh:
+                    WriteValue(payloadData, resourceRecorder.AddMesh(static_cast<const ApplyMeshRenderCommand*>(renderCommand)->GetRenderMesh()));
+                    break;
+                case RenderCommand::Type::k_applyDynamicMesh:
+                    WriteValue(payloadData, resourceRecorder.AddDynamicMesh(static_cast<const ApplyDynamicMeshRenderCommand*>(renderCommand)->GetRenderDynamicMesh()));
+                    break;
+                case RenderCommand::Type::k_applyMeshBatch:
+                {
+                    //The batch is stored in its combined, world space form, so it's rebuilt as a single mesh with an identity transform.
+                    auto renderMeshBatch = static_cast<const ApplyMeshBatchRenderCommand*>(renderCommand)->GetRenderMeshBatch();
+                    WriteEnum(payloadData, renderMeshBatch->GetPolygonType());
+                    WriteVertexFormat(payloadData, renderMeshBatch->GetVertexFormat());
+                    WriteEnum(payloadData, renderMeshBatch->GetIndexFormat());
+                    WriteValue(payloadData, renderMeshBatch->GetNumVertices());
+                    WriteValue(payloadData, renderMeshBatch->GetNumIndices());
+                    WriteBytes(payloadData, renderMeshBatch->GetVertexData(), renderMeshBatch->GetVertexDataSize());
+                    WriteBytes(payloadData, renderMeshBatch->GetIndexData(), renderMeshBatch->GetIndexData() ? renderMeshBatch->GetIndexDataSize() : 0);
+                    break;
+                }
+                case RenderCommand::Type::k_applySkinnedAnimation:
+                    WriteValue(payloadData, resourceRecorder.AddSkinnedAnimation(static_cast<const ApplySkinnedAnimationRenderCommand*>(renderCommand)->GetRenderSkinnedAnimation()));
+                    break;
+                case RenderCommand::Type::k_renderInstance:
+                    WriteValue(payloadData, static_cast<const RenderInstanceRenderCommand*>(renderCommand)->GetWorldMatrix());
+                    break;
+                case RenderCommand::Type::k_renderInstances:
+                    WriteVector(payloadData, static_cast<const RenderInstancesRenderCommand*>(renderCommand)->GetWorldMatrices());
+                    break;
+                case RenderCommand::Type::k_end:
+                    break;
+                case RenderCommand::Type::k_unloadTargetGroup:
+                    WriteValue(payloadData, resourceRecorder.AddTargetGroup(static_cast<const UnloadTargetGroupRenderCommand*>(renderCommand)->GetRenderTargetGroup()));
+                    break;
+                case RenderCommand::Type::k_unloadMesh:
+                    WriteValue(payloadData, resourceRecorder.AddMesh(static_cast<const UnloadMeshRenderCommand*>(renderCommand)->GetRenderMesh()));
+                    break;
+                case RenderCommand::Type::k_unloadMaterialGroup:
+                    WriteValue(payloadData, resourceRecorder.AddMaterialGroup(static_cast<const UnloadMaterialGroupRenderCommand*>(renderCommand)->GetRenderMaterialGroup()));
+                    break;
+                case RenderCommand::Type::k_unloadShader:
+                    WriteValue(payloadData, resourceRecorder.AddShader(static_cast<const UnloadShaderRenderCommand*>(renderCommand)->GetRenderShader()));
+                    break;
+                case RenderCommand::Type::k_unloadTexture:
+                    WriteValue(payloadData, resourceRecorder.AddTexture(static_cast<const UnloadTextureRenderCommand*>(renderCommand)->GetRenderTexture()));
+                    break;
+                case RenderCommand::Type::k_unloadCubemap:
+                    WriteValue(payloadData, resourceRecorder.AddTexture(static_cast<const UnloadCubemapRenderCommand*>(renderCommand)->GetRenderTexture()));
+                    break;
+            }
+        }
+        
+        
+        /// Creates a new object, either from the given allocator or, if it is null, from the
+        /// free store.
+        ///
+        /// @param allocator
+        ///     (Optional) The allocator to create the object from.
+        /// @param constructorArgs
+        ///     The constructor arguments.
+        ///
+        /// @return The new object.
+        ///
+        template <typename TType, typename... TConstructorArgs> UniquePtr<TType> CreateUnique(IAllocator* allocator, TConstructorArgs&&... constructorArgs) noexcept
+        {
+            if (allocator)
+            {
+                return MakeUnique<TType>(*allocator, std::forward<TConstructorArgs>(constructorArgs)...);
+            }
+            
+            return UniquePtr<TType>(new TType(std::forward<TConstructorArgs>(constructorArgs)...), [](const TType* object) noexcept -> void
+            {
+                delete object;
+            });
+        }
+        
+        /// Creates a copy of the given data, either from the given allocator or, if it is null,
+        /// from the free store.
+        ///
+        /// @param allocator
+        ///     (Optional) The allocator to create the copy from.
+        /// @param data
+        ///     The data to copy.
+        /// @param size
+        ///     The number of values.
+        ///
+        /// @return The copy.
+        ///
+        template <typename TType> UniquePtr<TType[]> CreateUniqueArrayCopy(IAllocator* allocator, const u8* data, u32 size) noexcept
+        {
+            UniquePtr<TType[]> copy;
+            if (allocator)
+            {
+                copy = MakeUniqueArray<TType>(*allocator, size);
+            }
+            else
+            {
+                copy = UniquePtr<TType[]>(new TType[size], [](const TType* array) noexcept -> void
+                {
+                    delete[] array;
+                });
+            }
+            
+            if (size > 0)
+            {
+                memcpy(copy.get(), data, size * sizeof(TType));
+            }
+            
+            return copy;
+        }
+        
+        /// @param bytes
+        ///     The bytes to copy. May be null if the size is zero.
+        /// @param size
+        ///     The number of bytes.
+        ///
+        /// @return A copy of the given bytes, or null if there are none.
+        ///
+        std::unique_ptr<const u8[]> CopyBytes(const u8* bytes, u32 size) noexcept
+        {
+            if (size == 0)
+            {
+                return nullptr;
+            }
+            
+            std::unique_ptr<u8[]> copy(new u8[size]);
+            memcpy(copy.get(), bytes, size);
+            return std::unique_ptr<const u8[]>(std::move(copy));
+        }
+    }
+    
+    /// The resources created to replay a capture. Every entry in the resource table other than
+    /// per-frame data is created up front, and is shared by each rebuilt buffer. Materials are
+    /// owned by the captured group which contains them, or by a group of their own if their
+    /// group wasn't captured.
+    ///
+    struct RenderCommandCapture::ReplayResources final
+    {
+        /// Creates the resources described by the given resource table.
+        ///
+        /// @param resourceData
+        ///     The resource table. Must outlive this.
+        ///
+        ReplayResources(const std::vector<u8>& resourceData) noexcept;
+        
+        /// Looks up the resource with the given index.
+        ///
+        /// @param reader
+        ///     The reader which the index was read from. This fails if the index is invalid.
+        /// @param index
+        ///     The resource index.
+        /// @param type
+        ///     The expected type of the resource.
+        /// @param isOptional
+        ///     (Optional) Whether or not the index can refer to no resource.
+        ///
+        /// @return The resource, or null if there is none.
+        ///
+        template <typename TType> TType* FindResource(DataReader& reader, u32 index, ResourceType type, bool isOptional = false) const noexcept;
+        
+        /// Reads a resource index, and looks up the resource it refers to.
+        ///
+        /// @param reader
+        ///     The reader to read the index from. This fails if the index is invalid.
+        /// @param type
+        ///     The expected type of the resource.
+        /// @param isOptional
+        ///     (Optional) Whether or not the index can refer to no resource.
+        ///
+        /// @return The resource, or null if there is none.
+        ///
+        template <typename TType> TType* GetResource(DataReader& reader, ResourceType type, bool isOptional = false) const noexcept;
+        
+        /// Creates a new object from the resource description at the current read position. Any
+        /// resources which it depends on must already have been created.
+        ///
+        /// @param reader
+        ///     The reader for the resource table, positioned after the resource type.
+        /// @param allocator
+        ///     (Optional) The allocator to create the object from.
+        ///
+        /// @return The new object, or null if the description is invalid.
+        ///
+        template <typename TType> UniquePtr<TType> CreateResource(DataReader& reader, IAllocator* allocator) const noexcept;
+        
+        /// Creates a new material group, and the materials it contains, from the description at
+        /// the current read position.
+        ///
+        /// @param reader
+        ///     The reader for the resource table, positioned after the resource type.
+        /// @param allocator
+        ///     (Optional) The allocator to create the group and its materials from.
+        /// @param materialIndices
+        ///     (Optional) (Out) The resource index of each material in the group.
+        ///
+        /// @return The new group, or null if the description is invalid.
+        ///
+        UniquePtr<RenderMaterialGroup> CreateMaterialGroup(DataReader& reader, IAllocator* allocator, std::vector<u32>* materialIndices) const noexcept;
+        
+        /// Reads a resource index, and creates a new copy of the resource it refers to. This is
+        /// used for resources which are owned by a command.
+        ///
+        /// @param reader
+        ///     The reader to read the index from. This fails if the index is invalid.
+        /// @param type
+        ///     The expected type of the resource.
+        /// @param allocator
+        ///     The allocator to create the copy from.
+        ///
+        /// @return The new copy, or null if it could not be created.
+        ///
+        template <typename TType> UniquePtr<TType> CreateResourceCopy(DataReader& reader, ResourceType type, IAllocator* allocator) const noexcept;
+        
+        /// Reads the payload of a single command, and adds the command it describes to the given
+        /// list.
+        ///
+        /// @param type
+        ///     The type of the command.
+        /// @param reader
+        ///     The reader for the payload data. This fails if the payload is invalid.
+        /// @param frameAllocator
+        ///     The allocator for per-frame data.
+        /// @param frameResources
+        ///     The per-frame resources which have already been created for the frame, by index.
+        /// @param renderFrameData
+        ///     The container which owns the per-frame resources.
+        /// @param renderCommandList
+        ///     The list to add the command to.
+        ///
+        void AddCommand(RenderCommand::Type type, DataReader& reader, IAllocator* frameAllocator, std::vector<const void*>& frameResources, RenderFrameData& renderFrameData,
+                        RenderCommandList& renderCommandList) const noexcept;
+        
+        const std::vector<u8>& m_resourceData;
+        bool m_isValid = false;
+        std::vector<ResourceType> m_types;
+        std::vector<std::size_t> m_offsets;
+        std::vector<void*> m_resources;
+        std::vector<UniquePtr<RenderTexture>> m_renderTextures;
+        std::vector<UniquePtr<RenderShader>> m_renderShaders;
+        std::vector<UniquePtr<RenderMesh>> m_renderMeshes;
+        std::vector<UniquePtr<RenderMaterialGroup>> m_renderMaterialGroups;
+        std::vector<UniquePtr<RenderTargetGroup>> m_renderTargetGroups;
+    };
+    
+    //------------------------------------------------------------------------------
+    template <typename TType> TType* RenderCommandCapture::ReplayResources::FindResource(DataReader& reader, u32 index, ResourceType type, bool isOptional) const noexcept
+    {
+        if (index == k_noResource && isOptional)
+        {
+            return nullptr;
+        }
+        
+        if (index >= m_types.size() || m_types[index] != type || !m_resources[index])
+        {
+            reader.Fail();
+            return nullptr;
+        }
+        
+        return static_cast<TType*>(m_resources[index]);
+    }
+    
+    //------------------------------------------------------------------------------
+    template <typename TType> TType* RenderCommandCapture::ReplayResources::GetResource(DataReader& reader, ResourceType type, bool isOptional) const noexcept
+    {
+        auto index = reader.ReadValue<u32>();
+        return FindResource<TType>(reader, index, type, isOptional);
+    }
+    
+    //------------------------------------------------------------------------------
+    template <> UniquePtr<RenderTexture> RenderCommandCapture::ReplayResources::CreateResource<RenderTexture>(DataReader& reader, IAllocator* allocator) const noexcept
+    {
+        auto dimensions = reader.ReadValue<Integer2>();
+        auto imageFormat = reader.ReadEnum<ImageFormat>();
+        auto imageCompression = reader.ReadEnum<ImageCompression>();
+        auto filterMode = reader.ReadEnum<TextureFilterMode>();
+        auto wrapModeS = reader.ReadEnum<TextureWrapMode>();
+        auto wrapModeT = reader.ReadEnum<TextureWrapMode>();
+        auto isMipmapped = reader.ReadBool();
+        auto shouldBackupData = reader.ReadBool();
+        
+        if (!reader.IsValid())
+        {
+            return nullptr;
+        }
+        
+        return CreateUnique<RenderTexture>(allocator, dimensions, imageFormat, imageCompression, filterMode, wrapModeS, wrapModeT, isMipmapped, shouldBackupData);
+    }
+    
+    //------------------------------------------------------------------------------
+    template <> UniquePtr<RenderShader> RenderCommandCapture::ReplayResources::CreateResource<RenderShader>(DataReader& reader, IAllocator* allocator) const noexcept
+    {
+        return CreateUnique<RenderShader>(allocator);
+    }
+    
+    //------------------------------------------------------------------------------
+    template <> UniquePtr<RenderMesh> RenderCommandCapture::ReplayResources::CreateResource<RenderMesh>(DataReader& reader, IAllocator* allocator) const noexcept
+    {
+        auto polygonType = reader.ReadEnum<PolygonType>();
+        auto vertexFormat = reader.ReadVertexFormat();
+        auto indexFormat = reader.ReadEnum<IndexFormat>();
+        auto numVertices = reader.ReadValue<u32>();
+        auto numIndices = reader.ReadValue<u32>();
+        auto boundingSphere = reader.ReadSphere();
+        auto shouldBackupData = reader.ReadBool();
+        auto inverseBindPoseMatrices = reader.ReadVector<Matrix4>();
+        
+        if (!reader.IsValid())
+        {
+            return nullptr;
+        }
+        
+        return CreateUnique<RenderMesh>(allocator, polygonType, vertexFormat, indexFormat, numVertices, numIndices, boundingSphere, shouldBackupData, std::move(inverseBindPoseMatrices));
+    }
+    
+    //------------------------------------------------------------------------------
+    template <> UniquePtr<RenderMaterial> RenderCommandCapture::ReplayResources::CreateResource<RenderMaterial>(DataReader& reader, IAllocator* allocator) const noexcept
+    {
+        auto renderShader = GetResource<const RenderShader>(reader, ResourceType::k_shader);
+        
+        std::vector<const RenderTexture*> renderTextures2D;
+        for (auto index : reader.ReadVector<u32>())
+        {
+            renderTextures2D.push_back(FindResource<const RenderTexture>(reader, index, ResourceType::k_texture, true));
+        }
+        
+        std::vector<const RenderTexture*> renderTexturesCubemap;
+        for (auto index : reader.ReadVector<u32>())
+        {
+            renderTexturesCubemap.push_back(FindResource<const RenderTexture>(reader, index, ResourceType::k_texture, true));
+        }
+        
+        auto isTransparencyEnabled = reader.ReadBool();
+        auto isColourWriteEnabled = reader.ReadBool();
+        auto isDepthWriteEnabled = reader.ReadBool();
+        auto isDepthTestEnabled = reader.ReadBool();
+        auto isFaceCullingEnabled = reader.ReadBool();
+        auto isStencilTestEnabled = reader.ReadBool();
+        auto depthTestFunc = reader.ReadEnum<TestFunc>();
+        auto sourceBlendMode = reader.ReadEnum<BlendMode>();
+        auto destinationBlendMode = reader.ReadEnum<BlendMode>();
+        auto stencilFailOp = reader.ReadEnum<StencilOp>();
+        auto stencilDepthFailOp = reader.ReadEnum<StencilOp>();
+        auto stencilPassOp = reader.ReadEnum<StencilOp>();
+        auto stencilTestFunc = reader.ReadEnum<TestFunc>();
+        auto stencilRef = reader.ReadValue<s32>();
+        auto stencilMask = reader.ReadValue<u32>();
+        auto cullFace = reader.ReadEnum<CullFace>();
+        auto emissiveColour = reader.ReadValue<Colour>();
+        auto ambientColour = reader.ReadValue<Colour>();
+        auto diffuseColour = reader.ReadValue<Colour>();
+        auto specularColour = reader.ReadValue<Colour>();
+        
+        RenderShaderVariablesUPtr renderShaderVariables;
+        if (reader.ReadBool())
+        {
+            std::vector<RenderShaderVariables::Variable> variables;
+            auto numVariables = reader.ReadValue<u32>();
+            for (u32 i = 0; i < numVariables && reader.IsValid(); ++i)
+            {
+                auto name = reader.ReadString();
+                auto type = reader.ReadEnum<RenderShaderVariables::Type>();
+                auto dataOffset = reader.ReadValue<u32>();
+                variables.push_back(RenderShaderVariables::Variable { std::move(name), type, dataOffset });
+            }
+            
+            auto data = reader.ReadVector<f32>();
+            
+            std::unordered_map<std::string, f32> floatVars;
+            std::unordered_map<std::string, Vector2> vec2Vars;
+            std::unordered_map<std::string, Vector3> vec3Vars;
+            std::unordered_map<std::string, Vector4> vec4Vars;
+            std::unordered_map<std::string, Matrix4> mat4Vars;
+            std::unordered_map<std::string, Colour> colourVars;
+            
+            for (const auto& variable : variables)
+            {
+                if (variable.m_type > RenderShaderVariables::Type::k_colour || variable.m_dataOffset > data.size() || RenderShaderVariables::GetNumComponents(variable.m_type) > data.size() - variable.m_dataOffset)
+                {
+                    reader.Fail();
+                    break;
+                }
+                
+                auto values = data.data() + variable.m_dataOffset;
+                switch (variable.m_type)
+                {
+                    case RenderShaderVariables::Type::k_float:
+                        floatVars.emplace(variable.m_name, values[0]);
+                        break;
+                    case RenderShaderVariables::Type::k_vector2:
+                        vec2Vars.emplace(variable.m_name, Vector2(values[0], values[1]));
+                        break;
+                    case RenderShaderVariables::Type::k_vector3:
+                        vec3Vars.emplace(variable.m_name, Vector3(values[0], values[1], values[2]));
+                        break;
+                    case RenderShaderVariables::Type::k_vector4:
+                        vec4Vars.emplace(variable.m_name, Vector4(values[0], values[1], values[2], values[3]));
+                        break;
+                    case RenderShaderVariables::Type::k_matrix4:
+                    {
+                        Matrix4 matrix;
+                        memcpy(matrix.m, values, sizeof(matrix.m));
+                        mat4Vars.emplace(variable.m_name, matrix);
+                        break;
+                    }
+                    case RenderShaderVariables::Type::k_colour:
+                        colourVars.emplace(variable.m_name, Colour(values[0], values[1], values[2], values[3]));
+                        break;
+                }
+            }
+            
+            if (reader.IsValid())
+            {
+                renderShaderVariables = RenderShaderVariablesUPtr(new RenderShaderVariables(floatVars, vec2Vars, vec3Vars, vec4Vars, mat4Vars, colourVars));
+            }
+        }
+        
+        if (!reader.IsValid())
+        {
+            return nullptr;
+        }
+        
+        return CreateUnique<RenderMaterial>(allocator, renderShader, std::move(renderTextures2D), std::move(renderTexturesCubemap), isTransparencyEnabled, isColourWriteEnabled, isDepthWriteEnabled,
+                                            isDepthTestEnabled, isFaceCullingEnabled, isStencilTestEnabled, depthTestFunc, sourceBlendMode, destinationBlendMode, stencilFailOp, stencilDepthFailOp,
+                                            stencilPassOp, stencilTestFunc, stencilRef, stencilMask, cullFace, emissiveColour, ambientColour, diffuseColour, specularColour, std::move(renderShaderVariables));
+    }
+    
+    //------------------------------------------------------------------------------
+    template <> UniquePtr<RenderMaterialGroup> RenderCommandCapture::ReplayResources::CreateResource<RenderMaterialGroup>(DataReader& reader, IAllocator* allocator) const noexcept
+    {
+        return CreateMaterialGroup(reader, allocator, nullptr);
+    }
+    
+    //------------------------------------------------------------------------------
+    template <> UniquePtr<RenderTargetGroup> RenderCommandCapture::ReplayResources::CreateResource<RenderTargetGroup>(DataReader& reader, IAllocator* allocator) const noexcept
+    {
+        auto colourTarget = GetResource<const RenderTexture>(reader, ResourceType::k_texture, true);
+        auto depthTarget = GetResource<const RenderTexture>(reader, ResourceType::k_texture, true);
+        auto type = reader.ReadEnum<RenderTargetGroupType>();
+        
+        if (!reader.IsValid() || (!colourTarget && !depthTarget))
+        {
+            reader.Fail();
+            return nullptr;
+        }
+        
+        return CreateUnique<RenderTargetGroup>(allocator, colourTarget, depthTarget, type);
+    }
+    
+    //------------------------------------------------------------------------------
+    template <> UniquePtr<RenderDynamicMesh> RenderCommandCapture::ReplayResources::CreateResource<RenderDynamicMesh>(DataReader& reader, IAllocator* allocator) const noexcept
+    {
+        auto polygonType = reader.ReadEnum<PolygonType>();
+        auto vertexFormat = reader.ReadVertexFormat();
+        auto indexFormat = reader.ReadEnum<IndexFormat>();
+        auto numVertices = reader.ReadValue<u32>();
+        auto numIndices = reader.ReadValue<u32>();
+        auto boundingSphere = reader.ReadSphere();
+        
+        u32 vertexDataSize = 0;
+        auto vertexData = reader.ReadBytes(vertexDataSize);
+        u32 indexDataSize = 0;
+        auto indexData = reader.ReadBytes(indexDataSize);
+        
+        if (!reader.IsValid() || indexFormat != IndexFormat::k_short || u64(numVertices) * vertexFormat.GetSize() != vertexDataSize || u64(numIndices) * GetIndexSize(indexFormat) != indexDataSize)
+        {
+            reader.Fail();
+            return nullptr;
+        }
+        
+        return CreateUnique<RenderDynamicMesh>(allocator, polygonType, vertexFormat, indexFormat, numVertices, numIndices, boundingSphere, CreateUniqueArrayCopy<u8>(allocator, vertexData, vertexDataSize),
+                                               vertexDataSize, CreateUniqueArrayCopy<u8>(allocator, indexData, indexDataSize), indexDataSize);
+    }
+    
+    //------------------------------------------------------------------------------
+    template <> UniquePtr<RenderSkinnedAnimation> RenderCommandCapture::ReplayResources::CreateResource<RenderSkinnedAnimation>(DataReader& reader, IAllocator* allocator) const noexcept
+    {
+        u32 jointDataSize = 0;
+        auto jointData = reader.ReadBytes(jointDataSize);
+        
+        if (!reader.IsValid() || jointDataSize % sizeof(Vector4) != 0)
+        {
+            reader.Fail();
+            return nullptr;
+        }
+        
+        auto numJointVectors = u32(jointDataSize / sizeof(Vector4));
+        return CreateUnique<RenderSkinnedAnimation>(allocator, CreateUniqueArrayCopy<Vector4>(allocator, jointData, numJointVectors), numJointVectors);
+    }
+    
+    //------------------------------------------------------------------------------
+    UniquePtr<RenderMaterialGroup> RenderCommandCapture::ReplayResources::CreateMaterialGroup(DataReader& reader, IAllocator* allocator, std::vector<u32>* materialIndices) const noexcept
+    {
+        auto indices = reader.ReadVector<u32>();
+        
+        std::vector<UniquePtr<RenderMaterial>> renderMaterials;
+        for (auto index : indices)
+        {
+            if (index >= m_types.size() || m_types[index] != ResourceType::k_material)
+            {
+                reader.Fail();
+                return nullptr;
+            }
+            
+            DataReader materialReader(m_resourceData, m_offsets[index]);
+            auto renderMaterial = CreateResource<RenderMaterial>(materialReader, allocator);
+            if (!renderMaterial)
+            {
+                reader.Fail();
+                return nullptr;
+            }
+            
+            renderMaterials.push_back(std::move(renderMaterial));
+        }
+        
+        std::vector<RenderMaterialGroup::Collection> collections;
+        auto numCollections = reader.ReadValue<u32>();
+        for (u32 i = 0; i < numCollections && reader.IsValid(); ++i)
+        {
+            auto vertexFormat = reader.ReadVertexFormat();
+            
+            std::array<const RenderMaterial*, RenderMaterialGroup::k_numMaterialSlots> slotRenderMaterials;
+            for (auto& slotRenderMaterial : slotRenderMaterials)
+            {
+                auto index = reader.ReadValue<u32>();
+                if (index != k_noResource && index >= renderMaterials.size())
+                {
+                    reader.Fail();
+                }
+                
+                slotRenderMaterial = index < renderMaterials.size() ? renderMaterials[index].get() : nullptr;
+            }
+            
+            collections.push_back(RenderMaterialGroup::Collection(vertexFormat, slotRenderMaterials));
+        }
+        
+        if (!reader.IsValid())
+        {
+            return nullptr;
+        }
+        
+        if (materialIndices)
+        {
+            *materialIndices = std::move(indices);
+        }
+        
+        return CreateUnique<RenderMaterialGroup>(allocator, std::move(renderMaterials), std::move(collections));
+    }
+    
+    //------------------------------------------------------------------------------
+    template <typename TType> UniquePtr<TType> RenderCommandCapture::ReplayResources::CreateResourceCopy(DataReader& reader, ResourceType type, IAllocator* allocator) const noexcept
+    {
+        auto index = reader.ReadValue<u32>();
+        if (index >= m_types.size() || m_types[index] != type)
+        {
+            reader.Fail();
+            return nullptr;
+        }
+        
+        DataReader resourceReader(m_resourceData, m_offsets[index]);
+        auto resource = CreateResource<TType>(resourceReader, allocator);
+        if (!resource)
+        {
+            reader.Fail();
+        }
+        
+        return resource;
+    }
+    
+    //------------------------------------------------------------------------------
+    RenderCommandCapture::ReplayResources::ReplayResources(const std::vector<u8>& resourceData) noexcept
+        : m_resourceData(resourceData)
+    {
+        DataReader reader(m_resourceData);
+        while (reader.IsValid() && !reader.IsAtEnd())
+        {
+            auto type = reader.ReadEnum<ResourceType>();
+            m_types.push_back(type);
+            m_offsets.push_back(reader.GetOffset());
+            m_resources.push_back(nullptr);
+            
+            //Each description is read even if nothing is kept, as this validates it and moves on to the next.
+            switch (type)
+            {
+                case ResourceType::k_texture:
+                    m_renderTextures.push_back(CreateResource<RenderTexture>(reader, nullptr));
+                    m_resources.back() = m_renderTextures.back().get();
+                    break;
+                case ResourceType::k_shader:
+                    m_renderShaders.push_back(CreateResource<RenderShader>(reader, nullptr));
+                    m_resources.back() = m_renderShaders.back().get();
+                    break;
+                case ResourceType::k_mesh:
+                    m_renderMeshes.push_back(CreateResource<RenderMesh>(reader, nullptr));
+                    m_resources.back() = m_renderMeshes.back().get();
+                    break;
+                case ResourceType::k_material:
+                    CreateResource<RenderMaterial>(reader, nullptr);
+                    break;
+                case ResourceType::k_materialGroup:
+                {
+                    std::vector<u32> materialIndices;
+                    auto renderMaterialGroup = CreateMaterialGroup(reader, nullptr, &materialIndices);
+                    if (renderMaterialGroup)
+                    {
+                        const auto& renderMaterials = renderMaterialGroup->GetRenderMaterials();
+                        for (std::size_t i = 0; i < renderMaterials.size(); ++i)
+                        {
+                            if (!m_resources[materialIndices[i]])
+                            {
+                                m_resources[materialIndices[i]] = renderMaterials[i];
+                            }
+                        }
+                        
+                        m_resources.back() = renderMaterialGroup.get();
+                        m_renderMaterialGroups.push_back(std::move(renderMaterialGroup));
+                    }
+                    break;
+                }
+                case ResourceType::k_targetGroup:
+                    m_renderTargetGroups.push_back(CreateResource<RenderTargetGroup>(reader, nullptr));
+                    m_resources.back() = m_renderTargetGroups.back().get();
+                    break;
+                case ResourceType::k_dynamicMesh:
+                    CreateResource<RenderDynamicMesh>(reader, nullptr);
+                    break;
+                case ResourceType::k_skinnedAnimation:
+                    CreateResource<RenderSkinnedAnimation>(reader, nullptr);
+                    break;
+                default:
+                    reader.Fail();
+                    break;
+            }
+        }
+        
+        for (std::size_t i = 0; i < m_types.size() && reader.IsValid(); ++i)
+        {
+            if (m_types[i] == ResourceType::k_material && !m_resources[i])
+            {
+                DataReader materialReader(m_resourceData, m_offsets[i]);
+                
+                std::vector<UniquePtr<RenderMaterial>> renderMaterials;
+                renderMaterials.push_back(CreateResource<RenderMaterial>(materialReader, nullptr));
+                m_resources[i] = renderMaterials.back().get();
+                
+                m_renderMaterialGroups.push_back(CreateUnique<RenderMaterialGroup>(nullptr, std::move(renderMaterials), std::vector<RenderMaterialGroup::Collection>()));
+            }
+        }
+        
+        m_isValid = reader.IsValid();
+    }
+    
+    //------------------------------------------------------------------------------
+    void RenderCommandCapture::ReplayResources::AddCommand(RenderCommand::Type type, DataReader& reader, IAllocator* frameAllocator, std::vector<const void*>& frameResources, RenderFrameData& renderFrameData,
+                                                           RenderCommandList& renderCommandList) const noexcept
+    {
+        switch (type)
+        {
+            case RenderCommand::Type::k_loadTexture:
+            {
+                auto renderTexture = GetResource<RenderTexture>(reader, ResourceType::k_texture);
+                u32 textureDataSize = 0;
+                auto textureData = reader.ReadBytes(textureDataSize);
+                if (reader.IsValid())
+                {
+                    renderCommandList.AddLoadTextureCommand(renderTexture, CopyBytes(textureData, textureDataSize), textureDataSize);
+                }
+                break;
+            }
+            case RenderCommand::Type::k_loadCubemap:
+            {
+                auto renderTexture = GetResource<RenderTexture>(reader, ResourceType::k_texture);
+                std::array<std::unique_ptr<const u8[]>, k_numCubemapFaces> textureData;
+                u32 textureDataSize = 0;
+                for (auto& faceTextureData : textureData)
+                {
+                    auto faceData = reader.ReadBytes(textureDataSize);
+                    faceTextureData = CopyBytes(faceData, textureDataSize);
+                }
+                if (reader.IsValid())
+                {
+                    renderCommandList.AddLoadCubemapCommand(renderTexture, std::move(textureData), textureDataSize);
+                }
+                break;
+            }
+            case RenderCommand::Type::k_loadShader:
+            {
+                auto renderShader = GetResource<RenderShader>(reader, ResourceType::k_shader);
+                auto vertexShader = reader.ReadString();
+                auto fragmentShader = reader.ReadString();
+                if (reader.IsValid())
+                {
+                    renderCommandList.AddLoadShaderCommand(renderShader, vertexShader, fragmentShader);
+                }
+                break;
+            }
+            case RenderCommand::Type::k_loadMaterialGroup:
+            {
+                auto renderMaterialGroup = GetResource<RenderMaterialGroup>(reader, ResourceType::k_materialGroup);
+                if (reader.IsValid())
+                {
+                    renderCommandList.AddLoadMaterialGroupCommand(renderMaterialGroup);
+                }
+                break;
+            }
+            case RenderCommand::Type::k_loadMesh:
+            {
+                auto renderMesh = GetResource<RenderMesh>(reader, ResourceType::k_mesh);
+                u32 vertexDataSize = 0;
+                auto vertexData = reader.ReadBytes(vertexDataSize);
+                u32 indexDataSize = 0;
+                auto indexData = reader.ReadBytes(indexDataSize);
+                if (reader.IsValid())
+                {
+                    renderCommandList.AddLoadMeshCommand(renderMesh, CopyBytes(vertexData, vertexDataSize), vertexDataSize, CopyBytes(indexData, indexDataSize), indexDataSize);
+                }
+                break;
+            }
+            case RenderCommand::Type::k_restoreTexture:
+            {
+                auto renderTexture = GetResource<const RenderTexture>(reader, ResourceType::k_texture);
+                if (reader.IsValid())
+                {
+                    renderCommandList.AddRestoreTextureCommand(renderTexture);
+                }
+                break;
+            }
+            case RenderCommand::Type::k_restoreCubemap:
+            {
+                auto renderTexture = GetResource<const RenderTexture>(reader, ResourceType::k_texture);
+                if (reader.IsValid())
+                {
+                    renderCommandList.AddRestoreCubemapCommand(renderTexture);
+                }
+                break;
+            }
+            case RenderCommand::Type::k_restoreMesh:
+            {
+                auto renderMesh = GetResource<const RenderMesh>(reader, ResourceType::k_mesh);
+                if (reader.IsValid())
+                {
+                    renderCommandList.AddRestoreMeshCommand(renderMesh);
+                }
+                break;
+            }
+            case RenderCommand::Type::k_restoreRenderTargetGroup:
+            {
+                auto renderTargetGroup = GetResource<const RenderTargetGroup>(reader, ResourceType::k_targetGroup);
+                if (reader.IsValid())
+                {
+                    renderCommandList.AddRestoreRenderTargetGroupCommand(renderTargetGroup);
+                }
+                break;
+            }
+            case RenderCommand::Type::k_loadTargetGroup:
+            {
+                auto renderTargetGroup = GetResource<RenderTargetGroup>(reader, ResourceType::k_targetGroup);
+                if (reader.IsValid())
+                {
+                    renderCommandList.AddLoadTargetGroupCommand(renderTargetGroup);
+                }
+                break;
+            }
+            case RenderCommand::Type::k_begin:
+            {
+                auto resolution = reader.ReadValue<Integer2>();
+                auto clearColour = reader.ReadValue<Colour>();
+                if (reader.IsValid())
+                {
+                    renderCommandList.AddBeginCommand(resolution, clearColour);
+                }
+                break;
+            }
+            case RenderCommand::Type::k_beginWithTargetGroup:
+            {
+                auto renderTargetGroup = GetResource<const RenderTargetGroup>(reader, ResourceType::k_targetGroup);
+                auto clearColour = reader.ReadValue<Colour>();
+                if (reader.IsValid())
+                {
+                    renderCommandList.AddBeginWithTargetGroupCommand(renderTargetGroup, clearColour);
+                }
+                break;
+            }
+            case RenderCommand::Type::k_applyCamera:
+            {
+                auto position = reader.ReadValue<Vector3>();
+                auto viewMatrix = reader.ReadValue<Matrix4>();
+                auto viewProjectionMatrix = reader.ReadValue<Matrix4>();
+                if (reader.IsValid())
+                {
+                    renderCommandList.AddApplyCameraCommand(position, viewMatrix, viewProjectionMatrix);
+                }
+                break;
+            }
+            case RenderCommand::Type::k_applyAmbientLight:
+            {
+                auto colour = reader.ReadValue<Colour>();
+                if (reader.IsValid())
+                {
+                    renderCommandList.AddApplyAmbientLightCommand(colour);
+                }
+                break;
+            }
+            case RenderCommand::Type::k_applyDirectionalLight:
+            {
+                auto colour = reader.ReadValue<Colour>();
+                auto direction = reader.ReadValue<Vector3>();
+                auto lightViewProjection = reader.ReadValue<Matrix4>();
+                auto shadowTolerance = reader.ReadValue<f32>();
+                auto shadowMapRenderTexture = GetResource<const RenderTexture>(reader, ResourceType::k_texture, true);
+                if (reader.IsValid())
+                {
+                    renderCommandList.AddApplyDirectionalLightCommand(colour, direction, lightViewProjection, shadowTolerance, shadowMapRenderTexture);
+                }
+                break;
+            }
+            case RenderCommand::Type::k_applyPointLight:
+            {
+                auto colour = reader.ReadValue<Colour>();
+                auto position = reader.ReadValue<Vector3>();
+                auto attenuation = reader.ReadValue<Vector3>();
+                if (reader.IsValid())
+                {
+                    renderCommandList.AddApplyPointLightCommand(colour, position, attenuation);
+                }
+                break;
+            }
+            case RenderCommand::Type::k_applyPointLights:
+            {
+                auto colours = reader.ReadVector<Colour>();
+                auto positions = reader.ReadVector<Vector3>();
+                auto attenuations = reader.ReadVector<Vector3>();
+                if (colours.size() != positions.size() || colours.size() != attenuations.size())
+                {
+                    reader.Fail();
+                }
+                if (reader.IsValid())
+                {
+                    renderCommandList.AddApplyPointLightsCommand(std::move(colours), std::move(positions), std::move(attenuations));
+                }
+                break;
+            }
+            case RenderCommand::Type::k_applyMaterial:
+            {
+                auto renderMaterial = GetResource<const RenderMaterial>(reader, ResourceType::k_material);
+                if (reader.IsValid())
+                {
+                    renderCommandList.AddApplyMaterialCommand(renderMaterial);
+                }
+                break;
+            }
+            case RenderCommand::Type::k_applyMesh:
+            {
+                auto renderMesh = GetResource<const RenderMesh>(reader, ResourceType::k_mesh);
+                if (reader.IsValid())
+                {
+                    renderCommandList.AddApplyMeshCommand(renderMesh);
+                }
+                break;
+            }
+            case RenderCommand::Type::k_applyDynamicMesh:
+            {
+                auto index = reader.ReadValue<u32>();
+                if (index >= m_types.size() || m_types[index] != ResourceType::k_dynamicMesh)
+                {
+                    reader.Fail();
+                    break;
+                }
+                
+                if (!frameResources[index])
+                {
+                    DataReader resourceReader(m_resourceData, m_offsets[index]);
+                    auto renderDynamicMesh = CreateResource<RenderDynamicMesh>(resourceReader, frameAllocator);
+                    if (!renderDynamicMesh)
+                    {
+                        reader.Fail();
+                        break;
+                    }
+                    
+                    frameResources[index] = renderDynamicMesh.get();
+                    renderFrameData.AddRenderDynamicMesh(std::move(renderDynamicMesh));
+                }
+                
+                renderCommandList.AddApplyDynamicMeshCommand(static_cast<const RenderDynamicMesh*>(frameResources[index]));
+                break;
+            }
+            case RenderCommand::Type::k_applyMeshBatch:
+            {
+                auto polygonType = reader.ReadEnum<PolygonType>();
+                auto vertexFormat = reader.ReadVertexFormat();
+                auto indexFormat = reader.ReadEnum<IndexFormat>();
+                auto numVertices = reader.ReadValue<u32>();
+                auto numIndices = reader.ReadValue<u32>();
+                u32 vertexDataSize = 0;
+                auto vertexData = reader.ReadBytes(vertexDataSize);
+                u32 indexDataSize = 0;
+                auto indexData = reader.ReadBytes(indexDataSize);
+                
+                //mesh batches are only built from sprites.
+                if (!reader.IsValid() || !(vertexFormat == VertexFormat::k_sprite) || indexFormat != IndexFormat::k_short || u64(numVertices) * vertexFormat.GetSize() != vertexDataSize ||
+                    u64(numIndices) * GetIndexSize(indexFormat) != indexDataSize)
+                {
+                    reader.Fail();
+                    break;
+                }
+                
+                std::vector<RenderMeshBatch::Mesh> meshes;
+                meshes.push_back(RenderMeshBatch::Mesh(Matrix4::k_identity, numVertices, numIndices, vertexData, vertexDataSize, indexData, indexDataSize));
+                renderCommandList.AddApplyMeshBatchCommand(RenderMeshBatchUPtr(new RenderMeshBatch(polygonType, vertexFormat, indexFormat, std::move(meshes))));
+                break;
+            }
+            case RenderCommand::Type::k_applySkinnedAnimation:
+            {
+                auto index = reader.ReadValue<u32>();
+                if (index >= m_types.size() || m_types[index] != ResourceType::k_skinnedAnimation)
+                {
+                    reader.Fail();
+                    break;
+                }
+                
+                if (!frameResources[index])
+                {
+                    DataReader resourceReader(m_resourceData, m_offsets[index]);
+                    auto renderSkinnedAnimation = CreateResource<RenderSkinnedAnimation>(resourceReader, frameAllocator);
+                    if (!renderSkinnedAnimation)
+                    {
+                        reader.Fail();
+                        break;
+                    }
+                    
+                    frameResources[index] = renderSkinnedAnimation.get();
+                    renderFrameData.AddRenderSkinnedAnimation(std::move(renderSkinnedAnimation));
+                }
+                
+                renderCommandList.AddApplySkinnedAnimationCommand(static_cast<const RenderSkinnedAnimation*>(frameResources[index]));
+                break;
+            }
+            case RenderCommand::Type::k_renderInstance:
+            {
+                auto worldMatrix = reader.ReadValue<Matrix4>();
+                if (reader.IsValid())
+                {
+                    renderCommandList.AddRenderInstanceCommand(worldMatrix);
+                }
+                break;
+            }
+            case RenderCommand::Type::k_renderInstances:
+            {
+                auto worldMatrices = reader.ReadVector<Matrix4>();
+                if (reader.IsValid())
+                {
+                    renderCommandList.AddRenderInstancesCommand(std::move(worldMatrices));
+                }
+                break;
+            }
+            case RenderCommand::Type::k_end:
+                renderCommandList.AddEndCommand();
+                break;
+            case RenderCommand::Type::k_unloadTargetGroup:
+            {
+                auto renderTargetGroup = CreateResourceCopy<RenderTargetGroup>(reader, ResourceType::k_targetGroup, frameAllocator);
+                if (reader.IsValid())
+                {
+                    renderCommandList.AddUnloadTargetGroupCommand(std::move(renderTargetGroup));
+                }
+                break;
+            }
+            case RenderCommand::Type::k_unloadMesh:
+            {
+                auto renderMesh = CreateResourceCopy<RenderMesh>(reader, ResourceType::k_mesh, frameAllocator);
+                if (reader.IsValid())
+                {
+                    renderCommandList.AddUnloadMeshCommand(std::move(renderMesh));
+                }
+                break;
+            }
+            case RenderCommand::Type::k_unloadMaterialGroup:
+            {
+                auto renderMaterialGroup = CreateResourceCopy<RenderMaterialGroup>(reader, ResourceType::k_materialGroup, frameAllocator);
+                if (reader.IsValid())
+                {
+                    renderCommandList.AddUnloadMaterialGroupCommand(std::move(renderMaterialGroup));
+                }
+                break;
+            }
+            case RenderCommand::Type::k_unloadShader:
+            {
+                auto renderShader = CreateResourceCopy<RenderShader>(reader, ResourceType::k_shader, frameAllocator);
+                if (reader.IsValid())
+                {
+                    renderCommandList.AddUnloadShaderCommand(std::move(renderShader));
+                }
+                break;
+            }
+            case RenderCommand::Type::k_unloadTexture:
+            {
+                auto renderTexture = CreateResourceCopy<RenderTexture>(reader, ResourceType::k_texture, frameAllocator);
+                if (reader.IsValid())
+                {
+                    renderCommandList.AddUnloadTextureCommand(std::move(renderTexture));
+                }
+                break;
+            }
+            case RenderCommand::Type::k_unloadCubemap:
+            {
+                auto renderTexture = CreateResourceCopy<RenderTexture>(reader, ResourceType::k_texture, frameAllocator);
+                if (reader.IsValid())
+                {
+                    renderCommandList.AddUnloadCubemapCommand(std::move(renderTexture));
+                }
+                break;
+            }
+        }
+    }
+    
+    //------------------------------------------------------------------------------
+    void RenderCommandCapture::Stats::Add(const Stats& other) noexcept
+    {
+        m_numCommandLists += other.m_numCommandLists;
+        m_numCommands += other.m_numCommands;
+        m_numDrawCalls += other.m_numDrawCalls;
+        m_numInstances += other.m_numInstances;
+        m_numVertices += other.m_numVertices;
+        m_numIndices += other.m_numIndices;
+        
+        for (u32 i = 0; i < RenderCommand::k_numTypes; ++i)
+        {
+            m_numCommandsByType[i] += other.m_numCommandsByType[i];
+        }
+    }
+    
+    //------------------------------------------------------------------------------
+    RenderCommandCapture::RenderCommandCapture(const RenderCommandBuffer* renderCommandBuffer, bool shouldRecordPayload) noexcept
+    {
+        CS_ASSERT(renderCommandBuffer, "Cannot capture a null render command buffer.");
+        
+        const auto& queue = renderCommandBuffer->GetQueue();
+        
+        std::size_t numCommands = 0;
+        for (const auto& renderCommandList : queue)
+        {
+            numCommands += renderCommandList->GetOrderedList().size();
+        }
+        
+        m_commandListSizes.reserve(queue.size());
+        m_commands.reserve(numCommands);
+        
+        ResourceRecorder resourceRecorder(m_resourceData);
+        
+        u32 currentNumVertices = 0;
+        u32 currentNumIndices = 0;
+        for (const auto& renderCommandList : queue)
+        {
+            const auto& renderCommands = renderCommandList->GetOrderedList();
+            m_commandListSizes.push_back(u32(renderCommands.size()));
+            
+            for (const auto& renderCommand : renderCommands)
+            {
+                Command command { renderCommand->GetType(), 0, 0, 0 };
+                
+                switch (renderCommand->GetType())
+                {
+                    case RenderCommand::Type::k_applyMesh:
+                    {
+                        auto renderMesh = static_cast<const ApplyMeshRenderCommand*>(renderCommand)->GetRenderMesh();
+                        currentNumVertices = renderMesh->GetNumVertices();
+                        currentNumIndices = renderMesh->GetNumIndices();
+                        command.m_numVertices = currentNumVertices;
+                        command.m_numIndices = currentNumIndices;
+                        break;
+                    }
+                    case RenderCommand::Type::k_applyDynamicMesh:
+                    {
+                        auto renderDynamicMesh = static_cast<const ApplyDynamicMeshRenderCommand*>(renderCommand)->GetRenderDynamicMesh();
+                        currentNumVertices = renderDynamicMesh->GetNumVertices();
+                        currentNumIndices = renderDynamicMesh->GetNumIndices();
+                        command.m_numVertices = currentNumVertices;
+                        command.m_numIndices = currentNumIndices;
+                        break;
+                    }
+                    case RenderCommand::Type::k_applyMeshBatch:
+                    {
+                        auto renderMeshBatch = static_cast<const ApplyMeshBatchRenderCommand*>(renderCommand)->GetRenderMeshBatch();
+                        currentNumVertices = renderMeshBatch->GetNumVertices();
+                        currentNumIndices = renderMeshBatch->GetNumIndices();
+                        command.m_numVertices = currentNumVertices;
+                        command.m_numIndices = currentNumIndices;
+                        break;
+                    }
+                    case RenderCommand::Type::k_renderInstance:
+                    {
+                        command.m_numInstances = 1;
+                        command.m_numVertices = currentNumVertices;
+                        command.m_numIndices = currentNumIndices;
+                        break;
+                    }
+                    case RenderCommand::Type::k_renderInstances:
+                    {
+                        auto numInstances = static_cast<const RenderInstancesRenderCommand*>(renderCommand)->GetNumInstances();
+                        command.m_numInstances = numInstances;
+                        command.m_numVertices = currentNumVertices * numInstances;
+                        command.m_numIndices = currentNumIndices * numInstances;
+                        break;
+                    }
+                    default:
+                        break;
+                }
+                
+                m_commands.push_back(command);
+                
+                if (shouldRecordPayload)
+                {
+                    WritePayload(renderCommand, resourceRecorder, m_payloadData);
+                }
+            }
+        }
+        
+        CalcStats();
+    }
+    
+    //------------------------------------------------------------------------------
+    RenderCommandCapture::RenderCommandCapture(std::vector<u32> commandListSizes, std::vector<Command> commands, std::vector<u8> resourceData, std::vector<u8> payloadData) noexcept
+        : m_commandListSizes(std::move(commandListSizes)), m_commands(std::move(commands)), m_resourceData(std::move(resourceData)), m_payloadData(std::move(payloadData))
+    {
+        CalcStats();
+    }
+    
+    //------------------------------------------------------------------------------
+    RenderCommandCaptureUPtr RenderCommandCapture::Load(StorageLocation storageLocation, const std::string& filePath) noexcept
+    {
+        auto stream = Application::Get()->GetFileSystem()->CreateBinaryInputStream(storageLocation, filePath);
+        if (!stream)
+        {
+            CS_LOG_ERROR("Failed to open render command capture: " + filePath);
+            return nullptr;
+        }
+        
+        u32 identifier = 0;
+        u32 version = 0;
+        u32 numCommandLists = 0;
+        if (!ReadU32(stream.get(), identifier) || !ReadU32(stream.get(), version) || identifier != k_fileIdentifier || version != k_fileVersion || !ReadU32(stream.get(), numCommandLists))
+        {
+            CS_LOG_ERROR("Invalid render command capture: " + filePath);
+            return nullptr;
+        }
+        
+        //the counts are checked against the file length before anything is allocated.
+        const u64 fileLength = stream->GetLength();
+        if (fileLength < k_headerSize || u64(numCommandLists) > (fileLength - k_headerSize) / k_commandListSize)
+        {
+            CS_LOG_ERROR("Render command capture is truncated: " + filePath);
+            return nullptr;
+        }
+        
+        std::vector<u32> commandListSizes(numCommandLists);
+        u64 numCommands = 0;
+        for (auto& commandListSize : commandListSizes)
+        {
+            if (!ReadU32(stream.get(), commandListSize))
+            {
+                CS_LOG_ERROR("Render command capture is truncated: " + filePath);
+                return nullptr;
+            }
+            
+            numCommands += commandListSize;
+        }
+        
+        if (numCommands > (fileLength - stream->GetReadPosition()) / k_commandSize)
+        {
+            CS_LOG_ERROR("Render command capture is truncated: " + filePath);
+            return nullptr;
+        }
+        
+        std::vector<Command> commands(static_cast<std::size_t>(numCommands));
+        for (auto& command : commands)
+        {
+            u32 type = 0;
+            if (!ReadU32(stream.get(), type) || !ReadU32(stream.get(), command.m_numInstances) || !ReadU32(stream.get(), command.m_numVertices) || !ReadU32(stream.get(), command.m_numIndices))
+            {
+                CS_LOG_ERROR("Render command capture is truncated: " + filePath);
+                return nullptr;
+            }
+            
+            if (type >= RenderCommand::k_numTypes)
+            {
+                CS_LOG_ERROR("Render command capture contains an unknown command type: " + filePath);
+                return nullptr;
+            }
+            
+            command.m_type = RenderCommand::Type(type);
+        }
+        
+        std::vector<u8> resourceData;
+        std::vector<u8> payloadData;
+        if (!ReadData(stream.get(), resourceData) || !ReadData(stream.get(), payloadData) || stream->GetReadPosition() != fileLength)
+        {
+            CS_LOG_ERROR("Render command capture is truncated: " + filePath);
+            return nullptr;
+        }
+        
+        return RenderCommandCaptureUPtr(new RenderCommandCapture(std::move(commandListSizes), std::move(commands), std::move(resourceData), std::move(payloadData)));
+    }
+    
+    //------------------------------------------------------------------------------
+    bool RenderCommandCapture::Save(StorageLocation storageLocation, const std::string& filePath) const noexcept
+    {
+        auto stream = Application::Get()->GetFileSystem()->CreateBinaryOutputStream(storageLocation, filePath);
+        if (!stream)
+        {
+            CS_LOG_ERROR("Failed to create render command capture: " + filePath);
+            return false;
+        }
+        
+        stream->Write(k_fileIdentifier);
+        stream->Write(k_fileVersion);
+        stream->Write(u32(m_commandListSizes.size()));
+        
+        for (auto commandListSize : m_commandListSizes)
+        {
+            stream->Write(commandListSize);
+        }
+        
+        for (const auto& command : m_commands)
+        {
+            stream->Write(u32(command.m_type));
+            stream->Write(command.m_numInstances);
+            stream->Write(command.m_numVertices);
+            stream->Write(command.m_numIndices);
+        }
+        
+        stream->Write(u32(m_resourceData.size()));
+        if (!m_resourceData.empty())
+        {
+            stream->Write(m_resourceData.data(), m_resourceData.size());
+        }
+        
+        stream->Write(u32(m_payloadData.size()));
+        if (!m_payloadData.empty())
+        {
+            stream->Write(m_payloadData.data(), m_payloadData.size());
+        }
+        
+        return true;
+    }
+    
+    //------------------------------------------------------------------------------
+    RenderCommandBufferUPtr RenderCommandCapture::CreateRenderCommandBuffer(IAllocator* frameAllocator) const noexcept
+    {
+        CS_ASSERT(frameAllocator, "Cannot rebuild a render command buffer without a frame allocator.");
+        
+        std::call_once(m_replayResourcesFlag, [this]()
+        {
+            m_replayResources.reset(new ReplayResources(m_resourceData));
+        });
+        
+        if (!m_replayResources->m_isValid)
+        {
+            CS_LOG_ERROR("Cannot rebuild a render command buffer from a capture with an invalid resource table.");
+            return nullptr;
+        }
+        
+        std::vector<RenderCommandList> renderCommandLists(m_commandListSizes.size());
+        std::vector<const void*> frameResources(m_replayResources->m_types.size(), nullptr);
+        RenderFrameData renderFrameData;
+        
+        DataReader reader(m_payloadData);
+        auto command = m_commands.begin();
+        for (std::size_t i = 0; i < m_commandListSizes.size() && reader.IsValid(); ++i)
+        {
+            for (u32 j = 0; j < m_commandListSizes[i] && reader.IsValid(); ++j, ++command)
+            {
+                m_replayResources->AddCommand(command->m_type, reader, frameAllocator, frameResources, renderFrameData, renderCommandLists[i]);
+            }
+        }
+        
+        if (!reader.IsValid() || !reader.IsAtEnd())
+        {
+            CS_LOG_ERROR("Cannot rebuild a render command buffer from a capture with invalid command data.");
+            return nullptr;
+        }
+        
+        std::vector<RenderFrameData> renderFramesData;
+        renderFramesData.push_back(std::move(renderFrameData));
+        
+        RenderCommandBufferUPtr renderCommandBuffer(new RenderCommandBuffer(u32(renderCommandLists.size()), frameAllocator, std::move(renderFramesData)));
+        for (std::size_t i = 0; i < renderCommandLists.size(); ++i)
+        {
+            *renderCommandBuffer->GetRenderCommandList(u32(i)) = std::move(renderCommandLists[i]);
+        }
+        
+        return renderCommandBuffer;
+    }
+    
+    //------------------------------------------------------------------------------
+    RenderCommandCapture::~RenderCommandCapture() noexcept
+    {
+    }
+    
+    //------------------------------------------------------------------------------
+    void RenderCommandCapture::CalcStats() noexcept
+    {
+        m_stats = Stats();
+        m_stats.m_numCommandLists = u32(m_commandListSizes.size());
+        m_stats.m_numCommands = u32(m_commands.size());
+        
+        for (const auto& command : m_commands)
+        {
+            m_stats.m_numCommandsByType[u32(command.m_type)]++;
+            
+            if (command.m_type == RenderCommand::Type::k_renderInstance || command.m_type == RenderCommand::Type::k_renderInstances)
+            {
+                m_stats.m_numDrawCalls++;
+                m_stats.m_numInstances += command.m_numInstances;
+                m_stats.m_numVertices += command.m_numVertices;
+                m_stats.m_numIndices += command.m_numIndices;
+            }
+        }
+    }
+}
@@ -0,0 +1,187 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017 Tag Games Limited
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#ifndef _CHILLISOURCE_RENDERING_RENDERCOMMAND_RENDERCOMMANDCAPTURE_H_
+#define _CHILLISOURCE_RENDERING_RENDERCOMMAND_RENDERCOMMANDCAPTURE_H_
+
+#include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/File/StorageLocation.h>
+#include <ChilliSource/Rendering/RenderCommand/RenderCommand.h>
+
+#include <array>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ChilliSource
+{
+    /// A recording of the command stream described by a single RenderCommandBuffer. Along
+    /// with the type of each command and the data relevant to profiling, such as the number
+    /// of instances and vertices submitted by each draw, the capture stores the payload of
+    /// every command: transforms, lights, vertex and index buffers, texture data and a
+    /// description of each resource the commands reference. No pointers to the original
+    /// resources are kept, so a capture can outlive the frame it was recorded from, and can
+    /// be saved to disk and reloaded later for comparison or analysis.
+    ///
+    /// A capture can be replayed by rebuilding the frame as a new RenderCommandBuffer, which
+    /// can then be passed to any render command processor. The first time a frame is rebuilt
+    /// the capture creates its own copy of each referenced resource, which is then shared by
+    /// every rebuilt buffer. Resources which are owned by a command, such as those passed to
+    /// unload commands, and per-frame data such as dynamic meshes are recreated for each
+    /// buffer.
+    ///
+    /// This is immutable and therefore thread-safe, aside from the extra data of the
+    /// resources created for replay, which should only be accessed on the render thread.
+    ///
+    class RenderCommandCapture final
+    {
+    public:
+        CS_DECLARE_NOCOPY(RenderCommandCapture);
+        
+        /// A single captured command. For apply mesh commands the vertex and index counts
+        /// describe the mesh, and for render instance commands they are the total number of
+        /// vertices and indices submitted across all instances. They are zero otherwise.
+        ///
+        struct Command final
+        {
+            RenderCommand::Type m_type;
+            u32 m_numInstances;
+            u32 m_numVertices;
+            u32 m_numIndices;
+        };
+        
+        /// Statistics calculated from one or more captured frames.
+        ///
+        struct Stats final
+        {
+            /// Adds the given statistics to these.
+            ///
+            /// @param other
+            ///     The statistics to add.
+            ///
+            void Add(const Stats& other) noexcept;
+            
+            u32 m_numCommandLists = 0;
+            u32 m_numCommands = 0;
+            u32 m_numDrawCalls = 0;
+            u32 m_numInstances = 0;
+            u64 m_numVertices = 0;
+            u64 m_numIndices = 0;
+            std::array<u32, RenderCommand::k_numTypes> m_numCommandsByType = {{}};
+        };
+        
+        /// Records the command stream described by the given render command buffer.
+        ///
+        /// @param renderCommandBuffer
+        ///     The buffer which should be recorded.
+        /// @param shouldRecordPayload
+        ///     (Optional) Whether or not the payload of each command should be recorded. If not,
+        ///     only the stats are available and the capture cannot be replayed, but it is much
+        ///     cheaper to create.
+        ///
+        RenderCommandCapture(const RenderCommandBuffer* renderCommandBuffer, bool shouldRecordPayload = true) noexcept;
+        
+        /// Creates a capture from previously recorded data.
+        ///
+        /// @param commandListSizes
+        ///     The number of commands in each command list. Should be moved.
+        /// @param commands
+        ///     The commands in each list, in the order they will be processed. Should be moved.
+        /// @param resourceData
+        ///     The description of each resource referenced by the commands. Should be moved.
+        /// @param payloadData
+        ///     The payload of each command, in the order they will be processed. Should be moved.
+        ///
+        RenderCommandCapture(std::vector<u32> commandListSizes, std::vector<Command> commands, std::vector<u8> resourceData, std::vector<u8> payloadData) noexcept;
+        
+        /// Loads a capture which was previously saved with Save(). The counts in the file are
+        /// validated against its length, so a truncated or corrupt file fails to load rather
+        /// than causing large allocations.
+        ///
+        /// @param storageLocation
+        ///     The storage location of the file.
+        /// @param filePath
+        ///     The file path.
+        ///
+        /// @return The loaded capture, or null if it could not be loaded.
+        ///
+        static RenderCommandCaptureUPtr Load(StorageLocation storageLocation, const std::string& filePath) noexcept;
+        
+        /// @return The number of commands in each command list.
+        ///
+        const std::vector<u32>& GetCommandListSizes() const noexcept { return m_commandListSizes; }
+        
+        /// @return The commands in each list, in the order they will be processed.
+        ///
+        const std::vector<Command>& GetCommands() const noexcept { return m_commands; }
+        
+        /// @return The statistics for the captured frame.
+        ///
+        const Stats& GetStats() const noexcept { return m_stats; }
+        
+        /// Saves the capture to the given file in a compact binary format.
+        ///
+        /// @param storageLocation
+        ///     The storage location of the file.
+        /// @param filePath
+        ///     The file path.
+        ///
+        /// @return Whether or not the capture was successfully saved.
+        ///
+        bool Save(StorageLocation storageLocation, const std::string& filePath) const noexcept;
+        
+        /// Rebuilds the captured frame as a new render command buffer, which can be passed to a
+        /// render command processor in the same way as a buffer compiled by the Renderer. The
+        /// buffer references resources owned by this capture, so must not outlive it.
+        ///
+        /// @param frameAllocator
+        ///     The allocator from which the per-frame data of the buffer, such as dynamic meshes,
+        ///     should be allocated. This must outlive the buffer.
+        ///
+        /// @return The rebuilt buffer, or null if the captured data is invalid.
+        ///
+        RenderCommandBufferUPtr CreateRenderCommandBuffer(IAllocator* frameAllocator) const noexcept;
+        
+        ~RenderCommandCapture() noexcept;
+        
+    private:
+        struct ReplayResources;
+        
+        /// Calculates the stats for the captured commands.
+        ///
+        void CalcStats() noexcept;
+        
+        std::vector<u32> m_commandListSizes;
+        std::vector<Command> m_commands;
+        std::vector<u8> m_resourceData;
+        std::vector<u8> m_payloadData;
+        Stats m_stats;
+        
+        mutable std::once_flag m_replayResourcesFlag;
+        mutable std::unique_ptr<const ReplayResources> m_replayResources;
+    };
+}
+
+#endif
@@ -32,6 +32,7 @@
 #include <ChilliSource/Rendering/RenderCommand/Commands/ApplyMeshRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/ApplyMeshBatchRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/ApplyPointLightRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/ApplyPointLightsRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/ApplySkinnedAnimationRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/BeginRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/BeginWithTargetGroupRenderCommand.h>
@@ -43,6 +44,7 @@
 #include <ChilliSource/Rendering/RenderCommand/Commands/LoadTextureRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/LoadCubemapRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/RenderInstanceRenderCommand.h>
+#include <ChilliSource/Rendering/RenderCommand/Commands/RenderInstancesRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/RestoreMeshRenderCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/RestoreRenderTargetGroupCommand.h>
 #include <ChilliSource/Rendering/RenderCommand/Commands/RestoreTextureRenderCommand.h>
@@ -199,6 +201,15 @@ namespace ChilliSource
         m_renderCommands.push_back(std::move(renderCommand));
     }
     
+    //------------------------------------------------------------------------------
+    void RenderCommandList::AddApplyPointLightsCommand(std::vector<Colour> colours, std::vector<Vector3> positions, std::vector<Vector3> attenuations) noexcept
+    {
+        RenderCommandUPtr renderCommand(new ApplyPointLightsRenderCommand(std::move(colours), std::move(positions), std::move(attenuations)));
+        
+        m_orderedCommands.push_back(renderCommand.get());
+        m_renderCommands.push_back(std::move(renderCommand));
+    }
+    
     //------------------------------------------------------------------------------
     void RenderCommandList::AddApplyMaterialCommand(const RenderMaterial* renderMaterial) noexcept
     {
@@ -253,6 +264,15 @@ namespace ChilliSource
         m_renderCommands.push_back(std::move(renderCommand));
     }
     
+    //------------------------------------------------------------------------------
+    void RenderCommandList::AddRenderInstancesCommand(std::vector<Matrix4> worldMatrices) noexcept
+    {
+        RenderCommandUPtr renderCommand(new RenderInstancesRenderCommand(std::move(worldMatrices)));
+        
+        m_orderedCommands.push_back(renderCommand.get());
+        m_renderCommands.push_back(std::move(renderCommand));
+    }
+    
     //------------------------------------------------------------------------------
     void RenderCommandList::AddEndCommand() noexcept
     {
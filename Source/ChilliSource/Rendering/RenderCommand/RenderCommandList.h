@@ -205,6 +205,18 @@ namespace ChilliSource
         ///
         void AddApplyPointLightCommand(const Colour& colour, const Vector3& position, const Vector3& attenuation) noexcept;
         
+        /// Creates and adds a new apply point lights command to the render command list.
+        ///
+        /// @param colours
+        ///     The colour of each light. Should be moved.
+        /// @param positions
+        ///     The world space position of each light. Should be moved.
+        /// @param attenuations
+        ///     The vector containing the constant, linear and quadratic attenuation values of each
+        ///     light. Should be moved.
+        ///
+        void AddApplyPointLightsCommand(std::vector<Colour> colours, std::vector<Vector3> positions, std::vector<Vector3> attenuations) noexcept;
+        
         /// Creates and adds a new apply material command to the render command list.
         ///
         /// @param renderMaterial
@@ -247,6 +259,13 @@ namespace ChilliSource
         ///
         void AddRenderInstanceCommand(const Matrix4& worldMatrix) noexcept;
         
+        /// Creates and adds a new render instances command to the render command list.
+        ///
+        /// @param worldMatrices
+        ///     The world matrix of each instance. Should be moved.
+        ///
+        void AddRenderInstancesCommand(std::vector<Matrix4> worldMatrices) noexcept;
+        
         /// Creates and adds a new end command to the render command list.
         ///
         void AddEndCommand() noexcept;
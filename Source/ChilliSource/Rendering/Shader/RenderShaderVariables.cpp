@@ -24,23 +24,78 @@
 
 #include <ChilliSource/Rendering/Shader/RenderShaderVariables.h>
 
+#include <algorithm>
+
 namespace ChilliSource
 {
+    static_assert(sizeof(Vector2) == 2 * sizeof(f32), "Vector2 must be tightly packed.");
+    static_assert(sizeof(Vector3) == 3 * sizeof(f32), "Vector3 must be tightly packed.");
+    static_assert(sizeof(Vector4) == 4 * sizeof(f32), "Vector4 must be tightly packed.");
+    static_assert(sizeof(Matrix4) == 16 * sizeof(f32), "Matrix4 must be tightly packed.");
+    static_assert(sizeof(Colour) == 4 * sizeof(f32), "Colour must be tightly packed.");
+    
+    //------------------------------------------------------------------------------
+    u32 RenderShaderVariables::GetNumComponents(Type type) noexcept
+    {
+        switch (type)
+        {
+            case Type::k_float:
+                return 1;
+            case Type::k_vector2:
+                return 2;
+            case Type::k_vector3:
+                return 3;
+            case Type::k_vector4:
+            case Type::k_colour:
+                return 4;
+            case Type::k_matrix4:
+                return 16;
+            default:
+                CS_LOG_FATAL("Invalid shader variable type.");
+                return 0;
+        }
+    }
+    
     //------------------------------------------------------------------------------
     RenderShaderVariables::RenderShaderVariables(const std::unordered_map<std::string, f32>& floatVars, const std::unordered_map<std::string, Vector2>& vec2Vars, const std::unordered_map<std::string, Vector3>& vec3Vars,
                                                  const std::unordered_map<std::string, Vector4>& vec4Vars, const std::unordered_map<std::string, Matrix4>& mat4Vars,
                                                  const std::unordered_map<std::string, Colour>& colourVars) noexcept
-        : m_floatVars(floatVars), m_vec2Vars(vec2Vars), m_vec3Vars(vec3Vars), m_vec4Vars(vec4Vars), m_mat4Vars(mat4Vars), m_colourVars(colourVars)
     {
+        m_variables.reserve(floatVars.size() + vec2Vars.size() + vec3Vars.size() + vec4Vars.size() + mat4Vars.size() + colourVars.size());
+        m_data.reserve(floatVars.size() * GetNumComponents(Type::k_float) + vec2Vars.size() * GetNumComponents(Type::k_vector2) + vec3Vars.size() * GetNumComponents(Type::k_vector3) +
+                       vec4Vars.size() * GetNumComponents(Type::k_vector4) + mat4Vars.size() * GetNumComponents(Type::k_matrix4) + colourVars.size() * GetNumComponents(Type::k_colour));
+        
+        AddVariables(floatVars, Type::k_float);
+        AddVariables(vec2Vars, Type::k_vector2);
+        AddVariables(vec3Vars, Type::k_vector3);
+        AddVariables(vec4Vars, Type::k_vector4);
+        AddVariables(mat4Vars, Type::k_matrix4);
+        AddVariables(colourVars, Type::k_colour);
     }
     
     //------------------------------------------------------------------------------
-    RenderShaderVariables::RenderShaderVariables(const RenderShaderVariables& toCopy)
+    template <typename TValueType> void RenderShaderVariables::AddVariables(const std::unordered_map<std::string, TValueType>& variables, Type type) noexcept
     {
-        m_floatVars = toCopy.m_floatVars;
-        m_vec2Vars = toCopy.m_vec2Vars;
-        m_vec3Vars = toCopy.m_vec3Vars;
-        m_vec4Vars = toCopy.m_vec4Vars;
-        m_colourVars = toCopy.m_colourVars;
+        CS_ASSERT(sizeof(TValueType) == GetNumComponents(type) * sizeof(f32), "Variable type doesn't match value type.");
+        
+        std::vector<const std::pair<const std::string, TValueType>*> sortedVariables;
+        sortedVariables.reserve(variables.size());
+        for (const auto& pair : variables)
+        {
+            sortedVariables.push_back(&pair);
+        }
+        
+        std::sort(sortedVariables.begin(), sortedVariables.end(), [](const std::pair<const std::string, TValueType>* a, const std::pair<const std::string, TValueType>* b)
+        {
+            return a->first < b->first;
+        });
+        
+        for (const auto pair : sortedVariables)
+        {
+            m_variables.push_back(Variable { pair->first, type, u32(m_data.size()) });
+            
+            auto values = reinterpret_cast<const f32*>(&pair->second);
+            m_data.insert(m_data.end(), values, values + GetNumComponents(type));
+        }
     }
 }
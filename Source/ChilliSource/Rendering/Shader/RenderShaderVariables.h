@@ -33,16 +33,50 @@
 #include <ChilliSource/Core/Math/Matrix4.h>
 
 #include <unordered_map>
+#include <vector>
 
 namespace ChilliSource
 {
     /// A container for custom shader variables.
     ///
+    /// The variables are compiled on construction into a single flat block of float data,
+    /// alongside a list describing the name, type and offset of each variable. This allows
+    /// the render system to resolve the location of each variable once and then apply them
+    /// all with a linear walk over contiguous memory, rather than looking up each variable
+    /// by name every time the material is applied.
+    ///
     /// This is immutable and therefore thread-safe.
     ///
     class RenderShaderVariables final
     {
     public:
+        /// The type of a single shader variable.
+        ///
+        enum class Type
+        {
+            k_float,
+            k_vector2,
+            k_vector3,
+            k_vector4,
+            k_matrix4,
+            k_colour
+        };
+        
+        /// Describes a single shader variable in the compiled block.
+        ///
+        struct Variable final
+        {
+            std::string m_name;
+            Type m_type;
+            u32 m_dataOffset;
+        };
+        
+        /// @param type
+        ///     The variable type.
+        ///
+        /// @return The number of floats required to store a variable of the given type.
+        ///
+        static u32 GetNumComponents(Type type) noexcept;
         
         /// Creates a new instance with the given shader variables.
         ///
@@ -65,39 +99,34 @@ namespace ChilliSource
         ///
         /// Copy constructor
         ///
-        RenderShaderVariables(const RenderShaderVariables& toCopy);
-        
-        /// @return The variables of type: float.
-        ///
-        const std::unordered_map<std::string, f32>& GetFloatVariables() const noexcept { return m_floatVars; }
+        RenderShaderVariables(const RenderShaderVariables& toCopy) = default;
         
-        /// @return The variables of type: Vector2.
+        /// @return The number of variables.
         ///
-        const std::unordered_map<std::string, Vector2>& GetVector2Variables() const noexcept { return m_vec2Vars; }
+        u32 GetNumVariables() const noexcept { return u32(m_variables.size()); }
         
-        /// @return The variables of type: Vector3.
+        /// @return The description of each variable, ordered by type then name.
         ///
-        const std::unordered_map<std::string, Vector3>& GetVector3Variables() const noexcept { return m_vec3Vars; }
+        const std::vector<Variable>& GetVariables() const noexcept { return m_variables; }
         
-        /// @return The variables of type: Vector4.
+        /// @return The flat block of float data containing the value of every variable. The
+        ///     data for each variable begins at its data offset.
         ///
-        const std::unordered_map<std::string, Vector4>& GetVector4Variables() const noexcept { return m_vec4Vars; }
+        const std::vector<f32>& GetData() const noexcept { return m_data; }
         
-        /// @return The variables of type: Matrix4.
+    private:
+        /// Appends each of the given variables of a single type to the compiled block, ordered
+        /// by name so that the layout is deterministic.
         ///
-        const std::unordered_map<std::string, Matrix4>& GetMatrix4Variables() const noexcept { return m_mat4Vars; }
-        
-        /// @return The variables of type: Colour.
+        /// @param variables
+        ///     The variables to add.
+        /// @param type
+        ///     The type of the variables.
         ///
-        const std::unordered_map<std::string, Colour>& GetColourVariables() const noexcept { return m_colourVars; }
+        template <typename TValueType> void AddVariables(const std::unordered_map<std::string, TValueType>& variables, Type type) noexcept;
         
-    private:
-        std::unordered_map<std::string, f32> m_floatVars;
-        std::unordered_map<std::string, Vector2> m_vec2Vars;
-        std::unordered_map<std::string, Vector3> m_vec3Vars;
-        std::unordered_map<std::string, Vector4> m_vec4Vars;
-        std::unordered_map<std::string, Matrix4> m_mat4Vars;
-        std::unordered_map<std::string, Colour> m_colourVars;
+        std::vector<Variable> m_variables;
+        std::vector<f32> m_data;
     };
 }
 
@@ -28,6 +28,7 @@
 
 #include <ChilliSource/Rendering/Sprite/SpriteComponent.h>
 
+#include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Base/ByteColour.h>
 #include <ChilliSource/Core/Base/ColourUtils.h>
 #include <ChilliSource/Core/Delegate/MakeDelegate.h>
@@ -485,9 +486,28 @@ namespace ChilliSource
         }
         
         const auto& transform = GetEntity()->GetTransform();
+        auto interpolationFactor = Application::Get()->GetInterpolationFactor();
+        
+        Matrix4 worldTransform;
+        Vector3 worldPosition, worldScale;
+        Quaternion worldOrientation;
+        if (interpolationFactor < 1.0f)
+        {
+            //The bounds are derived from the interpolated transform so they match what is presented.
+            worldTransform = transform.GetInterpolatedWorldTransform(interpolationFactor);
+            worldTransform.Decompose(worldPosition, worldScale, worldOrientation);
+        }
+        else
+        {
+            worldTransform = transform.GetWorldTransform();
+            worldPosition = transform.GetWorldPosition();
+            worldScale = transform.GetWorldScale();
+            worldOrientation = transform.GetWorldOrientation();
+        }
+        
         auto renderDynamicMesh = SpriteMeshBuilder::Build(frameAllocator, Vector3(frameCenter, 0.0f), frameSize, transformedUVs, m_colour, m_originAlignment);
-        auto boundingSphere = Sphere::Transform(renderDynamicMesh->GetBoundingSphere(), transform.GetWorldPosition(), transform.GetWorldOrientation(), transform.GetWorldScale());
-        renderSnapshot.AddRenderObject(RenderObject(GetMaterial()->GetRenderMaterialGroup(), renderDynamicMesh.get(), transform.GetWorldTransform(), boundingSphere, false, RenderLayer::k_standard));
+        auto boundingSphere = Sphere::Transform(renderDynamicMesh->GetBoundingSphere(), worldPosition, worldOrientation, worldScale);
+        renderSnapshot.AddRenderObject(RenderObject(GetMaterial()->GetRenderMaterialGroup(), renderDynamicMesh.get(), worldTransform, boundingSphere, false, RenderLayer::k_standard));
         renderSnapshot.AddRenderDynamicMesh(std::move(renderDynamicMesh));
     }
     //----------------------------------------------------
@@ -26,11 +26,18 @@
 
 #include <ChilliSource/Rendering/Texture/RenderTexture.h>
 
+#include <atomic>
+
 namespace ChilliSource
 {
+    namespace
+    {
+        std::atomic<u64> g_nextUniqueId(1);
+    }
+    
     //------------------------------------------------------------------------------
     RenderTargetGroup::RenderTargetGroup(const RenderTexture* colourTarget, const RenderTexture* depthTarget, RenderTargetGroupType type) noexcept
-        : m_colourTarget(colourTarget), m_depthTarget(depthTarget), m_type(type)
+        : m_colourTarget(colourTarget), m_depthTarget(depthTarget), m_type(type), m_uniqueId(g_nextUniqueId++)
     {
         CS_ASSERT(colourTarget || depthTarget, "Must supply either a colour target or a depth target.");
         
@@ -88,6 +88,11 @@ namespace ChilliSource
         ///
         const Integer2& GetResolution() const noexcept { return m_resolution; }
         
+        /// @return An id which identifies this group. Unlike the address of the group, this is never
+        ///     reused after the group is destroyed, so it is safe to use as a cache key.
+        ///
+        u64 GetUniqueId() const noexcept { return m_uniqueId; }
+        
         /// This is not thread safe and should only be called from the render thread.
         ///
         /// @return A pointer to render system specific additional information.
@@ -107,6 +112,7 @@ namespace ChilliSource
         const RenderTexture* m_depthTarget;
         RenderTargetGroupType m_type;
         Integer2 m_resolution;
+        u64 m_uniqueId;
         void* m_extraData = nullptr;
     };
 }
@@ -111,6 +111,16 @@ namespace ChilliSource
         ///
         const RenderTexture* GetRenderTexture() const noexcept;
         
+        /// @return The approximate number of bytes of main memory held by the cubemap. This is
+        ///     only non-zero if texture data is being kept for restoring on context loss.
+        ///
+        u64 GetCpuMemoryUsage() const noexcept override;
+        
+        /// @return The approximate number of bytes of graphics memory used by the cubemap,
+        ///     including mipmaps.
+        ///
+        u64 GetGpuMemoryUsage() const noexcept override;
+        
         ~Cubemap() noexcept;
         
     private:
@@ -131,6 +141,7 @@ namespace ChilliSource
         
         UniquePtr<RenderTexture> m_renderTexture;
         bool m_restoreTextureDataEnabled = false;
+        u64 m_textureDataSize = 0;
     };
 }
 
@@ -54,6 +54,7 @@ namespace ChilliSource
         CS_ASSERT(renderTextureManager, "RenderTextureManager must exist.");
         
         m_restoreTextureDataEnabled = textureDesc.IsRestoreTextureDataEnabled();
+        m_textureDataSize = u64(textureDataSize);
         
         m_renderTexture = renderTextureManager->CreateTexture2D(std::move(textureData), textureDataSize, textureDesc.GetDimensions(), textureDesc.GetImageFormat(), textureDesc.GetImageCompression(),
                                                                     textureDesc.GetFilterMode(), textureDesc.GetWrapModeS(), textureDesc.GetWrapModeT(), textureDesc.IsMipmappingEnabled(), m_restoreTextureDataEnabled);
@@ -140,6 +141,34 @@ namespace ChilliSource
         return m_renderTexture.get();
     }
     
+    //------------------------------------------------------------------------------
+    u64 Texture::GetCpuMemoryUsage() const noexcept
+    {
+        if (m_renderTexture && m_restoreTextureDataEnabled)
+        {
+            return m_textureDataSize;
+        }
+        
+        return 0;
+    }
+    
+    //------------------------------------------------------------------------------
+    u64 Texture::GetGpuMemoryUsage() const noexcept
+    {
+        if (!m_renderTexture)
+        {
+            return 0;
+        }
+        
+        //A full mip chain adds roughly a third on top of the base level.
+        if (m_renderTexture->IsMipmapped())
+        {
+            return m_textureDataSize + m_textureDataSize / 3;
+        }
+        
+        return m_textureDataSize;
+    }
+    
     //------------------------------------------------------------------------------
     void Texture::DestroyRenderTexture() noexcept
     {
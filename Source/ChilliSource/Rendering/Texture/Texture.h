@@ -106,6 +106,16 @@ namespace ChilliSource
         ///
         const RenderTexture* GetRenderTexture() const noexcept;
         
+        /// @return The approximate number of bytes of main memory held by the texture. This is
+        ///     only non-zero if texture data is being kept for restoring on context loss.
+        ///
+        u64 GetCpuMemoryUsage() const noexcept override;
+        
+        /// @return The approximate number of bytes of graphics memory used by the texture,
+        ///     including mipmaps.
+        ///
+        u64 GetGpuMemoryUsage() const noexcept override;
+        
         ~Texture() noexcept;
         
     private:
@@ -126,6 +136,7 @@ namespace ChilliSource
         
         UniquePtr<RenderTexture> m_renderTexture;
         bool m_restoreTextureDataEnabled = false;
+        u64 m_textureDataSize = 0;
     };
 }
 
@@ -30,7 +30,10 @@
 
 #include <ChilliSource/Core/Base/Application.h>
 #include <ChilliSource/Core/Image/Image.h>
+#include <ChilliSource/Core/Image/ImageFormatConverter.h>
+#include <ChilliSource/Core/Image/ImageResourceOptions.h>
 #include <ChilliSource/Core/Threading/TaskScheduler.h>
+#include <ChilliSource/Core/Time/Profiler.h>
 #include <ChilliSource/Rendering/Texture/Texture.h>
 #include <ChilliSource/Rendering/Texture/TextureDesc.h>
 #include <ChilliSource/Rendering/Texture/TextureResourceOptions.h>
@@ -97,21 +100,23 @@ namespace ChilliSource
     //----------------------------------------------------------------------------
     void TextureProvider::CreateResourceFromFile(StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsBaseCSPtr& in_options, const ResourceSPtr& out_resource)
     {
-        LoadTexture(in_location, in_filePath, in_options, nullptr, out_resource);
+        LoadTexture(nullptr, in_location, in_filePath, in_options, nullptr, out_resource);
     }
     //----------------------------------------------------------------------------
     //----------------------------------------------------------------------------
     void TextureProvider::CreateResourceFromFileAsync(StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsBaseCSPtr& in_options, const ResourceProvider::AsyncLoadDelegate& in_delegate, const ResourceSPtr& out_resource)
     {
-        Application::Get()->GetTaskScheduler()->ScheduleTask(TaskType::k_file, [=](const TaskContext&) noexcept
+        Application::Get()->GetTaskScheduler()->ScheduleTask(TaskType::k_file, [=](const TaskContext& in_taskContext) noexcept
         {
-            LoadTexture(in_location, in_filePath, in_options, in_delegate, out_resource);
+            LoadTexture(&in_taskContext, in_location, in_filePath, in_options, in_delegate, out_resource);
         });
     }
     //----------------------------------------------------------------------------
     //----------------------------------------------------------------------------
-    void TextureProvider::LoadTexture(StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsBaseCSPtr& in_options, const ResourceProvider::AsyncLoadDelegate& in_delegate, const ResourceSPtr& out_resource)
+    void TextureProvider::LoadTexture(const TaskContext* in_taskContext, StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsBaseCSPtr& in_options, const ResourceProvider::AsyncLoadDelegate& in_delegate, const ResourceSPtr& out_resource)
     {
+        CS_PROFILE_SCOPE("TextureProvider::LoadTexture");
+        
         CS_ASSERT(in_options != nullptr, "Options for texture load cannot be null");
         
         std::string fileName;
@@ -142,8 +147,16 @@ namespace ChilliSource
             return;
         }
         
+        //the image providers which decode to RGBA8888 will convert to the preferred format as they decode.
+        const ImageFormat preferredFormat = static_cast<const TextureResourceOptions*>(in_options.get())->GetPreferredFormat();
+        IResourceOptionsBaseCSPtr imageOptions;
+        if (preferredFormat != ImageFormat::k_RGBA8888)
+        {
+            imageOptions = std::make_shared<ImageResourceOptions>(preferredFormat);
+        }
+        
         ResourceSPtr imageResource(Image::Create());
-        imageProvider->CreateResourceFromFile(in_location, in_filePath, nullptr, imageResource);
+        imageProvider->CreateResourceFromFile(in_location, in_filePath, imageOptions, imageResource);
         ImageSPtr image(std::static_pointer_cast<Image>(imageResource));
         
         if(image->GetLoadState() == Resource::LoadState::k_failed)
@@ -160,6 +173,19 @@ namespace ChilliSource
             return;
         }
         
+        //convert any image which the provider didn't, so the render thread only ever has to upload.
+        if (preferredFormat != ImageFormat::k_RGBA8888 && image->GetFormat() == ImageFormat::k_RGBA8888 && image->GetCompression() == ImageCompression::k_none)
+        {
+            if (in_taskContext != nullptr)
+            {
+                ImageFormatConverter::ConvertRGBA8888(*in_taskContext, image.get(), preferredFormat);
+            }
+            else
+            {
+                ImageFormatConverter::ConvertRGBA8888(image.get(), preferredFormat);
+            }
+        }
+        
         if(in_delegate == nullptr)
         {
             auto texture = static_cast<Texture*>(out_resource.get());
@@ -126,17 +126,19 @@ namespace ChilliSource
         TextureProvider() = default;
         //----------------------------------------------------------------------------
         /// Does the heavy lifting for the 2 create methods. The building of the texture
-        /// is always done on the main thread
+        /// is always done on the main thread. Any conversion to the preferred format is
+        /// done on the loading thread, split into child tasks if a task context is given.
         ///
         /// @author S Downie
         ///
+        /// @param The context of the loading task, or null if loading synchronously.
         /// @param Location to load from
         /// @param File path
         /// @param Options to customise the creation
         /// @param Completion delegate
         /// @param [Out] Resource object
         //----------------------------------------------------------------------------
-        void LoadTexture(StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsBaseCSPtr& in_options, const ResourceProvider::AsyncLoadDelegate& in_delegate, const ResourceSPtr& out_resource);
+        void LoadTexture(const TaskContext* in_taskContext, StorageLocation in_location, const std::string& in_filePath, const IResourceOptionsBaseCSPtr& in_options, const ResourceProvider::AsyncLoadDelegate& in_delegate, const ResourceSPtr& out_resource);
         
     private:
         
@@ -34,12 +34,13 @@ namespace ChilliSource
 {
     //-------------------------------------------------------
     //-------------------------------------------------------
-    TextureResourceOptions::TextureResourceOptions(bool in_mipmaps, TextureFilterMode in_filter, TextureWrapMode in_wrapS, TextureWrapMode in_wrapT)
+    TextureResourceOptions::TextureResourceOptions(bool in_mipmaps, TextureFilterMode in_filter, TextureWrapMode in_wrapS, TextureWrapMode in_wrapT, ImageFormat in_preferredFormat)
     {
         m_options.m_hasMipMaps = in_mipmaps;
         m_options.m_filterMode = in_filter;
         m_options.m_wrapModeS = in_wrapS;
         m_options.m_wrapModeT = in_wrapT;
+        m_options.m_preferredFormat = in_preferredFormat;
     }
     //-------------------------------------------------------
     //-------------------------------------------------------
@@ -71,5 +72,11 @@ namespace ChilliSource
     {
         return m_options.m_filterMode;
     }
+    //-------------------------------------------------------
+    //-------------------------------------------------------
+    ImageFormat TextureResourceOptions::GetPreferredFormat() const
+    {
+        return m_options.m_preferredFormat;
+    }
 }
 
@@ -31,6 +31,7 @@
 #define _CHILLISOURCE_RENDERING_TEXTURE_TEXTURERESOURCEOPTIONS_H_
 
 #include <ChilliSource/ChilliSource.h>
+#include <ChilliSource/Core/Image/ImageFormat.h>
 #include <ChilliSource/Core/Resource/IResourceOptions.h>
 #include <ChilliSource/Rendering/Texture/Texture.h>
 #include <ChilliSource/Rendering/Texture/TextureFilterMode.h>
@@ -70,8 +71,12 @@ namespace ChilliSource
         /// are loaded from file as they are always restored from
         /// disk. This will only work for RGBA8888, RGB888, RGBA4444
         /// and RGB565 textures.
+        /// @param The format RGBA8888 images should be converted
+        /// to as they are loaded. The conversion happens on the
+        /// loading thread, so the texture is uploaded in the
+        /// smaller format.
         //-------------------------------------------------------
-        TextureResourceOptions(bool in_mipmaps, TextureFilterMode in_filter, TextureWrapMode in_wrapS, TextureWrapMode in_wrapT);
+        TextureResourceOptions(bool in_mipmaps, TextureFilterMode in_filter, TextureWrapMode in_wrapS, TextureWrapMode in_wrapT, ImageFormat in_preferredFormat = ImageFormat::k_RGBA8888);
         //-------------------------------------------------------
         /// Generate a unique hash based on the
         /// currently set options
@@ -106,6 +111,11 @@ namespace ChilliSource
         /// @return Filter mode to create texture with
         //-------------------------------------------------------
         TextureFilterMode GetFilterMode() const;
+        //-------------------------------------------------------
+        /// @return The format RGBA8888 images should be converted
+        /// to as they are loaded.
+        //-------------------------------------------------------
+        ImageFormat GetPreferredFormat() const;
         
     private:
         
@@ -120,6 +130,7 @@ namespace ChilliSource
             TextureWrapMode m_wrapModeS = TextureWrapMode::k_clamp;
             TextureWrapMode m_wrapModeT = TextureWrapMode::k_clamp;
             TextureFilterMode m_filterMode = TextureFilterMode::k_bilinear;
+            ImageFormat m_preferredFormat = ImageFormat::k_RGBA8888;
             bool m_hasMipMaps = false;
         };
         